@@ -0,0 +1,147 @@
+/*
+ * Room background: flash size vs. redraw time.
+ *
+ * Same 480x320 background drawn as the C array linked in the app (before) and
+ * as the packed files of the storage partition (tools/bg_pack.py: row-aligned
+ * RLE, LZ4 bands). For each: bytes in flash, the cost of a full-screen redraw
+ * and of the partial redraws the dashboard actually does (a tile, a label,
+ * a full-width strip), with the board's 480x100 partial draw buffer.
+ *
+ * Every variant must produce the same pixels as the C array, both for a full
+ * redraw and for a partial one (column clipping of the row decoder).
+ *
+ *   bench_bg_image [--quick] room1_rle.bin room1_lz4.bin ...
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "lvgl.h"
+
+#include "bg_image.h"
+
+#include "sim_bsp.h"
+#include "bench_util.h"
+
+#define MAX_VARIANTS 8
+#define FB_PIXELS    (BSP_LCD_H_RES * BSP_LCD_V_RES)
+
+LV_IMAGE_DECLARE(backg_room1);
+
+typedef struct {
+    const char *name;
+    lv_area_t area;
+} RedrawCase;
+
+// Screen areas over the background (centered: y = 80..399)
+static const RedrawCase cases[] = {
+    {"full screen",   {0, 0, BSP_LCD_H_RES - 1, BSP_LCD_V_RES - 1}},
+    {"tile 200x130",  {20, 100, 219, 229}},
+    {"label 120x24",  {260, 200, 379, 223}},
+    {"strip 480x20",  {0, 300, BSP_LCD_H_RES - 1, 319}},
+};
+#define CASE_COUNT (sizeof(cases) / sizeof(cases[0]))
+
+static uint16_t s_reference[FB_PIXELS];
+
+static double redraw_us(lv_obj_t *scr, const lv_area_t *area, uint32_t iters)
+{
+    uint64_t t0 = bench_now_ns();
+    for (uint32_t i = 0; i < iters; i++) {
+        lv_obj_invalidate_area(scr, area);
+        lv_refr_now(NULL);
+    }
+    return (double)(bench_now_ns() - t0) / 1000.0 / iters;
+}
+
+static bool same_pixels(const lv_area_t *a)
+{
+    const uint16_t *fb = sim_bsp_framebuffer();
+    for (int32_t y = a->y1; y <= a->y2; y++) {
+        size_t ofs = (size_t)y * BSP_LCD_H_RES + a->x1;
+        if (memcmp(fb + ofs, s_reference + ofs, (size_t)lv_area_get_width(a) * 2)) return false;
+    }
+    return true;
+}
+
+// Full redraw, then a partial one on top of a screen without the image
+static bool check_pixels(lv_obj_t *scr, lv_obj_t *bg)
+{
+    lv_obj_invalidate(scr);
+    lv_refr_now(NULL);
+    if (!same_pixels(&cases[0].area)) return false;
+
+    lv_obj_add_flag(bg, LV_OBJ_FLAG_HIDDEN);
+    lv_refr_now(NULL);
+    lv_obj_remove_flag(bg, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_invalidate_area(scr, &cases[1].area);
+    lv_refr_now(NULL);
+    bool ok = same_pixels(&cases[1].area);
+
+    lv_obj_invalidate(scr);
+    lv_refr_now(NULL);
+    return ok;
+}
+
+int main(int argc, char **argv)
+{
+    const bool quick = bench_quick(argc, argv);
+    const uint32_t iters = quick ? 20 : 300;
+
+    lv_init();
+    bsp_display_start();
+
+    lv_obj_t *scr = lv_screen_active();
+    lv_obj_t *bg = lv_image_create(scr);
+    lv_obj_center(bg);
+
+    const void *srcs[MAX_VARIANTS] = {&backg_room1};
+    const char *names[MAX_VARIANTS] = {"C array (app)"};
+    uint32_t sizes[MAX_VARIANTS] = {backg_room1.data_size};
+    int n = 1;
+    for (int i = 1; i < argc && n < MAX_VARIANTS; i++) {
+        if (argv[i][0] == '-') continue;
+        const lv_image_dsc_t *img;
+        if (bg_image_load(argv[i], &img) != ESP_OK) return 1;
+        BgImageStats st;
+        bg_image_get_stats(img, &st);
+        const char *base = strrchr(argv[i], '/');
+        srcs[n] = img;
+        names[n] = base ? base + 1 : argv[i];
+        sizes[n] = st.file_size;
+        n++;
+    }
+
+    lv_image_set_src(bg, &backg_room1);
+    lv_refr_now(NULL);
+    memcpy(s_reference, sim_bsp_framebuffer(), sizeof(s_reference));
+
+    printf("%-18s %8s %6s", "background", "flash", "ratio");
+    for (size_t c = 0; c < CASE_COUNT; c++) printf(" %14s", cases[c].name);
+    printf("  rows/full  bands/full\n");
+
+    bool ok = true;
+    for (int v = 0; v < n; v++) {
+        lv_image_set_src(bg, srcs[v]);
+        bool same = check_pixels(scr, bg);
+        ok &= same;
+
+        printf("%-18s %8u %5.1f%%", names[v], (unsigned)sizes[v], 100.0 * sizes[v] / backg_room1.data_size);
+        BgImageStats st0, st1;
+        bg_image_get_stats(srcs[v], &st0);
+        for (size_t c = 0; c < CASE_COUNT; c++) {
+            printf(" %11.1f us", redraw_us(scr, &cases[c].area, iters));
+            if (c == 0) bg_image_get_stats(srcs[v], &st1);
+        }
+        if (v == 0) {
+            printf("  %9s  %10s", "-", "-");
+        } else {
+            printf("  %9u  %10u", (st1.decoded_rows - st0.decoded_rows) / iters,
+                   (st1.decoded_bands - st0.decoded_bands) / iters);
+        }
+        printf("%s\n", same ? "" : "  PIXELS DIFFER");
+    }
+
+    printf("%s\n", ok ? "OK" : "FAILED");
+    return ok ? 0 : 1;
+}
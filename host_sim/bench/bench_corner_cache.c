@@ -0,0 +1,185 @@
+/*
+ * Corner cache of LVGL's rounded rectangle fill (lv_draw_sw_corner_cache_*).
+ *
+ * Repaint time of the dashboard's fixed-radius widgets without and with the
+ * cache: a lamp tile (200x130, radius 10), a badge (radius 10) and the whole
+ * dashboard over the room background, with the cache hit rate.
+ *
+ * The cache must not change a pixel: rounded rectangles of many radii, sizes
+ * (down to narrower than two radii), opacities and positions (overlapping,
+ * across the screen edges and the partial-mode bands) are drawn without the
+ * cache as the reference, then with it, in full and through small
+ * invalidated areas cutting the corners.
+ *
+ *   bench_corner_cache [--quick]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "lvgl.h"
+#include "src/draw/sw/lv_draw_sw.h"
+
+#include "dashboard_ui.h"
+#include "entity_config.h"
+
+#include "sim_bsp.h"
+#include "bench_util.h"
+
+#define FB_PIXELS           (BSP_LCD_H_RES * BSP_LCD_V_RES)
+#define CORNER_CACHE_SIZE   (4 * 1024)   // as the firmware (CONFIG_DASHBOARD_LVGL_CORNER_CACHE_KB)
+// The rectangles of the pixel check and their local styles: beyond the board's 64 KB LVGL heap
+#define EXTRA_POOL_SIZE     (64 * 1024)
+
+LV_IMAGE_DECLARE(backg_room1);
+
+static uint16_t s_reference[FB_PIXELS];
+
+static void on_command(const char *topic, const char *payload)
+{
+    (void)topic;
+    (void)payload;
+}
+
+static const DashboardUiCallbacks ui_cbs = { .on_command = on_command };
+
+static void corner_cache(bool on)
+{
+    lv_draw_sw_corner_cache_set_size(on ? CORNER_CACHE_SIZE : 0, NULL, NULL);
+}
+
+static double repaint_us(lv_obj_t *obj, uint32_t iters)
+{
+    uint64_t t0 = bench_now_ns();
+    for (uint32_t i = 0; i < iters; i++) {
+        lv_obj_invalidate(obj);
+        lv_refr_now(NULL);
+    }
+    return (double)(bench_now_ns() - t0) / 1000.0 / iters;
+}
+
+static bool same_as_reference(void)
+{
+    return memcmp(sim_bsp_framebuffer(), s_reference, sizeof(s_reference)) == 0;
+}
+
+static lv_obj_t *rounded_rect(lv_obj_t *parent, int32_t x, int32_t y, int32_t w, int32_t h, int32_t r,
+                              lv_opa_t opa, lv_color_t color)
+{
+    lv_obj_t *obj = lv_obj_create(parent);
+    lv_obj_remove_style_all(obj);
+    lv_obj_set_pos(obj, x, y);
+    lv_obj_set_size(obj, w, h);
+    lv_obj_set_style_radius(obj, r, 0);
+    lv_obj_set_style_bg_opa(obj, opa, 0);
+    lv_obj_set_style_bg_color(obj, color, 0);
+    return obj;
+}
+
+static bool check_pixels(void)
+{
+    static const int32_t radii[] = {1, 2, 3, 4, 5, 7, 8, 10, 13, 16, 24};
+    static const lv_opa_t opas[] = {LV_OPA_COVER, 254, LV_OPA_50, 20};
+    uint32_t seed = 0x2545F491u;
+
+    lv_obj_t *scr = lv_obj_create(NULL);
+    lv_obj_set_style_bg_color(scr, lv_color_hex(0x102030), 0);
+    for (size_t i = 0; i < sizeof(radii) / sizeof(radii[0]); i++) {
+        const int32_t r = radii[i];
+        // Narrower than two radii, exactly two, and wider
+        const int32_t sizes[][2] = {{2 * r - 1, 2 * r + 2}, {2 * r, 2 * r}, {2 * r + 1, 2 * r + 1},
+                                    {2 * r + 2, 2 * r + 5}, {3 * r + 7, 2 * r + 3}, {200, 130}};
+        for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+            for (size_t o = 0; o < sizeof(opas) / sizeof(opas[0]); o++) {
+                int32_t x = (int32_t)(bench_rand(&seed) % (BSP_LCD_H_RES + 40)) - 40;
+                int32_t y = (int32_t)(bench_rand(&seed) % (BSP_LCD_V_RES + 40)) - 40;
+                rounded_rect(scr, x, y, sizes[s][0], sizes[s][1], r, opas[o], lv_color_hex(bench_rand(&seed) & 0xFFFFFF));
+            }
+        }
+    }
+    lv_screen_load(scr);
+
+    corner_cache(false);
+    lv_obj_invalidate(scr);
+    lv_refr_now(NULL);
+    memcpy(s_reference, sim_bsp_framebuffer(), sizeof(s_reference));
+
+    corner_cache(true);
+    lv_obj_invalidate(scr);
+    lv_refr_now(NULL);
+    bool ok = same_as_reference();
+
+    // Small areas: the corners clipped on every side
+    for (int i = 0; i < 200 && ok; i++) {
+        lv_area_t a;
+        a.x1 = (int32_t)(bench_rand(&seed) % BSP_LCD_H_RES);
+        a.y1 = (int32_t)(bench_rand(&seed) % BSP_LCD_V_RES);
+        a.x2 = LV_MIN(a.x1 + (int32_t)(bench_rand(&seed) % 24), BSP_LCD_H_RES - 1);
+        a.y2 = LV_MIN(a.y1 + (int32_t)(bench_rand(&seed) % 24), BSP_LCD_V_RES - 1);
+        lv_obj_invalidate_area(scr, &a);
+        lv_refr_now(NULL);
+        ok = same_as_reference();
+    }
+
+    lv_draw_sw_corner_cache_stats_t st;
+    lv_draw_sw_corner_cache_get_stats(&st, true);
+    printf("pixel check: %u corners cached (%u bytes), %u hits, %u misses, %u evicted, %u uncached: %s\n",
+           (unsigned)st.entries, (unsigned)st.size, (unsigned)st.hits, (unsigned)st.misses,
+           (unsigned)st.evictions, (unsigned)st.uncached, ok ? "same pixels" : "PIXELS DIFFER");
+    lv_screen_load(lv_obj_create(NULL));
+    lv_obj_delete(scr);
+    return ok;
+}
+
+int main(int argc, char **argv)
+{
+    const bool quick = bench_quick(argc, argv);
+    const uint32_t iters = quick ? 100 : 2000;
+
+    lv_init();
+    lv_mem_add_pool(malloc(EXTRA_POOL_SIZE), EXTRA_POOL_SIZE);
+    sim_bsp_set_render_mode(SIM_RENDER_PARTIAL);    // bands: corners cut across the draw buffers
+    bsp_display_start();
+
+    lv_obj_t *dashboard = lv_screen_active();
+    ui_create(entity_table_get(), &ui_cbs);
+    ui_set_background(&backg_room1);
+
+    bool ok = check_pixels();
+
+    lv_obj_t *scr = lv_obj_create(NULL);
+    lv_obj_t *tile = lv_button_create(scr);
+    lv_obj_set_size(tile, 200, 130);
+    lv_obj_set_style_bg_color(tile, lv_color_hex(0x607D8B), 0);
+    lv_obj_set_style_radius(tile, 10, 0);
+    lv_obj_center(tile);
+    lv_obj_t *badge = rounded_rect(scr, 20, 20, 120, 40, 10, LV_OPA_COVER, lv_color_hex(0x607D8B));
+
+    struct {
+        const char *name;
+        lv_obj_t *screen;
+        lv_obj_t *obj;
+        uint32_t iters;
+    } scenes[] = {
+        {"lamp tile", scr, tile, iters},
+        {"badge", scr, badge, iters},
+        {"dashboard", dashboard, dashboard, iters / 10},
+    };
+
+    printf("%-12s %14s %14s %9s\n", "scene", "no cache", "corner cache", "hit rate");
+    for (size_t i = 0; i < sizeof(scenes) / sizeof(scenes[0]); i++) {
+        lv_screen_load(scenes[i].screen);
+        corner_cache(false);
+        double off = repaint_us(scenes[i].obj, scenes[i].iters);
+        corner_cache(true);
+        lv_draw_sw_corner_cache_stats_t st;
+        lv_draw_sw_corner_cache_get_stats(&st, true);
+        double on = repaint_us(scenes[i].obj, scenes[i].iters);
+        lv_draw_sw_corner_cache_get_stats(&st, true);
+        printf("%-12s %11.2f us %11.2f us %8.1f%%\n", scenes[i].name, off, on,
+               st.hits + st.misses ? 100.0 * st.hits / (st.hits + st.misses) : 0.0);
+    }
+
+    printf("%s\n", ok ? "OK" : "FAILED");
+    return ok ? 0 : 1;
+}
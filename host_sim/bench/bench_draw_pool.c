@@ -0,0 +1,266 @@
+/*
+ * Slab pools of the draw tasks, layers and layer buffers (lv_draw_pool_set_size()).
+ *
+ * The dashboard over the backg_room1 background: the clock ticking minutes,
+ * the temperature badge taking new values, a tile switched now and then and
+ * the whole screen redrawn every few dozen updates. Without the pool (every
+ * draw task and layer from lv_malloc), then with it, followed by whole screen
+ * redraws: time per update and per screen, allocations and how many still
+ * went to the LVGL heap, the fragmentation of the LVGL heap afterwards, and
+ * the slots used at most per slab. The allocation itself is timed apart: the
+ * draw tasks of a whole screen allocated and freed, from lv_malloc and from
+ * the slabs.
+ *
+ * The pool must not change a pixel: every update of the sequence is hashed
+ * without it as the reference. A screen of objects drawn in layers (opacity,
+ * rotation) is compared as well and must take its layers from the pool.
+ *
+ *   bench_draw_pool [--quick]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "lvgl.h"
+#include "src/draw/lv_draw_pool_private.h"     // lv_draw_pool_alloc()
+
+#include "dashboard_ui.h"
+#include "entity_config.h"
+
+#include "sim_bsp.h"
+#include "bench_util.h"
+
+#define FB_PIXELS           (BSP_LCD_H_RES * BSP_LCD_V_RES)
+#define MAX_UPDATES         2000
+#define FULL_EVERY          50      // updates between whole screen redraws
+#define TILE_EVERY          7       // updates between tile switches
+#define POOL_SIZE           (64 * 1024)
+#define SPILL_POOL_SIZE     (64 * 1024)
+#define SPILL_POOL_MAX      4
+
+LV_IMAGE_DECLARE(backg_room1);
+
+static uint16_t s_reference[FB_PIXELS];
+static uint64_t s_hashes[MAX_UPDATES];
+
+static const char *s_class_names[LV_DRAW_POOL_CNT] = {
+    "fill", "border", "label", "image", "other", "layer", "layer buf",
+};
+
+static void on_command(const char *topic, const char *payload)
+{
+    (void)topic;
+    (void)payload;
+}
+
+static const DashboardUiCallbacks ui_cbs = { .on_command = on_command };
+
+static uint64_t fb_hash(void)
+{
+    const uint8_t *p = (const uint8_t *)sim_bsp_framebuffer();
+    uint64_t h = 0xcbf29ce484222325ULL;
+    for (size_t i = 0; i < FB_PIXELS * 2; i++) h = (h ^ p[i]) * 0x100000001b3ULL;
+    return h;
+}
+
+static size_t entity_index(EntityType type)
+{
+    const EntityTable *entities = entity_table_get();
+    for (size_t i = 0; i < entities->count; i++) {
+        if (entities->items[i].type == type) return i;
+    }
+    return SIZE_MAX;
+}
+
+// Counters of every slab since the last call
+static void pool_stats(lv_draw_pool_stats_t stats[LV_DRAW_POOL_CNT], uint32_t *hits, uint32_t *fallbacks)
+{
+    *hits = 0;
+    *fallbacks = 0;
+    for (int c = 0; c < LV_DRAW_POOL_CNT; c++) {
+        lv_draw_pool_get_stats((lv_draw_pool_class_t)c, &stats[c], true);
+        *hits += stats[c].hits;
+        *fallbacks += stats[c].fallbacks;
+    }
+}
+
+// Clock minutes and temperatures in tenths, a tile switched, the whole screen redrawn
+static double updates_us(size_t sensor, size_t tile, uint32_t updates, bool reference, bool *same)
+{
+    *same = true;
+    uint64_t ns = 0;
+    for (uint32_t i = 0; i < updates; i++) {
+        uint64_t t0 = bench_now_ns();
+        char txt[16];
+        if (i % FULL_EVERY == FULL_EVERY - 1) {
+            lv_obj_invalidate(lv_screen_active());
+        } else if (tile != SIZE_MAX && i % TILE_EVERY == TILE_EVERY - 1) {
+            ui_entity_set_state(tile, i / TILE_EVERY % 2 ? "OFF" : "ON", i / TILE_EVERY % 2 ? 3 : 2);
+            sim_time_skip_us(1000 * 1000);   // the theme's colour transition drawn at its end
+        } else if (i % 2 == 0) {
+            snprintf(txt, sizeof(txt), "%02u:%02u", (unsigned)(i / 120 % 24), (unsigned)(i / 2 % 60));
+            ui_set_clock(txt);
+        } else {
+            int t = 150 + (int)(i * 7 % 120);
+            int len = snprintf(txt, sizeof(txt), "%d.%d", t / 10, t % 10);
+            ui_entity_set_state(sensor, txt, len);
+        }
+        lv_refr_now(NULL);
+        ns += bench_now_ns() - t0;
+        if (reference) s_hashes[i] = fb_hash();
+        else if (*same && s_hashes[i] != fb_hash()) *same = false;
+    }
+    return (double)ns / 1000.0 / updates;
+}
+
+static lv_obj_t *add_rect(lv_obj_t *parent, int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color)
+{
+    lv_obj_t *obj = lv_obj_create(parent);
+    lv_obj_set_pos(obj, x, y);
+    lv_obj_set_size(obj, w, h);
+    lv_obj_set_style_bg_color(obj, lv_color_hex(color), 0);
+    return obj;
+}
+
+// Nanoseconds to allocate and free the draw tasks of a screen, per task
+static double alloc_ns(uint32_t rounds)
+{
+    static const lv_draw_pool_class_t classes[] = {
+        LV_DRAW_POOL_FILL, LV_DRAW_POOL_IMAGE, LV_DRAW_POOL_LABEL, LV_DRAW_POOL_FILL, LV_DRAW_POOL_OTHER,
+        LV_DRAW_POOL_LABEL, LV_DRAW_POOL_IMAGE, LV_DRAW_POOL_FILL,
+    };
+    const uint32_t cnt = sizeof(classes) / sizeof(classes[0]);
+    void *tasks[sizeof(classes) / sizeof(classes[0])];
+    uint64_t t0 = bench_now_ns();
+    for (uint32_t r = 0; r < rounds; r++) {
+        for (uint32_t i = 0; i < cnt; i++) tasks[i] = lv_draw_pool_alloc(classes[i], 200);
+        for (uint32_t i = 0; i < cnt; i++) lv_draw_pool_free(tasks[i]);
+    }
+    return (double)(bench_now_ns() - t0) / rounds / cnt;
+}
+
+// Semi-transparent objects and a rotated one, drawn in layers
+static bool check_layers(void)
+{
+    lv_obj_t *scr = lv_obj_create(NULL);
+    lv_obj_set_style_bg_color(scr, lv_color_hex(0x203040), 0);
+    for (int i = 0; i < 4; i++) {
+        lv_obj_t *card = add_rect(scr, 20 + i * 110, 20, 100, 60, 0x40A0E0);
+        lv_obj_set_style_opa_layered(card, LV_OPA_60, 0);
+        lv_label_set_text(lv_label_create(card), "21.5");
+    }
+    lv_obj_t *rotated = add_rect(scr, 140, 200, 60, 40, 0xE0A040);
+    lv_obj_set_style_transform_rotation(rotated, 150, 0);
+    lv_obj_set_style_transform_pivot_x(rotated, 30, 0);
+    lv_obj_set_style_transform_pivot_y(rotated, 20, 0);
+    lv_screen_load(scr);
+
+    lv_draw_pool_set_size(0, NULL, NULL);
+    lv_obj_invalidate(scr);
+    lv_refr_now(NULL);
+    memcpy(s_reference, sim_bsp_framebuffer(), sizeof(s_reference));
+
+    lv_draw_pool_set_size(POOL_SIZE, malloc, free);
+    lv_draw_pool_stats_t st[LV_DRAW_POOL_CNT];
+    uint32_t hits, fallbacks;
+    pool_stats(st, &hits, &fallbacks);
+    lv_obj_invalidate(scr);
+    lv_refr_now(NULL);
+    pool_stats(st, &hits, &fallbacks);
+    bool ok = memcmp(sim_bsp_framebuffer(), s_reference, sizeof(s_reference)) == 0;
+    printf("layer check: %u layers and %u layer buffers from the pool, %u from the heap: %s\n",
+           (unsigned)st[LV_DRAW_POOL_LAYER].hits, (unsigned)st[LV_DRAW_POOL_LAYER_BUF].hits,
+           (unsigned)st[LV_DRAW_POOL_LAYER_BUF].fallbacks, ok ? "same pixels" : "PIXELS DIFFER");
+    ok &= st[LV_DRAW_POOL_LAYER].hits > 0 && st[LV_DRAW_POOL_LAYER_BUF].hits > 0;
+
+    lv_draw_pool_set_size(0, NULL, NULL);
+    lv_screen_load(lv_obj_create(NULL));
+    lv_obj_delete(scr);
+    return ok;
+}
+
+int main(int argc, char **argv)
+{
+    const bool quick = bench_quick(argc, argv);
+    const uint32_t updates = quick ? 200 : MAX_UPDATES;
+
+    lv_init();
+    // Heap overflow to spill pools as on the device: the layer and transform buffers of the
+    // draw threads do not fail when the tagged allocations leave less room
+    lv_mem_set_spill_pools(SPILL_POOL_SIZE, SPILL_POOL_MAX, malloc, free);
+    bsp_display_start();
+    lv_obj_t *dashboard = lv_screen_active();
+    ui_create(entity_table_get(), &ui_cbs);
+    ui_set_background(&backg_room1);
+    const size_t sensor = entity_index(ENTITY_SENSOR);
+    const size_t tile = entity_index(ENTITY_SWITCH);
+    if (sensor == SIZE_MAX) {
+        printf("no temperature sensor\nFAILED\n");
+        return 1;
+    }
+
+    bool ok = check_layers();
+    lv_screen_load(dashboard);
+
+    const uint32_t fulls = quick ? 10 : 100;
+    printf("%u updates: clock, temperature, a tile every %d, the whole screen every %d; then %u whole screens\n",
+           (unsigned)updates, TILE_EVERY, FULL_EVERY, (unsigned)fulls);
+    printf("%-10s %12s %8s %8s %12s %8s %8s %6s %8s\n", "", "per update", "allocs", "heap", "per screen", "allocs",
+           "heap", "frag", "biggest");
+    const char *names[] = {"lv_malloc", "pool"};
+    lv_draw_pool_stats_t st[LV_DRAW_POOL_CNT];
+    lv_draw_pool_stats_t st_full[LV_DRAW_POOL_CNT];
+    uint64_t full_hash = 0;
+    for (int c = 0; c < 2; c++) {
+        lv_draw_pool_set_size(c == 1 ? POOL_SIZE : 0, malloc, free);   // out of the LVGL heap, as on the device
+        ui_set_clock("--:--");
+        ui_entity_set_state(sensor, "--.-", 4);
+        if (tile != SIZE_MAX) ui_entity_set_state(tile, "OFF", 3);
+        sim_time_skip_us(1000 * 1000);
+        lv_refr_now(NULL);
+        uint32_t hits, fallbacks;
+        pool_stats(st, &hits, &fallbacks);
+
+        bool same;
+        double us = updates_us(sensor, tile, updates, c == 0, &same);
+        pool_stats(st, &hits, &fallbacks);
+
+        uint64_t t0 = bench_now_ns();
+        for (uint32_t i = 0; i < fulls; i++) {
+            lv_obj_invalidate(lv_screen_active());
+            lv_refr_now(NULL);
+        }
+        double full_us = (double)(bench_now_ns() - t0) / 1000.0 / fulls;
+        uint32_t full_hits, full_fallbacks;
+        pool_stats(st_full, &full_hits, &full_fallbacks);
+        if (c == 0) full_hash = fb_hash();
+        else same &= full_hash == fb_hash();
+
+        lv_mem_monitor_t mon;
+        lv_mem_monitor_heap(LV_MEM_HEAP_MAIN, &mon);
+        printf("%-10s %9.2f us %8.1f %8.1f %9.0f us %8.1f %8.1f %4u %% %8u%s\n", names[c], us,
+               (double)(hits + fallbacks) / updates, (double)fallbacks / updates, full_us,
+               (double)(full_hits + full_fallbacks) / fulls, (double)full_fallbacks / fulls, (unsigned)mon.frag_pct,
+               (unsigned)mon.free_biggest_size, same ? "" : "  PIXELS DIFFER");
+        ok &= same;
+        if (c == 0) ok &= hits == 0 && full_hits == 0;
+        else ok &= hits > 0 && fallbacks == 0 && full_fallbacks == 0;
+    }
+
+    const uint32_t rounds = quick ? 10000 : 200000;
+    lv_draw_pool_set_size(0, NULL, NULL);
+    double heap_ns = alloc_ns(rounds);
+    lv_draw_pool_set_size(POOL_SIZE, malloc, free);
+    double slab_ns = alloc_ns(rounds);
+    printf("allocation and free of a draw task: %.1f ns from lv_malloc, %.1f ns from a slab\n", heap_ns, slab_ns);
+
+    printf("%-10s %9s %9s %12s %12s\n", "slab", "peak", "slots", "per update", "per screen");
+    for (int c = 0; c < LV_DRAW_POOL_CNT; c++) {
+        printf("%-10s %9u %9u %12.1f %12.1f\n", s_class_names[c], (unsigned)st_full[c].peak,
+               (unsigned)st_full[c].slots, (double)st[c].hits / updates, (double)st_full[c].hits / fulls);
+    }
+    lv_draw_pool_set_size(0, NULL, NULL);
+
+    printf("%s\n", ok ? "OK" : "FAILED");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,181 @@
+/*
+ * Parallel SW rendering: frame time with one and with two LVGL draw units.
+ *
+ * Built twice, against the LVGL of the simulator (LV_DRAW_SW_DRAW_UNIT_CNT 2,
+ * pthreads as the FreeRTOS OSAL of the board) and against the same LVGL with
+ * a single draw unit. Each scene is redrawn in the board's direct mode:
+ *   - the dashboard, full screen and one tile, over the packed background
+ *     (decoded by the bg_image decoder from both draw units)
+ *   - the widgets of LVGL's test_cases_perf (test_label: the long wrapped
+ *     label, test_chart: the chart after its 10 point count doublings)
+ *   - a 4x4 button grid, the best case: independent areas
+ *
+ * Two units only help when the draw tasks of an area do not overlap: the
+ * full-screen background is one task that everything above it waits for.
+ * --dump FILE writes a hash of the framebuffer of every scene, which must
+ * not depend on the number of draw units.
+ *
+ *   bench_draw_units_1 [--quick] [--dump FILE] [room1_rle.bin]
+ *   bench_draw_units_2 [--quick] [--dump FILE] [room1_rle.bin]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "lvgl.h"
+
+#include "bg_image.h"
+#include "dashboard_ui.h"
+#include "entity_config.h"
+
+#include "sim_bsp.h"
+#include "bench_util.h"
+
+#define CHART_POINTS   (10 << 10)   // test_chart: 10 points, doubled 10 times
+// 2 x 40 KB of chart series and one draw task per line segment: beyond the board's
+// 64 KB LVGL heap (TLSF caps a pool at LV_MEM_SIZE)
+#define EXTRA_POOL_SIZE   (64 * 1024)
+#define EXTRA_POOL_COUNT  16
+
+LV_IMAGE_DECLARE(backg_room1);
+
+typedef struct {
+    const char *name;
+    lv_obj_t *screen;
+    lv_area_t area;
+} Scene;
+
+static void on_command(const char *topic, const char *payload)
+{
+    (void)topic;
+    (void)payload;
+}
+
+static const DashboardUiCallbacks ui_cbs = { .on_command = on_command };
+
+static void settle(void)
+{
+    sim_time_skip_us(1000000);
+    lv_anim_refr_now();
+    lv_refr_now(NULL);
+}
+
+static double redraw_us(lv_obj_t *scr, const lv_area_t *area, uint32_t iters)
+{
+    uint64_t t0 = bench_now_ns();
+    for (uint32_t i = 0; i < iters; i++) {
+        lv_obj_invalidate_area(scr, area);
+        lv_refr_now(NULL);
+    }
+    return (double)(bench_now_ns() - t0) / 1000.0 / iters;
+}
+
+// FNV-1a of the scanned out framebuffer
+static uint32_t fb_hash(void)
+{
+    const uint8_t *p = (const uint8_t *)sim_bsp_framebuffer();
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < (size_t)BSP_LCD_H_RES * BSP_LCD_V_RES * 2; i++) {
+        h = (h ^ p[i]) * 16777619u;
+    }
+    return h;
+}
+
+static lv_obj_t *label_screen(void)
+{
+    lv_obj_t *scr = lv_obj_create(NULL);
+    lv_obj_t *label = lv_label_create(scr);
+    lv_obj_set_width(label, lv_pct(100));
+    lv_label_set_text(label,
+                      "Lorem ipsum dolor sit amet, consectetur adipiscing elit. Ut auctor sed dui interdum convallis. Proin in ante magna. Pellentesque placerat condimentum erat ac laoreet. Cras mi eros, convallis vitae massa ac, blandit sodales urna. Proin tincidunt fermentum leo a volutpat. Donec ut blandit tortor. Duis elementum nibh nec consequat sagittis. Lutrae sunt praeclarae");
+    return scr;
+}
+
+static lv_obj_t *chart_screen(void)
+{
+    lv_obj_t *scr = lv_obj_create(NULL);
+    lv_obj_t *chart = lv_chart_create(scr);
+    lv_obj_set_size(chart, lv_pct(100), lv_pct(100));
+    lv_chart_set_point_count(chart, CHART_POINTS);
+    lv_chart_set_axis_range(chart, LV_CHART_AXIS_PRIMARY_Y, 0, 1000);
+    lv_chart_set_axis_range(chart, LV_CHART_AXIS_SECONDARY_Y, 0, 1000);
+
+    uint32_t seed = 0x1234567u;
+    lv_chart_series_t *ser[] = {
+        lv_chart_add_series(chart, lv_palette_main(LV_PALETTE_RED), LV_CHART_AXIS_SECONDARY_Y),
+        lv_chart_add_series(chart, lv_palette_main(LV_PALETTE_BLUE), LV_CHART_AXIS_PRIMARY_Y),
+    };
+    for (size_t s = 0; s < sizeof(ser) / sizeof(ser[0]); s++) {
+        for (uint32_t i = 0; i < CHART_POINTS; i++) {
+            lv_chart_set_next_value(chart, ser[s], (int32_t)(bench_rand(&seed) % 1000));
+        }
+    }
+    return scr;
+}
+
+static lv_obj_t *grid_screen(void)
+{
+    lv_obj_t *scr = lv_obj_create(NULL);
+    lv_obj_set_flex_flow(scr, LV_FLEX_FLOW_ROW_WRAP);
+    lv_obj_set_style_pad_all(scr, 12, 0);
+    lv_obj_set_style_pad_gap(scr, 12, 0);
+    for (int i = 0; i < 16; i++) {
+        lv_obj_t *btn = lv_button_create(scr);
+        lv_obj_set_size(btn, 102, 102);
+        lv_obj_t *label = lv_label_create(btn);
+        lv_label_set_text_fmt(label, "Button %d", i + 1);
+        lv_obj_center(label);
+    }
+    return scr;
+}
+
+int main(int argc, char **argv)
+{
+    const bool quick = bench_quick(argc, argv);
+    const uint32_t iters = quick ? 5 : 100;
+    const char *dump_path = NULL;
+    const char *bg_path = NULL;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--dump") && i + 1 < argc) {
+            dump_path = argv[++i];
+        } else if (argv[i][0] != '-') {
+            bg_path = argv[i];
+        }
+    }
+
+    lv_init();
+    for (int i = 0; i < EXTRA_POOL_COUNT; i++) lv_mem_add_pool(malloc(EXTRA_POOL_SIZE), EXTRA_POOL_SIZE);
+    bsp_display_start();
+
+    const lv_area_t full = {0, 0, BSP_LCD_H_RES - 1, BSP_LCD_V_RES - 1};
+    lv_obj_t *dashboard = lv_screen_active();
+    ui_create(entity_table_get(), &ui_cbs);
+    const lv_image_dsc_t *bg = &backg_room1;
+    if (bg_path && bg_image_load(bg_path, &bg) != ESP_OK) return 1;
+    ui_set_background(bg);
+
+    const Scene scenes[] = {
+        {"dashboard",       dashboard,        full},
+        {"dashboard tile",  dashboard,        {20, 100, 219, 229}},
+        {"test_label",      label_screen(),   full},
+        {"test_chart",      chart_screen(),   full},
+        {"button grid",     grid_screen(),    full},
+    };
+
+    FILE *dump = dump_path ? fopen(dump_path, "w") : NULL;
+    if (dump_path && !dump) return 1;
+
+    printf("%d SW draw unit(s), %s background, %u frames per scene\n", LV_DRAW_SW_DRAW_UNIT_CNT,
+           bg_path ? "packed" : "C array", (unsigned)iters);
+    printf("%-16s %14s\n", "scene", "frame");
+    for (size_t i = 0; i < sizeof(scenes) / sizeof(scenes[0]); i++) {
+        const Scene *sc = &scenes[i];
+        if (lv_screen_active() != sc->screen) lv_screen_load(sc->screen);
+        settle();
+        printf("%-16s %11.1f us\n", sc->name, redraw_us(sc->screen, &sc->area, iters));
+        if (dump) fprintf(dump, "%s %08x\n", sc->name, (unsigned)fb_hash());
+    }
+
+    if (dump) fclose(dump);
+    return 0;
+}
@@ -0,0 +1,201 @@
+/*
+ * Entity model at scale: build the dashboard for 200 entities, then push state
+ * updates through the real path (topic registry -> mailbox -> widget).
+ *
+ * Reports LVGL heap + table memory per entity, the time to create the UI and
+ * the cost of one update (dispatch + apply, render excluded), plus the render
+ * time of a frame that carries a batch of updates.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "lvgl.h"
+
+#include "entity_config.h"
+#include "dashboard_ui.h"
+#include "mqtt_dispatch.h"
+#include "state_mailbox.h"
+#include "topic_registry.h"
+
+#include "sim_bsp.h"
+#include "bench_util.h"
+
+#define ENTITY_COUNT    200
+// The board's 64 KB LVGL heap does not fit 200 tiles: add pools (TLSF caps a pool at LV_MEM_SIZE)
+#define EXTRA_POOL_SIZE   (32 * 1024)
+#define EXTRA_POOL_COUNT  64
+#define UPDATES_PER_FRAME 10
+
+static const char *const type_names[] = {"switch", "sensor", "light", "cover"};
+
+typedef struct {
+    char topic[64];
+    int len;
+    int entity;
+    bool brightness;
+} BenchTopic;
+
+static BenchTopic s_topics[ENTITY_COUNT * 2];
+static int s_topic_cnt;
+
+static void on_command(const char *topic, const char *payload)
+{
+    (void)topic;
+    (void)payload;
+}
+
+static const DashboardUiCallbacks ui_cbs = { .on_command = on_command };
+
+static size_t lv_heap_used(void)
+{
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    return mon.total_size - mon.free_size;
+}
+
+static void settle(void)
+{
+    sim_time_skip_us(1000000);
+    lv_anim_refr_now();
+}
+
+static char *build_entity_file(void)
+{
+    size_t cap = ENTITY_COUNT * 256;
+    char *text = malloc(cap);
+    size_t n = 0;
+
+    for (int i = 0; i < ENTITY_COUNT; i++) {
+        int type = i % 4;
+        const char *t = type_names[type];
+        BenchTopic *bt = &s_topics[s_topic_cnt++];
+        bt->len = snprintf(bt->topic, sizeof(bt->topic), "home/bench/%s_%03d/state", t, i);
+        bt->entity = i;
+
+        switch (type) {
+        case ENTITY_SENSOR:
+            n += (size_t)snprintf(text + n, cap - n, "sensor|Sensor %d|%s||%s\n", i, bt->topic, (i % 8) == 1 ? "°C" : "W");
+            break;
+        case ENTITY_LIGHT: {
+            BenchTopic *bb = &s_topics[s_topic_cnt++];
+            bb->len = snprintf(bb->topic, sizeof(bb->topic), "home/bench/light_%03d/brightness", i);
+            bb->entity = i;
+            bb->brightness = true;
+            n += (size_t)snprintf(text + n, cap - n, "light|Light %d|%s|home/bench/light_%03d/set|%s|home/bench/light_%03d/brightness/set\n",
+                                  i, bt->topic, i, bb->topic, i);
+            break;
+        }
+        default:
+            n += (size_t)snprintf(text + n, cap - n, "%s|%s %d|%s|home/bench/%s_%03d/set\n", t, t, i, bt->topic, t, i);
+            break;
+        }
+    }
+    return text;
+}
+
+// Payload that always differs from the previous one for this entity
+static int make_payload(char *buf, size_t size, const BenchTopic *bt, uint32_t seq)
+{
+    if (bt->brightness) return snprintf(buf, size, "%u", (seq * 37u) % 256u);
+
+    switch (bt->entity % 4) {
+    case ENTITY_SWITCH:
+    case ENTITY_LIGHT:
+        return snprintf(buf, size, "%s", (seq & 1) ? "ON" : "OFF");
+    case ENTITY_SENSOR:
+        return snprintf(buf, size, "%u.%u", 15 + seq % 20, seq % 10);
+    default:
+        return snprintf(buf, size, "%u%%", seq % 101);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const bool quick = bench_quick(argc, argv);
+    const uint32_t updates = quick ? 2000 : 50000;
+    const uint32_t frames = quick ? 20 : 200;
+
+    lv_init();
+    for (int i = 0; i < EXTRA_POOL_COUNT; i++) lv_mem_add_pool(malloc(EXTRA_POOL_SIZE), EXTRA_POOL_SIZE);
+    bsp_display_start();
+
+    // ---- Build ----
+    char *text = build_entity_file();
+    size_t text_bytes = strlen(text) + 1;
+    EntityTable table;
+    if (entity_table_parse(text, &table) != ESP_OK || table.count != ENTITY_COUNT) {
+        fprintf(stderr, "entity table parse failed\n");
+        return 1;
+    }
+
+    size_t heap0 = lv_heap_used();
+    uint64_t t0 = bench_now_ns();
+    ui_create(&table, &ui_cbs);
+    double create_ms = (double)(bench_now_ns() - t0) / 1e6;
+    size_t heap_ui = lv_heap_used() - heap0;
+
+    t0 = bench_now_ns();
+    lv_refr_now(NULL);      // layout + first full render
+    double first_frame_ms = (double)(bench_now_ns() - t0) / 1e6;
+
+    mqtt_dispatch_start_ui(&table);
+    mqtt_dispatch_init();
+
+    size_t table_bytes = text_bytes + table.count * sizeof(EntityConfig);
+    size_t widgets_bytes = table.count * 3 * sizeof(void *);
+    printf("entities               %u (%u topics registered)\n", (unsigned)table.count, (unsigned)topic_registry_count());
+    printf("LVGL heap              %u bytes = %.0f bytes/entity (host, %u-bit pointers)\n",
+           (unsigned)heap_ui, (double)heap_ui / ENTITY_COUNT, (unsigned)(sizeof(void *) * 8));
+    printf("table + widget index   %u bytes = %.0f bytes/entity\n",
+           (unsigned)(table_bytes + widgets_bytes), (double)(table_bytes + widgets_bytes) / ENTITY_COUNT);
+    printf("ui_create              %.2f ms (%.1f us/entity), first frame %.2f ms\n",
+           create_ms, create_ms * 1000.0 / ENTITY_COUNT, first_frame_ms);
+
+    // ---- Updates: one message, applied right away (no coalescing, no render) ----
+    uint32_t rng = 7;
+    char payload[16];
+    StateMailboxStats st0;
+    state_mailbox_get_stats(&st0);
+
+    uint64_t update_ns = 0;
+    for (uint32_t i = 0; i < updates; i++) {
+        const BenchTopic *bt = &s_topics[bench_rand(&rng) % (uint32_t)s_topic_cnt];
+        int len = make_payload(payload, sizeof(payload), bt, i);
+
+        t0 = bench_now_ns();
+        handle_state_msg(bt->topic, bt->len, payload, len);
+        state_mailbox_drain();
+        update_ns += bench_now_ns() - t0;
+
+        // Let the style transitions of the toggled tiles finish (not timed)
+        if (i % 100 == 99) settle();
+    }
+    double update_us = (double)update_ns / 1000.0 / updates;
+
+    StateMailboxStats st1;
+    state_mailbox_get_stats(&st1);
+    bool ok = (st1.applied - st0.applied) == updates;
+    printf("update                 %.2f us (dispatch + mailbox + widget), %u/%u applied\n",
+           update_us, st1.applied - st0.applied, updates);
+
+    // ---- Frames carrying a batch of updates ----
+    double render_total = 0;
+    for (uint32_t f = 0; f < frames; f++) {
+        for (int u = 0; u < UPDATES_PER_FRAME; u++) {
+            const BenchTopic *bt = &s_topics[bench_rand(&rng) % (uint32_t)s_topic_cnt];
+            int len = make_payload(payload, sizeof(payload), bt, updates + f * UPDATES_PER_FRAME + u);
+            handle_state_msg(bt->topic, bt->len, payload, len);
+        }
+        t0 = bench_now_ns();
+        state_mailbox_drain();
+        lv_refr_now(NULL);
+        render_total += (double)(bench_now_ns() - t0);
+        settle();
+    }
+    printf("frame                  %.1f us per frame with %d updates (apply + render)\n",
+           render_total / 1000.0 / frames, UPDATES_PER_FRAME);
+
+    printf("%s\n", ok ? "OK" : "FAILED");
+    return ok ? 0 : 1;
+}
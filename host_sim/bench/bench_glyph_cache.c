@@ -0,0 +1,213 @@
+/*
+ * Glyph bitmap cache of the built-in fonts (lv_font_glyph_cache_*) and the
+ * ASCII index of their cmaps (lv_font_fmt_txt_add_ascii_index()).
+ *
+ * The dashboard's short numeric labels in montserrat_14: the clock ticking
+ * minutes and the temperature badge taking new values, each update redrawn,
+ * plus the glyph lookup alone over "0123456789:.°C" as LVGL's label layout
+ * does it. Without cache, with the cache, then with the ASCII index as well:
+ * time per update and the cache hit rate.
+ *
+ * The cache must not change a pixel: every update of the sequence is hashed
+ * without cache as the reference, and a screen of text in every size of
+ * glyph (ASCII, Latin-1, symbols larger than a slot) is compared as well.
+ *
+ *   bench_glyph_cache [--quick]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "lvgl.h"
+
+#include "dashboard_ui.h"
+#include "entity_config.h"
+
+#include "sim_bsp.h"
+#include "bench_util.h"
+
+#define FB_PIXELS           (BSP_LCD_H_RES * BSP_LCD_V_RES)
+#define GLYPH_CACHE_SIZE    (8 * 1024)   // as the firmware (CONFIG_DASHBOARD_LVGL_GLYPH_CACHE_KB)
+#define MAX_UPDATES         2000
+
+static uint16_t s_reference[FB_PIXELS];
+static uint64_t s_hashes[MAX_UPDATES];
+
+static void on_command(const char *topic, const char *payload)
+{
+    (void)topic;
+    (void)payload;
+}
+
+static const DashboardUiCallbacks ui_cbs = { .on_command = on_command };
+
+static uint64_t fb_hash(void)
+{
+    const uint8_t *p = (const uint8_t *)sim_bsp_framebuffer();
+    uint64_t h = 0xcbf29ce484222325ULL;
+    for (size_t i = 0; i < FB_PIXELS * 2; i++) h = (h ^ p[i]) * 0x100000001b3ULL;
+    return h;
+}
+
+static size_t sensor_index(void)
+{
+    const EntityTable *entities = entity_table_get();
+    for (size_t i = 0; i < entities->count; i++) {
+        if (entities->items[i].type == ENTITY_SENSOR) return i;
+    }
+    return SIZE_MAX;
+}
+
+// Clock minutes and temperatures in tenths: the dozen glyphs of the dashboard's numeric labels
+static double updates_us(size_t sensor, uint32_t updates, bool reference, bool *same)
+{
+    *same = true;
+    uint64_t ns = 0;
+    for (uint32_t i = 0; i < updates; i++) {
+        uint64_t t0 = bench_now_ns();
+        char txt[16];
+        if (i % 2 == 0) {
+            snprintf(txt, sizeof(txt), "%02u:%02u", (unsigned)(i / 120 % 24), (unsigned)(i / 2 % 60));
+            ui_set_clock(txt);
+        } else {
+            int t = 150 + (int)(i * 7 % 120);
+            int len = snprintf(txt, sizeof(txt), "%d.%d", t / 10, t % 10);
+            ui_entity_set_state(sensor, txt, len);
+        }
+        lv_refr_now(NULL);
+        ns += bench_now_ns() - t0;
+        if (reference) s_hashes[i] = fb_hash();
+        else if (*same && s_hashes[i] != fb_hash()) *same = false;
+    }
+    return (double)ns / 1000.0 / updates;
+}
+
+// Glyph descriptors of a short label, as lv_text_get_size() and the label drawing get them
+static double lookup_ns(uint32_t iters)
+{
+    static const uint32_t letters[] = {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', ':', '.', 0xB0, 'C'};
+    const size_t n = sizeof(letters) / sizeof(letters[0]);
+    lv_font_glyph_dsc_t g;
+    uint32_t sum = 0;
+    uint64_t t0 = bench_now_ns();
+    for (uint32_t i = 0; i < iters; i++) {
+        for (size_t k = 0; k < n; k++) {
+            lv_font_get_glyph_dsc(&lv_font_montserrat_14, &g, letters[k], letters[(k + 1) % n]);
+            sum += g.adv_w;
+        }
+    }
+    double ns = (double)(bench_now_ns() - t0) / iters / n;
+    return sum ? ns : 0.0;
+}
+
+// A8 bitmaps of the same glyphs, as the SW draw unit gets them for each letter
+static double bitmap_ns(uint32_t iters)
+{
+    static const uint32_t letters[] = {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', ':', '.', 0xB0, 'C'};
+    const size_t n = sizeof(letters) / sizeof(letters[0]);
+    lv_font_glyph_dsc_t g[sizeof(letters) / sizeof(letters[0])];
+    for (size_t k = 0; k < n; k++) lv_font_get_glyph_dsc(&lv_font_montserrat_14, &g[k], letters[k], 0);
+    lv_draw_buf_t *draw_buf = lv_draw_buf_create(32, 32, LV_COLOR_FORMAT_A8, LV_STRIDE_AUTO);
+    uint32_t sum = 0;
+    uint64_t t0 = bench_now_ns();
+    for (uint32_t i = 0; i < iters; i++) {
+        for (size_t k = 0; k < n; k++) {
+            lv_draw_buf_reshape(draw_buf, 0, g[k].box_w, g[k].box_h, LV_STRIDE_AUTO);
+            const lv_draw_buf_t *bitmap = lv_font_get_glyph_bitmap(&g[k], draw_buf);
+            sum += bitmap->data[bitmap->header.stride * (g[k].box_h / 2) + g[k].box_w / 2];
+            lv_font_glyph_release_draw_data(&g[k]);
+        }
+    }
+    double ns = (double)(bench_now_ns() - t0) / iters / n;
+    lv_draw_buf_destroy(draw_buf);
+    return sum ? ns : 0.0;
+}
+
+static bool check_text(void)
+{
+    lv_obj_t *scr = lv_obj_create(NULL);
+    lv_obj_set_style_bg_color(scr, lv_color_hex(0x102030), 0);
+    lv_obj_t *label = lv_label_create(scr);
+    lv_obj_set_width(label, BSP_LCD_H_RES - 20);
+    lv_obj_set_pos(label, 10, 10);
+    lv_obj_set_style_text_color(label, lv_color_hex(0xF0E0C0), 0);
+    lv_label_set_text(label,
+                      "0123456789 :.,;-+%/ 21.5 \xC2\xB0" "C 12:34\n"
+                      "ABCDEFGHIJKLMNOPQRSTUVWXYZ abcdefghijklmnopqrstuvwxyz\n"
+                      "!\"#$&'()*<=>?@[\\]^_`{|}~\n"
+                      LV_SYMBOL_HOME LV_SYMBOL_SETTINGS LV_SYMBOL_WIFI LV_SYMBOL_POWER " " LV_SYMBOL_OK);
+    lv_obj_t *small = lv_label_create(scr);
+    lv_obj_set_pos(small, 10, 200);
+    lv_obj_set_style_text_opa(small, LV_OPA_60, 0);
+    lv_label_set_text(small, "18.0 \xC2\xB0" "C  23:59");
+    lv_screen_load(scr);
+
+    lv_font_glyph_cache_set_size(0, NULL, NULL);
+    lv_obj_invalidate(scr);
+    lv_refr_now(NULL);
+    memcpy(s_reference, sim_bsp_framebuffer(), sizeof(s_reference));
+
+    lv_font_glyph_cache_set_size(GLYPH_CACHE_SIZE, NULL, NULL);
+    bool ok = true;
+    for (int pass = 0; pass < 2 && ok; pass++) {   // decoded into the slots, then drawn from them
+        lv_obj_invalidate(scr);
+        lv_refr_now(NULL);
+        ok = memcmp(sim_bsp_framebuffer(), s_reference, sizeof(s_reference)) == 0;
+    }
+
+    lv_font_glyph_cache_stats_t st;
+    lv_font_glyph_cache_get_stats(&st, true);
+    printf("pixel check: %u of %u slots, %u hits, %u misses, %u evicted, %u uncached: %s\n",
+           (unsigned)st.entries, (unsigned)st.slots, (unsigned)st.hits, (unsigned)st.misses,
+           (unsigned)st.evictions, (unsigned)st.uncached, ok ? "same pixels" : "PIXELS DIFFER");
+    ok &= st.evictions > 0 && st.uncached > 0;     // more glyphs than slots, symbols too large
+    lv_screen_load(lv_obj_create(NULL));
+    lv_obj_delete(scr);
+    return ok;
+}
+
+int main(int argc, char **argv)
+{
+    const bool quick = bench_quick(argc, argv);
+    const uint32_t updates = quick ? 200 : MAX_UPDATES;
+    const uint32_t lookups = quick ? 2000 : 100000;
+
+    lv_init();
+    bsp_display_start();
+    lv_obj_t *dashboard = lv_screen_active();
+    ui_create(entity_table_get(), &ui_cbs);
+    const size_t sensor = sensor_index();
+    if (sensor == SIZE_MAX) {
+        printf("no temperature sensor\nFAILED\n");
+        return 1;
+    }
+
+    bool ok = check_text();
+    lv_screen_load(dashboard);
+
+    printf("%u clock and temperature updates, glyph lookup over \"0123456789:.\xC2\xB0" "C\"\n", (unsigned)updates);
+    printf("%-22s %12s %12s %12s %9s\n", "", "per update", "per lookup", "per bitmap", "hit rate");
+    const char *names[] = {"no cache", "glyph cache", "glyph cache + ASCII"};
+    for (int c = 0; c < 3; c++) {
+        lv_font_glyph_cache_set_size(c ? GLYPH_CACHE_SIZE : 0, NULL, NULL);
+        if (c == 2) ok &= lv_font_fmt_txt_add_ascii_index(&lv_font_montserrat_14);
+        ui_set_clock("--:--");
+        ui_entity_set_state(sensor, "--.-", 4);
+        lv_refr_now(NULL);
+        lv_font_glyph_cache_stats_t st;
+        lv_font_glyph_cache_get_stats(&st, true);
+
+        bool same;
+        double us = updates_us(sensor, updates, c == 0, &same);
+        lv_font_glyph_cache_get_stats(&st, true);
+        double lookup = lookup_ns(lookups);
+        double bitmap = bitmap_ns(lookups);
+        printf("%-22s %9.2f us %9.1f ns %9.1f ns %8.1f%%%s\n", names[c], us, lookup, bitmap,
+               st.hits + st.misses ? 100.0 * st.hits / (st.hits + st.misses) : 0.0, same ? "" : "  PIXELS DIFFER");
+        ok &= same;
+        if (c > 0) ok &= st.uncached == 0 && st.evictions == 0;   // the numeric labels fit
+    }
+
+    printf("%s\n", ok ? "OK" : "FAILED");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,127 @@
+/*
+ * Tile icons: ARGB8888 (as converted) vs. the variants of tools/icon_pack.py.
+ *
+ * Each icon is put on a tile styled like the dashboard's (200x130, radius 10,
+ * lamp-off grey) and repainted: the icon area alone, and the whole tile as on
+ * a toggle. Reports the bytes the icon takes in flash and the repaint time.
+ *
+ * Both variants round differently from ARGB8888 at the antialiased edges
+ * (RGB565A8 quantizes the colour before blending instead of after, the
+ * premultiplied colour is truncated), so pixels may differ by one step of a
+ * 565 channel; more than that fails.
+ *
+ *   bench_icons [--quick]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "lvgl.h"
+
+#include "sim_bsp.h"
+#include "bench_util.h"
+
+#define FB_PIXELS    (BSP_LCD_H_RES * BSP_LCD_V_RES)
+#define MAX_565_DIFF 1
+
+LV_IMAGE_DECLARE(floor_lamp_argb8888);
+LV_IMAGE_DECLARE(floor_lamp_argb8888_premultiplied);
+LV_IMAGE_DECLARE(floor_lamp_rgb565a8);
+LV_IMAGE_DECLARE(ui_img_clock_icon_argb8888);
+LV_IMAGE_DECLARE(ui_img_clock_icon_argb8888_premultiplied);
+LV_IMAGE_DECLARE(ui_img_clock_icon_rgb565a8);
+LV_IMAGE_DECLARE(ui_thermostat_icon_argb8888);
+LV_IMAGE_DECLARE(ui_thermostat_icon_argb8888_premultiplied);
+LV_IMAGE_DECLARE(ui_thermostat_icon_rgb565a8);
+
+typedef struct {
+    const char *name;
+    const lv_image_dsc_t *variants[3];  // ARGB8888 first: the reference
+} IconCase;
+
+static const IconCase icons[] = {
+    {"floor_lamp", {&floor_lamp_argb8888, &floor_lamp_argb8888_premultiplied, &floor_lamp_rgb565a8}},
+    {"clock_icon", {&ui_img_clock_icon_argb8888, &ui_img_clock_icon_argb8888_premultiplied, &ui_img_clock_icon_rgb565a8}},
+    {"thermostat", {&ui_thermostat_icon_argb8888, &ui_thermostat_icon_argb8888_premultiplied, &ui_thermostat_icon_rgb565a8}},
+};
+static const char *const variant_names[] = {"ARGB8888", "ARGB8888 premult", "RGB565A8"};
+#define ICON_COUNT    (sizeof(icons) / sizeof(icons[0]))
+#define VARIANT_COUNT (sizeof(variant_names) / sizeof(variant_names[0]))
+
+static uint16_t s_reference[FB_PIXELS];
+
+static double repaint_us(lv_obj_t *obj, uint32_t iters)
+{
+    uint64_t t0 = bench_now_ns();
+    for (uint32_t i = 0; i < iters; i++) {
+        lv_obj_invalidate(obj);
+        lv_refr_now(NULL);
+    }
+    return (double)(bench_now_ns() - t0) / 1000.0 / iters;
+}
+
+// Largest difference of one RGB565 channel against the ARGB8888 reference
+static int max_channel_diff(const lv_area_t *a)
+{
+    const uint16_t *fb = sim_bsp_framebuffer();
+    int worst = 0;
+    for (int32_t y = a->y1; y <= a->y2; y++) {
+        for (int32_t x = a->x1; x <= a->x2; x++) {
+            uint16_t p = fb[y * BSP_LCD_H_RES + x];
+            uint16_t r = s_reference[y * BSP_LCD_H_RES + x];
+            int d[3] = {abs((p >> 11) - (r >> 11)), abs(((p >> 5) & 0x3F) - ((r >> 5) & 0x3F)), abs((p & 0x1F) - (r & 0x1F))};
+            for (int c = 0; c < 3; c++) {
+                if (d[c] > worst) worst = d[c];
+            }
+        }
+    }
+    return worst;
+}
+
+int main(int argc, char **argv)
+{
+    const bool quick = bench_quick(argc, argv);
+    const uint32_t iters = quick ? 200 : 5000;
+
+    lv_init();
+    bsp_display_start();
+
+    lv_obj_t *scr = lv_screen_active();
+    lv_obj_t *tile = lv_button_create(scr);
+    lv_obj_set_size(tile, 200, 130);
+    lv_obj_set_style_bg_color(tile, lv_color_hex(0x607D8B), 0);
+    lv_obj_set_style_radius(tile, 10, 0);
+    lv_obj_center(tile);
+    lv_obj_t *icon = lv_image_create(tile);
+    lv_obj_align(icon, LV_ALIGN_TOP_MID, 0, 8);
+
+    printf("%-12s %-18s %8s %14s %14s %9s\n", "icon", "format", "flash", "icon repaint", "tile repaint", "max diff");
+
+    bool ok = true;
+    for (size_t i = 0; i < ICON_COUNT; i++) {
+        for (size_t v = 0; v < VARIANT_COUNT; v++) {
+            const lv_image_dsc_t *img = icons[i].variants[v];
+            lv_image_set_src(icon, img);
+            lv_obj_invalidate(scr);
+            lv_refr_now(NULL);
+
+            lv_area_t area;
+            lv_obj_get_coords(tile, &area);
+            int diff = 0;
+            if (v == 0) {
+                memcpy(s_reference, sim_bsp_framebuffer(), sizeof(s_reference));
+            } else {
+                diff = max_channel_diff(&area);
+            }
+            bool same = diff <= MAX_565_DIFF;
+            ok &= same;
+
+            printf("%-12s %-18s %8u %11.2f us %11.2f us %9d%s\n", icons[i].name, variant_names[v],
+                   (unsigned)img->data_size, repaint_us(icon, iters), repaint_us(tile, iters / 4), diff,
+                   same ? "" : "  PIXELS DIFFER");
+        }
+    }
+
+    printf("%s\n", ok ? "OK" : "FAILED");
+    return ok ? 0 : 1;
+}
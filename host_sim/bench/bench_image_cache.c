@@ -0,0 +1,277 @@
+/*
+ * Decoded image cache (lv_image_cache, image_cache_start()) across room
+ * background switches.
+ *
+ * Four room backgrounds stored as plain LVGL LZ4 images (decoded whole by
+ * LVGL's bin decoder, loaded through bg_image_load() like the storage
+ * partition files) and a few small LZ4 badges on the dashboard. A sequence of
+ * room switches, each followed by tile repaints, runs without the cache, with
+ * a budget of two rooms and with a budget holding everything: time per
+ * switch, bytes decoded, hits, misses, evictions.
+ *
+ * Every budget must give the same pixels, the cache must stay within its
+ * budget, the two-room budget must evict rooms rather than the badges, and
+ * with everything cached each image must be decoded once.
+ *
+ *   bench_image_cache [--quick]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "lvgl.h"
+#include "src/draw/lv_draw_buf_private.h"
+#include "src/draw/lv_image_decoder_private.h"
+#include "src/libs/lz4/lz4.h"
+
+#include "bg_image.h"
+#include "dashboard_ui.h"
+#include "entity_config.h"
+#include "image_cache.h"
+
+#include "sim_bsp.h"
+#include "bench_util.h"
+
+#define ROOM_CNT        4
+#define BADGE_CNT       6
+#define BADGE_SIZE      40
+#define FB_BYTES        (BSP_LCD_H_RES * BSP_LCD_V_RES * 2)
+#define MAX_STEPS       64
+
+LV_IMAGE_DECLARE(backg_room1);
+
+typedef struct {
+    const char *name;
+    uint32_t budget;
+} Budget;
+
+typedef struct {
+    double us_per_step;
+    uint64_t decoded_bytes;
+    uint32_t max_size;          // largest cache size seen after a step
+    uint32_t badges_cached;     // badges in the cache at the end
+    lv_image_cache_stats_t st;
+} RunResult;
+
+static const lv_image_dsc_t *s_rooms[ROOM_CNT];
+static lv_image_dsc_t s_badges[BADGE_CNT];
+static uint64_t s_hashes[MAX_STEPS];
+
+static lv_draw_buf_malloc_cb_t s_psram_malloc;
+static uint64_t s_decoded_bytes;
+
+static void on_command(const char *topic, const char *payload)
+{
+    (void)topic;
+    (void)payload;
+}
+
+static const DashboardUiCallbacks ui_cbs = { .on_command = on_command };
+
+// Every buffer an image decoder creates goes through the image handlers
+static void *counting_malloc(size_t size, lv_color_format_t cf)
+{
+    s_decoded_bytes += size;
+    return s_psram_malloc(size, cf);
+}
+
+static uint64_t fb_hash(void)
+{
+    const uint8_t *p = (const uint8_t *)sim_bsp_framebuffer();
+    uint64_t h = 0xcbf29ce484222325ULL;
+    for (size_t i = 0; i < FB_BYTES; i++) h = (h ^ p[i]) * 0x100000001b3ULL;
+    return h;
+}
+
+// LVGL compressed image: header, lv_image_compressed_t (method, sizes), one LZ4 block
+static uint8_t *lz4_image(const uint16_t *px, uint32_t w, uint32_t h, uint32_t *size)
+{
+    const int raw = (int)(w * h * 2);
+    uint8_t *out = malloc(sizeof(lv_image_header_t) + 12 + LZ4_compressBound(raw));
+    if (!out) return NULL;
+    int len = LZ4_compress_default((const char *)px, (char *)out + sizeof(lv_image_header_t) + 12, raw,
+                                   LZ4_compressBound(raw));
+    lv_image_header_t header = {
+        .magic = LV_IMAGE_HEADER_MAGIC,
+        .cf = LV_COLOR_FORMAT_RGB565,
+        .flags = LV_IMAGE_FLAGS_COMPRESSED,
+        .w = w,
+        .h = h,
+        .stride = w * 2,
+    };
+    uint32_t ch[3] = {LV_IMAGE_COMPRESS_LZ4, (uint32_t)len, (uint32_t)raw};   // band height 0: one block
+    memcpy(out, &header, sizeof(header));
+    memcpy(out + sizeof(header), ch, sizeof(ch));
+    *size = (uint32_t)(sizeof(header) + sizeof(ch) + len);
+    return out;
+}
+
+// The rooms: room1 as is, colour swapped, inverted and mirrored, through the storage partition loader
+static bool load_rooms(void)
+{
+    const uint32_t w = backg_room1.header.w, h = backg_room1.header.h;
+    const uint16_t *src = (const uint16_t *)backg_room1.data;
+    uint16_t *px = malloc(w * h * 2);
+    if (!px) return false;
+
+    for (int r = 0; r < ROOM_CNT; r++) {
+        for (uint32_t y = 0; y < h; y++) {
+            for (uint32_t x = 0; x < w; x++) {
+                uint16_t c = src[y * w + x];
+                switch (r) {
+                case 1: c = (uint16_t)((c >> 11) | (c & 0x07E0) | (c << 11)); break;
+                case 2: c = (uint16_t)~c; break;
+                case 3: c = src[y * w + (w - 1 - x)]; break;
+                default: break;
+                }
+                px[y * w + x] = c;
+            }
+        }
+        uint32_t size;
+        uint8_t *file = lz4_image(px, w, h, &size);
+        char path[64];
+        snprintf(path, sizeof(path), "bench_image_cache_room%d.bin", r + 1);
+        FILE *f = fopen(path, "wb");
+        bool written = file && f && fwrite(file, 1, size, f) == size;
+        if (f) fclose(f);
+        free(file);
+        if (!written || bg_image_load(path, &s_rooms[r]) != ESP_OK) {
+            free(px);
+            return false;
+        }
+        remove(path);
+    }
+    free(px);
+    return true;
+}
+
+// Small LZ4 images on the dashboard, drawn over every room
+static bool create_badges(void)
+{
+    uint16_t px[BADGE_SIZE * BADGE_SIZE];
+    for (int b = 0; b < BADGE_CNT; b++) {
+        for (int i = 0; i < BADGE_SIZE * BADGE_SIZE; i++) {
+            px[i] = (uint16_t)(((i / BADGE_SIZE) << 11) + ((i % BADGE_SIZE) << 5) + b * 4);
+        }
+        uint32_t size;
+        uint8_t *file = lz4_image(px, BADGE_SIZE, BADGE_SIZE, &size);
+        if (!file) return false;
+        memcpy(&s_badges[b].header, file, sizeof(lv_image_header_t));
+        s_badges[b].data = file + sizeof(lv_image_header_t);
+        s_badges[b].data_size = size - sizeof(lv_image_header_t);
+
+        lv_obj_t *img = lv_image_create(lv_screen_active());
+        lv_image_set_src(img, &s_badges[b]);
+        lv_obj_set_pos(img, 10 + b * (BADGE_SIZE + 8), 340);   // over the room background (y 80..399)
+    }
+    return true;
+}
+
+static uint32_t badges_cached(void)
+{
+    uint32_t n = 0;
+    lv_iter_t *iter = lv_image_cache_iter_create();
+    if (!iter) return 0;
+    lv_image_cache_data_t *elem = malloc(lv_cache_entry_get_size(sizeof(lv_image_cache_data_t)));
+    while (elem && lv_iter_next(iter, elem) == LV_RESULT_OK) {
+        for (int b = 0; b < BADGE_CNT; b++) n += elem->src == &s_badges[b];
+    }
+    free(elem);
+    lv_iter_destroy(iter);
+    return n;
+}
+
+static RunResult run(uint32_t budget, const int *seq, size_t steps, uint32_t repaints, bool reference, bool *same)
+{
+    static const lv_area_t tile = {20, 100, 219, 229};
+    RunResult res = {0};
+
+    lv_image_cache_resize(budget, false);
+    lv_image_cache_drop(NULL);
+    ui_set_background(&backg_room1);
+    lv_refr_now(NULL);
+    lv_image_cache_get_stats(&res.st, true);
+    s_decoded_bytes = 0;
+
+    *same = true;
+    uint64_t t0 = bench_now_ns();
+    for (size_t i = 0; i < steps; i++) {
+        ui_set_background(s_rooms[seq[i]]);
+        lv_refr_now(NULL);
+        for (uint32_t r = 0; r < repaints; r++) {
+            lv_obj_invalidate_area(lv_screen_active(), &tile);
+            lv_refr_now(NULL);
+        }
+
+        uint64_t h = fb_hash();
+        if (reference) s_hashes[i] = h;
+        else if (h != s_hashes[i]) *same = false;
+        lv_image_cache_stats_t st;
+        lv_image_cache_get_stats(&st, false);
+        if (st.size > res.max_size) res.max_size = st.size;
+    }
+    res.us_per_step = (double)(bench_now_ns() - t0) / 1000.0 / steps;
+    res.decoded_bytes = s_decoded_bytes;
+    res.badges_cached = badges_cached();
+    lv_image_cache_get_stats(&res.st, false);
+    return res;
+}
+
+int main(int argc, char **argv)
+{
+    const bool quick = bench_quick(argc, argv);
+    static const int pattern[] = {0, 1, 0, 2, 0, 1, 3, 0};   // back to the first room between the others
+    const size_t steps = quick ? 8 : MAX_STEPS;
+    const uint32_t repaints = quick ? 3 : 10;
+    int seq[MAX_STEPS];
+    for (size_t i = 0; i < steps; i++) seq[i] = pattern[i % (sizeof(pattern) / sizeof(pattern[0]))];
+
+    lv_init();
+    bsp_display_start();
+    ui_create(entity_table_get(), &ui_cbs);
+
+    image_cache_start(0);
+    lv_draw_buf_handlers_t *handlers = lv_draw_buf_get_image_handlers();
+    s_psram_malloc = handlers->buf_malloc_cb;
+    handlers->buf_malloc_cb = counting_malloc;
+
+    if (!load_rooms() || !create_badges()) {
+        printf("cannot build the images\nFAILED\n");
+        return 1;
+    }
+
+    const uint32_t room_size = backg_room1.header.w * backg_room1.header.h * 2;
+    const uint32_t badge_size = BADGE_SIZE * BADGE_SIZE * 2;
+    const Budget budgets[] = {
+        {"no cache", 0},
+        {"two rooms", 2 * room_size + BADGE_CNT * badge_size + 4096},
+        {"everything", ROOM_CNT * room_size + BADGE_CNT * badge_size + 4096},
+    };
+
+    printf("%zu room switches, %u tile repaints each\n", steps, repaints);
+    printf("%-11s %8s %12s %12s %6s %6s %6s %7s %9s\n", "budget", "KB", "per switch", "decoded/sw",
+           "hits", "misses", "evict", "hit", "max KB");
+    bool ok = true;
+    for (size_t b = 0; b < sizeof(budgets) / sizeof(budgets[0]); b++) {
+        bool same;
+        RunResult r = run(budgets[b].budget, seq, steps, repaints, b == 0, &same);
+        const lv_image_cache_stats_t *st = &r.st;
+        printf("%-11s %8u %9.1f us %9.1f KB %6u %6u %6u %6.1f%% %9u%s\n", budgets[b].name,
+               (unsigned)(budgets[b].budget / 1024), r.us_per_step, r.decoded_bytes / 1024.0 / steps,
+               (unsigned)st->hits, (unsigned)st->misses, (unsigned)st->evictions,
+               st->hits + st->misses ? 100.0 * st->hits / (st->hits + st->misses) : 0.0,
+               (unsigned)(r.max_size / 1024), same ? "" : "  PIXELS DIFFER");
+
+        ok &= same && r.max_size <= budgets[b].budget;
+        if (b == 0) ok &= st->hits == 0 && st->misses == 0;
+        if (b == 1) ok &= st->evictions > 0 && r.badges_cached == BADGE_CNT;
+        if (b == 2) ok &= st->misses == ROOM_CNT && st->evictions == 0;   // the badges: before the switches
+    }
+
+    char json[128];
+    image_cache_stats_json(json, sizeof(json), false);
+    printf("published: %s\n", json);
+
+    printf("%s\n", ok ? "OK" : "FAILED");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,207 @@
+/*
+ * Joining of the invalidated areas before a refresh (lv_display_set_inv_join()).
+ *
+ * The invalidated areas of the dashboard over the backg_room1 background are
+ * recorded frame by frame: the clock, the temperature badge, the tiles and
+ * their combinations in the same frame (the clock at the top and the badge at
+ * the bottom). The recording is then replayed with LVGL's join of overlapping
+ * areas and with the cost model for a few overheads per area, drawn normally
+ * then as the dashboard does (static layer and occlusion culling): time per
+ * frame, areas flushed and pixels rendered (refreshed, then written by the
+ * draw tasks and the static layer copies).
+ *
+ * Every invalidated area must be inside one of the areas flushed by its frame.
+ *
+ *   bench_inv_join [--quick]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "lvgl.h"
+#include "src/core/lv_refr_private.h"      // lv_inv_area()
+#include "src/misc/lv_area_private.h"      // lv_area_is_in()
+
+#include "dashboard_ui.h"
+#include "entity_config.h"
+
+#include "sim_bsp.h"
+#include "bench_util.h"
+
+#define FB_PIXELS           (BSP_LCD_H_RES * BSP_LCD_V_RES)
+#define MAX_FRAMES          128
+#define MAX_AREAS           32      // LV_INV_BUF_SIZE
+#define CYCLES              10      // recorded rounds of the update patterns
+
+LV_IMAGE_DECLARE(backg_room1);
+
+typedef struct {
+    lv_area_t areas[MAX_AREAS];
+    uint32_t cnt;
+} Frame;
+
+static uint16_t s_layer[FB_PIXELS] __attribute__((aligned(LV_DRAW_BUF_ALIGN)));
+static Frame s_frames[MAX_FRAMES];
+static uint32_t s_frame_cnt;
+static bool s_recording;
+static lv_area_t s_flushed[MAX_AREAS];
+static uint32_t s_flushed_cnt;
+
+static void on_command(const char *topic, const char *payload)
+{
+    (void)topic;
+    (void)payload;
+}
+
+static const DashboardUiCallbacks ui_cbs = { .on_command = on_command };
+
+static void on_display_event(lv_event_t *e)
+{
+    const lv_area_t *area = lv_event_get_param(e);
+    if (lv_event_get_code(e) == LV_EVENT_INVALIDATE_AREA) {
+        Frame *f = &s_frames[s_frame_cnt];
+        if (s_recording && s_frame_cnt < MAX_FRAMES && f->cnt < MAX_AREAS) f->areas[f->cnt++] = *area;
+    } else if (s_flushed_cnt < MAX_AREAS) {
+        s_flushed[s_flushed_cnt++] = *area;
+    }
+}
+
+static size_t entity_index(EntityType type, size_t nth)
+{
+    const EntityTable *entities = entity_table_get();
+    for (size_t i = 0; i < entities->count; i++) {
+        if (entities->items[i].type == type && nth-- == 0) return i;
+    }
+    return SIZE_MAX;
+}
+
+enum { CLOCK = 1, TEMP = 2, TILE1 = 4, TILE2 = 8 };
+
+// Alone and together in the same frame, as the MQTT messages and the SNTP minute come in
+static const uint8_t s_patterns[] = {
+    CLOCK, TEMP, CLOCK | TEMP, TILE1, CLOCK | TILE1, TEMP | TILE2, CLOCK | TEMP | TILE1 | TILE2,
+};
+
+static void record(size_t sensor, size_t tile1, size_t tile2)
+{
+    s_recording = true;
+    for (uint32_t i = 0; i < CYCLES * sizeof(s_patterns) && s_frame_cnt < MAX_FRAMES; i++) {
+        uint8_t p = s_patterns[i % sizeof(s_patterns)];
+        char txt[16];
+        if (p & CLOCK) {
+            snprintf(txt, sizeof(txt), "%02u:%02u", (unsigned)(i / 60 % 24), (unsigned)(i % 60));
+            ui_set_clock(txt);
+        }
+        if (p & TEMP) {
+            int t = 150 + (int)(i * 7 % 120);
+            int len = snprintf(txt, sizeof(txt), "%d.%d", t / 10, t % 10);
+            ui_entity_set_state(sensor, txt, len);
+        }
+        const bool on = i / sizeof(s_patterns) % 2 == 0;
+        if ((p & TILE1) && tile1 != SIZE_MAX) ui_entity_set_state(tile1, on ? "ON" : "OFF", on ? 2 : 3);
+        if ((p & TILE2) && tile2 != SIZE_MAX) ui_entity_set_state(tile2, on ? "ON" : "OFF", on ? 2 : 3);
+        sim_time_skip_us(1000 * 1000);   // the theme's colour transition drawn at its end
+        lv_refr_now(NULL);
+        if (s_frames[s_frame_cnt].cnt > 0) s_frame_cnt++;
+    }
+    s_recording = false;
+}
+
+// Every invalidated area of the frame in one of the flushed areas
+static bool frame_covered(const Frame *f)
+{
+    for (uint32_t i = 0; i < f->cnt; i++) {
+        bool in = false;
+        for (uint32_t j = 0; j < s_flushed_cnt && !in; j++) in = lv_area_is_in(&f->areas[i], &s_flushed[j], 0);
+        if (!in) return false;
+    }
+    return true;
+}
+
+static double replay_us(uint32_t rounds, bool *covered)
+{
+    *covered = true;
+    uint64_t ns = 0;
+    for (uint32_t r = 0; r < rounds; r++) {
+        for (uint32_t i = 0; i < s_frame_cnt; i++) {
+            const Frame *f = &s_frames[i];
+            s_flushed_cnt = 0;
+            uint64_t t0 = bench_now_ns();
+            for (uint32_t a = 0; a < f->cnt; a++) lv_inv_area(NULL, &f->areas[a]);
+            lv_refr_now(NULL);
+            ns += bench_now_ns() - t0;
+            if (*covered && !frame_covered(f)) *covered = false;
+        }
+    }
+    return (double)ns / 1000.0 / (rounds * s_frame_cnt);
+}
+
+int main(int argc, char **argv)
+{
+    const bool quick = bench_quick(argc, argv);
+    const uint32_t rounds = quick ? 2 : 30;
+
+    lv_init();
+    bsp_display_start();
+    ui_create(entity_table_get(), &ui_cbs);
+    ui_set_background(&backg_room1);
+    const size_t sensor = entity_index(ENTITY_SENSOR, 0);
+    if (sensor == SIZE_MAX) {
+        printf("no temperature sensor\nFAILED\n");
+        return 1;
+    }
+    lv_display_t *disp = lv_display_get_default();
+    lv_display_add_event_cb(disp, on_display_event, LV_EVENT_INVALIDATE_AREA, NULL);
+    lv_display_add_event_cb(disp, on_display_event, LV_EVENT_FLUSH_START, NULL);
+    sim_time_skip_us(1000 * 1000);
+    lv_refr_now(NULL);
+
+    record(sensor, entity_index(ENTITY_SWITCH, 0), entity_index(ENTITY_SWITCH, 1));
+    uint32_t recorded = 0;
+    for (uint32_t i = 0; i < s_frame_cnt; i++) recorded += s_frames[i].cnt;
+    printf("%u frames recorded, %.2f areas invalidated per frame, replayed %u times\n", (unsigned)s_frame_cnt,
+           (double)recorded / s_frame_cnt, (unsigned)rounds);
+
+    static const struct {
+        const char *name;
+        lv_display_inv_join_t join;
+        uint32_t cost_px;
+    } modes[] = {
+        {"overlap", LV_DISPLAY_INV_JOIN_OVERLAP, 0},
+        {"cost 0 px", LV_DISPLAY_INV_JOIN_COST, 0},
+        {"cost 2000 px", LV_DISPLAY_INV_JOIN_COST, 2000},
+        {"cost 8000 px", LV_DISPLAY_INV_JOIN_COST, 8000},
+        {"cost 32000 px", LV_DISPLAY_INV_JOIN_COST, 32000},
+        {"cost 128000 px", LV_DISPLAY_INV_JOIN_COST, 128000},
+    };
+    const uint32_t mode_cnt = sizeof(modes) / sizeof(modes[0]);
+    bool ok = s_frame_cnt > 0;
+    for (int dashboard = 0; dashboard < 2; dashboard++) {
+        lv_display_set_static_layer(disp, dashboard ? s_layer : NULL, sizeof(s_layer));
+        lv_display_set_occlusion_culling(disp, dashboard);
+        lv_refr_now(NULL);
+        printf("%-16s %12s %9s %12s %12s\n", dashboard ? "static + culling" : "drawn normally", "per frame",
+               "flushes", "refreshed px", "drawn px");
+        double overlap_flushes = 0;
+        for (uint32_t m = 0; m < mode_cnt; m++) {
+            lv_display_set_inv_join(disp, modes[m].join, modes[m].cost_px);
+            lv_display_overdraw_stats_t st;
+            lv_display_get_overdraw_stats(disp, &st, true);
+
+            bool covered;
+            double us = replay_us(rounds, &covered);
+            lv_display_get_overdraw_stats(disp, &st, true);
+            const double frames = (double)rounds * s_frame_cnt;
+            const double flushes = st.flushes / frames;
+            printf("  %-14s %9.2f us %9.2f %12.0f %12.0f%s\n", modes[m].name, us, flushes, st.flushed_px / frames,
+                   st.drawn_px / frames, covered ? "" : "  AREAS MISSED");
+            ok &= covered;
+            if (m == 0) overlap_flushes = flushes;
+            else if (m == mode_cnt - 1) ok &= flushes < overlap_flushes;
+        }
+    }
+    lv_display_set_inv_join(disp, LV_DISPLAY_INV_JOIN_OVERLAP, 0);
+
+    printf("%s\n", ok ? "OK" : "FAILED");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,232 @@
+/*
+ * LVGL heap with spill pools and allocation tags (lv_mem_set_spill_pools()).
+ *
+ * The dashboard of 200 entities does not fit in the board's 64 KB LVGL heap.
+ * The spill pools take the allocations of at least 1 KB and the untagged ones
+ * (label texts, chart points) first, and any other one when the heap is full;
+ * a pool of 64 KB is taken on demand and given back when empty.
+ *
+ * 24 simulated hours of updates follow (a week without --quick): every minute
+ * the clock and a batch of state messages, every hour a popup of labels and a
+ * chart created and deleted. Per day: bytes in use in the heap and the spill
+ * pools, their fragmentation, the pools in use, their peak and the pools taken
+ * and given back; per subsystem after the creation and at the end.
+ *
+ * From the end of the first hour to the end of the run the bytes in use must
+ * not grow by more than 1 %, nor the pools in use, and the heap must pass
+ * lv_mem_test().
+ *
+ *   bench_lv_heap [--quick]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "lvgl.h"
+
+#include "entity_config.h"
+#include "dashboard_ui.h"
+#include "mqtt_dispatch.h"
+#include "state_mailbox.h"
+
+#include "sim_bsp.h"
+#include "bench_util.h"
+
+#define ENTITY_COUNT        200
+#define SPILL_POOL_SIZE     (64 * 1024)
+#define SPILL_POOL_MAX      32
+#define SPILL_MIN_SIZE      1024
+#define UPDATES_PER_MINUTE  20
+#define POPUP_LABELS        30
+#define CHART_POINTS        120
+
+static const char *const type_names[] = {"switch", "sensor", "light", "cover"};
+static const char *const tag_names[] = {"app", "objects", "styles", "draw", "cache"};
+
+typedef struct {
+    char topic[64];
+    int len;
+    int entity;
+} BenchTopic;
+
+typedef struct {
+    size_t used;
+    size_t spill_used;
+    uint32_t pools;
+} HeapSample;
+
+static BenchTopic s_topics[ENTITY_COUNT];
+
+static void on_command(const char *topic, const char *payload)
+{
+    (void)topic;
+    (void)payload;
+}
+
+static const DashboardUiCallbacks ui_cbs = { .on_command = on_command };
+
+static char *build_entity_file(void)
+{
+    size_t cap = ENTITY_COUNT * 256;
+    char *text = malloc(cap);
+    size_t n = 0;
+
+    for (int i = 0; i < ENTITY_COUNT; i++) {
+        const char *t = type_names[i % 4];
+        BenchTopic *bt = &s_topics[i];
+        bt->len = snprintf(bt->topic, sizeof(bt->topic), "home/bench/%s_%03d/state", t, i);
+        bt->entity = i;
+        if (i % 4 == ENTITY_SENSOR) {
+            n += (size_t)snprintf(text + n, cap - n, "sensor|Sensor %d|%s||%s\n", i, bt->topic, i % 8 == 1 ? "°C" : "W");
+        } else {
+            n += (size_t)snprintf(text + n, cap - n, "%s|%s %d|%s|home/bench/%s_%03d/set\n", t, t, i, bt->topic, t, i);
+        }
+    }
+    return text;
+}
+
+static int make_payload(char *buf, size_t size, const BenchTopic *bt, uint32_t seq)
+{
+    switch (bt->entity % 4) {
+    case ENTITY_SWITCH:
+    case ENTITY_LIGHT:
+        return snprintf(buf, size, "%s", (seq & 1) ? "ON" : "OFF");
+    case ENTITY_SENSOR:
+        return snprintf(buf, size, "%u.%u", 5 + seq % 30, seq % 10);
+    default:
+        return snprintf(buf, size, "%u%%", seq % 101);
+    }
+}
+
+// Details opened and closed: objects, styles, texts and chart points freed again
+static void popup_open_close(uint32_t hour)
+{
+    lv_obj_t *popup = lv_obj_create(lv_layer_top());
+    lv_obj_set_size(popup, 400, 400);
+    lv_obj_center(popup);
+    lv_obj_set_flex_flow(popup, LV_FLEX_FLOW_COLUMN);
+    lv_obj_set_style_bg_color(popup, lv_color_hex(0x202020), 0);
+    for (int i = 0; i < POPUP_LABELS; i++) {
+        lv_obj_t *label = lv_label_create(popup);
+        lv_label_set_text_fmt(label, "Sensor %d at %02u:00: %u.%u", i, (unsigned)(hour % 24), (unsigned)(hour * 7 + i) % 40,
+                              (unsigned)i % 10);
+    }
+    lv_obj_t *chart = lv_chart_create(popup);
+    lv_obj_set_size(chart, 360, 120);
+    lv_chart_set_point_count(chart, CHART_POINTS);
+    lv_chart_series_t *ser = lv_chart_add_series(chart, lv_color_hex(0x40a0ff), LV_CHART_AXIS_PRIMARY_Y);
+    for (int i = 0; i < CHART_POINTS; i++) lv_chart_set_next_value(chart, ser, (int32_t)((hour * 13 + i * 7) % 100));
+    lv_refr_now(NULL);
+    lv_obj_delete(popup);
+}
+
+static HeapSample sample(void)
+{
+    lv_mem_monitor_t main_mon, spill_mon;
+    lv_mem_monitor_heap(LV_MEM_HEAP_MAIN, &main_mon);
+    lv_mem_monitor_heap(LV_MEM_HEAP_SPILL, &spill_mon);
+    lv_mem_spill_stats_t ss;
+    lv_mem_get_spill_stats(&ss, false);
+    HeapSample s = {
+        .used = main_mon.total_size - main_mon.free_size + spill_mon.total_size - spill_mon.free_size,
+        .spill_used = spill_mon.total_size - spill_mon.free_size,
+        .pools = ss.pools,
+    };
+    return s;
+}
+
+static void print_hour(uint32_t hour)
+{
+    lv_mem_monitor_t main_mon, spill_mon;
+    lv_mem_monitor_heap(LV_MEM_HEAP_MAIN, &main_mon);
+    lv_mem_monitor_heap(LV_MEM_HEAP_SPILL, &spill_mon);
+    lv_mem_spill_stats_t ss;
+    lv_mem_get_spill_stats(&ss, true);
+    printf("%5u %10u %6u %% %10u %6u %% %6u %6u %6u\n", (unsigned)hour,
+           (unsigned)(main_mon.total_size - main_mon.free_size), main_mon.frag_pct,
+           (unsigned)(spill_mon.total_size - spill_mon.free_size), spill_mon.frag_pct, (unsigned)ss.pools,
+           (unsigned)ss.max_pools, (unsigned)(ss.added + ss.removed));
+}
+
+static void print_tags(const char *when)
+{
+    printf("%-20s %10s %10s %8s\n", when, "bytes", "spilled", "allocs");
+    for (int tag = 0; tag < LV_MEM_TAG_CNT; tag++) {
+        lv_mem_tag_stats_t ts;
+        lv_mem_get_tag_stats(tag, &ts, false);
+        printf("  %-18s %10u %10u %8u\n", tag_names[tag], (unsigned)ts.used, (unsigned)ts.spill_used, (unsigned)ts.cnt);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const bool quick = bench_quick(argc, argv);
+    const uint32_t hours = quick ? 24 : 24 * 7;
+
+    lv_init();
+    lv_mem_set_spill_pools(SPILL_POOL_SIZE, SPILL_POOL_MAX, malloc, free);
+    lv_mem_set_spill_policy(SPILL_MIN_SIZE, 1U << LV_MEM_TAG_APP);
+    bsp_display_start();
+
+    char *text = build_entity_file();
+    EntityTable table;
+    if (entity_table_parse(text, &table) != ESP_OK || table.count != ENTITY_COUNT) {
+        printf("entity table parse failed\nFAILED\n");
+        return 1;
+    }
+    ui_create(&table, &ui_cbs);
+    mqtt_dispatch_start_ui(&table);
+    mqtt_dispatch_init();
+    sim_time_skip_us(1000 * 1000);
+    lv_refr_now(NULL);
+
+    lv_mem_monitor_t mon;
+    lv_mem_monitor_heap(LV_MEM_HEAP_MAIN, &mon);
+    printf("%u entities: %u of %u bytes of the LVGL heap, %u bytes in spill pools of %u bytes\n",
+           (unsigned)table.count, (unsigned)(mon.total_size - mon.free_size), (unsigned)mon.total_size,
+           (unsigned)sample().spill_used, (unsigned)SPILL_POOL_SIZE);
+    print_tags("created");
+
+    printf("%5s %10s %8s %10s %8s %6s %6s %6s\n", "hour", "heap", "frag", "spill", "frag", "pools", "peak",
+           "churn");
+    uint32_t rng = 11;
+    uint32_t seq = 0;
+    char payload[16];
+    HeapSample first = {0};
+    uint64_t t0 = bench_now_ns();
+    for (uint32_t hour = 1; hour <= hours; hour++) {
+        for (uint32_t minute = 0; minute < 60; minute++) {
+            char clock[8];
+            snprintf(clock, sizeof(clock), "%02u:%02u", (unsigned)(hour % 24), (unsigned)minute);
+            ui_set_clock(clock);
+            for (int u = 0; u < UPDATES_PER_MINUTE; u++) {
+                const BenchTopic *bt = &s_topics[bench_rand(&rng) % ENTITY_COUNT];
+                int len = make_payload(payload, sizeof(payload), bt, seq++);
+                handle_state_msg(bt->topic, bt->len, payload, len);
+            }
+            state_mailbox_drain();
+            sim_time_skip_us(1000 * 1000);   // the transitions of the toggled tiles drawn at their end
+            lv_anim_refr_now();
+            lv_refr_now(NULL);
+        }
+        popup_open_close(hour);
+        if (hour <= 2 || hour % 24 == 0) print_hour(hour);
+        if (hour == 1) first = sample();
+    }
+    const double run_s = (double)(bench_now_ns() - t0) / 1e9;
+    HeapSample last = sample();
+    print_tags("after the run");
+
+    const double growth = first.used ? 100.0 * ((double)last.used - (double)first.used) / (double)first.used : 0.0;
+    printf("%u simulated hours in %.1f s: %u -> %u bytes in use (%+.2f %%), %u -> %u spill pools\n",
+           (unsigned)hours, run_s, (unsigned)first.used, (unsigned)last.used, growth, (unsigned)first.pools,
+           (unsigned)last.pools);
+
+    lv_mem_tag_stats_t app;
+    lv_mem_get_tag_stats(LV_MEM_TAG_APP, &app, false);
+    bool ok = lv_mem_test() == LV_RESULT_OK;
+    ok &= growth <= 1.0 && last.pools <= first.pools;
+    ok &= app.spill_used > 0 && last.spill_used > 0;
+    printf("%s\n", ok ? "OK" : "FAILED");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,212 @@
+/*
+ * Occlusion culling of the refresh (lv_display_set_occlusion_culling()) and
+ * the overdraw of the display (lv_display_get_overdraw_stats()).
+ *
+ * The dashboard over the backg_room1 background: the clock ticking minutes,
+ * the temperature badge taking new values, a tile switched now and then and
+ * the whole screen redrawn every few dozen updates. Without and with the
+ * culling, then the same over the static layer: time per update, overdraw
+ * (pixels written per pixel refreshed, over the run and its worst frame) and
+ * what the culling did not draw.
+ *
+ * The culling must not change a pixel: every update of the sequence is hashed
+ * without it as the reference. A screen of overlapping opaque, rounded,
+ * translucent, layered and clip-corner objects is compared as well.
+ *
+ *   bench_occlusion [--quick]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "lvgl.h"
+
+#include "dashboard_ui.h"
+#include "entity_config.h"
+
+#include "sim_bsp.h"
+#include "bench_util.h"
+
+#define FB_PIXELS           (BSP_LCD_H_RES * BSP_LCD_V_RES)
+#define MAX_UPDATES         2000
+#define FULL_EVERY          50      // updates between whole screen redraws
+#define TILE_EVERY          7       // updates between tile switches
+
+LV_IMAGE_DECLARE(backg_room1);
+
+static uint16_t s_layer[FB_PIXELS] __attribute__((aligned(LV_DRAW_BUF_ALIGN)));
+static uint16_t s_reference[FB_PIXELS];
+static uint64_t s_hashes[MAX_UPDATES];
+
+static void on_command(const char *topic, const char *payload)
+{
+    (void)topic;
+    (void)payload;
+}
+
+static const DashboardUiCallbacks ui_cbs = { .on_command = on_command };
+
+static uint64_t fb_hash(void)
+{
+    const uint8_t *p = (const uint8_t *)sim_bsp_framebuffer();
+    uint64_t h = 0xcbf29ce484222325ULL;
+    for (size_t i = 0; i < FB_PIXELS * 2; i++) h = (h ^ p[i]) * 0x100000001b3ULL;
+    return h;
+}
+
+static size_t entity_index(EntityType type)
+{
+    const EntityTable *entities = entity_table_get();
+    for (size_t i = 0; i < entities->count; i++) {
+        if (entities->items[i].type == type) return i;
+    }
+    return SIZE_MAX;
+}
+
+static double overdraw(const lv_display_overdraw_stats_t *st)
+{
+    return st->flushed_px ? (double)st->drawn_px / (double)st->flushed_px : 0.0;
+}
+
+// Clock minutes and temperatures in tenths, a tile switched, the whole screen redrawn
+static double updates_us(size_t sensor, size_t tile, uint32_t updates, bool reference, bool *same)
+{
+    *same = true;
+    uint64_t ns = 0;
+    for (uint32_t i = 0; i < updates; i++) {
+        uint64_t t0 = bench_now_ns();
+        char txt[16];
+        if (i % FULL_EVERY == FULL_EVERY - 1) {
+            lv_obj_invalidate(lv_screen_active());
+        } else if (tile != SIZE_MAX && i % TILE_EVERY == TILE_EVERY - 1) {
+            ui_entity_set_state(tile, i / TILE_EVERY % 2 ? "OFF" : "ON", i / TILE_EVERY % 2 ? 3 : 2);
+            sim_time_skip_us(1000 * 1000);   // the theme's colour transition drawn at its end
+        } else if (i % 2 == 0) {
+            snprintf(txt, sizeof(txt), "%02u:%02u", (unsigned)(i / 120 % 24), (unsigned)(i / 2 % 60));
+            ui_set_clock(txt);
+        } else {
+            int t = 150 + (int)(i * 7 % 120);
+            int len = snprintf(txt, sizeof(txt), "%d.%d", t / 10, t % 10);
+            ui_entity_set_state(sensor, txt, len);
+        }
+        lv_refr_now(NULL);
+        ns += bench_now_ns() - t0;
+        if (reference) s_hashes[i] = fb_hash();
+        else if (*same && s_hashes[i] != fb_hash()) *same = false;
+    }
+    return (double)ns / 1000.0 / updates;
+}
+
+static lv_obj_t *add_rect(lv_obj_t *parent, int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color)
+{
+    lv_obj_t *obj = lv_obj_create(parent);
+    lv_obj_remove_style_all(obj);
+    lv_obj_set_pos(obj, x, y);
+    lv_obj_set_size(obj, w, h);
+    lv_obj_set_style_bg_color(obj, lv_color_hex(color), 0);
+    lv_obj_set_style_bg_opa(obj, LV_OPA_COVER, 0);
+    return obj;
+}
+
+// Opaque objects hiding others whole, in parts, and the ones which must not hide anything
+static bool check_objects(void)
+{
+    lv_obj_t *scr = lv_obj_create(NULL);
+    lv_obj_set_style_bg_color(scr, lv_color_hex(0x203040), 0);
+
+    lv_obj_t *label = lv_label_create(scr);
+    lv_obj_set_pos(label, 20, 20);
+    lv_label_set_text(label, "hidden 12:34");
+    add_rect(scr, 0, 0, BSP_LCD_H_RES, 60, 0x405060);                   // hides the label
+    lv_obj_t *band = add_rect(scr, 0, 50, BSP_LCD_H_RES / 2, 40, 0x806040);
+    lv_obj_set_style_radius(band, 12, 0);                                // rounded: only its middle hides
+    add_rect(scr, 100, 40, 40, 200, 0x608040);                          // cuts the band and the screen
+    lv_obj_t *glass = add_rect(scr, 60, 120, 200, 60, 0xF0F0F0);
+    lv_obj_set_style_bg_opa(glass, LV_OPA_50, 0);                        // translucent: hides nothing
+    lv_obj_t *layered = add_rect(scr, 80, 110, 160, 80, 0x2060C0);
+    lv_obj_set_style_opa_layered(layered, LV_OPA_70, 0);                 // in a layer: hides nothing
+    lv_obj_t *card = add_rect(scr, 240, 200, 200, 160, 0xC0C0C0);
+    lv_obj_set_style_radius(card, 30, 0);
+    lv_obj_set_style_clip_corner(card, true, 0);
+    add_rect(card, -10, -10, 120, 120, 0x104080);                       // under the clip corner
+    lv_obj_t *arc = lv_arc_create(scr);
+    lv_obj_set_pos(arc, 20, 300);
+    lv_obj_set_size(arc, 100, 100);
+    lv_arc_set_value(arc, 60);
+    lv_obj_t *cover = add_rect(scr, 40, 320, 60, 60, 0x000000);
+    lv_obj_set_style_border_width(cover, 4, 0);
+    lv_obj_set_style_border_color(cover, lv_color_hex(0xFFFF00), 0);
+    lv_screen_load(scr);
+
+    lv_display_set_occlusion_culling(NULL, false);
+    lv_obj_invalidate(scr);
+    lv_refr_now(NULL);
+    memcpy(s_reference, sim_bsp_framebuffer(), sizeof(s_reference));
+
+    lv_display_set_occlusion_culling(NULL, true);
+    lv_display_overdraw_stats_t st;
+    lv_display_get_overdraw_stats(NULL, &st, true);
+    lv_obj_invalidate(scr);
+    lv_refr_now(NULL);
+    lv_display_get_overdraw_stats(NULL, &st, true);
+    bool ok = memcmp(sim_bsp_framebuffer(), s_reference, sizeof(s_reference)) == 0;
+    printf("object check: overdraw %.2f, %u objects culled, %u hidden: %s\n", overdraw(&st),
+           (unsigned)st.culled_objs, (unsigned)st.hidden_objs, ok ? "same pixels" : "PIXELS DIFFER");
+    ok &= st.culled_objs > 0 && st.hidden_objs > 0;
+
+    lv_display_set_occlusion_culling(NULL, false);
+    lv_screen_load(lv_obj_create(NULL));
+    lv_obj_delete(scr);
+    return ok;
+}
+
+int main(int argc, char **argv)
+{
+    const bool quick = bench_quick(argc, argv);
+    const uint32_t updates = quick ? 200 : MAX_UPDATES;
+
+    lv_init();
+    bsp_display_start();
+    lv_obj_t *dashboard = lv_screen_active();
+    ui_create(entity_table_get(), &ui_cbs);
+    ui_set_background(&backg_room1);
+    const size_t sensor = entity_index(ENTITY_SENSOR);
+    const size_t tile = entity_index(ENTITY_SWITCH);
+    if (sensor == SIZE_MAX) {
+        printf("no temperature sensor\nFAILED\n");
+        return 1;
+    }
+
+    bool ok = check_objects();
+    lv_screen_load(dashboard);
+
+    printf("%u updates: clock, temperature, a tile every %d, the whole screen every %d\n", (unsigned)updates,
+           TILE_EVERY, FULL_EVERY);
+    printf("%-24s %12s %9s %9s %9s %9s\n", "", "per update", "overdraw", "peak", "culled", "hidden");
+    const char *names[] = {"no culling", "culling", "static layer", "static layer + culling"};
+    double overdraws[4];
+    for (int c = 0; c < 4; c++) {
+        lv_display_set_static_layer(NULL, c >= 2 ? s_layer : NULL, sizeof(s_layer));
+        lv_display_set_occlusion_culling(NULL, c % 2 == 1);
+        ui_set_clock("--:--");
+        ui_entity_set_state(sensor, "--.-", 4);
+        if (tile != SIZE_MAX) ui_entity_set_state(tile, "OFF", 3);
+        sim_time_skip_us(1000 * 1000);
+        lv_refr_now(NULL);
+        lv_display_overdraw_stats_t st;
+        lv_display_get_overdraw_stats(NULL, &st, true);
+
+        bool same;
+        double us = updates_us(sensor, tile, updates, c == 0, &same);
+        lv_display_get_overdraw_stats(NULL, &st, true);
+        overdraws[c] = overdraw(&st);
+        printf("%-24s %9.2f us %9.2f %9.2f %9u %9u%s\n", names[c], us, overdraws[c], st.peak_x100 / 100.0,
+               (unsigned)st.culled_objs, (unsigned)st.hidden_objs, same ? "" : "  PIXELS DIFFER");
+        ok &= same;
+        if (c % 2 == 0) ok &= st.culled_objs == 0;
+        else ok &= st.culled_objs > 0 && overdraws[c] < overdraws[c - 1];
+    }
+
+    printf("%s\n", ok ? "OK" : "FAILED");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,294 @@
+/*
+ * Screens built in a memory arena (lv_mem_arena_create(), lv_mem_set_arena()).
+ *
+ * Pages of 8, 12 and 16 tiles (a button with local and shared styles, two
+ * event callbacks and three labels each) are built, loaded, drawn, given new values
+ * and deleted in turn, with a status label of the base screen taking a text of
+ * another length while each page is shown. First every allocation in the LVGL
+ * heap, then the objects, their attributes, local styles and event descriptors
+ * of each page in an arena released right after the build: the page's last
+ * lv_free() gives its region back.
+ *
+ * Per mode: build and teardown time of a page, heap blocks freed by a
+ * teardown, peak bytes in the LVGL heap (spill pools included) above the base
+ * screen, bytes taken from the arena, and the fragmentation and biggest free
+ * block of the 64 KB heap after the last page.
+ *
+ * The arena must not change a pixel of the pages, nor fall back to the heap;
+ * the heap must come back to the base screen's bytes in both modes, every
+ * arena must be freed with its page, and the heap must pass lv_mem_test().
+ * As in ui_create() the shared styles are first set while the warm-up page is
+ * built in an arena: their properties must stay out of it.
+ *
+ *   bench_screen_arena [--quick]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "lvgl.h"
+
+#include "sim_bsp.h"
+#include "bench_util.h"
+
+#define FB_PIXELS           (BSP_LCD_H_RES * BSP_LCD_V_RES)
+#define PAGE_KINDS          3
+#define ARENA_SIZE          (32 * 1024)
+#define UPDATES_PER_PAGE    6
+#define SPILL_POOL_SIZE     (64 * 1024)
+#define SPILL_POOL_MAX      4
+
+typedef struct {
+    uint64_t build_ns;
+    uint64_t teardown_ns;
+    uint64_t heap_frees;
+    size_t heap_peak;
+    size_t arena_peak;
+    uint32_t fallbacks;
+    uint8_t frag_pct;
+    size_t biggest;
+    size_t leaked;
+} ModeResult;
+
+static uint64_t s_hashes[PAGE_KINDS];
+static lv_obj_t *s_values[16];
+static uint32_t s_clicks;
+static uint32_t s_arena_frees;
+static lv_style_t s_style_tile;
+static lv_style_t s_style_name;
+static bool s_styles_ready;
+
+static void arena_free(void *p)
+{
+    s_arena_frees++;
+    free(p);
+}
+
+static void init_styles_once(void)
+{
+    if (s_styles_ready) return;
+    s_styles_ready = true;
+    lv_style_init(&s_style_tile);
+    lv_style_set_radius(&s_style_tile, 12);
+    lv_style_set_pad_all(&s_style_tile, 8);
+    lv_style_set_shadow_width(&s_style_tile, 0);
+    lv_style_init(&s_style_name);
+    lv_style_set_text_color(&s_style_name, lv_color_hex(0xc0c8d0));
+}
+
+static uint64_t fb_hash(void)
+{
+    const uint8_t *p = (const uint8_t *)sim_bsp_framebuffer();
+    uint64_t h = 0xcbf29ce484222325ULL;
+    for (size_t i = 0; i < FB_PIXELS * 2; i++) h = (h ^ p[i]) * 0x100000001b3ULL;
+    return h;
+}
+
+static void on_tile(lv_event_t *e)
+{
+    (void)e;
+    s_clicks++;
+}
+
+static lv_obj_t *build_page(int kind)
+{
+    const int tiles = 8 + 4 * kind;
+    init_styles_once();
+    lv_obj_t *scr = lv_obj_create(NULL);
+    lv_obj_set_style_bg_color(scr, lv_color_hex(0x101418), 0);
+
+    lv_obj_t *title = lv_label_create(scr);
+    lv_label_set_text_fmt(title, "Room %d", kind + 1);
+    lv_obj_set_style_text_color(title, lv_color_white(), 0);
+    lv_obj_align(title, LV_ALIGN_TOP_MID, 0, 12);
+
+    lv_obj_t *grid = lv_obj_create(scr);
+    lv_obj_set_size(grid, BSP_LCD_H_RES, BSP_LCD_V_RES - 50);
+    lv_obj_align(grid, LV_ALIGN_BOTTOM_MID, 0, 0);
+    lv_obj_set_flex_flow(grid, LV_FLEX_FLOW_ROW_WRAP);
+    lv_obj_set_style_bg_opa(grid, LV_OPA_TRANSP, 0);
+    lv_obj_set_style_border_width(grid, 0, 0);
+    lv_obj_set_style_pad_all(grid, 12, 0);
+    lv_obj_set_style_pad_gap(grid, 12, 0);
+
+    for (int i = 0; i < tiles; i++) {
+        lv_obj_t *tile = lv_button_create(grid);
+        lv_obj_set_size(tile, 104, 90);
+        lv_obj_set_style_bg_color(tile, lv_color_hex(i % 3 ? 0x2a3440 : 0xff9800), 0);
+        lv_obj_add_style(tile, &s_style_tile, 0);
+        lv_obj_add_event_cb(tile, on_tile, LV_EVENT_CLICKED, (void *)(uintptr_t)i);
+        lv_obj_add_event_cb(tile, on_tile, LV_EVENT_LONG_PRESSED, (void *)(uintptr_t)i);
+
+        lv_obj_t *icon = lv_label_create(tile);
+        lv_label_set_text(icon, LV_SYMBOL_POWER);
+        lv_obj_align(icon, LV_ALIGN_TOP_LEFT, 0, 0);
+
+        lv_obj_t *name = lv_label_create(tile);
+        lv_label_set_text_fmt(name, "Light %d", i + 1);
+        lv_obj_add_style(name, &s_style_name, 0);
+        lv_obj_align(name, LV_ALIGN_BOTTOM_LEFT, 0, 0);
+
+        s_values[i] = lv_label_create(tile);
+        lv_label_set_text_fmt(s_values[i], "%d %%", (i * 17) % 101);
+        lv_obj_align(s_values[i], LV_ALIGN_TOP_RIGHT, 0, 0);
+    }
+    return scr;
+}
+
+static size_t heap_used(void)
+{
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    return mon.total_size - mon.free_size;
+}
+
+static size_t heap_blocks(void)
+{
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    return mon.used_cnt;
+}
+
+static bool run_mode(bool use_arena, lv_obj_t *base, lv_obj_t *status, uint32_t pages, ModeResult *r)
+{
+    bool ok = true;
+    uint32_t rng = 5;
+    char text[48];
+    memset(r, 0, sizeof(*r));
+    lv_label_set_text(status, "Home");
+    const size_t baseline = heap_used();
+
+    for (uint32_t p = 0; p < pages; p++) {
+        const int kind = (int)(p % PAGE_KINDS);
+
+        uint64_t t0 = bench_now_ns();
+        lv_mem_arena_t *arena = use_arena ? lv_mem_arena_create(ARENA_SIZE, malloc, arena_free) : NULL;
+        lv_mem_arena_t *prev = lv_mem_set_arena(arena);
+        lv_obj_t *scr = build_page(kind);
+        lv_mem_set_arena(prev);
+        if (arena) {
+            lv_mem_arena_stats_t as;
+            lv_mem_arena_get_stats(arena, &as);
+            if (as.max_used > r->arena_peak) r->arena_peak = as.max_used;
+            r->fallbacks += as.fallbacks;
+            lv_mem_arena_release(arena);
+        } else if (use_arena) {
+            printf("no arena for page %u\n", (unsigned)p);
+            ok = false;
+        }
+        r->build_ns += bench_now_ns() - t0;
+
+        lv_screen_load(scr);
+        lv_refr_now(NULL);
+        if (p < PAGE_KINDS) {
+            if (!use_arena) s_hashes[kind] = fb_hash();
+            else if (s_hashes[kind] != fb_hash()) {
+                printf("page %d differs with the arena\n", kind);
+                ok = false;
+            }
+        }
+
+        // Values of the page and a status text outliving it, both in the heap
+        const int tiles = 8 + 4 * kind;
+        for (int u = 0; u < UPDATES_PER_PAGE; u++) {
+            uint32_t v = bench_rand(&rng);
+            lv_label_set_text_fmt(s_values[v % tiles], "%u %%", (unsigned)(v % 101));
+        }
+        snprintf(text, sizeof(text), "Room %d: %.*s", kind + 1, (int)(bench_rand(&rng) % 24), "updated a moment ago...");
+        lv_label_set_text(status, text);
+        size_t used = heap_used() - baseline;
+        if (used > r->heap_peak) r->heap_peak = used;
+
+        lv_screen_load(base);
+        const size_t blocks = heap_blocks();
+        const uint32_t arena_frees = s_arena_frees;
+        t0 = bench_now_ns();
+        lv_obj_delete(scr);
+        r->teardown_ns += bench_now_ns() - t0;
+        r->heap_frees += blocks - heap_blocks();
+        if (arena && s_arena_frees != arena_frees + 1) {
+            printf("arena of page %u not freed with it\n", (unsigned)p);
+            ok = false;
+        }
+    }
+
+    lv_mem_monitor_t mon;
+    lv_mem_monitor_heap(LV_MEM_HEAP_MAIN, &mon);
+    r->frag_pct = mon.frag_pct;
+    r->biggest = mon.free_biggest_size;
+    lv_label_set_text(status, "Home");
+    r->leaked = heap_used() - baseline;
+    return ok;
+}
+
+int main(int argc, char **argv)
+{
+    const bool quick = bench_quick(argc, argv);
+    const uint32_t pages = quick ? 60 : 600;
+
+    lv_init();
+    // Heap overflow to spill pools as on the device: the draw threads' buffers do not fail
+    // while a page is drawn next to the previous one's free blocks
+    lv_mem_set_spill_pools(SPILL_POOL_SIZE, SPILL_POOL_MAX, malloc, free);
+    bsp_display_start();
+    lv_obj_t *base = lv_screen_active();
+    lv_obj_t *status = lv_label_create(base);
+    lv_obj_align(status, LV_ALIGN_TOP_MID, 0, 12);
+    lv_refr_now(NULL);
+
+    // Once untimed: what the first page leaves for good (glyphs in the cache, the shared styles'
+    // properties...) is in the baseline. Built in an arena as the dashboard is
+    lv_mem_arena_t *arena = lv_mem_arena_create(ARENA_SIZE, malloc, arena_free);
+    lv_mem_arena_t *prev = lv_mem_set_arena(arena);
+    lv_obj_t *warmup = build_page(PAGE_KINDS - 1);
+    lv_mem_set_arena(prev);
+    lv_mem_arena_release(arena);
+    lv_screen_load(warmup);
+    lv_refr_now(NULL);
+    lv_screen_load(base);
+    lv_obj_delete(warmup);
+    lv_refr_now(NULL);
+    bool ok = s_arena_frees == 1;
+    if (!ok) printf("shared styles kept the warm-up page's arena\n");
+
+    ModeResult res[2];
+    ok &= run_mode(false, base, status, pages, &res[0]);
+    ok &= run_mode(true, base, status, pages, &res[1]);
+
+    printf("%u pages of 8, 12 and 16 tiles, built, drawn, updated and deleted; arena of %u bytes\n", (unsigned)pages,
+           (unsigned)ARENA_SIZE);
+    printf("%-8s %10s %10s %10s %10s %10s %6s %8s\n", "", "build", "teardown", "heap frees", "heap peak", "arena",
+           "frag", "biggest");
+    const char *names[] = {"heap", "arena"};
+    for (int m = 0; m < 2; m++) {
+        const ModeResult *r = &res[m];
+        printf("%-8s %7.1f us %7.1f us %10.1f %10u %10u %4u %% %8u\n", names[m], r->build_ns / 1e3 / pages,
+               r->teardown_ns / 1e3 / pages, (double)r->heap_frees / pages, (unsigned)r->heap_peak,
+               (unsigned)r->arena_peak, r->frag_pct, (unsigned)r->biggest);
+        if (r->leaked) {
+            printf("%s: %u bytes left in the heap\n", names[m], (unsigned)r->leaked);
+            ok = false;
+        }
+    }
+    if (res[1].fallbacks) {
+        printf("%u allocations did not fit in the arena\n", (unsigned)res[1].fallbacks);
+        ok = false;
+    }
+
+    // Every page gave its region back: all the slots are free again
+    lv_mem_arena_t *arenas[LV_MEM_ARENA_CNT];
+    for (int i = 0; i < LV_MEM_ARENA_CNT; i++) {
+        arenas[i] = lv_mem_arena_create(ARENA_SIZE, malloc, free);
+        if (arenas[i] == NULL) {
+            printf("arena %d still in use\n", i);
+            ok = false;
+        }
+    }
+    for (int i = 0; i < LV_MEM_ARENA_CNT; i++) {
+        if (arenas[i]) lv_mem_arena_release(arenas[i]);
+    }
+
+    ok &= lv_mem_test() == LV_RESULT_OK && res[1].heap_frees < res[0].heap_frees;
+    printf("%s\n", ok ? "OK" : "FAILED");
+    return ok ? 0 : 1;
+}
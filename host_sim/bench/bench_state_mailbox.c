@@ -0,0 +1,111 @@
+/*
+ * State mailbox: producer/consumer stress and coalescing check.
+ *
+ * A producer thread (the MQTT task) posts numbered values to a few slots while
+ * a consumer thread (the LVGL task) drains at a fixed frame period. At the end:
+ *   - every slot shows the last value posted to it,
+ *   - received == applied + coalesced,
+ *   - values are applied in posting order (never an older one after a newer one).
+ * Also reports post/drain cost.
+ */
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "state_mailbox.h"
+
+#include "bench_util.h"
+
+#define SLOTS 48
+
+static uint32_t s_last_applied[SLOTS];
+static bool s_order_ok = true;
+static atomic_bool s_done;
+static uint32_t s_frames;
+static uint32_t s_frame_us;
+
+static void apply(int slot, const char *value, int len)
+{
+    char buf[STATE_MAILBOX_VALUE_MAX + 1];
+    memcpy(buf, value, len);
+    buf[len] = 0;
+
+    uint32_t v = (uint32_t)strtoul(buf, NULL, 10);
+    if (v <= s_last_applied[slot] && s_last_applied[slot] != 0) s_order_ok = false;
+    s_last_applied[slot] = v;
+}
+
+static void *consumer(void *arg)
+{
+    (void)arg;
+    struct timespec frame = {0, (long)s_frame_us * 1000L};
+    while (!atomic_load(&s_done)) {
+        state_mailbox_drain();
+        s_frames++;
+        nanosleep(&frame, NULL);
+    }
+    return NULL;
+}
+
+int main(int argc, char **argv)
+{
+    const bool quick = bench_quick(argc, argv);
+    const uint32_t posts = quick ? 200000 : 5000000;
+    s_frame_us = quick ? 1000 : 16000;
+    bool ok = true;
+
+    if (state_mailbox_init(SLOTS, apply) != ESP_OK) return 1;
+
+    uint32_t last_posted[SLOTS] = {0};
+    pthread_t th;
+    pthread_create(&th, NULL, consumer, NULL);
+
+    uint32_t rng = 1;
+    uint64_t t0 = bench_now_ns();
+    for (uint32_t i = 1; i <= posts; i++) {
+        // Skewed towards a few hot entities (temperature / power sensors)
+        uint32_t r = bench_rand(&rng);
+        int slot = (r & 3) ? (int)(r >> 8) % 4 : (int)(r >> 8) % SLOTS;
+        char buf[16];
+        int len = snprintf(buf, sizeof(buf), "%u", i);
+        state_mailbox_post(slot, buf, len);
+        last_posted[slot] = i;
+    }
+    double post_ns = (double)(bench_now_ns() - t0) / posts;
+
+    atomic_store(&s_done, true);
+    pthread_join(th, NULL);
+
+    // Final frame picks up whatever the last drain missed
+    t0 = bench_now_ns();
+    uint32_t final_applied = state_mailbox_drain();
+    double drain_ns = (double)(bench_now_ns() - t0);
+
+    StateMailboxStats st;
+    state_mailbox_get_stats(&st);
+
+    for (int s = 0; s < SLOTS; s++) {
+        if (last_posted[s] != s_last_applied[s]) {
+            fprintf(stderr, "slot %d: last posted %u, last applied %u\n", s, last_posted[s], s_last_applied[s]);
+            ok = false;
+        }
+    }
+    if (st.received != posts || st.received != st.applied + st.coalesced) {
+        fprintf(stderr, "counters inconsistent: received=%u applied=%u coalesced=%u\n",
+                st.received, st.applied, st.coalesced);
+        ok = false;
+    }
+    if (!s_order_ok) {
+        fprintf(stderr, "an older value was applied after a newer one\n");
+        ok = false;
+    }
+
+    printf("posts %u over %u frames: received=%u coalesced=%u applied=%u (%.1f%% coalesced)\n",
+           posts, s_frames, st.received, st.coalesced, st.applied, 100.0 * st.coalesced / st.received);
+    printf("post %.1f ns, final drain %u slots in %.0f ns\n", post_ns, final_applied, drain_ns);
+    printf("%s\n", ok ? "OK" : "FAILED");
+    return ok ? 0 : 1;
+}
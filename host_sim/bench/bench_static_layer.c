@@ -0,0 +1,211 @@
+/*
+ * Static layer of the display (lv_display_set_static_layer(), lv_obj_set_static()).
+ *
+ * The dashboard over the backg_room1 background: the clock ticking minutes,
+ * the temperature badge taking new values, a tile switched now and then and
+ * the room background replaced by another one every few dozen updates (the
+ * static layer rendered again). Without the static layer, then with it: time
+ * per update, areas drawn over the copy and pixels rendered into the layer.
+ *
+ * The static layer must not change a pixel: every update of the sequence is
+ * hashed without it as the reference. A screen where a static object covers
+ * a dynamic one must be drawn normally (counted as a fallback), with the same
+ * pixels as well.
+ *
+ *   bench_static_layer [--quick]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "lvgl.h"
+
+#include "dashboard_ui.h"
+#include "entity_config.h"
+
+#include "sim_bsp.h"
+#include "bench_util.h"
+
+#define FB_PIXELS           (BSP_LCD_H_RES * BSP_LCD_V_RES)
+#define MAX_UPDATES         2000
+#define ROOM_EVERY          50      // updates between background switches
+#define TILE_EVERY          7       // updates between tile switches
+
+LV_IMAGE_DECLARE(backg_room1);
+
+static uint16_t s_layer[FB_PIXELS] __attribute__((aligned(LV_DRAW_BUF_ALIGN)));
+static uint16_t s_reference[FB_PIXELS];
+static uint64_t s_hashes[MAX_UPDATES];
+static lv_image_dsc_t s_room2;
+
+static void on_command(const char *topic, const char *payload)
+{
+    (void)topic;
+    (void)payload;
+}
+
+static const DashboardUiCallbacks ui_cbs = { .on_command = on_command };
+
+static uint64_t fb_hash(void)
+{
+    const uint8_t *p = (const uint8_t *)sim_bsp_framebuffer();
+    uint64_t h = 0xcbf29ce484222325ULL;
+    for (size_t i = 0; i < FB_PIXELS * 2; i++) h = (h ^ p[i]) * 0x100000001b3ULL;
+    return h;
+}
+
+static size_t entity_index(EntityType type)
+{
+    const EntityTable *entities = entity_table_get();
+    for (size_t i = 0; i < entities->count; i++) {
+        if (entities->items[i].type == type) return i;
+    }
+    return SIZE_MAX;
+}
+
+// A second room: backg_room1 with its colours inverted
+static bool create_room2(void)
+{
+    uint16_t *px = malloc(backg_room1.data_size);
+    if (!px) return false;
+    const uint16_t *src = (const uint16_t *)backg_room1.data;
+    for (uint32_t i = 0; i < backg_room1.data_size / 2; i++) px[i] = (uint16_t)~src[i];
+    s_room2 = backg_room1;
+    s_room2.data = (const uint8_t *)px;
+    return true;
+}
+
+static void set_static_layer(bool on)
+{
+    lv_display_set_static_layer(NULL, on ? s_layer : NULL, sizeof(s_layer));
+}
+
+// Clock minutes and temperatures in tenths, a tile switched, the room replaced
+static double updates_us(size_t sensor, size_t tile, uint32_t updates, bool reference, bool *same)
+{
+    *same = true;
+    uint64_t ns = 0;
+    for (uint32_t i = 0; i < updates; i++) {
+        uint64_t t0 = bench_now_ns();
+        char txt[16];
+        if (i % ROOM_EVERY == ROOM_EVERY - 1) {
+            ui_set_background(i / ROOM_EVERY % 2 ? &backg_room1 : &s_room2);
+        } else if (tile != SIZE_MAX && i % TILE_EVERY == TILE_EVERY - 1) {
+            ui_entity_set_state(tile, i / TILE_EVERY % 2 ? "OFF" : "ON", i / TILE_EVERY % 2 ? 3 : 2);
+            sim_time_skip_us(1000 * 1000);   // the theme's colour transition drawn at its end
+        } else if (i % 2 == 0) {
+            snprintf(txt, sizeof(txt), "%02u:%02u", (unsigned)(i / 120 % 24), (unsigned)(i / 2 % 60));
+            ui_set_clock(txt);
+        } else {
+            int t = 150 + (int)(i * 7 % 120);
+            int len = snprintf(txt, sizeof(txt), "%d.%d", t / 10, t % 10);
+            ui_entity_set_state(sensor, txt, len);
+        }
+        lv_refr_now(NULL);
+        ns += bench_now_ns() - t0;
+        if (reference) s_hashes[i] = fb_hash();
+        else if (*same && s_hashes[i] != fb_hash()) *same = false;
+    }
+    return (double)ns / 1000.0 / updates;
+}
+
+// A static badge over a dynamic label, a static icon in a dynamic tile: the static layer cannot be under both
+static bool check_order(void)
+{
+    lv_obj_t *scr = lv_obj_create(NULL);
+    lv_obj_set_style_bg_color(scr, lv_color_hex(0x203040), 0);
+    lv_obj_set_static(scr, true);
+
+    lv_obj_t *label = lv_label_create(scr);
+    lv_obj_set_pos(label, 20, 20);
+    lv_label_set_text(label, "12:34");
+
+    lv_obj_t *over = lv_obj_create(scr);
+    lv_obj_set_pos(over, 30, 24);
+    lv_obj_set_size(over, 80, 40);
+    lv_obj_set_style_bg_opa(over, LV_OPA_50, 0);
+    lv_obj_set_static(over, true);
+
+    lv_obj_t *tile = lv_obj_create(scr);
+    lv_obj_set_pos(tile, 150, 100);
+    lv_obj_set_size(tile, 120, 120);
+    lv_obj_t *icon = lv_obj_create(tile);
+    lv_obj_set_size(icon, 40, 40);
+    lv_obj_set_style_radius(icon, 20, 0);
+    lv_obj_set_static(icon, true);
+    lv_screen_load(scr);
+
+    set_static_layer(false);
+    lv_label_set_text(label, "23:45");
+    lv_obj_set_style_bg_color(tile, lv_color_hex(0x806040), 0);
+    lv_refr_now(NULL);
+    memcpy(s_reference, sim_bsp_framebuffer(), sizeof(s_reference));
+
+    lv_label_set_text(label, "12:34");
+    lv_obj_set_style_bg_color(tile, lv_color_hex(0xFFFFFF), 0);
+    set_static_layer(true);
+    lv_refr_now(NULL);
+    lv_display_static_layer_stats_t st;
+    lv_display_get_static_layer_stats(NULL, &st, true);
+
+    lv_label_set_text(label, "23:45");
+    lv_obj_set_style_bg_color(tile, lv_color_hex(0x806040), 0);
+    lv_refr_now(NULL);
+    lv_display_get_static_layer_stats(NULL, &st, true);
+    bool ok = memcmp(sim_bsp_framebuffer(), s_reference, sizeof(s_reference)) == 0;
+    printf("order check: %u composited, %u drawn again: %s\n", (unsigned)st.composited, (unsigned)st.fallbacks,
+           ok ? "same pixels" : "PIXELS DIFFER");
+    ok &= st.fallbacks >= 2;
+
+    lv_screen_load(lv_obj_create(NULL));
+    lv_obj_delete(scr);
+    return ok;
+}
+
+int main(int argc, char **argv)
+{
+    const bool quick = bench_quick(argc, argv);
+    const uint32_t updates = quick ? 200 : MAX_UPDATES;
+
+    lv_init();
+    bsp_display_start();
+    lv_obj_t *dashboard = lv_screen_active();
+    ui_create(entity_table_get(), &ui_cbs);
+    const size_t sensor = entity_index(ENTITY_SENSOR);
+    const size_t tile = entity_index(ENTITY_SWITCH);
+    if (sensor == SIZE_MAX || !create_room2()) {
+        printf("no temperature sensor or no memory\nFAILED\n");
+        return 1;
+    }
+
+    bool ok = check_order();
+    lv_screen_load(dashboard);
+
+    printf("%u updates: clock, temperature, a tile every %d, the room every %d\n", (unsigned)updates,
+           TILE_EVERY, ROOM_EVERY);
+    printf("%-14s %12s %11s %9s %9s %12s\n", "", "per update", "composited", "again", "renders", "rendered px");
+    const char *names[] = {"no layer", "static layer"};
+    for (int c = 0; c < 2; c++) {
+        set_static_layer(c == 1);
+        ui_set_background(&backg_room1);
+        ui_set_clock("--:--");
+        ui_entity_set_state(sensor, "--.-", 4);
+        if (tile != SIZE_MAX) ui_entity_set_state(tile, "OFF", 3);
+        sim_time_skip_us(1000 * 1000);
+        lv_refr_now(NULL);
+        lv_display_static_layer_stats_t st;
+        lv_display_get_static_layer_stats(NULL, &st, true);
+
+        bool same;
+        double us = updates_us(sensor, tile, updates, c == 0, &same);
+        lv_display_get_static_layer_stats(NULL, &st, true);
+        printf("%-14s %9.2f us %11u %9u %9u %12u%s\n", names[c], us, (unsigned)st.composited,
+               (unsigned)st.fallbacks, (unsigned)st.renders, (unsigned)st.rendered_px, same ? "" : "  PIXELS DIFFER");
+        ok &= same;
+        if (c == 0) ok &= st.composited == 0 && st.renders == 0;
+        else ok &= st.composited > 0 && st.fallbacks == 0 && st.renders >= updates / ROOM_EVERY;   // the dashboard's order holds
+    }
+
+    printf("%s\n", ok ? "OK" : "FAILED");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,150 @@
+/*
+ * MQTT topic dispatch cost vs number of registered topics.
+ *
+ * Compares topic_registry_dispatch() on the raw (topic, topic_len) slice with
+ * the previous path: copy the topic into a stack buffer to NUL-terminate it,
+ * then walk a strcmp chain. 90 % of the messages hit a registered topic.
+ * A topic registered by two entities must reach both handlers.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "topic_registry.h"
+
+#include "bench_util.h"
+
+#define MAX_TOPICS   500
+#define MSG_COUNT    1024
+#define MISS_PERCENT 10
+
+typedef struct {
+    const char *topic;      // points into s_wire, not NUL-terminated
+    int topic_len;
+    int expected;           // index of the registered topic, -1 for a miss
+} Msg;
+
+static char s_topics[MAX_TOPICS][48];
+static const char *s_topic_ptr[MAX_TOPICS];
+static char s_wire[MSG_COUNT * 64];
+static Msg s_msgs[MSG_COUNT];
+static uint32_t s_hits[MAX_TOPICS];
+static volatile uint32_t s_sink;
+
+static void on_topic(const char *data, int len, void *ctx)
+{
+    s_hits[(uintptr_t)ctx]++;
+    s_sink += (uint32_t)len + (uint8_t)data[0];
+}
+
+// ---------------- Previous implementation ----------------
+static void strcmp_chain_dispatch(int n, const char *topic, int topic_len, const char *data, int len)
+{
+    char t[192];
+    int tn = (topic_len < (int)sizeof(t) - 1) ? topic_len : (int)sizeof(t) - 1;
+    memcpy(t, topic, tn);
+    t[tn] = 0;
+
+    for (int i = 0; i < n; i++) {
+        if (strcmp(t, s_topic_ptr[i]) == 0) {
+            on_topic(data, len, (void *)(uintptr_t)i);
+            return;
+        }
+    }
+}
+
+// ---------------- Workload ----------------
+static void build_messages(int n)
+{
+    uint32_t rng = 0x12345678u ^ (uint32_t)n;
+    char *w = s_wire;
+
+    for (int i = 0; i < MSG_COUNT; i++) {
+        int idx = (int)(bench_rand(&rng) % (uint32_t)n);
+        bool miss = bench_rand(&rng) % 100 < MISS_PERCENT;
+        // esp-mqtt hands out slices of its receive buffer: topic followed directly by the payload
+        int len = miss ? sprintf(w, "home/panel/unknown_%03d/stateON", idx) - 2
+                       : sprintf(w, "%sON", s_topics[idx]) - 2;
+        s_msgs[i].topic = w;
+        s_msgs[i].topic_len = len;
+        s_msgs[i].expected = miss ? -1 : idx;
+        w += len + 2;
+    }
+}
+
+static bool check_hits(int n, uint32_t rounds)
+{
+    uint32_t expected[MAX_TOPICS] = {0};
+    for (int i = 0; i < MSG_COUNT; i++) {
+        if (s_msgs[i].expected >= 0) expected[s_msgs[i].expected] += rounds;
+    }
+    for (int i = 0; i < n; i++) {
+        if (s_hits[i] != expected[i]) {
+            fprintf(stderr, "n=%d topic %d: %u hits, expected %u\n", n, i, s_hits[i], expected[i]);
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    static const int sizes[] = {3, 10, 25, 50, 100, 200, 500};
+    const uint32_t rounds = bench_quick(argc, argv) ? 20 : 2000;
+    bool ok = true;
+
+    for (int i = 0; i < MAX_TOPICS; i++) {
+        snprintf(s_topics[i], sizeof(s_topics[i]), "home/panel%02d/entity_%03d/state", i % 7, i);
+        s_topic_ptr[i] = s_topics[i];
+    }
+
+    printf("topics  registry ns/msg  strcmp-chain ns/msg  speedup\n");
+    for (size_t si = 0; si < sizeof(sizes) / sizeof(sizes[0]); si++) {
+        int n = sizes[si];
+
+        topic_registry_clear();
+        for (int i = 0; i < n; i++) topic_registry_add(s_topics[i], on_topic, (void *)(uintptr_t)i);
+        build_messages(n);
+
+        memset(s_hits, 0, sizeof(s_hits));
+        uint64_t t0 = bench_now_ns();
+        for (uint32_t r = 0; r < rounds; r++) {
+            for (int i = 0; i < MSG_COUNT; i++) {
+                const Msg *m = &s_msgs[i];
+                topic_registry_dispatch(m->topic, m->topic_len, m->topic + m->topic_len, 2);
+            }
+        }
+        double reg_ns = (double)(bench_now_ns() - t0) / ((double)rounds * MSG_COUNT);
+        ok &= check_hits(n, rounds);
+
+        memset(s_hits, 0, sizeof(s_hits));
+        t0 = bench_now_ns();
+        for (uint32_t r = 0; r < rounds; r++) {
+            for (int i = 0; i < MSG_COUNT; i++) {
+                const Msg *m = &s_msgs[i];
+                strcmp_chain_dispatch(n, m->topic, m->topic_len, m->topic + m->topic_len, 2);
+            }
+        }
+        double chain_ns = (double)(bench_now_ns() - t0) / ((double)rounds * MSG_COUNT);
+        ok &= check_hits(n, rounds);
+
+        printf("%6d  %15.1f  %19.1f  %6.1fx\n", n, reg_ns, chain_ns, chain_ns / reg_ns);
+    }
+
+    // Two entities showing the same state topic: one subscription, both handlers called in order
+    topic_registry_clear();
+    memset(s_hits, 0, sizeof(s_hits));
+    topic_registry_add(s_topics[0], on_topic, (void *)(uintptr_t)0);
+    topic_registry_add(s_topics[1], on_topic, (void *)(uintptr_t)1);
+    topic_registry_add(s_topics[0], on_topic, (void *)(uintptr_t)2);
+    topic_registry_dispatch(s_topics[0], (int)strlen(s_topics[0]), "on", 2);
+    if (topic_registry_count() != 2 || s_hits[0] != 1 || s_hits[1] != 0 || s_hits[2] != 1) {
+        printf("shared topic: %u topics, hits %u %u %u\n", (unsigned)topic_registry_count(), s_hits[0], s_hits[1],
+               s_hits[2]);
+        ok = false;
+    }
+
+    topic_registry_clear();
+    printf("%s\n", ok ? "OK" : "FAILED");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,45 @@
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "esp_log.h"
+
+#include "bench_util.h"
+
+// Benchmarks only print errors from the code under test
+void sim_log(esp_log_level_t level, const char *tag, const char *fmt, ...)
+{
+    if (level > ESP_LOG_WARN) return;
+
+    fprintf(stderr, "%c %s: ", level == ESP_LOG_ERROR ? 'E' : 'W', tag);
+    va_list ap;
+    va_start(ap, fmt);
+    vfprintf(stderr, fmt, ap);
+    va_end(ap);
+    fputc('\n', stderr);
+}
+
+uint64_t bench_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+uint32_t bench_rand(uint32_t *state)
+{
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return *state = x;
+}
+
+bool bench_quick(int argc, char **argv)
+{
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--quick") == 0) return true;
+    }
+    return false;
+}
@@ -0,0 +1,23 @@
+/*
+ * Helpers shared by the host micro-benchmarks.
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+uint64_t bench_now_ns(void);
+
+// Deterministic xorshift32 so every run measures the same workload
+uint32_t bench_rand(uint32_t *state);
+
+// true if "--quick" was passed (used by ctest: fewer iterations, same checks)
+bool bench_quick(int argc, char **argv);
+
+#ifdef __cplusplus
+}
+#endif
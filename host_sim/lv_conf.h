@@ -0,0 +1,100 @@
+/**
+ * @file lv_conf.h
+ * LVGL configuration for the host simulator.
+ *
+ * Mirrors the CONFIG_LV_* values of the firmware sdkconfig so that render
+ * timings measured on the host follow the same code paths as the panel.
+ * Everything not listed here uses the lv_conf_internal.h defaults.
+ */
+
+#ifndef LV_CONF_H
+#define LV_CONF_H
+
+/*====================
+   COLOR SETTINGS
+ *====================*/
+#define LV_COLOR_DEPTH 16
+
+/*=========================
+   STDLIB WRAPPER SETTINGS
+ *=========================*/
+#define LV_USE_STDLIB_MALLOC    LV_STDLIB_BUILTIN
+#define LV_USE_STDLIB_STRING    LV_STDLIB_BUILTIN
+#define LV_USE_STDLIB_SPRINTF   LV_STDLIB_BUILTIN
+
+#define LV_MEM_SIZE (64 * 1024U)          /* CONFIG_LV_MEM_SIZE_KILOBYTES */
+#define LV_MEM_POOL_EXPAND_SIZE 0
+#define LV_USE_MEM_TAGS 1                 /* CONFIG_LV_USE_MEM_TAGS */
+#define LV_MEM_ARENA_CNT 2                /* 0 in the firmware sdkconfig, on here for bench_screen_arena */
+
+/*====================
+   HAL SETTINGS
+ *====================*/
+#define LV_DEF_REFR_PERIOD  33
+#define LV_DPI_DEF 130
+
+/*=================
+ * OPERATING SYSTEM
+ *=================*/
+#define LV_USE_OS   LV_OS_PTHREAD         /* CONFIG_LV_OS_FREERTOS on the board */
+#define LV_DRAW_THREAD_STACK_SIZE (64 * 1024)   /* 8 KB on the board, host frames are larger */
+
+/*========================
+ * RENDERING CONFIGURATION
+ *========================*/
+#define LV_DRAW_BUF_STRIDE_ALIGN        1
+#define LV_DRAW_BUF_ALIGN               4
+#define LV_DRAW_LAYER_SIMPLE_BUF_SIZE   (24 * 1024)
+#define LV_USE_DRAW_SW 1
+#ifndef SIM_DRAW_UNIT_CNT
+#define SIM_DRAW_UNIT_CNT               2     /* 1 for the LVGL of bench_draw_units_1 */
+#endif
+#define LV_DRAW_SW_DRAW_UNIT_CNT        SIM_DRAW_UNIT_CNT
+#define LV_DRAW_SW_COMPLEX              1
+#define LV_DRAW_SW_SHADOW_CACHE_SIZE    0
+#define LV_DRAW_SW_CIRCLE_CACHE_SIZE    4
+#ifndef LV_USE_DRAW_SW_ASM
+#define LV_USE_DRAW_SW_ASM              LV_DRAW_SW_ASM_NONE   /* CUSTOM for the esp32s3 blend of test_simd_blend_rgb565 */
+#endif
+
+/*=======================
+ * FEATURE CONFIGURATION
+ *=======================*/
+#define LV_USE_LOG 0
+#define LV_USE_ASSERT_NULL          1
+#define LV_USE_ASSERT_MALLOC        1
+#define LV_ASSERT_HANDLER_INCLUDE <stdlib.h>
+#define LV_ASSERT_HANDLER abort();
+
+#define LV_CACHE_DEF_SIZE               0
+#define LV_IMAGE_HEADER_CACHE_DEF_CNT   0
+#define LV_GRADIENT_MAX_STOPS           2
+#define LV_COLOR_MIX_ROUND_OFS          128
+
+/*==================
+ *   FONT USAGE
+ *===================*/
+#define LV_FONT_MONTSERRAT_14 1
+#define LV_FONT_DEFAULT &lv_font_montserrat_14
+#define LV_USE_FONT_PLACEHOLDER 1
+
+/*==================
+ * 3RD PARTY LIBRARIES
+ *==================*/
+#define LV_USE_LZ4_INTERNAL 1             /* CONFIG_LV_USE_LZ4_INTERNAL: banded LZ4 backgrounds */
+#define LV_BIN_DECODER_RAM_LOAD 1         /* CONFIG_LV_BIN_DECODER_RAM_LOAD: compressed images decoded whole */
+
+/*==================
+ * THEMES
+ *==================*/
+#define LV_USE_THEME_DEFAULT 1
+#define LV_THEME_DEFAULT_GROW 1
+#define LV_THEME_DEFAULT_TRANSITION_TIME 80
+
+/*==================
+* EXAMPLES / DEMOS
+*==================*/
+#define LV_BUILD_EXAMPLES 0
+#define LV_BUILD_DEMOS 0
+
+#endif /*LV_CONF_H*/
@@ -0,0 +1,481 @@
+/*
+ * Host implementation of the BSP display/touch API used by the dashboard.
+ *
+ * Mirrors the firmware setup: 480x480 RGB565 panel, LVGL direct mode in the
+ * two panel framebuffers (or partial mode with one or two 480 x LVGL_BUFFER_HEIGHT
+ * draw buffers, or partial mode into the port's scanout tile or RLE line store), pointer indev for the GT911 polled slower when idle, event-driven
+ * LVGL port task.
+ * Pixels land in in-memory framebuffers instead of the RGB panel.
+ */
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "esp_log.h"
+
+#include "esp_lvgl_port.h"
+#include "lcd_scanout.h"                 // the port's tile store, built from its sources
+#include "src/misc/lv_anim_private.h"   // lv_anim_enable_vsync_mode()
+
+#include "sim_bsp.h"
+#include "sim_metrics.h"
+
+static const char *TAG = "sim_bsp";
+
+// Polled touch as configured by the firmware (CONFIG_DASHBOARD_TOUCH_IDLE_POLL_MS,
+// LVGL_PORT_TOUCH_IDLE_AFTER_MS in esp_lvgl_port_touch.c), lvgl_port_set_touch_idle_poll_ms() changes it
+#define TOUCH_IDLE_POLL_MS      100
+#define TOUCH_IDLE_AFTER_MS     1000
+
+// Async flush: areas widened to whole 64-byte GDMA bursts (esp_lvgl_port_disp.c)
+#define ASYNC_FLUSH_ALIGN_PX    32
+
+// Scanout: lines filled per bounce buffer interrupt (CONFIG_BSP_LCD_RGB_BOUNCE_BUFFER_HEIGHT)
+#define BOUNCE_BUFFER_HEIGHT    20
+
+// Panel framebuffers: [0] only in partial mode, [0] and [1] flipped in direct mode
+static uint16_t s_fbs[2][BSP_LCD_H_RES * BSP_LCD_V_RES] __attribute__((aligned(LV_DRAW_BUF_ALIGN)));
+static uint16_t *s_fb = s_fbs[0];       // scanned out
+static uint8_t s_draw_bufs[2][BSP_LCD_H_RES * LVGL_BUFFER_HEIGHT * 2] __attribute__((aligned(64)));
+static SimRenderMode s_render_mode = SIM_RENDER_DIRECT;
+
+// Panel VSYNC every 16.7 ms (60 Hz timing), paced refresh as esp_lvgl_port_disp.c (flags.vsync_paced)
+#define VSYNC_PERIOD_US     16667
+static bool s_vsync_paced;
+static bool s_refr_pending;
+static bool s_vsync_requested;
+static uint64_t s_vsync_handled;
+static SimFrameStats s_frame_stats;
+
+// Async flush: area handed to the "DMA", copied when LVGL waits for it
+static lv_area_t s_async_area;
+static const uint8_t *s_async_src;
+static bool s_async_pending;
+
+// Scanout: no framebuffer, the panel is filled from the tile store (s_fbs[0] holds one scanout)
+static lvgl_port_scanout_handle_t s_scanout;
+
+static lv_display_t *s_disp;
+static lv_indev_t *s_indev;
+static bool s_backlight;
+
+static bool s_touch_pressed;
+static int32_t s_touch_x;
+static int32_t s_touch_y;
+static uint32_t s_last_touch_ms;
+static bool s_touch_idle;
+static uint32_t s_touch_idle_poll_ms = TOUCH_IDLE_POLL_MS;
+static uint32_t s_touch_idle_period;
+
+static uint32_t s_port_events;
+static lvgl_port_user_event_cb_t s_user_event_cb;
+static void *s_user_event_ctx;
+static uint32_t s_task_runs;
+
+static uint64_t s_t0_ns;
+static uint64_t s_skipped_us;
+
+// ---------------- Time ----------------
+uint64_t sim_wall_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+uint64_t sim_time_us(void)
+{
+    if (s_t0_ns == 0) s_t0_ns = sim_wall_ns();
+    return (sim_wall_ns() - s_t0_ns) / 1000ULL + s_skipped_us;
+}
+
+void sim_time_skip_us(uint64_t us)
+{
+    s_skipped_us += us;
+}
+
+static uint32_t sim_tick_cb(void)
+{
+    return (uint32_t)(sim_time_us() / 1000ULL);
+}
+
+// ---------------- Display ----------------
+// Partial mode: the draw buffer is copied into the framebuffer being scanned out
+// (esp_lcd_panel_draw_bitmap() of the RGB driver)
+static void sim_copy_area(const lv_area_t *area, const uint8_t *px_map)
+{
+    int32_t w = lv_area_get_width(area);
+    const uint16_t *src = (const uint16_t *)px_map;
+
+    for (int32_t y = area->y1; y <= area->y2; y++) {
+        memcpy(&s_fb[y * BSP_LCD_H_RES + area->x1], src, (size_t)w * 2);
+        src += w;
+    }
+    sim_metrics_copy((uint32_t)(w * lv_area_get_height(area) * 2));
+}
+
+static void sim_flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map)
+{
+    sim_metrics_flush((uint32_t)(lv_area_get_size(area) * 2));
+    sim_copy_area(area, px_map);
+    lv_display_flush_ready(disp);
+}
+
+// Async flush: the copy runs while LVGL renders the next area into the other
+// draw buffer, it is only done here when LVGL waits for it (the port's
+// lvgl_port_async_flush_wait_callback()), so a missing wait shows on the screen
+static void sim_flush_async_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map)
+{
+    (void)disp;
+    sim_metrics_flush((uint32_t)(lv_area_get_size(area) * 2));
+    s_async_area = *area;
+    s_async_src = px_map;
+    s_async_pending = true;
+}
+
+static void sim_async_copy_done(void)
+{
+    if (s_async_pending) {
+        sim_copy_area(&s_async_area, s_async_src);
+        s_async_pending = false;
+    }
+}
+
+static void sim_flush_async_wait_cb(lv_display_t *disp)
+{
+    (void)disp;
+    sim_async_copy_done();
+}
+
+static void sim_async_round_cb(lv_event_t *e)
+{
+    lv_area_t *area = (lv_area_t *)lv_event_get_param(e);
+    area->x1 &= ~(ASYNC_FLUSH_ALIGN_PX - 1);
+    area->x2 |= ASYNC_FLUSH_ALIGN_PX - 1;
+}
+
+// Scanout: areas go to the tile store, as the port's flush without frame buffer
+static void sim_flush_scanout_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map)
+{
+    sim_metrics_flush((uint32_t)(lv_area_get_size(area) * 2));
+    lvgl_port_scanout_write(s_scanout, area->x1, area->y1, area->x2, area->y2, (const uint16_t *)px_map);
+    lv_display_flush_ready(disp);
+}
+
+// Direct mode: LVGL rendered in place into the back framebuffer, the last flush
+// of a refresh flips it to the front (the port waits for VSYNC, immediate here)
+static void sim_flush_direct_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map)
+{
+    sim_metrics_flush((uint32_t)(lv_area_get_size(area) * 2));
+    if (lv_display_flush_is_last(disp)) s_fb = (uint16_t *)px_map;
+    lv_display_flush_ready(disp);
+}
+
+// In double-buffered direct mode LVGL brings the back buffer up to date by copying
+// the previous frame's areas from the front buffer (refr_sync_areas() in lv_refr.c).
+// Linked with --wrap=lv_draw_buf_copy (CMakeLists.txt) to count these bytes.
+void __real_lv_draw_buf_copy(lv_draw_buf_t *dest, const lv_area_t *dest_area,
+                             const lv_draw_buf_t *src, const lv_area_t *src_area);
+
+void __wrap_lv_draw_buf_copy(lv_draw_buf_t *dest, const lv_area_t *dest_area,
+                             const lv_draw_buf_t *src, const lv_area_t *src_area)
+{
+    if (src->data == (uint8_t *)s_fbs[0] || src->data == (uint8_t *)s_fbs[1]) {
+        uint32_t px = src_area ? lv_area_get_size(src_area) : src->header.w * src->header.h;
+        sim_metrics_copy(px * 2);
+    }
+    __real_lv_draw_buf_copy(dest, dest_area, src, src_area);
+}
+
+static void sim_refr_event_cb(lv_event_t *e)
+{
+    switch (lv_event_get_code(e)) {
+    case LV_EVENT_REFR_START:
+        sim_metrics_frame_start();
+        break;
+    case LV_EVENT_REFR_READY:
+        // Nothing waits for the last area of a refresh, its copy ends on its own on the device
+        sim_async_copy_done();
+        sim_metrics_frame_end();
+        break;
+    default:
+        break;
+    }
+}
+
+static void sim_touch_read_cb(lv_indev_t *indev, lv_indev_data_t *data)
+{
+    data->point.x = s_touch_x;
+    data->point.y = s_touch_y;
+    data->state = s_touch_pressed ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
+
+    // Same read period switch as lvgl_port_touch_update_poll_period()
+    if (s_touch_pressed) {
+        s_last_touch_ms = lv_tick_get();
+        if (s_touch_idle) {
+            lv_timer_set_period(lv_indev_get_read_timer(indev), LV_DEF_REFR_PERIOD);
+            s_touch_idle = false;
+        }
+    } else if (s_touch_idle) {
+        if (s_touch_idle_period != s_touch_idle_poll_ms) {
+            lv_timer_set_period(lv_indev_get_read_timer(indev), s_touch_idle_poll_ms ? s_touch_idle_poll_ms : LV_DEF_REFR_PERIOD);
+            s_touch_idle_period = s_touch_idle_poll_ms;
+        }
+    } else if (s_touch_idle_poll_ms && lv_tick_elaps(s_last_touch_ms) >= TOUCH_IDLE_AFTER_MS) {
+        lv_timer_set_period(lv_indev_get_read_timer(indev), s_touch_idle_poll_ms);
+        s_touch_idle_period = s_touch_idle_poll_ms;
+        s_touch_idle = true;
+    }
+}
+
+void sim_bsp_set_render_mode(SimRenderMode mode)
+{
+    s_render_mode = mode;
+}
+
+void sim_bsp_set_vsync_paced(bool paced)
+{
+    s_vsync_paced = paced;
+}
+
+static void sim_vsync_event_cb(lv_event_t *e)
+{
+    if (lv_event_get_code(e) == LV_EVENT_VSYNC_REQUEST) {
+        s_vsync_requested = lv_event_get_param(e) != NULL;
+    } else {
+        s_refr_pending = true;
+    }
+}
+
+static uint64_t sim_vsync_count(void)
+{
+    return sim_time_us() / VSYNC_PERIOD_US;
+}
+
+// lvgl_port_disp_vsync_refresh(): one refresh per VSYNC at most, only when something is invalid
+static void sim_vsync_refresh(void)
+{
+    const uint64_t start = sim_vsync_count();
+    if (start == s_vsync_handled) return;
+    s_vsync_handled = start;
+
+    lv_display_send_vsync_event(s_disp, NULL);
+    if (!s_refr_pending) return;
+    s_refr_pending = false;
+    lv_display_refr_timer(NULL);
+
+    // The direct mode flip waits for the next VSYNC: shown one scanout later, as on the device
+    const uint64_t elapsed = sim_vsync_count() - start;
+    const uint64_t due = s_render_mode == SIM_RENDER_DIRECT ? 1 : 0;
+    s_frame_stats.frames++;
+    if (elapsed > due) {
+        s_frame_stats.late++;
+        s_frame_stats.dropped += (uint32_t)(elapsed - due);
+    }
+}
+
+lv_display_t *bsp_display_start(void)
+{
+    lv_tick_set_cb(sim_tick_cb);
+
+    s_disp = lv_display_create(BSP_LCD_H_RES, BSP_LCD_V_RES);
+    lv_display_set_color_format(s_disp, LV_COLOR_FORMAT_RGB565);
+    if (s_render_mode == SIM_RENDER_DIRECT) {
+        lv_display_set_buffers(s_disp, s_fbs[1], s_fbs[0], sizeof(s_fbs[0]), LV_DISPLAY_RENDER_MODE_DIRECT);
+        lv_display_set_flush_cb(s_disp, sim_flush_direct_cb);
+    } else if (s_render_mode == SIM_RENDER_ASYNC) {
+        lv_display_set_buffers(s_disp, s_draw_bufs[0], s_draw_bufs[1], sizeof(s_draw_bufs[0]), LV_DISPLAY_RENDER_MODE_PARTIAL);
+        lv_display_set_flush_cb(s_disp, sim_flush_async_cb);
+        lv_display_set_flush_wait_cb(s_disp, sim_flush_async_wait_cb);
+        lv_display_add_event_cb(s_disp, sim_async_round_cb, LV_EVENT_INVALIDATE_AREA, NULL);
+    } else if (s_render_mode == SIM_RENDER_SCANOUT || s_render_mode == SIM_RENDER_SCANOUT_RLE) {
+        const lvgl_port_scanout_cfg_t scanout_cfg = {
+            .hres = BSP_LCD_H_RES,
+            .vres = BSP_LCD_V_RES,
+            .format = s_render_mode == SIM_RENDER_SCANOUT_RLE ? LVGL_PORT_SCANOUT_RLE_LINES : LVGL_PORT_SCANOUT_TILES,
+        };
+        s_scanout = lvgl_port_scanout_create(&scanout_cfg);
+        lv_display_set_buffers(s_disp, s_draw_bufs[0], NULL, sizeof(s_draw_bufs[0]), LV_DISPLAY_RENDER_MODE_PARTIAL);
+        lv_display_set_flush_cb(s_disp, sim_flush_scanout_cb);
+    } else {
+        lv_display_set_buffers(s_disp, s_draw_bufs[0], NULL, sizeof(s_draw_bufs[0]), LV_DISPLAY_RENDER_MODE_PARTIAL);
+        lv_display_set_flush_cb(s_disp, sim_flush_cb);
+    }
+    lv_display_add_event_cb(s_disp, sim_refr_event_cb, LV_EVENT_REFR_START, NULL);
+    lv_display_add_event_cb(s_disp, sim_refr_event_cb, LV_EVENT_REFR_READY, NULL);
+    if (s_vsync_paced) {
+        lv_display_delete_refr_timer(s_disp);
+        lv_display_add_event_cb(s_disp, sim_vsync_event_cb, LV_EVENT_REFR_REQUEST, NULL);
+        lv_display_add_event_cb(s_disp, sim_vsync_event_cb, LV_EVENT_VSYNC_REQUEST, NULL);
+        lv_anim_enable_vsync_mode(true);
+        s_refr_pending = true;
+    }
+
+    s_indev = lv_indev_create();
+    lv_indev_set_type(s_indev, LV_INDEV_TYPE_POINTER);
+    lv_indev_set_read_cb(s_indev, sim_touch_read_cb);
+    lv_indev_set_display(s_indev, s_disp);
+
+    if (s_render_mode == SIM_RENDER_DIRECT) {
+        ESP_LOGI(TAG, "Display %dx%d RGB565, direct mode in 2 framebuffers", BSP_LCD_H_RES, BSP_LCD_V_RES);
+    } else if (s_render_mode == SIM_RENDER_ASYNC) {
+        ESP_LOGI(TAG, "Display %dx%d RGB565, 2 draw buffers %d lines, async flush", BSP_LCD_H_RES, BSP_LCD_V_RES, LVGL_BUFFER_HEIGHT);
+    } else if (s_render_mode == SIM_RENDER_SCANOUT || s_render_mode == SIM_RENDER_SCANOUT_RLE) {
+        ESP_LOGI(TAG, "Display %dx%d RGB565, draw buffer %d lines, no framebuffer (%s)", BSP_LCD_H_RES, BSP_LCD_V_RES, LVGL_BUFFER_HEIGHT,
+                 s_render_mode == SIM_RENDER_SCANOUT_RLE ? "RLE lines" : "tiles");
+    } else {
+        ESP_LOGI(TAG, "Display %dx%d RGB565, draw buffer %d lines", BSP_LCD_H_RES, BSP_LCD_V_RES, LVGL_BUFFER_HEIGHT);
+    }
+    return s_disp;
+}
+
+lv_indev_t *bsp_display_get_input_dev(void)
+{
+    return s_indev;
+}
+
+// Single-threaded simulator: LVGL only runs from the main loop, nothing to lock.
+bool bsp_display_lock(uint32_t timeout_ms)
+{
+    (void)timeout_ms;
+    return true;
+}
+
+void bsp_display_unlock(void)
+{
+}
+
+esp_err_t bsp_display_brightness_set(int brightness_percent)
+{
+    s_backlight = brightness_percent > 0;
+    ESP_LOGD(TAG, "Backlight %d%%", brightness_percent);
+    return ESP_OK;
+}
+
+esp_err_t bsp_display_backlight_on(void)
+{
+    return bsp_display_brightness_set(100);
+}
+
+esp_err_t bsp_display_backlight_off(void)
+{
+    return bsp_display_brightness_set(0);
+}
+
+esp_err_t lvgl_port_set_scanout_background(lv_display_t *disp, lvgl_port_scanout_bg_cb_t cb, void *user_ctx)
+{
+    if (!s_scanout) return ESP_ERR_NOT_SUPPORTED;
+    lvgl_port_scanout_set_bg(s_scanout, cb, user_ctx);
+    lv_obj_invalidate(lv_display_get_screen_active(disp));
+    return ESP_OK;
+}
+
+esp_err_t lvgl_port_get_scanout_stats(lv_display_t *disp, lvgl_port_scanout_stats_t *stats, bool reset)
+{
+    (void)disp;
+    if (!s_scanout) return ESP_ERR_NOT_SUPPORTED;
+    lvgl_port_scanout_get_stats(s_scanout, stats, reset);
+    return ESP_OK;
+}
+
+// ---------------- Panel access ----------------
+const uint16_t *sim_bsp_framebuffer(void)
+{
+    // Scanout: what the panel receives now, bounce buffer by bounce buffer
+    if (s_scanout) {
+        const uint32_t bounce_px = BSP_LCD_H_RES * BOUNCE_BUFFER_HEIGHT;
+        for (uint32_t pos = 0; pos < BSP_LCD_H_RES * BSP_LCD_V_RES; pos += bounce_px) {
+            lvgl_port_scanout_fill(s_scanout, pos, bounce_px, &s_fbs[0][pos]);
+        }
+    }
+    return s_fb;
+}
+
+bool sim_bsp_backlight(void)
+{
+    return s_backlight;
+}
+
+bool sim_bsp_dump_ppm(const char *path)
+{
+    FILE *f = fopen(path, "wb");
+    if (!f) {
+        ESP_LOGE(TAG, "Cannot open %s", path);
+        return false;
+    }
+
+    const uint16_t *fb = sim_bsp_framebuffer();
+    fprintf(f, "P6\n%d %d\n255\n", BSP_LCD_H_RES, BSP_LCD_V_RES);
+    for (int i = 0; i < BSP_LCD_H_RES * BSP_LCD_V_RES; i++) {
+        uint16_t c = fb[i];
+        uint8_t rgb[3] = {
+            (uint8_t)(((c >> 11) & 0x1F) * 255 / 31),
+            (uint8_t)(((c >> 5) & 0x3F) * 255 / 63),
+            (uint8_t)((c & 0x1F) * 255 / 31),
+        };
+        fwrite(rgb, 1, sizeof(rgb), f);
+    }
+    fclose(f);
+    return true;
+}
+
+// ---------------- LVGL port task ----------------
+esp_err_t lvgl_port_set_user_event_cb(lvgl_port_user_event_cb_t cb, void *user_ctx)
+{
+    s_user_event_cb = cb;
+    s_user_event_ctx = user_ctx;
+    return ESP_OK;
+}
+
+void lvgl_port_set_touch_idle_poll_ms(int ms)
+{
+    s_touch_idle_poll_ms = (uint32_t)ms;
+}
+
+esp_err_t lvgl_port_task_wake(lvgl_port_event_type_t event, void *param)
+{
+    (void)param;
+    s_port_events |= event;
+    return ESP_OK;
+}
+
+uint32_t sim_bsp_task_run(void)
+{
+    uint32_t events = s_port_events;
+    s_port_events = 0;
+    s_task_runs++;
+
+    if ((events & LVGL_PORT_EVENT_USER) && s_user_event_cb) s_user_event_cb(s_user_event_ctx);
+    if (s_vsync_paced) sim_vsync_refresh();
+    uint32_t wait_ms = lv_timer_handler();
+
+    // The VSYNC interrupt only wakes the task when a refresh is pending or requested
+    if (s_vsync_paced && (s_refr_pending || s_vsync_requested)) {
+        const uint64_t now = sim_time_us();
+        const uint64_t next = (sim_vsync_count() + 1) * VSYNC_PERIOD_US;
+        const uint32_t to_vsync_ms = (uint32_t)((next - now + 999) / 1000);
+        if (to_vsync_ms < wait_ms) wait_ms = to_vsync_ms;
+    }
+    return wait_ms;
+}
+
+void sim_bsp_get_frame_stats(SimFrameStats *stats)
+{
+    *stats = s_frame_stats;
+    stats->vsyncs = (uint32_t)sim_vsync_count();
+}
+
+uint32_t sim_bsp_task_runs(void)
+{
+    return s_task_runs;
+}
+
+// ---------------- Touch ----------------
+void sim_bsp_touch(bool pressed, int32_t x, int32_t y)
+{
+    s_touch_pressed = pressed;
+    if (pressed) {
+        s_touch_x = x;
+        s_touch_y = y;
+    }
+}
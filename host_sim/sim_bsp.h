@@ -0,0 +1,56 @@
+/*
+ * Host simulator board: in-memory panel, scripted touch and simulated time.
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "bsp/esp32_s3_touch_lcd_4.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ---------------- Time ----------------
+// Simulated time = real time elapsed since start + idle time skipped with sim_time_skip_us().
+uint64_t sim_time_us(void);
+void sim_time_skip_us(uint64_t us);
+uint64_t sim_wall_ns(void);              // monotonic host clock, used for CPU timings
+
+// ---------------- Panel ----------------
+typedef enum {
+    SIM_RENDER_DIRECT,      // firmware default: LVGL renders into the 2 panel framebuffers, flip on VSYNC
+    SIM_RENDER_PARTIAL,     // 480 x LVGL_BUFFER_HEIGHT draw buffer copied into the framebuffer
+    SIM_RENDER_ASYNC,       // partial mode, 2 draw buffers, copy overlapped with rendering (BSP async flush)
+    SIM_RENDER_SCANOUT,     // partial mode into the port's tile store, no framebuffer (BSP scanout)
+    SIM_RENDER_SCANOUT_RLE, // partial mode into the port's RLE line store, no framebuffer (BSP scanout, RLE lines)
+} SimRenderMode;
+
+void sim_bsp_set_render_mode(SimRenderMode mode);    // before bsp_display_start()
+void sim_bsp_set_vsync_paced(bool paced);            // before bsp_display_start(), BSP VSYNC paced refresh
+const uint16_t *sim_bsp_framebuffer(void);   // BSP_LCD_H_RES * BSP_LCD_V_RES RGB565 pixels (scanout: one scanout of the store)
+bool sim_bsp_backlight(void);
+bool sim_bsp_dump_ppm(const char *path);
+
+// ---------------- LVGL port task ----------------
+// One run of the event-driven LVGL port task: callback of the pending
+// LVGL_PORT_EVENT_USER wake, then lv_timer_handler(). Returns its next timeout.
+uint32_t sim_bsp_task_run(void);
+uint32_t sim_bsp_task_runs(void);
+
+// VSYNC paced refresh, as lvgl_port_get_frame_stats()
+typedef struct {
+    uint32_t vsyncs;
+    uint32_t frames;
+    uint32_t late;
+    uint32_t dropped;
+} SimFrameStats;
+void sim_bsp_get_frame_stats(SimFrameStats *stats);
+
+// ---------------- Touch ----------------
+void sim_bsp_touch(bool pressed, int32_t x, int32_t y);
+
+#ifdef __cplusplus
+}
+#endif
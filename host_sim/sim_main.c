@@ -0,0 +1,619 @@
+/*
+ * Headless host simulator for the dashboard.
+ *
+ * Runs the real UI (main/dashboard_ui.c) and MQTT dispatch (main/mqtt_dispatch.c)
+ * against an in-memory 480x480 RGB565 panel. Input comes from a replay script
+ * (MQTT messages and touches at given times) and/or a live MQTT broker.
+ *
+ * Script lines (blank lines and '#' comments ignored):
+ *   <ms> <topic> [payload...]        MQTT message
+ *   <ms> press <x> <y>               touch down / move
+ *   <ms> release                     touch up
+ *   <ms> tap <x> <y>                 press, release 100 ms later
+ */
+#include <errno.h>
+#include <signal.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "esp_log.h"
+
+#include "esp_lvgl_port.h"
+#include "lvgl.h"
+#include "src/draw/sw/lv_draw_sw.h"
+
+#include "mqtt_config.h"
+#include "entity_config.h"
+#include "dashboard_ui.h"
+#include "bg_image.h"
+#include "image_cache.h"
+#include "mqtt_dispatch.h"
+#include "clock_service.h"
+#include "topic_registry.h"
+#include "state_mailbox.h"
+
+#include "sim_bsp.h"
+#include "sim_metrics.h"
+
+#ifdef SIM_HAVE_MOSQUITTO
+#include <mosquitto.h>
+#endif
+
+static const char *TAG = "host_sim";
+
+#define TAP_RELEASE_MS      100
+#define SIM_EPOCH           1767268800  // 2026-01-01 12:00:00 UTC
+#define MAX_SKIP_MS         1000
+
+typedef enum {
+    EV_MQTT,
+    EV_PRESS,
+    EV_RELEASE,
+} SimEventKind;
+
+typedef struct {
+    uint32_t t_ms;
+    uint32_t seq;           // keeps file order for equal timestamps
+    SimEventKind kind;
+    int32_t x, y;
+    char *topic;
+    char *payload;
+} SimEvent;
+
+typedef struct {
+    SimEvent *v;
+    size_t n;
+    size_t cap;
+} SimScript;
+
+static esp_log_level_t s_log_level = ESP_LOG_WARN;
+static volatile sig_atomic_t s_stop;
+static SimScript s_script;
+static uint32_t s_commands;
+static uint32_t s_touches;
+// As the firmware's PSRAM buffer (CONFIG_DASHBOARD_LVGL_STATIC_LAYER)
+static uint16_t s_static_layer[BSP_LCD_H_RES * BSP_LCD_V_RES] __attribute__((aligned(LV_DRAW_BUF_ALIGN)));
+// The dashboard's objects as they were built (CONFIG_DASHBOARD_LVGL_SCREEN_ARENA_KB)
+static lv_mem_arena_stats_t s_arena_stats;
+static bool s_arena_freed;
+
+static void screen_arena_free(void *p)
+{
+    s_arena_freed = true;
+    free(p);
+}
+
+#ifdef SIM_HAVE_MOSQUITTO
+static struct mosquitto *s_mosq;
+#endif
+
+// ---------------- Logging ----------------
+void sim_log(esp_log_level_t level, const char *tag, const char *fmt, ...)
+{
+    static const char letters[] = "NEWIDV";
+    if (level > s_log_level) return;
+
+    fprintf(stderr, "%c (%8.3f) %s: ", letters[level], sim_time_us() / 1e6, tag);
+    va_list ap;
+    va_start(ap, fmt);
+    vfprintf(stderr, fmt, ap);
+    va_end(ap);
+    fputc('\n', stderr);
+}
+
+// ---------------- Script ----------------
+static SimEvent *script_add(SimScript *s)
+{
+    if (s->n == s->cap) {
+        size_t cap = s->cap ? s->cap * 2 : 64;
+        SimEvent *nv = realloc(s->v, cap * sizeof(SimEvent));
+        if (!nv) return NULL;
+        s->v = nv;
+        s->cap = cap;
+    }
+    SimEvent *ev = &s->v[s->n];
+    memset(ev, 0, sizeof(*ev));
+    ev->seq = (uint32_t)s->n++;
+    return ev;
+}
+
+static bool script_load(SimScript *s, const char *path)
+{
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        ESP_LOGE(TAG, "Cannot open %s: %s", path, strerror(errno));
+        return false;
+    }
+
+    char line[512];
+    int lineno = 0;
+    while (fgets(line, sizeof(line), f)) {
+        lineno++;
+        line[strcspn(line, "\r\n")] = 0;
+
+        char *p = line;
+        while (*p == ' ' || *p == '\t') p++;
+        if (*p == 0 || *p == '#') continue;
+
+        char *end;
+        unsigned long t = strtoul(p, &end, 10);
+        if (end == p) {
+            ESP_LOGE(TAG, "%s:%d: expected a timestamp", path, lineno);
+            fclose(f);
+            return false;
+        }
+        p = end;
+        while (*p == ' ' || *p == '\t') p++;
+
+        char word[192];
+        int n = 0;
+        if (sscanf(p, "%191s%n", word, &n) != 1) {
+            ESP_LOGE(TAG, "%s:%d: missing event", path, lineno);
+            fclose(f);
+            return false;
+        }
+        p += n;
+        while (*p == ' ' || *p == '\t') p++;
+
+        SimEvent *ev = script_add(s);
+        if (!ev) break;
+        ev->t_ms = (uint32_t)t;
+
+        if (strcmp(word, "press") == 0 || strcmp(word, "tap") == 0) {
+            if (sscanf(p, "%d %d", &ev->x, &ev->y) != 2) {
+                ESP_LOGE(TAG, "%s:%d: %s needs <x> <y>", path, lineno, word);
+                fclose(f);
+                return false;
+            }
+            ev->kind = EV_PRESS;
+            if (word[0] == 't') {
+                SimEvent *up = script_add(s);
+                if (!up) break;
+                up->t_ms = (uint32_t)t + TAP_RELEASE_MS;
+                up->kind = EV_RELEASE;
+            }
+        } else if (strcmp(word, "release") == 0) {
+            ev->kind = EV_RELEASE;
+        } else {
+            ev->kind = EV_MQTT;
+            ev->topic = strdup(word);
+            ev->payload = strdup(p);
+        }
+    }
+
+    fclose(f);
+    return true;
+}
+
+static int cmp_event(const void *a, const void *b)
+{
+    const SimEvent *ea = a;
+    const SimEvent *eb = b;
+    if (ea->t_ms != eb->t_ms) return ea->t_ms < eb->t_ms ? -1 : 1;
+    return ea->seq < eb->seq ? -1 : 1;
+}
+
+// ---------------- Delivery ----------------
+static void deliver_message(const char *topic, const char *data, int len)
+{
+    ESP_LOGI(TAG, "MQTT rx topic=%s data=%.*s", topic, len, data);
+    handle_state_msg(topic, (int)strlen(topic), data, len);
+    sim_metrics_message();
+}
+
+static void deliver_event(const SimEvent *ev)
+{
+    switch (ev->kind) {
+    case EV_MQTT:
+        deliver_message(ev->topic, ev->payload, (int)strlen(ev->payload));
+        break;
+    case EV_PRESS:
+        s_touches++;
+        sim_bsp_touch(true, ev->x, ev->y);
+        break;
+    case EV_RELEASE:
+        sim_bsp_touch(false, 0, 0);
+        break;
+    }
+}
+
+// ---------------- UI callbacks ----------------
+static void on_command(const char *topic, const char *payload)
+{
+    s_commands++;
+    ESP_LOGI(TAG, "MQTT tx topic=%s data=%s", topic, payload);
+#ifdef SIM_HAVE_MOSQUITTO
+    if (s_mosq) mosquitto_publish(s_mosq, NULL, topic, (int)strlen(payload), payload, 1, false);
+#endif
+}
+
+// Screen timeout of the firmware (SCREEN_TIMEOUT_MS), the touch read slower while the backlight is off
+// (CONFIG_DASHBOARD_TOUCH_SLEEP_POLL_MS)
+#define SCREEN_TIMEOUT_MS   120000
+#define TOUCH_SLEEP_POLL_MS 500
+#define TOUCH_IDLE_POLL_MS  100
+static uint64_t s_activity_ms;
+
+static void on_activity(void)
+{
+    s_activity_ms = sim_time_us() / 1000ULL;
+    if (!sim_bsp_backlight()) {
+        bsp_display_backlight_on();
+        lvgl_port_set_touch_idle_poll_ms(TOUCH_IDLE_POLL_MS);
+    }
+}
+
+static void screen_timeout_check(uint64_t now_ms)
+{
+    if (sim_bsp_backlight() && now_ms - s_activity_ms >= SCREEN_TIMEOUT_MS) {
+        bsp_display_backlight_off();
+        lvgl_port_set_touch_idle_poll_ms(TOUCH_SLEEP_POLL_MS);
+    }
+}
+
+static const DashboardUiCallbacks ui_cbs = {
+    .on_command  = on_command,
+    .on_activity = on_activity,
+};
+
+// Simulated wall clock for the clock service: starts at SIM_EPOCH (UTC)
+static int sim_gettimeofday(struct timeval *tv, void *tz)
+{
+    (void)tz;
+    uint64_t us = sim_time_us();
+    tv->tv_sec = (time_t)(SIM_EPOCH + us / 1000000ULL);
+    tv->tv_usec = (suseconds_t)(us % 1000000ULL);
+    return 0;
+}
+
+// ---------------- Broker ----------------
+#ifdef SIM_HAVE_MOSQUITTO
+static void broker_subscribe_topic(const char *topic, void *arg)
+{
+    mosquitto_subscribe((struct mosquitto *)arg, NULL, topic, 1);
+}
+
+static void on_mqtt_connect(struct mosquitto *m, void *obj, int rc)
+{
+    (void)obj;
+    if (rc != 0) {
+        ESP_LOGE(TAG, "MQTT connect failed: %s", mosquitto_connack_string(rc));
+        return;
+    }
+    ESP_LOGI(TAG, "MQTT connected");
+    topic_registry_foreach(broker_subscribe_topic, m);
+}
+
+static void on_mqtt_message(struct mosquitto *m, void *obj, const struct mosquitto_message *msg)
+{
+    (void)m;
+    (void)obj;
+    deliver_message(msg->topic, msg->payload ? (const char *)msg->payload : "", msg->payloadlen);
+}
+
+static bool broker_start(const char *spec)
+{
+    char host[128];
+    int port = 1883;
+    snprintf(host, sizeof(host), "%s", spec);
+    char *colon = strrchr(host, ':');
+    if (colon) {
+        *colon = 0;
+        port = atoi(colon + 1);
+    }
+
+    mosquitto_lib_init();
+    s_mosq = mosquitto_new("ha-dashboard-sim", true, NULL);
+    if (!s_mosq) return false;
+    if (mqtt_config.user && mqtt_config.user[0]) {
+        mosquitto_username_pw_set(s_mosq, mqtt_config.user, mqtt_config.pass);
+    }
+    mosquitto_connect_callback_set(s_mosq, on_mqtt_connect);
+    mosquitto_message_callback_set(s_mosq, on_mqtt_message);
+
+    int rc = mosquitto_connect(s_mosq, host, port, 30);
+    if (rc != MOSQ_ERR_SUCCESS) {
+        ESP_LOGE(TAG, "Cannot connect to %s:%d: %s", host, port, mosquitto_strerror(rc));
+        return false;
+    }
+    return true;
+}
+#endif
+
+// ---------------- Main ----------------
+static void usage(const char *argv0)
+{
+    fprintf(stderr,
+            "usage: %s [options]\n"
+            "  -e, --entities FILE   entity table (storage/entities.cfg format), built-in otherwise\n"
+            "  -g, --background FILE room background (tools/bg_pack.py output), none otherwise\n"
+            "  -r, --replay FILE     replay MQTT messages / touches from FILE (repeatable)\n"
+            "  -t, --touch FILE      same format, kept for separate touch scripts\n"
+            "  -b, --broker HOST[:PORT]  subscribe to a live broker (realtime)%s\n"
+            "  -d, --duration MS     stop after MS of simulated time (default: script end + 2000)\n"
+            "  -c, --csv FILE        write per-frame metrics as CSV\n"
+            "  -o, --dump FILE.ppm   write the final framebuffer\n"
+            "  -m, --render-mode direct|partial|async|scanout|scanout-rle  LVGL buffers (default: direct, as the firmware)\n"
+            "  -s, --vsync           refresh on the simulated panel VSYNC (BSP_DISPLAY_LVGL_VSYNC_PACED)\n"
+            "  -v                    verbose (repeat for debug)\n",
+            argv0,
+#ifdef SIM_HAVE_MOSQUITTO
+            ""
+#else
+            " [not built: libmosquitto missing]"
+#endif
+           );
+}
+
+static void on_sigint(int sig)
+{
+    (void)sig;
+    s_stop = 1;
+}
+
+int main(int argc, char **argv)
+{
+    const char *broker = NULL;
+    const char *entities_path = NULL;
+    const char *bg_path = NULL;
+    const char *csv_path = NULL;
+    const char *dump_path = NULL;
+    long duration_ms = -1;
+
+    for (int i = 1; i < argc; i++) {
+        const char *a = argv[i];
+        bool has_arg = i + 1 < argc;
+        if ((!strcmp(a, "-r") || !strcmp(a, "--replay") || !strcmp(a, "-t") || !strcmp(a, "--touch")) && has_arg) {
+            if (!script_load(&s_script, argv[++i])) return 1;
+        } else if ((!strcmp(a, "-e") || !strcmp(a, "--entities")) && has_arg) {
+            entities_path = argv[++i];
+        } else if ((!strcmp(a, "-g") || !strcmp(a, "--background")) && has_arg) {
+            bg_path = argv[++i];
+        } else if ((!strcmp(a, "-b") || !strcmp(a, "--broker")) && has_arg) {
+            broker = argv[++i];
+        } else if ((!strcmp(a, "-d") || !strcmp(a, "--duration")) && has_arg) {
+            duration_ms = atol(argv[++i]);
+        } else if ((!strcmp(a, "-c") || !strcmp(a, "--csv")) && has_arg) {
+            csv_path = argv[++i];
+        } else if ((!strcmp(a, "-o") || !strcmp(a, "--dump")) && has_arg) {
+            dump_path = argv[++i];
+        } else if ((!strcmp(a, "-m") || !strcmp(a, "--render-mode")) && has_arg) {
+            const char *mode = argv[++i];
+            if (!strcmp(mode, "direct")) {
+                sim_bsp_set_render_mode(SIM_RENDER_DIRECT);
+            } else if (!strcmp(mode, "partial")) {
+                sim_bsp_set_render_mode(SIM_RENDER_PARTIAL);
+            } else if (!strcmp(mode, "async")) {
+                sim_bsp_set_render_mode(SIM_RENDER_ASYNC);
+            } else if (!strcmp(mode, "scanout")) {
+                sim_bsp_set_render_mode(SIM_RENDER_SCANOUT);
+            } else if (!strcmp(mode, "scanout-rle")) {
+                sim_bsp_set_render_mode(SIM_RENDER_SCANOUT_RLE);
+            } else {
+                usage(argv[0]);
+                return 2;
+            }
+        } else if (!strcmp(a, "-s") || !strcmp(a, "--vsync")) {
+            sim_bsp_set_vsync_paced(true);
+        } else if (!strcmp(a, "-v")) {
+            if (s_log_level < ESP_LOG_VERBOSE) s_log_level++;
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+
+#ifndef SIM_HAVE_MOSQUITTO
+    if (broker) {
+        ESP_LOGE(TAG, "Built without libmosquitto, --broker unavailable");
+        return 2;
+    }
+#endif
+
+    qsort(s_script.v, s_script.n, sizeof(SimEvent), cmp_event);
+    if (duration_ms < 0) {
+        uint32_t last = s_script.n ? s_script.v[s_script.n - 1].t_ms : 0;
+        duration_ms = broker ? 60000 : (long)last + 2000;
+    }
+
+    FILE *csv = NULL;
+    if (csv_path) {
+        csv = fopen(csv_path, "w");
+        if (!csv) {
+            ESP_LOGE(TAG, "Cannot open %s", csv_path);
+            return 1;
+        }
+    }
+    sim_metrics_init(csv);
+    signal(SIGINT, on_sigint);
+
+    if (entities_path && entity_table_load(entities_path) != ESP_OK) return 1;
+    const EntityTable *entities = entity_table_get();
+
+    setenv("TZ", "UTC0", 1);
+    tzset();
+    clock_service_set_time_source(sim_gettimeofday);
+
+    lv_init();
+    bsp_display_start();
+    bsp_display_backlight_on();
+
+    bsp_display_lock(0);
+    lv_mem_set_spill_pools(64 * 1024, 16, malloc, free);       // CONFIG_DASHBOARD_LVGL_SPILL_POOL_KB, _MAX
+    lv_mem_set_spill_policy(1024, 1U << LV_MEM_TAG_APP);
+    lv_draw_sw_corner_cache_set_size(4 * 1024, NULL, NULL);    // CONFIG_DASHBOARD_LVGL_CORNER_CACHE_KB
+    lv_font_glyph_cache_set_size(8 * 1024, NULL, NULL);        // CONFIG_DASHBOARD_LVGL_GLYPH_CACHE_KB
+    lv_draw_pool_set_size(12 * 1024, NULL, NULL);              // CONFIG_DASHBOARD_LVGL_DRAW_POOL_KB
+    lv_font_fmt_txt_add_ascii_index(&lv_font_montserrat_14);
+    lv_display_set_static_layer(NULL, s_static_layer, sizeof(s_static_layer));
+    lv_display_set_occlusion_culling(NULL, true);               // CONFIG_DASHBOARD_LVGL_OCCLUSION_CULLING
+    image_cache_start(1024 * 1024);                             // CONFIG_DASHBOARD_LVGL_IMAGE_CACHE_KB
+    lv_mem_arena_t *arena = lv_mem_arena_create(16 * 1024, malloc, screen_arena_free);   // CONFIG_DASHBOARD_LVGL_SCREEN_ARENA_KB
+    lv_mem_arena_t *prev_arena = lv_mem_set_arena(arena);
+    ui_create(entities, &ui_cbs);
+    lv_mem_set_arena(prev_arena);
+    lv_mem_arena_get_stats(arena, &s_arena_stats);
+    lv_mem_arena_release(arena);
+    const lv_image_dsc_t *bg;
+    if (bg_path) {
+        if (bg_image_load(bg_path, &bg) != ESP_OK) return 1;
+        ui_set_background(bg);
+    }
+    // Scanout mode: as the firmware with BSP_DISPLAY_LVGL_SCANOUT_TILES, ignored by the RLE lines and otherwise
+    static UiBackgroundLayer bg_layer;
+    ui_get_background_layer(&bg_layer);
+    lvgl_port_set_scanout_background(lv_display_get_default(), ui_background_layer_line, &bg_layer);
+    mqtt_dispatch_start_ui(entities);
+    bsp_display_unlock();
+    clock_service_start();
+
+    // The firmware builds the table on MQTT connect; replay mode is "connected" from the start
+    mqtt_dispatch_init();
+
+#ifdef SIM_HAVE_MOSQUITTO
+    if (broker && !broker_start(broker)) return 1;
+#endif
+
+    const uint64_t end_us = (uint64_t)duration_ms * 1000ULL;
+    size_t next_ev = 0;
+
+    while (!s_stop && sim_time_us() < end_us) {
+        uint64_t now_ms = sim_time_us() / 1000ULL;
+        screen_timeout_check(now_ms);
+        while (next_ev < s_script.n && s_script.v[next_ev].t_ms <= now_ms) {
+            deliver_event(&s_script.v[next_ev++]);
+        }
+
+        uint32_t wait_ms = sim_bsp_task_run();
+        if (wait_ms == LV_NO_TIMER_READY || wait_ms > MAX_SKIP_MS) wait_ms = MAX_SKIP_MS;
+
+#ifdef SIM_HAVE_MOSQUITTO
+        if (s_mosq) {
+            // Live broker: wall-clock pacing, network I/O fills the idle time
+            mosquitto_loop(s_mosq, wait_ms ? (int)wait_ms : 1, 1);
+            continue;
+        }
+#endif
+        // Replay: skip idle time instead of sleeping
+        now_ms = sim_time_us() / 1000ULL;
+        if (next_ev < s_script.n) {
+            uint64_t ev_ms = s_script.v[next_ev].t_ms;
+            uint64_t until_ev = ev_ms > now_ms ? ev_ms - now_ms : 0;
+            if (until_ev < wait_ms) wait_ms = (uint32_t)until_ev;
+        }
+        sim_time_skip_us((uint64_t)wait_ms * 1000ULL);
+    }
+
+#ifdef SIM_HAVE_MOSQUITTO
+    if (s_mosq) {
+        mosquitto_disconnect(s_mosq);
+        mosquitto_destroy(s_mosq);
+        mosquitto_lib_cleanup();
+    }
+#endif
+
+    sim_metrics_report(stdout);
+
+    StateMailboxStats mb;
+    state_mailbox_get_stats(&mb);
+    printf("  state mailbox          %u received, %u coalesced, %u applied\n", mb.received, mb.coalesced, mb.applied);
+    printf("  touches                %u (%u commands sent)\n", s_touches, s_commands);
+    double sim_s = (double)sim_time_us() / 1e6;
+    printf("  LVGL task runs         %u (%.1f/s)\n", sim_bsp_task_runs(), sim_s > 0 ? sim_bsp_task_runs() / sim_s : 0.0);
+    lv_draw_sw_corner_cache_stats_t cs;
+    lv_draw_sw_corner_cache_get_stats(&cs, false);
+    printf("  corner cache           %u hits, %u misses, %u corners in %u bytes\n",
+           (unsigned)cs.hits, (unsigned)cs.misses, (unsigned)cs.entries, (unsigned)cs.size);
+    lv_font_glyph_cache_stats_t gs;
+    lv_font_glyph_cache_get_stats(&gs, false);
+    printf("  glyph cache            %u hits, %u misses, %u uncached, %u of %u slots\n",
+           (unsigned)gs.hits, (unsigned)gs.misses, (unsigned)gs.uncached, (unsigned)gs.entries, (unsigned)gs.slots);
+    lv_draw_pool_stats_t ps = {0};
+    for (int cls = 0; cls < LV_DRAW_POOL_CNT; cls++) {
+        lv_draw_pool_stats_t st;
+        lv_draw_pool_get_stats(cls, &st, false);
+        ps.hits += st.hits;
+        ps.fallbacks += st.fallbacks;
+        ps.peak += st.peak;
+        ps.slots += st.slots;
+    }
+    printf("  draw pool              %u hits, %u fallbacks, peak %u of %u slots\n",
+           (unsigned)ps.hits, (unsigned)ps.fallbacks, (unsigned)ps.peak, (unsigned)ps.slots);
+    printf("  screen arena           %u of %u bytes, %u allocations, %u fallbacks\n", (unsigned)s_arena_stats.used,
+           (unsigned)s_arena_stats.size, (unsigned)s_arena_stats.cnt, (unsigned)s_arena_stats.fallbacks);
+    lv_mem_monitor_t mm, sm;
+    lv_mem_monitor_heap(LV_MEM_HEAP_MAIN, &mm);
+    lv_mem_monitor_heap(LV_MEM_HEAP_SPILL, &sm);
+    lv_mem_spill_stats_t ms;
+    lv_mem_get_spill_stats(&ms, false);
+    printf("  LVGL heap              %u bytes used (%u%% frag), spill %u bytes in %u pools (peak %u, %u%% frag)\n",
+           (unsigned)(mm.total_size - mm.free_size), mm.frag_pct, (unsigned)(sm.total_size - sm.free_size),
+           (unsigned)ms.pools, (unsigned)ms.max_pools, sm.frag_pct);
+    static const char *const tag_names[] = {"app", "objects", "styles", "draw", "cache"};
+    for (int tag = 0; tag < LV_MEM_TAG_CNT; tag++) {
+        lv_mem_tag_stats_t ts;
+        lv_mem_get_tag_stats(tag, &ts, false);
+        printf("    %-20s %u bytes (peak %u, %u spilled) in %u allocations\n", tag_names[tag], (unsigned)ts.used,
+               (unsigned)ts.max_used, (unsigned)ts.spill_used, (unsigned)ts.cnt);
+    }
+    lv_display_static_layer_stats_t ls;
+    lv_display_get_static_layer_stats(NULL, &ls, false);
+    printf("  static layer           %u areas composited, %u drawn again, %u renders (%u px)\n",
+           (unsigned)ls.composited, (unsigned)ls.fallbacks, (unsigned)ls.renders, (unsigned)ls.rendered_px);
+    lv_display_overdraw_stats_t os;
+    lv_display_get_overdraw_stats(NULL, &os, false);
+    printf("  overdraw               %.2f over %u frames (peak %.2f), %u objects culled, %u hidden, %u areas flushed\n",
+           os.flushed_px ? (double)os.drawn_px / (double)os.flushed_px : 0.0, (unsigned)os.frames,
+           os.peak_x100 / 100.0, (unsigned)os.culled_objs, (unsigned)os.hidden_objs, (unsigned)os.flushes);
+    char image_cache[128];
+    image_cache_stats_json(image_cache, sizeof(image_cache), false);
+    printf("  image cache            %s\n", image_cache);
+    SimFrameStats frs;
+    sim_bsp_get_frame_stats(&frs);
+    if (frs.frames) {
+        printf("  VSYNC paced frames     %u on %u VSYNC, %u late, %u scanouts dropped\n",
+               frs.frames, frs.vsyncs, frs.late, frs.dropped);
+    }
+
+    lvgl_port_scanout_stats_t ss;
+    if (lvgl_port_get_scanout_stats(lv_display_get_default(), &ss, true) == ESP_OK) {
+        // Counters of one scanout: what the panel reads instead of a whole framebuffer
+        sim_bsp_framebuffer();
+        lvgl_port_get_scanout_stats(lv_display_get_default(), &ss, false);
+        const unsigned fb_bytes = BSP_LCD_H_RES * BSP_LCD_V_RES * 2;
+        if (ss.lines_rle + ss.lines_raw > 0) {
+            printf("  scanout lines          %u RLE, %u raw, %u KB (framebuffer %u KB, ratio %.2f)\n",
+                   ss.lines_rle, ss.lines_raw, ss.bytes / 1024, fb_bytes / 1024, (double)ss.bytes / fb_bytes);
+            printf("  scanout reads          %.1f KB of lines, %.0f%% of the framebuffer reads saved\n",
+                   ss.bytes_read / 1024.0, 100.0 - 100.0 * ss.bytes_read / fb_bytes);
+        } else {
+            printf("  scanout tiles          %u background, %u solid, %u pixels, %u KB (framebuffer %u KB)\n",
+                   ss.tiles_bg, ss.tiles_solid, ss.tiles_pixels, ss.bytes / 1024, fb_bytes / 1024);
+            printf("  scanout reads          %.1f KB of tile pixels, %u of %u lines with background\n",
+                   ss.bytes_read / 1024.0, ss.bg_lines, ss.lines);
+        }
+    }
+    if (dump_path && sim_bsp_dump_ppm(dump_path)) printf("  framebuffer            %s\n", dump_path);
+    if (csv) fclose(csv);
+
+    for (size_t i = 0; i < s_script.n; i++) {
+        free(s_script.v[i].topic);
+        free(s_script.v[i].payload);
+    }
+    free(s_script.v);
+
+    // Nothing outliving the dashboard (its screen, the shared styles) may hold on to its arena
+    lv_obj_clean(lv_screen_active());
+    if (!s_arena_freed) {
+        printf("  screen arena not freed with the dashboard\n");
+        return 1;
+    }
+    lv_deinit();
+    return 0;
+}
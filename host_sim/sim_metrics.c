@@ -0,0 +1,214 @@
+/*
+ * Per-frame and per-message measurements for the host simulator.
+ *
+ * Render time is host CPU time between LV_EVENT_REFR_START and LV_EVENT_REFR_READY.
+ * Latency is simulated time from message delivery to the end of the first
+ * refresh that flushed, so it includes the wait for the LVGL refresh timer.
+ */
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sim_bsp.h"
+#include "sim_metrics.h"
+
+typedef struct {
+    double *v;
+    uint32_t n;
+    uint32_t cap;
+} SampleBuf;
+
+#define MAX_PENDING_MSGS 256
+
+static FILE *s_csv;
+
+static SampleBuf s_render_us;
+static SampleBuf s_latency_us;
+
+static uint64_t s_frame_t0_ns;
+static uint32_t s_frame_flushes;
+static uint32_t s_frame_bytes;
+static uint32_t s_frame_copy_bytes;
+static bool s_in_frame;
+
+static uint32_t s_refreshes;
+static uint32_t s_frames;
+static uint64_t s_total_flushes;
+static uint64_t s_total_bytes;
+static uint32_t s_max_frame_bytes;
+static uint64_t s_total_copy_bytes;
+static uint32_t s_max_frame_copy_bytes;
+
+static uint64_t s_pending[MAX_PENDING_MSGS];
+static uint32_t s_pending_cnt;
+static uint32_t s_msgs;
+static uint32_t s_msgs_invisible;
+static uint32_t s_msgs_dropped;
+
+// ---------------- Samples ----------------
+static void sample_push(SampleBuf *b, double v)
+{
+    if (b->n == b->cap) {
+        uint32_t cap = b->cap ? b->cap * 2 : 256;
+        double *nv = realloc(b->v, cap * sizeof(double));
+        if (!nv) return;
+        b->v = nv;
+        b->cap = cap;
+    }
+    b->v[b->n++] = v;
+}
+
+static int cmp_double(const void *a, const void *b)
+{
+    double da = *(const double *)a;
+    double db = *(const double *)b;
+    return (da > db) - (da < db);
+}
+
+static double percentile(const double *sorted, uint32_t n, double p)
+{
+    uint32_t idx = (uint32_t)(p * (n - 1) + 0.5);
+    return sorted[idx];
+}
+
+static void compute_stats(const SampleBuf *b, SimStats *out)
+{
+    memset(out, 0, sizeof(*out));
+    if (b->n == 0) return;
+
+    double *sorted = malloc(b->n * sizeof(double));
+    if (!sorted) return;
+    memcpy(sorted, b->v, b->n * sizeof(double));
+    qsort(sorted, b->n, sizeof(double), cmp_double);
+
+    double sum = 0;
+    for (uint32_t i = 0; i < b->n; i++) sum += sorted[i];
+
+    out->count = b->n;
+    out->min = sorted[0];
+    out->max = sorted[b->n - 1];
+    out->avg = sum / b->n;
+    out->p50 = percentile(sorted, b->n, 0.50);
+    out->p95 = percentile(sorted, b->n, 0.95);
+    out->p99 = percentile(sorted, b->n, 0.99);
+    free(sorted);
+}
+
+// ---------------- Hooks ----------------
+void sim_metrics_init(FILE *csv)
+{
+    s_csv = csv;
+    if (s_csv) fprintf(s_csv, "frame,sim_ms,render_us,flushes,flush_bytes,copy_bytes,resolved_msgs\n");
+}
+
+void sim_metrics_frame_start(void)
+{
+    s_in_frame = true;
+    s_frame_flushes = 0;
+    s_frame_bytes = 0;
+    s_frame_copy_bytes = 0;
+    s_frame_t0_ns = sim_wall_ns();
+}
+
+void sim_metrics_flush(uint32_t bytes)
+{
+    s_frame_flushes++;
+    s_frame_bytes += bytes;
+}
+
+void sim_metrics_copy(uint32_t bytes)
+{
+    s_frame_copy_bytes += bytes;
+    s_total_copy_bytes += bytes;
+}
+
+void sim_metrics_frame_end(void)
+{
+    if (!s_in_frame) return;
+    s_in_frame = false;
+    s_refreshes++;
+
+    uint64_t now_us = sim_time_us();
+
+    if (s_frame_flushes == 0) {
+        // Nothing was redrawn: messages delivered before this refresh had no visible effect
+        s_msgs_invisible += s_pending_cnt;
+        s_pending_cnt = 0;
+        return;
+    }
+
+    double render_us = (double)(sim_wall_ns() - s_frame_t0_ns) / 1000.0;
+    sample_push(&s_render_us, render_us);
+
+    s_frames++;
+    s_total_flushes += s_frame_flushes;
+    s_total_bytes += s_frame_bytes;
+    if (s_frame_bytes > s_max_frame_bytes) s_max_frame_bytes = s_frame_bytes;
+    if (s_frame_copy_bytes > s_max_frame_copy_bytes) s_max_frame_copy_bytes = s_frame_copy_bytes;
+
+    uint32_t resolved = s_pending_cnt;
+    for (uint32_t i = 0; i < s_pending_cnt; i++) {
+        sample_push(&s_latency_us, (double)(now_us - s_pending[i]));
+    }
+    s_pending_cnt = 0;
+
+    if (s_csv) {
+        fprintf(s_csv, "%u,%.3f,%.1f,%u,%u,%u,%u\n", s_frames, now_us / 1000.0, render_us,
+                s_frame_flushes, s_frame_bytes, s_frame_copy_bytes, resolved);
+    }
+}
+
+void sim_metrics_message(void)
+{
+    s_msgs++;
+    if (s_pending_cnt == MAX_PENDING_MSGS) {
+        s_msgs_dropped++;
+        return;
+    }
+    s_pending[s_pending_cnt++] = sim_time_us();
+}
+
+// ---------------- Report ----------------
+void sim_metrics_render_stats(SimStats *out)
+{
+    compute_stats(&s_render_us, out);
+}
+
+void sim_metrics_latency_stats(SimStats *out)
+{
+    compute_stats(&s_latency_us, out);
+}
+
+static void print_stats(FILE *out, const char *name, const SimStats *s, double div, const char *unit)
+{
+    if (s->count == 0) {
+        fprintf(out, "  %-22s n/a\n", name);
+        return;
+    }
+    fprintf(out, "  %-22s n=%-6u min=%.2f avg=%.2f p50=%.2f p95=%.2f p99=%.2f max=%.2f %s\n",
+            name, s->count, s->min / div, s->avg / div, s->p50 / div, s->p95 / div,
+            s->p99 / div, s->max / div, unit);
+}
+
+void sim_metrics_report(FILE *out)
+{
+    SimStats render, latency;
+    sim_metrics_render_stats(&render);
+    sim_metrics_latency_stats(&latency);
+
+    fprintf(out, "\n==== host_sim report ====\n");
+    fprintf(out, "  simulated time         %.1f s\n", sim_time_us() / 1e6);
+    fprintf(out, "  refresh cycles         %u (%u with pixels flushed)\n", s_refreshes, s_frames);
+    print_stats(out, "render time", &render, 1.0, "us");
+    fprintf(out, "  flushes                %llu (%.2f per frame)\n",
+            (unsigned long long)s_total_flushes, s_frames ? (double)s_total_flushes / s_frames : 0.0);
+    fprintf(out, "  flush bytes            %llu total, %.0f avg/frame, %u max/frame\n",
+            (unsigned long long)s_total_bytes, s_frames ? (double)s_total_bytes / s_frames : 0.0,
+            s_max_frame_bytes);
+    fprintf(out, "  copied bytes           %llu total, %.0f avg/frame, %u max/frame\n",
+            (unsigned long long)s_total_copy_bytes, s_frames ? (double)s_total_copy_bytes / s_frames : 0.0,
+            s_max_frame_copy_bytes);
+    fprintf(out, "  messages               %u (%u without visible change, %u not tracked)\n",
+            s_msgs, s_msgs_invisible, s_msgs_dropped);
+    print_stats(out, "msg->pixel latency", &latency, 1000.0, "ms");
+}
@@ -0,0 +1,45 @@
+/*
+ * Host simulator metrics: per-frame render time, flush volume and
+ * MQTT message-to-pixel latency.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    uint32_t count;
+    double min;
+    double avg;
+    double p50;
+    double p95;
+    double p99;
+    double max;
+} SimStats;
+
+// csv may be NULL; otherwise one line per rendered frame is written to it.
+void sim_metrics_init(FILE *csv);
+
+// Display hooks (called from sim_bsp.c)
+void sim_metrics_frame_start(void);
+void sim_metrics_flush(uint32_t bytes);
+void sim_metrics_copy(uint32_t bytes);   // pixels memcpy'd into a framebuffer (flush or buffer sync)
+void sim_metrics_frame_end(void);
+
+// A MQTT message was handed to the UI. It is resolved by the end of the next
+// refresh: if that refresh flushed pixels the latency is recorded, otherwise
+// the message is counted as "no visible change".
+void sim_metrics_message(void);
+
+void sim_metrics_render_stats(SimStats *out);    // microseconds, frames that flushed only
+void sim_metrics_latency_stats(SimStats *out);   // microseconds of simulated time
+
+void sim_metrics_report(FILE *out);
+
+#ifdef __cplusplus
+}
+#endif
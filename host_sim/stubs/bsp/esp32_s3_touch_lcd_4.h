@@ -0,0 +1,33 @@
+/*
+ * Host stand-in for the Waveshare ESP32-S3-Touch-LCD-4 BSP.
+ * Implemented by host_sim/sim_bsp.c: in-memory 480x480 RGB565 panel and a scripted touch indev.
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "esp_err.h"
+#include "lvgl.h"
+
+/* LCD display definition */
+#define BSP_LCD_H_RES              (480)
+#define BSP_LCD_V_RES              (480)
+#define LVGL_BUFFER_HEIGHT         (100)   /* CONFIG_BSP_DISPLAY_LVGL_BUF_HEIGHT */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+lv_display_t *bsp_display_start(void);
+lv_indev_t *bsp_display_get_input_dev(void);
+bool bsp_display_lock(uint32_t timeout_ms);
+void bsp_display_unlock(void);
+
+esp_err_t bsp_display_brightness_set(int brightness_percent);
+esp_err_t bsp_display_backlight_on(void);
+esp_err_t bsp_display_backlight_off(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,33 @@
+/*
+ * Host stand-in for the esp_lvgl_port API used by the dashboard.
+ * Implemented by host_sim/sim_bsp.c: wakes are run by sim_bsp_task_run() from the main loop.
+ */
+#pragma once
+
+#include "esp_err.h"
+#include "lvgl.h"
+#include "esp_lvgl_port_scanout.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    LVGL_PORT_EVENT_DISPLAY = 0x01,
+    LVGL_PORT_EVENT_TOUCH   = 0x02,
+    LVGL_PORT_EVENT_USER    = 0x80,
+} lvgl_port_event_type_t;
+
+typedef void (*lvgl_port_user_event_cb_t)(void *user_ctx);
+
+esp_err_t lvgl_port_set_user_event_cb(lvgl_port_user_event_cb_t cb, void *user_ctx);
+esp_err_t lvgl_port_task_wake(lvgl_port_event_type_t event, void *param);
+void lvgl_port_set_touch_idle_poll_ms(int ms);
+
+// Framebuffer-less scanout (sim_bsp_set_render_mode(SIM_RENDER_SCANOUT)), ESP_ERR_NOT_SUPPORTED otherwise
+esp_err_t lvgl_port_set_scanout_background(lv_display_t *disp, lvgl_port_scanout_bg_cb_t cb, void *user_ctx);
+esp_err_t lvgl_port_get_scanout_stats(lv_display_t *disp, lvgl_port_scanout_stats_t *stats, bool reset);
+
+#ifdef __cplusplus
+}
+#endif
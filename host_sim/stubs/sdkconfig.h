@@ -0,0 +1,5 @@
+/*
+ * Host stand-in for the generated sdkconfig.h. Targets that need CONFIG_
+ * options define them on the command line (see CMakeLists.txt).
+ */
+#pragma once
@@ -0,0 +1,208 @@
+/*
+ * RGB565 opacity / mask blend and ARGB8888 image blend to RGB565: esp32s3
+ * kernels' portable reference vs. ANSI, through LVGL's own blend code.
+ *
+ * lv_draw_sw_blend_to_rgb565.c of the vendored LVGL is built a second time
+ * as the firmware builds it, with LV_DRAW_SW_ASM_CUSTOM and the hooks of
+ * esp_lvgl_port_lv_blend.h, its entry points renamed *_esp, and the C model
+ * of the assembly (test_apps/simd/host) in place of the .S files. Every
+ * variant is run through both entry points on the same input, over widths,
+ * heights, strides, buffer alignments and opacities; the results, matrix
+ * padding and the canary pixels around the destination must be identical.
+ *
+ *   test_simd_blend_rgb565
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "lvgl.h"
+#include "src/draw/sw/blend/lv_draw_sw_blend_private.h"
+#include "src/draw/sw/blend/lv_draw_sw_blend_to_rgb565.h"
+
+#include "bench_util.h"
+
+// The blend with the esp32s3 hooks (simd_blend_esp in CMakeLists.txt)
+void lv_draw_sw_blend_color_to_rgb565_esp(lv_draw_sw_blend_fill_dsc_t *dsc);
+void lv_draw_sw_blend_image_to_rgb565_esp(lv_draw_sw_blend_image_dsc_t *dsc);
+
+#define CANARY_PIXELS 8
+#define MAX_W         40
+#define MAX_H         3
+#define MAX_PAD       3
+#define MAX_PIXELS    (MAX_H * (MAX_W + MAX_PAD) + 2 * CANARY_PIXELS)
+
+typedef enum {
+    VARIANT_NORMAL,
+    VARIANT_OPA,
+    VARIANT_MASK,
+    VARIANT_MASK_OPA,
+} variant_t;
+
+static const char *const variant_names[] = {"NORMAL", "WITH_OPA", "WITH_MASK", "MIX_MASK_OPA"};
+static const lv_opa_t opas[] = {1, 7, 64, 128, 200, 252};
+// Every 16-byte phase of an RGB565 destination, 1 is odd: the kernels leave it to the ANSI code
+static const int dest_unaligns[] = {0, 1, 2, 4, 6, 8, 10, 12, 14};
+#define OPA_COUNT     (sizeof(opas) / sizeof(opas[0]))
+#define UNALIGN_COUNT (sizeof(dest_unaligns) / sizeof(dest_unaligns[0]))
+
+// 16-byte aligned, room for the unalignment
+static uint8_t s_dest_asm[MAX_PIXELS * 2 + 32] __attribute__((aligned(16)));
+static uint8_t s_dest_ansi[MAX_PIXELS * 2 + 32] __attribute__((aligned(16)));
+static uint8_t s_src[MAX_PIXELS * 4 + 32] __attribute__((aligned(16)));
+static uint8_t s_mask[MAX_PIXELS + 32] __attribute__((aligned(16)));
+
+static uint32_t s_seed = 0x5eed;
+static unsigned s_cases;
+static unsigned s_failures;
+
+static void fill_inputs(void)
+{
+    // Runs of transparent / opaque mask bytes between random ones, as antialiased edges are
+    for (size_t i = 0; i < sizeof(s_mask); i++) {
+        uint32_t r = bench_rand(&s_seed);
+        s_mask[i] = (i / 8) % 3 == 0 ? 0x00 : ((i / 8) % 3 == 1 ? 0xFF : (uint8_t)r);
+    }
+    for (size_t i = 0; i < sizeof(s_src); i++) {
+        s_src[i] = (uint8_t)bench_rand(&s_seed);
+    }
+    for (size_t i = 0; i < sizeof(s_dest_asm); i++) {
+        s_dest_asm[i] = (uint8_t)bench_rand(&s_seed);
+    }
+    memcpy(s_dest_ansi, s_dest_asm, sizeof(s_dest_asm));
+}
+
+static void check(const char *api, variant_t v, int w, int h, int stride, int dest_unalign, int src_unalign,
+                  int mask_unalign, lv_opa_t opa)
+{
+    s_cases++;
+    if (memcmp(s_dest_asm, s_dest_ansi, sizeof(s_dest_asm)) == 0) {
+        return;
+    }
+    if (s_failures++ < 10) {
+        printf("FAIL %s %s: w %d h %d stride %d dest+%d src+%d mask+%d opa %d\n", api, variant_names[v], w, h, stride,
+               dest_unalign, src_unalign, mask_unalign, opa);
+    }
+}
+
+static void run_fill(variant_t v, int w, int h, int pad, int dest_unalign, int mask_unalign, lv_opa_t opa)
+{
+    const int stride = w + pad;
+    fill_inputs();
+
+    lv_draw_sw_blend_fill_dsc_t dsc = {
+        .dest_w = w,
+        .dest_h = h,
+        .dest_stride = stride * 2,
+        .mask_buf = v == VARIANT_OPA ? NULL : s_mask + mask_unalign,
+        .mask_stride = stride,
+        .color = {.blue = 0x56, .green = 0x34, .red = 0x12},
+        .opa = v == VARIANT_MASK ? LV_OPA_COVER : opa,
+    };
+    dsc.dest_buf = s_dest_asm + dest_unalign + CANARY_PIXELS * 2;
+    lv_draw_sw_blend_color_to_rgb565_esp(&dsc);
+    dsc.dest_buf = s_dest_ansi + dest_unalign + CANARY_PIXELS * 2;
+    lv_draw_sw_blend_color_to_rgb565(&dsc);
+
+    check("fill", v, w, h, stride, dest_unalign, 0, mask_unalign, dsc.opa);
+}
+
+static void run_image(variant_t v, int w, int h, int pad, int dest_unalign, int src_unalign, int mask_unalign,
+                      lv_opa_t opa)
+{
+    const int stride = w + pad;
+    fill_inputs();
+
+    lv_draw_sw_blend_image_dsc_t dsc = {
+        .dest_w = w,
+        .dest_h = h,
+        .dest_stride = stride * 2,
+        .mask_buf = v == VARIANT_OPA ? NULL : s_mask + mask_unalign,
+        .mask_stride = stride,
+        .src_buf = s_src + src_unalign,
+        .src_stride = (stride + 1) * 2,     // different from the destination
+        .src_color_format = LV_COLOR_FORMAT_RGB565,
+        .opa = v == VARIANT_MASK ? LV_OPA_COVER : opa,
+        .blend_mode = LV_BLEND_MODE_NORMAL,
+    };
+    dsc.dest_buf = s_dest_asm + dest_unalign + CANARY_PIXELS * 2;
+    lv_draw_sw_blend_image_to_rgb565_esp(&dsc);
+    dsc.dest_buf = s_dest_ansi + dest_unalign + CANARY_PIXELS * 2;
+    lv_draw_sw_blend_image_to_rgb565(&dsc);
+
+    check("image", v, w, h, stride, dest_unalign, src_unalign, mask_unalign, dsc.opa);
+}
+
+static void run_argb8888(variant_t v, int w, int h, int pad, int dest_unalign, int src_unalign, int mask_unalign,
+                         lv_opa_t opa)
+{
+    const int stride = w + pad;
+    fill_inputs();
+
+    // Runs of transparent / opaque pixels between random alpha ones, as icons are
+    uint8_t *src = s_src + src_unalign;
+    for (int i = 0; i < h * (stride + 1); i++) {
+        src[4 * i + 3] = (i / 8) % 3 == 0 ? 0x00 : ((i / 8) % 3 == 1 ? 0xFF : src[4 * i + 3]);
+    }
+
+    lv_draw_sw_blend_image_dsc_t dsc = {
+        .dest_w = w,
+        .dest_h = h,
+        .dest_stride = stride * 2,
+        .mask_buf = (v == VARIANT_NORMAL || v == VARIANT_OPA) ? NULL : s_mask + mask_unalign,
+        .mask_stride = stride,
+        .src_buf = src,
+        .src_stride = (stride + 1) * 4,     // different from the destination
+        .src_color_format = LV_COLOR_FORMAT_ARGB8888,
+        .opa = (v == VARIANT_NORMAL || v == VARIANT_MASK) ? LV_OPA_COVER : opa,
+        .blend_mode = LV_BLEND_MODE_NORMAL,
+    };
+    dsc.dest_buf = s_dest_asm + dest_unalign + CANARY_PIXELS * 2;
+    lv_draw_sw_blend_image_to_rgb565_esp(&dsc);
+    dsc.dest_buf = s_dest_ansi + dest_unalign + CANARY_PIXELS * 2;
+    lv_draw_sw_blend_image_to_rgb565(&dsc);
+
+    check("argb8888", v, w, h, stride, dest_unalign, src_unalign, mask_unalign, dsc.opa);
+}
+
+int main(void)
+{
+    for (variant_t v = VARIANT_NORMAL; v <= VARIANT_MASK_OPA; v++) {
+        const size_t opa_count = (v == VARIANT_NORMAL || v == VARIANT_MASK) ? 1 : OPA_COUNT;
+        for (int w = 1; w <= MAX_W; w++) {
+            for (int h = 1; h <= MAX_H; h++) {
+                for (int pad = 0; pad <= MAX_PAD; pad += MAX_PAD) {
+                    for (size_t d = 0; d < UNALIGN_COUNT; d++) {
+                        for (int unalign = 0; unalign < 4; unalign++) {
+                            for (size_t o = 0; o < opa_count; o++) {
+                                run_argb8888(v, w, h, pad, dest_unaligns[d], unalign, 3 - unalign, opas[o]);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    for (variant_t v = VARIANT_OPA; v <= VARIANT_MASK_OPA; v++) {
+        const size_t opa_count = v == VARIANT_MASK ? 1 : OPA_COUNT;
+        for (int w = 1; w <= MAX_W; w++) {
+            for (int h = 1; h <= MAX_H; h++) {
+                for (int pad = 0; pad <= MAX_PAD; pad += MAX_PAD) {
+                    for (size_t d = 0; d < UNALIGN_COUNT; d++) {
+                        for (int unalign = 0; unalign < 4; unalign++) {
+                            for (size_t o = 0; o < opa_count; o++) {
+                                run_fill(v, w, h, pad, dest_unaligns[d], unalign, opas[o]);
+                                run_image(v, w, h, pad, dest_unaligns[d], unalign, 3 - unalign, opas[o]);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    printf("%u cases, %u failed\n", s_cases, s_failures);
+    printf("%s\n", s_failures ? "FAILED" : "OK");
+    return s_failures ? 1 : 0;
+}
@@ -0,0 +1,336 @@
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "esp_log.h"
+
+#include "src/draw/lv_image_decoder_private.h"
+#include "src/libs/lz4/lz4.h"
+
+#include "bg_image.h"
+
+static const char *TAG = "bg_image";
+
+#define BG_IMAGE_MAX     8
+#define BG_RLE_STRIP     16      // rows handed to LVGL per get_area call (RLE)
+#define BG_HEADER_SIZE   (sizeof(lv_image_header_t) + 12)   // + lv_image_compressed_t on disk
+#define BG_CURSOR_CNT    LV_DRAW_SW_DRAW_UNIT_CNT           // one open per SW draw unit at most
+
+// Decode state of one open: every SW draw unit may draw the image at the same time
+typedef struct {
+    atomic_flag busy;
+    uint8_t *rows;              // decoded rows handed to LVGL (internal RAM)
+    int32_t band_cached;        // LZ4: band currently in `rows`, -1 if none
+    lv_draw_buf_t strip;
+} BgCursor;
+
+typedef struct {
+    lv_image_dsc_t dsc;         // given to lv_image_set_src(); must stay first
+    uint8_t method;             // LV_IMAGE_COMPRESS_RLE / LV_IMAGE_COMPRESS_LZ4
+    uint16_t band_h;            // rows per independently decodable unit (1 for RLE, 0: plain LVGL LZ4)
+    uint32_t band_cnt;
+    const uint8_t *data;        // compressed stream
+    const uint32_t *band_off;   // LZ4: band_cnt + 1 offsets into data
+    uint32_t *row_off;          // RLE: offset of every row, built at load
+    BgCursor cursors[BG_CURSOR_CNT];
+    BgImageStats stats;         // updated with atomics, from the draw units
+} BgImage;
+
+// Loaded from the LVGL task, read-only once loaded: only the cursors are shared with the draw units
+static BgImage *s_images[BG_IMAGE_MAX];
+static size_t s_image_cnt;
+static lv_image_decoder_t *s_decoder;
+
+static BgImage *find_image(const void *src)
+{
+    for (size_t i = 0; i < s_image_cnt; i++) {
+        if (&s_images[i]->dsc == src) return s_images[i];
+    }
+    return NULL;
+}
+
+static esp_err_t alloc_cursors(BgImage *img, size_t rows_size)
+{
+    for (int i = 0; i < BG_CURSOR_CNT; i++) {
+        atomic_flag_clear(&img->cursors[i].busy);
+        img->cursors[i].band_cached = -1;
+        img->cursors[i].rows = malloc(rows_size);
+        if (!img->cursors[i].rows) return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+static void free_image(BgImage *img)
+{
+    free(img->row_off);
+    for (int i = 0; i < BG_CURSOR_CNT; i++) free(img->cursors[i].rows);
+    free(img);
+}
+
+// ---------------- RLE rows ----------------
+// Walk every row once: runs must end on the row boundary (tools/bg_pack.py
+// guarantees it) so that any row can be decoded on its own.
+static esp_err_t rle_index(BgImage *img, uint32_t size)
+{
+    uint32_t w = img->dsc.header.w;
+    uint32_t pos = 0;
+
+    for (uint32_t y = 0; y < img->dsc.header.h; y++) {
+        img->row_off[y] = pos;
+        uint32_t x = 0;
+        while (x < w) {
+            if (pos >= size) return ESP_ERR_INVALID_SIZE;
+            uint8_t ctrl = img->data[pos++];
+            uint32_t n = ctrl & 0x7f;
+            if (n == 0) return ESP_ERR_INVALID_RESPONSE;
+            pos += (ctrl & 0x80) ? n * 2 : 2;
+            x += n;
+        }
+        if (x != w) {
+            ESP_LOGE(TAG, "Row %u: run crosses the row end, repack with tools/bg_pack.py", (unsigned)y);
+            return ESP_ERR_NOT_SUPPORTED;
+        }
+    }
+    return pos <= size ? ESP_OK : ESP_ERR_INVALID_SIZE;
+}
+
+// Decode pixels x1..x2 of one row into `out`
+static void rle_row(const uint8_t *p, int32_t x1, int32_t x2, uint8_t *out)
+{
+    int32_t x = 0;
+    while (x <= x2) {
+        uint8_t ctrl = *p++;
+        int32_t n = ctrl & 0x7f;
+        int32_t a = LV_MAX(x, x1);
+        int32_t b = LV_MIN(x + n - 1, x2);
+        if (ctrl & 0x80) {
+            if (a <= b) memcpy(out + (a - x1) * 2, p + (a - x) * 2, (size_t)(b - a + 1) * 2);
+            p += n * 2;
+        } else {
+            for (int32_t i = a; i <= b; i++) memcpy(out + (i - x1) * 2, p, 2);
+            p += 2;
+        }
+        x += n;
+    }
+}
+
+// ---------------- LVGL decoder ----------------
+static lv_result_t bg_info(lv_image_decoder_t *decoder, lv_image_decoder_dsc_t *dsc, lv_image_header_t *header)
+{
+    LV_UNUSED(decoder);
+    if (dsc->src_type != LV_IMAGE_SRC_VARIABLE) return LV_RESULT_INVALID;
+
+    BgImage *img = find_image(dsc->src);
+    if (!img || !img->band_h) return LV_RESULT_INVALID;   // plain LZ4: LVGL's bin decoder
+
+    *header = img->dsc.header;
+    header->flags &= ~LV_IMAGE_FLAGS_COMPRESSED;   // what LVGL gets is plain RGB565
+    return LV_RESULT_OK;
+}
+
+static lv_result_t bg_open(lv_image_decoder_t *decoder, lv_image_decoder_dsc_t *dsc)
+{
+    LV_UNUSED(decoder);
+    dsc->decoded = NULL;   // never decoded as a whole: LVGL asks for areas
+    dsc->user_data = NULL;
+    BgImage *img = find_image(dsc->src);
+    if (!img) return LV_RESULT_INVALID;
+    for (int i = 0; i < BG_CURSOR_CNT; i++) {
+        if (!atomic_flag_test_and_set(&img->cursors[i].busy)) {
+            dsc->user_data = &img->cursors[i];
+            return LV_RESULT_OK;
+        }
+    }
+    ESP_LOGE(TAG, "More opens than draw units");
+    return LV_RESULT_INVALID;
+}
+
+static BgImage *cursor_image(const lv_image_decoder_dsc_t *dsc)
+{
+    return (BgImage *)dsc->src;   // dsc is the first member
+}
+
+// Called with decoded_area->y1 == LV_COORD_MIN first, then until it returns
+// INVALID. Each call hands out the next rows of `full_area` (image coords).
+static lv_result_t bg_get_area(lv_image_decoder_t *decoder, lv_image_decoder_dsc_t *dsc,
+                               const lv_area_t *full_area, lv_area_t *decoded_area)
+{
+    LV_UNUSED(decoder);
+    BgCursor *cur = dsc->user_data;
+    BgImage *img = cursor_image(dsc);
+    uint32_t stride = img->dsc.header.stride;
+
+    int32_t y1 = decoded_area->y1 == LV_COORD_MIN ? full_area->y1 : decoded_area->y2 + 1;
+    if (y1 > full_area->y2) return LV_RESULT_INVALID;
+
+    int32_t y2;
+    if (img->method == LV_IMAGE_COMPRESS_LZ4) {
+        // Whole band decompressed once, then given to LVGL in place (full width)
+        int32_t band = y1 / img->band_h;
+        int32_t band_y1 = band * img->band_h;
+        int32_t band_rows = LV_MIN((int32_t)img->band_h, (int32_t)img->dsc.header.h - band_y1);
+        if (band != cur->band_cached) {
+            const uint8_t *src = img->data + img->band_off[band];
+            int len = (int)(img->band_off[band + 1] - img->band_off[band]);
+            int exp = (int)(band_rows * stride);
+            if (LZ4_decompress_safe((const char *)src, (char *)cur->rows, len, exp) != exp) {
+                ESP_LOGE(TAG, "Corrupted LZ4 band %d", (int)band);
+                cur->band_cached = -1;
+                return LV_RESULT_INVALID;
+            }
+            cur->band_cached = band;
+            __atomic_fetch_add(&img->stats.decoded_bands, 1, __ATOMIC_RELAXED);
+        }
+        y2 = LV_MIN(full_area->y2, band_y1 + band_rows - 1);
+        lv_draw_buf_init(&cur->strip, img->dsc.header.w, y2 - y1 + 1, LV_COLOR_FORMAT_RGB565, stride,
+                         cur->rows + (y1 - band_y1) * stride, (y2 - y1 + 1) * stride);
+        decoded_area->x1 = 0;
+        decoded_area->x2 = img->dsc.header.w - 1;
+    } else {
+        // Only the columns of the area, row by row from the index
+        int32_t w = lv_area_get_width(full_area);
+        y2 = LV_MIN(full_area->y2, y1 + BG_RLE_STRIP - 1);
+        for (int32_t y = y1; y <= y2; y++) {
+            rle_row(img->data + img->row_off[y], full_area->x1, full_area->x2, cur->rows + (y - y1) * w * 2);
+        }
+        lv_draw_buf_init(&cur->strip, w, y2 - y1 + 1, LV_COLOR_FORMAT_RGB565, w * 2,
+                         cur->rows, (y2 - y1 + 1) * w * 2);
+        decoded_area->x1 = full_area->x1;
+        decoded_area->x2 = full_area->x2;
+    }
+
+    decoded_area->y1 = y1;
+    decoded_area->y2 = y2;
+    __atomic_fetch_add(&img->stats.decoded_rows, (uint32_t)(y2 - y1 + 1), __ATOMIC_RELAXED);
+    dsc->decoded = &cur->strip;
+    return LV_RESULT_OK;
+}
+
+static void bg_close(lv_image_decoder_t *decoder, lv_image_decoder_dsc_t *dsc)
+{
+    LV_UNUSED(decoder);
+    BgCursor *cur = dsc->user_data;   // the rows stay allocated, the band stays cached
+    if (cur) atomic_flag_clear(&cur->busy);
+}
+
+// ---------------- Load ----------------
+static esp_err_t parse(BgImage *img, uint8_t *file, uint32_t size)
+{
+    if (size < BG_HEADER_SIZE) return ESP_ERR_INVALID_SIZE;
+
+    lv_image_header_t header;
+    uint32_t ch[3];   // lv_image_compressed_t as stored: method|reserved, compressed, decompressed
+    memcpy(&header, file, sizeof(header));
+    memcpy(ch, file + sizeof(header), sizeof(ch));
+
+    if (header.magic != LV_IMAGE_HEADER_MAGIC || header.cf != LV_COLOR_FORMAT_RGB565 ||
+        !(header.flags & LV_IMAGE_FLAGS_COMPRESSED) || header.stride != header.w * 2 || !header.h) {
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+    uint32_t method = ch[0] & 0xf;
+    uint32_t compressed = ch[1];
+    if (compressed != size - BG_HEADER_SIZE || ch[2] != header.stride * header.h) return ESP_ERR_INVALID_SIZE;
+
+    img->dsc.header = header;
+    img->dsc.data = file + sizeof(header);
+    img->dsc.data_size = size - sizeof(header);
+    img->data = file + BG_HEADER_SIZE;
+    img->method = method;
+    img->stats.file_size = size;
+
+    if (method == LV_IMAGE_COMPRESS_RLE) {
+        img->band_h = 1;
+        img->band_cnt = header.h;
+        img->row_off = malloc(header.h * sizeof(uint32_t));
+        if (!img->row_off || alloc_cursors(img, BG_RLE_STRIP * header.stride) != ESP_OK) return ESP_ERR_NO_MEM;
+        return rle_index(img, compressed);
+    }
+    if (method == LV_IMAGE_COMPRESS_LZ4) {
+        img->band_h = ch[0] >> 4;
+        // Plain LVGL LZ4 (one block): decoded whole by LVGL's bin decoder, kept by the image cache
+        if (!img->band_h) return ESP_OK;
+        if (img->band_h > header.h) return ESP_ERR_NOT_SUPPORTED;
+        img->band_cnt = (header.h + img->band_h - 1) / img->band_h;
+        if ((img->band_cnt + 1) * 4 > compressed) return ESP_ERR_INVALID_SIZE;
+        img->band_off = (const uint32_t *)img->data;
+        for (uint32_t b = 0; b < img->band_cnt; b++) {
+            if (img->band_off[b] > img->band_off[b + 1]) return ESP_ERR_INVALID_RESPONSE;
+        }
+        if (img->band_off[img->band_cnt] > compressed) return ESP_ERR_INVALID_SIZE;
+        // Under CONFIG_SPIRAM_MALLOC_ALWAYSINTERNAL for the default band: decode target stays internal
+        return alloc_cursors(img, img->band_h * header.stride);
+    }
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+static void register_decoder(void)
+{
+    // Created after lv_init(): sits in front of the bin decoder in the decoder list
+    s_decoder = lv_image_decoder_create();
+    lv_image_decoder_set_info_cb(s_decoder, bg_info);
+    lv_image_decoder_set_open_cb(s_decoder, bg_open);
+    lv_image_decoder_set_get_area_cb(s_decoder, bg_get_area);
+    lv_image_decoder_set_close_cb(s_decoder, bg_close);
+    s_decoder->name = "bg_image";
+}
+
+esp_err_t bg_image_load(const char *path, const lv_image_dsc_t **out)
+{
+    if (s_image_cnt == BG_IMAGE_MAX) return ESP_ERR_NO_MEM;
+
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        ESP_LOGW(TAG, "%s not found", path);
+        return ESP_ERR_NOT_FOUND;
+    }
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+
+    // The compressed file stays resident: a few hundred KB, PSRAM through malloc
+    uint8_t *file = size > 0 ? malloc((size_t)size) : NULL;
+    BgImage *img = calloc(1, sizeof(BgImage));
+    esp_err_t err = ESP_ERR_NO_MEM;
+    if (file && img) {
+        err = fread(file, 1, (size_t)size, f) == (size_t)size ? parse(img, file, (uint32_t)size) : ESP_FAIL;
+    }
+    fclose(f);
+
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "%s: cannot load (0x%x)", path, err);
+        if (img) free_image(img);
+        free(file);
+        return err;
+    }
+
+    if (!s_decoder) register_decoder();
+    s_images[s_image_cnt++] = img;
+    ESP_LOGI(TAG, "%s: %ux%u, %s, %ld bytes", path, (unsigned)img->dsc.header.w, (unsigned)img->dsc.header.h,
+             img->method == LV_IMAGE_COMPRESS_RLE ? "RLE" : img->band_h ? "LZ4" : "LZ4, decoded whole", size);
+    *out = &img->dsc;
+    return ESP_OK;
+}
+
+bool bg_image_read_row(const lv_image_dsc_t *dsc, int32_t y, int32_t x1, int32_t x2, void *out)
+{
+    if (y < 0 || y >= (int32_t)dsc->header.h || x1 < 0 || x2 >= (int32_t)dsc->header.w) return false;
+
+    BgImage *img = find_image(dsc);
+    if (img) {
+        if (img->method != LV_IMAGE_COMPRESS_RLE) return false;
+        rle_row(img->data + img->row_off[y], x1, x2, out);
+        return true;
+    }
+    // Built-in C array
+    if (dsc->header.cf != LV_COLOR_FORMAT_RGB565 || (dsc->header.flags & LV_IMAGE_FLAGS_COMPRESSED)) return false;
+    uint32_t stride = dsc->header.stride ? dsc->header.stride : dsc->header.w * 2;
+    memcpy(out, dsc->data + y * stride + x1 * 2, (size_t)(x2 - x1 + 1) * 2);
+    return true;
+}
+
+void bg_image_get_stats(const lv_image_dsc_t *dsc, BgImageStats *out)
+{
+    BgImage *img = find_image(dsc);
+    *out = img ? img->stats : (BgImageStats) {0};
+}
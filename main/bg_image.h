@@ -0,0 +1,30 @@
+#pragma once
+#include "esp_err.h"
+#include "lvgl.h"
+
+// Room backgrounds live in the `storage` partition as LVGL compressed images
+// (tools/bg_pack.py, RGB565, row-aligned RLE or banded LZ4) instead of the app.
+// The compressed file is kept in RAM (PSRAM for anything this size) and only
+// the rows of an invalidated area are decoded, band by band, while LVGL draws.
+// A plain LVGL LZ4 image (one block, LVGLImage.py --compress LZ4) is left to
+// LVGL: decoded whole, then kept by the image cache (image_cache.h).
+
+#define BG_IMAGE_DEFAULT  "bg/room1.bin"   // relative to the storage mount point
+
+// Load `path` and return an image source for lv_image_set_src().
+// Must be called after lv_init(), with the display lock held. Images stay
+// loaded for the life of the app.
+esp_err_t bg_image_load(const char *path, const lv_image_dsc_t **out);
+
+typedef struct {
+    uint32_t file_size;     // bytes in flash (the .bin)
+    uint32_t decoded_rows;  // rows produced for the draw buffer
+    uint32_t decoded_bands; // LZ4 blocks decompressed (band cache misses)
+} BgImageStats;
+
+void bg_image_get_stats(const lv_image_dsc_t *img, BgImageStats *out);
+
+// Pixels x1..x2 of row `y` of `img` into `out` (RGB565), outside of LVGL: for the
+// framebuffer-less scanout, from the bounce buffer interrupt. No allocation, no lock.
+// RLE and uncompressed images only (an LZ4 band is too long to decode per line).
+bool bg_image_read_row(const lv_image_dsc_t *img, int32_t y, int32_t x1, int32_t x2, void *out);
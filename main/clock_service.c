@@ -0,0 +1,72 @@
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+
+#include "esp_log.h"
+#include "lvgl.h"
+
+#include "dashboard_ui.h"
+#include "clock_service.h"
+
+static const char *TAG = "clock";
+
+#define CLOCK_UNSYNCED_RETRY_MS  1000   // SNTP not done yet: check again every second
+#define CLOCK_BOUNDARY_SLACK_MS  20     // fire just after hh:mm:00, never just before
+
+static int system_now(struct timeval *tv, void *tz)
+{
+    return gettimeofday(tv, tz);
+}
+
+static int (*s_now)(struct timeval *tv, void *tz) = system_now;
+static char s_shown[6] = "--:--";
+
+// "HH:MM" without strftime
+static inline void format_hhmm(char out[6], int h, int m)
+{
+    out[0] = (char)('0' + h / 10);
+    out[1] = (char)('0' + h % 10);
+    out[2] = ':';
+    out[3] = (char)('0' + m / 10);
+    out[4] = (char)('0' + m % 10);
+    out[5] = '\0';
+}
+
+static void clock_timer_cb(lv_timer_t *t)
+{
+    struct timeval tv;
+    struct tm timeinfo;
+    s_now(&tv, NULL);
+    time_t now = tv.tv_sec;
+    localtime_r(&now, &timeinfo);
+
+    // Si l'année est < 2020, l'heure n'est pas encore synchronisée
+    if (timeinfo.tm_year <= 120) {
+        lv_timer_set_period(t, CLOCK_UNSYNCED_RETRY_MS);
+        return;
+    }
+
+    char buf[6];
+    format_hhmm(buf, timeinfo.tm_hour, timeinfo.tm_min);
+    if (memcmp(buf, s_shown, sizeof(buf)) != 0) {
+        memcpy(s_shown, buf, sizeof(buf));
+        ui_set_clock(s_shown);
+        ESP_LOGD(TAG, "%s", s_shown);
+    }
+
+    // Sleep until the next minute boundary
+    uint32_t ms_into_minute = (uint32_t)timeinfo.tm_sec * 1000U + (uint32_t)(tv.tv_usec / 1000);
+    if (ms_into_minute > 60000U) ms_into_minute = 60000U;   // leap second
+    lv_timer_set_period(t, 60000U - ms_into_minute + CLOCK_BOUNDARY_SLACK_MS);
+}
+
+void clock_service_start(void)
+{
+    lv_timer_t *t = lv_timer_create(clock_timer_cb, CLOCK_UNSYNCED_RETRY_MS, NULL);
+    lv_timer_ready(t);  // show the time on the first frame if already synced
+}
+
+void clock_service_set_time_source(int (*now)(struct timeval *tv, void *tz))
+{
+    s_now = now ? now : system_now;
+}
@@ -0,0 +1,11 @@
+#pragma once
+#include <sys/time.h>
+
+// Clock badge driver: one LVGL timer, re-armed for the next minute boundary.
+// The label is only touched when "HH:MM" changes.
+
+// Create the timer. Call once, with the display lock held, after ui_create().
+void clock_service_start(void);
+
+// Replace gettimeofday() as time source (host simulator). Call before clock_service_start().
+void clock_service_set_time_source(int (*now)(struct timeval *tv, void *tz));
@@ -0,0 +1,491 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "esp_log.h"
+
+// BSP Waveshare + LVGL
+#include "bsp/esp32_s3_touch_lcd_4.h"
+#include "lvgl.h"
+
+#include "bg_image.h"
+#include "dashboard_ui.h"
+
+static const char *TAG = "ui";
+
+// ---- UI Globals ----
+static lv_obj_t *label_clock;
+static lv_obj_t *background;
+
+// Widgets of one entity (same index as the entity table)
+typedef struct {
+    lv_obj_t *obj;      // tile or badge
+    lv_obj_t *value;    // sensor value / cover state label
+    lv_obj_t *slider;   // light brightness
+} EntityWidgets;
+
+static const EntityTable *s_entities;
+static EntityWidgets *s_widgets;
+static DashboardUiCallbacks s_cbs;
+
+// Shared styles: one instance each, referenced by every tile / badge
+static lv_style_t style_tile;
+static lv_style_t style_tile_on;
+static lv_style_t style_tile_icon;
+static lv_style_t style_tile_title;
+static lv_style_t style_tile_label;
+static lv_style_t style_tile_value;
+static lv_style_t style_tile_slider;
+static lv_style_t style_cover_btn;
+static lv_style_t style_badge;
+static lv_style_t style_badge_icon;
+static lv_style_t style_badge_value;
+static lv_style_t style_text_light;
+static lv_style_t style_container;
+static bool styles_inited = false;
+
+
+#define ICON_LAMP "\uE21E" // Unicode Material Icons: lamp
+#define COLOR_LAMP_ON   lv_color_hex(0xFF9800)
+#define COLOR_LAMP_OFF  lv_color_hex(0x607D8B)
+
+#define TILE_W   200
+#define TILE_H   130
+#define BADGE_W  100
+#define BADGE_H  40
+
+// Cover buttons: event user data = entity index * COVER_CMD_COUNT + command
+enum { COVER_OPEN, COVER_STOP, COVER_CLOSE, COVER_CMD_COUNT };
+static const char *const cover_cmds[COVER_CMD_COUNT]    = {"OPEN", "STOP", "CLOSE"};
+static const char *const cover_symbols[COVER_CMD_COUNT] = {LV_SYMBOL_UP, LV_SYMBOL_STOP, LV_SYMBOL_DOWN};
+static const lv_align_t cover_align[COVER_CMD_COUNT]    = {LV_ALIGN_BOTTOM_LEFT, LV_ALIGN_BOTTOM_MID, LV_ALIGN_BOTTOM_RIGHT};
+
+
+LV_IMAGE_DECLARE(floor_lamp);
+LV_IMG_DECLARE(ui_img_clock_icon);
+LV_IMG_DECLARE(ui_thermostat_icon);
+
+
+// ---------------- UI helpers ----------------
+static void init_styles_once(void)
+{
+    if (styles_inited) return;
+    styles_inited = true;
+
+    lv_style_init(&style_tile);
+    lv_style_set_width(&style_tile, TILE_W);
+    lv_style_set_height(&style_tile, TILE_H);
+    lv_style_set_bg_color(&style_tile, COLOR_LAMP_OFF);
+    lv_style_set_bg_opa(&style_tile, LV_OPA_COVER);
+    lv_style_set_border_width(&style_tile, 0);
+    lv_style_set_radius(&style_tile, 10);
+
+    lv_style_init(&style_tile_on);
+    lv_style_set_bg_color(&style_tile_on, COLOR_LAMP_ON);
+
+    lv_style_init(&style_tile_icon);
+    lv_style_set_align(&style_tile_icon, LV_ALIGN_TOP_MID);
+    lv_style_set_y(&style_tile_icon, 8);
+
+    lv_style_init(&style_tile_title);
+    lv_style_set_align(&style_tile_title, LV_ALIGN_TOP_MID);
+    lv_style_set_text_color(&style_tile_title, lv_color_white());
+
+    lv_style_init(&style_tile_label);
+    lv_style_set_align(&style_tile_label, LV_ALIGN_BOTTOM_MID);
+    lv_style_set_y(&style_tile_label, -10);
+    lv_style_set_text_align(&style_tile_label, LV_TEXT_ALIGN_CENTER);
+
+    lv_style_init(&style_tile_value);
+    lv_style_set_align(&style_tile_value, LV_ALIGN_CENTER);
+    lv_style_set_y(&style_tile_value, -12);
+    lv_style_set_text_color(&style_tile_value, lv_color_white());
+
+    lv_style_init(&style_tile_slider);
+    lv_style_set_align(&style_tile_slider, LV_ALIGN_BOTTOM_MID);
+    lv_style_set_y(&style_tile_slider, -36);
+    lv_style_set_width(&style_tile_slider, TILE_W - 40);
+    lv_style_set_height(&style_tile_slider, 8);
+
+    lv_style_init(&style_cover_btn);
+    lv_style_set_width(&style_cover_btn, 50);
+    lv_style_set_height(&style_cover_btn, 36);
+    lv_style_set_radius(&style_cover_btn, 8);
+    lv_style_set_bg_color(&style_cover_btn, lv_color_hex(0x455A64));
+
+    lv_style_init(&style_badge);
+    lv_style_set_width(&style_badge, BADGE_W);
+    lv_style_set_height(&style_badge, BADGE_H);
+    lv_style_set_bg_color(&style_badge, lv_color_hex(0x607D8B));
+    lv_style_set_bg_opa(&style_badge, LV_OPA_COVER);  // Make the background fully opaque
+    lv_style_set_border_width(&style_badge, 0);       // Remove the default border
+    lv_style_set_radius(&style_badge, 10);            // Rounded corners matching the buttons
+    lv_style_set_pad_all(&style_badge, 5);
+
+    lv_style_init(&style_badge_icon);
+    lv_style_set_align(&style_badge_icon, LV_ALIGN_LEFT_MID);
+    lv_style_set_x(&style_badge_icon, 5);
+
+    lv_style_init(&style_badge_value);
+    lv_style_set_align(&style_badge_value, LV_ALIGN_RIGHT_MID);
+    lv_style_set_x(&style_badge_value, -8);
+
+    lv_style_init(&style_text_light);
+    lv_style_set_text_color(&style_text_light, lv_color_white()); // Text in white
+    lv_style_set_text_font(&style_text_light, &lv_font_montserrat_14);
+
+    lv_style_init(&style_container);
+    lv_style_set_bg_opa(&style_container, LV_OPA_TRANSP);
+    lv_style_set_border_width(&style_container, 0);
+    lv_style_set_pad_all(&style_container, 0);
+}
+
+static inline bool payload_is_on(const char *data, int len)
+{
+    return len >= 2 && data[0] == 'O' && data[1] == 'N';
+}
+
+// Copy a (non NUL-terminated) MQTT payload into buf
+static void payload_to_str(char *buf, size_t size, const char *data, int len)
+{
+    size_t n = (len > 0) ? (size_t)len : 0;
+    if (n > size - 1) n = size - 1;
+    memcpy(buf, data, n);
+    buf[n] = '\0';
+}
+
+static inline bool is_celsius(const char *unit)
+{
+    return unit && (strcmp(unit, "°C") == 0 || strcmp(unit, "C") == 0);
+}
+
+// ---------------- State updates ----------------
+void ui_entity_set_state(size_t idx, const char *value, int len)
+{
+    if (!s_widgets || idx >= s_entities->count) return;
+
+    const EntityConfig *e = &s_entities->items[idx];
+    EntityWidgets *w = &s_widgets[idx];
+    char buf[24];
+
+    switch (e->type) {
+    case ENTITY_SWITCH:
+    case ENTITY_LIGHT: {
+        bool on = payload_is_on(value, len);
+        if (on == lv_obj_has_state(w->obj, LV_STATE_CHECKED)) return;
+        if (on) {
+            lv_obj_add_state(w->obj, LV_STATE_CHECKED);
+        } else {
+            lv_obj_remove_state(w->obj, LV_STATE_CHECKED);
+        }
+        break;
+    }
+
+    case ENTITY_SENSOR:
+        if (len <= 0) return;
+        payload_to_str(buf, sizeof(buf), value, len);
+        ESP_LOGD(TAG, "Affichage %s: %s", e->name, buf);
+        if (e->unit) {
+            lv_label_set_text_fmt(w->value, "%s %s", buf, e->unit);
+        } else {
+            lv_label_set_text(w->value, buf);
+        }
+        break;
+
+    case ENTITY_COVER:
+        payload_to_str(buf, sizeof(buf), value, len);
+        lv_label_set_text(w->value, buf);
+        break;
+    }
+}
+
+void ui_entity_set_brightness(size_t idx, const char *value, int len)
+{
+    if (!s_widgets || idx >= s_entities->count) return;
+
+    lv_obj_t *slider = s_widgets[idx].slider;
+    if (!slider || lv_obj_has_state(slider, LV_STATE_PRESSED)) return;  // don't fight the finger
+
+    char buf[8];
+    payload_to_str(buf, sizeof(buf), value, len);
+    lv_slider_set_value(slider, atoi(buf), LV_ANIM_OFF);
+}
+
+void ui_set_clock(const char *txt)
+{
+    if (label_clock != NULL) {
+        lv_label_set_text(label_clock, txt);
+    }
+}
+
+void ui_set_background(const void *src)
+{
+    if (background != NULL) {
+        lv_image_set_src(background, src);
+    }
+}
+
+void ui_get_background_layer(UiBackgroundLayer *layer)
+{
+    lv_obj_t *scr = lv_screen_active();
+    *layer = (UiBackgroundLayer) {
+        .color = lv_color_to_u16(lv_obj_get_style_bg_color(scr, LV_PART_MAIN)),
+    };
+    if (background == NULL) return;
+
+    const void *src = lv_image_get_src(background);
+    if (src && lv_image_src_get_type(src) == LV_IMAGE_SRC_VARIABLE) {
+        lv_obj_update_layout(background);
+        layer->image = src;
+        lv_obj_get_coords(background, &layer->coords);
+    }
+}
+
+void ui_background_layer_line(void *ctx, int32_t y, uint16_t *row)
+{
+    const UiBackgroundLayer *layer = ctx;
+    for (int32_t x = 0; x < BSP_LCD_H_RES; x++) row[x] = layer->color;
+
+    // A row the decoder cannot give stays in the screen colour: those tiles are stored instead
+    if (layer->image && y >= layer->coords.y1 && y <= layer->coords.y2) {
+        int32_t x1 = LV_MAX(layer->coords.x1, 0);
+        int32_t x2 = LV_MIN(layer->coords.x2, BSP_LCD_H_RES - 1);
+        if (x1 <= x2) {
+            bg_image_read_row(layer->image, y - layer->coords.y1, x1 - layer->coords.x1,
+                              x2 - layer->coords.x1, row + x1);
+        }
+    }
+}
+
+// ---------------- Event callbacks ----------------
+static inline void notify_activity(void)
+{
+    if (s_cbs.on_activity) s_cbs.on_activity();
+}
+
+static inline void send_command(const char *topic, const char *payload)
+{
+    if (topic && s_cbs.on_command) s_cbs.on_command(topic, payload);
+}
+
+static void tile_event_cb(lv_event_t *e)
+{
+    notify_activity();
+    if (lv_event_get_code(e) != LV_EVENT_CLICKED) return;
+
+    const EntityConfig *ent = &s_entities->items[(size_t)(uintptr_t)lv_event_get_user_data(e)];
+    ESP_LOGI(TAG, "Button clicked: %s", ent->name);
+
+    send_command(ent->cmd_topic, "TOGGLE");
+}
+
+static void slider_event_cb(lv_event_t *e)
+{
+    notify_activity();
+    if (lv_event_get_code(e) != LV_EVENT_RELEASED) return;
+
+    const EntityConfig *ent = &s_entities->items[(size_t)(uintptr_t)lv_event_get_user_data(e)];
+    char buf[8];
+    snprintf(buf, sizeof(buf), "%d", (int)lv_slider_get_value(lv_event_get_target_obj(e)));
+
+    send_command(ent->brightness_cmd_topic, buf);
+}
+
+static void cover_event_cb(lv_event_t *e)
+{
+    notify_activity();
+    if (lv_event_get_code(e) != LV_EVENT_CLICKED) return;
+
+    uintptr_t ud = (uintptr_t)lv_event_get_user_data(e);
+    const EntityConfig *ent = &s_entities->items[ud / COVER_CMD_COUNT];
+
+    send_command(ent->cmd_topic, cover_cmds[ud % COVER_CMD_COUNT]);
+}
+
+static void screen_touch_cb(lv_event_t *e)
+{
+    (void)e;
+    notify_activity();
+}
+
+// ---------------- Widget factories ----------------
+static lv_obj_t *create_label(lv_obj_t *parent, lv_style_t *style, const char *static_text)
+{
+    lv_obj_t *label = lv_label_create(parent);
+    lv_obj_add_style(label, style, 0);
+    if (static_text) lv_label_set_text_static(label, static_text);
+    return label;
+}
+
+// Switch and light: lamp icon on top, name at the bottom, orange when ON
+static void create_toggle_tile(lv_obj_t *parent, size_t idx)
+{
+    const EntityConfig *ent = &s_entities->items[idx];
+    EntityWidgets *w = &s_widgets[idx];
+
+    w->obj = lv_button_create(parent);
+    lv_obj_add_style(w->obj, &style_tile, 0);
+    lv_obj_add_style(w->obj, &style_tile_on, LV_STATE_CHECKED);
+    lv_obj_add_event_cb(w->obj, tile_event_cb, LV_EVENT_CLICKED, (void *)(uintptr_t)idx);
+
+    lv_obj_t *icon = lv_image_create(w->obj);
+    lv_image_set_src(icon, &floor_lamp);
+    lv_obj_add_style(icon, &style_tile_icon, 0);
+
+    create_label(w->obj, &style_tile_label, ent->name);
+
+    if (ent->type == ENTITY_LIGHT) {
+        w->slider = lv_slider_create(w->obj);
+        lv_obj_add_style(w->slider, &style_tile_slider, 0);
+        lv_slider_set_range(w->slider, 0, 255);
+        lv_obj_add_event_cb(w->slider, slider_event_cb, LV_EVENT_RELEASED, (void *)(uintptr_t)idx);
+    }
+}
+
+// Cover: name on top, state in the middle, open / stop / close buttons
+static void create_cover_tile(lv_obj_t *parent, size_t idx)
+{
+    const EntityConfig *ent = &s_entities->items[idx];
+    EntityWidgets *w = &s_widgets[idx];
+
+    w->obj = lv_obj_create(parent);
+    lv_obj_add_style(w->obj, &style_tile, 0);
+    lv_obj_clear_flag(w->obj, LV_OBJ_FLAG_SCROLLABLE);
+
+    create_label(w->obj, &style_tile_title, ent->name);
+    w->value = create_label(w->obj, &style_tile_value, "--");
+
+    for (int c = 0; c < COVER_CMD_COUNT; c++) {
+        lv_obj_t *btn = lv_button_create(w->obj);
+        lv_obj_add_style(btn, &style_cover_btn, 0);
+        lv_obj_align(btn, cover_align[c], 0, 0);
+        lv_obj_add_event_cb(btn, cover_event_cb, LV_EVENT_CLICKED, (void *)(uintptr_t)(idx * COVER_CMD_COUNT + c));
+
+        lv_obj_t *sym = create_label(btn, &style_text_light, cover_symbols[c]);
+        lv_obj_center(sym);
+    }
+}
+
+// Sensor: badge with the value (and a thermostat icon for temperatures)
+static void create_sensor_badge(lv_obj_t *parent, size_t idx)
+{
+    const EntityConfig *ent = &s_entities->items[idx];
+    EntityWidgets *w = &s_widgets[idx];
+
+    w->obj = lv_obj_create(parent);
+    lv_obj_add_style(w->obj, &style_badge, 0);
+    lv_obj_clear_flag(w->obj, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_set_static(w->obj, true);
+
+    if (is_celsius(ent->unit)) {
+        lv_obj_t *icon = lv_image_create(w->obj);
+        lv_image_set_src(icon, &ui_thermostat_icon);
+        lv_obj_add_style(icon, &style_badge_icon, 0);
+        lv_obj_set_static(icon, true);
+    }
+
+    w->value = create_label(w->obj, &style_badge_value, NULL);
+    lv_obj_add_style(w->value, &style_text_light, 0);
+    if (is_celsius(ent->unit)) {
+        lv_label_set_text(w->value, "--.- °C");
+    } else {
+        lv_label_set_text_fmt(w->value, "-- %s", ent->unit ? ent->unit : "");
+    }
+}
+
+static lv_obj_t *create_container(lv_obj_t *parent, lv_flex_flow_t flow, lv_dir_t scroll_dir)
+{
+    lv_obj_t *cont = lv_obj_create(parent);
+    lv_obj_add_style(cont, &style_container, 0);
+    lv_obj_set_flex_flow(cont, flow);
+    lv_obj_set_scroll_dir(cont, scroll_dir);
+    return cont;
+}
+
+// ---------------- UI create ----------------
+void ui_create(const EntityTable *entities, const DashboardUiCallbacks *cbs)
+{
+    if (cbs) s_cbs = *cbs;
+
+    s_entities = entities;
+    s_widgets = calloc(entities->count, sizeof(EntityWidgets));
+    if (!s_widgets) {
+        ESP_LOGE(TAG, "No memory for %u entities", (unsigned)entities->count);
+        return;
+    }
+
+#if LVGL_VERSION_MAJOR >= 9
+    lv_obj_t *scr = lv_screen_active();
+#else
+    lv_obj_t *scr = lv_scr_act();
+#endif
+
+    // --- ADDING THE BACKGROUND IMAGE ---
+    // We create the image first so that it is in the background.
+    // Its source comes from the storage partition (ui_set_background).
+    background = lv_image_create(scr);
+    lv_obj_center(background);
+
+    // Screen, background, badges and their icons stay in the display's static
+    // layer (when it has one): a new clock or sensor value redraws only its
+    // label over a copy of them. Each is created before the labels it carries.
+    lv_obj_set_static(scr, true);
+    lv_obj_set_static(background, true);
+
+    init_styles_once();
+
+    // --- CREATION OF THE CLOCK BADGE ---
+    lv_obj_t * clock_badge = lv_obj_create(scr);
+    lv_obj_add_style(clock_badge, &style_badge, 0);
+    lv_obj_align(clock_badge, LV_ALIGN_TOP_MID, 0, 10);
+    lv_obj_clear_flag(clock_badge, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_set_static(clock_badge, true);
+
+    lv_obj_t * icon_clock = lv_img_create(clock_badge);
+    lv_img_set_src(icon_clock, &ui_img_clock_icon);
+    lv_obj_align(icon_clock, LV_ALIGN_LEFT_MID, 8, 0);
+    lv_obj_set_static(icon_clock, true);
+
+    label_clock = create_label(clock_badge, &style_text_light, NULL);
+    lv_label_set_text(label_clock, "--:--");
+    lv_obj_align(label_clock, LV_ALIGN_RIGHT_MID, -10, 0);
+
+    // --- TILES (switch / light / cover), scrollable grid between the badges ---
+    lv_obj_t *tiles = create_container(scr, LV_FLEX_FLOW_ROW_WRAP, LV_DIR_VER);
+    lv_obj_set_size(tiles, BSP_LCD_H_RES, BSP_LCD_V_RES - 60 - 70);
+    lv_obj_align(tiles, LV_ALIGN_TOP_MID, 0, 60);
+    lv_obj_set_flex_align(tiles, LV_FLEX_ALIGN_SPACE_BETWEEN, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
+    lv_obj_set_style_pad_hor(tiles, 20, 0);
+    lv_obj_set_style_pad_row(tiles, 20, 0);
+
+    // --- SENSOR BADGES, bottom row ---
+    lv_obj_t *sensors = create_container(scr, LV_FLEX_FLOW_ROW, LV_DIR_HOR);
+    lv_obj_set_size(sensors, BSP_LCD_H_RES, BADGE_H);
+    lv_obj_align(sensors, LV_ALIGN_BOTTOM_MID, 0, -15); // A bit higher from the edge
+    lv_obj_set_flex_align(sensors, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
+    lv_obj_set_style_pad_column(sensors, 10, 0);
+
+    // One pass over the table. Nothing is positioned by hand: the flex
+    // layout of both containers is computed once, on the next refresh.
+    for (size_t i = 0; i < entities->count; i++) {
+        switch (entities->items[i].type) {
+        case ENTITY_SWITCH:
+        case ENTITY_LIGHT:
+            create_toggle_tile(tiles, i);
+            break;
+        case ENTITY_COVER:
+            create_cover_tile(tiles, i);
+            break;
+        case ENTITY_SENSOR:
+            create_sensor_badge(sensors, i);
+            break;
+        }
+    }
+
+    // --- SCREEN TOUCH EVENT TO RESET TIMEOUT ---
+    lv_obj_add_event_cb(scr, screen_touch_cb, LV_EVENT_PRESSED, NULL);
+    lv_obj_add_event_cb(scr, screen_touch_cb, LV_EVENT_CLICKED, NULL);
+
+    ESP_LOGI(TAG, "Dashboard created: %u entities", (unsigned)entities->count);
+}
@@ -0,0 +1,41 @@
+#pragma once
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "lvgl.h"
+
+#include "entity_config.h"
+
+// Hooks the UI calls back into the application (firmware or host simulator)
+typedef struct {
+  void (*on_command)(const char *topic, const char *payload);  // a tile was used (toggle, brightness, cover)
+  void (*on_activity)(void);                                   // any touch on the screen (screen timeout)
+} DashboardUiCallbacks;
+
+// Build the dashboard for `entities` on the active screen: one tile per
+// switch / light / cover, one badge per sensor. The table must outlive the UI.
+// Must be called with the display lock held.
+void ui_create(const EntityTable *entities, const DashboardUiCallbacks *cbs);
+
+// Widget updates. Call from the LVGL task (timer callbacks) or with the display lock held.
+// `value` is the raw MQTT payload (not NUL-terminated).
+void ui_entity_set_state(size_t idx, const char *value, int len);
+void ui_entity_set_brightness(size_t idx, const char *value, int len);
+void ui_set_clock(const char *txt);
+
+// Room background behind the tiles (e.g. from bg_image_load()), NULL for none
+void ui_set_background(const void *src);
+
+// What is below every widget: the screen colour and the room background. The
+// framebuffer-less scanout fills from it the tiles that show nothing else.
+typedef struct {
+  uint16_t color;               // RGB565 of the screen
+  const lv_image_dsc_t *image;  // NULL for none
+  lv_area_t coords;             // of the image on the screen
+} UiBackgroundLayer;
+
+// Snapshot of the current layer, with the display lock held. Take it again after ui_set_background().
+void ui_get_background_layer(UiBackgroundLayer *layer);
+
+// Line `y` of `layer` (a UiBackgroundLayer), BSP_LCD_H_RES pixels; lvgl_port_scanout_bg_cb_t
+void ui_background_layer_line(void *layer, int32_t y, uint16_t *row);
@@ -0,0 +1,183 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "esp_log.h"
+
+#include "mqtt_config.h"
+#include "lamp_config.h"
+#include "entity_config.h"
+
+static const char *TAG = "entity_config";
+
+#define ENTITY_FILE_MAX  (64 * 1024)
+#define ENTITY_FIELDS    6
+
+// ---------------- Built-in table ----------------
+static EntityConfig s_builtin[3];
+static EntityTable s_table;
+
+static void builtin_table(EntityTable *out)
+{
+    size_t n = 0;
+
+    if (mqtt_config.topic_left_state) {
+        s_builtin[n++] = (EntityConfig) {
+            .type = ENTITY_SWITCH,
+            .name = lamp_config.left_label,
+            .state_topic = mqtt_config.topic_left_state,
+            .cmd_topic = mqtt_config.topic_left_cmd,
+        };
+    }
+    if (mqtt_config.topic_right_state) {
+        s_builtin[n++] = (EntityConfig) {
+            .type = ENTITY_SWITCH,
+            .name = lamp_config.right_label,
+            .state_topic = mqtt_config.topic_right_state,
+            .cmd_topic = mqtt_config.topic_right_cmd,
+        };
+    }
+    if (mqtt_config.topic_temperature) {
+        s_builtin[n++] = (EntityConfig) {
+            .type = ENTITY_SENSOR,
+            .name = "Temperature",
+            .state_topic = mqtt_config.topic_temperature,
+            .unit = "°C",
+        };
+    }
+
+    out->items = s_builtin;
+    out->count = n;
+}
+
+// ---------------- Parser ----------------
+static int parse_type(const char *s)
+{
+    if (strcmp(s, "switch") == 0) return ENTITY_SWITCH;
+    if (strcmp(s, "sensor") == 0) return ENTITY_SENSOR;
+    if (strcmp(s, "light") == 0)  return ENTITY_LIGHT;
+    if (strcmp(s, "cover") == 0)  return ENTITY_COVER;
+    return -1;
+}
+
+static inline const char *opt(char *s)
+{
+    return (s && s[0]) ? s : NULL;
+}
+
+esp_err_t entity_table_parse(char *text, EntityTable *out)
+{
+    // First pass: count candidate lines to size the array once
+    size_t lines = 1;
+    for (const char *p = text; *p; p++) {
+        if (*p == '\n') lines++;
+    }
+
+    EntityConfig *items = calloc(lines, sizeof(EntityConfig));
+    if (!items) return ESP_ERR_NO_MEM;
+
+    size_t count = 0;
+    int lineno = 0;
+    char *line = text;
+    while (line) {
+        char *next = strchr(line, '\n');
+        if (next) *next++ = '\0';
+        lineno++;
+
+        size_t n = strlen(line);
+        if (n && line[n - 1] == '\r') line[--n] = '\0';
+        if (n == 0 || line[0] == '#') {
+            line = next;
+            continue;
+        }
+
+        // Split on '|', in place
+        char *f[ENTITY_FIELDS] = {0};
+        int nf = 0;
+        for (char *p = line; p && nf < ENTITY_FIELDS; nf++) {
+            f[nf] = p;
+            p = strchr(p, '|');
+            if (p) *p++ = '\0';
+        }
+
+        int type = parse_type(f[0]);
+        if (type < 0 || nf < 3 || !opt(f[1]) || !opt(f[2])) {
+            ESP_LOGE(TAG, "line %d: expected type|name|state_topic[|cmd_topic|extra|extra2]", lineno);
+            free(items);
+            return ESP_ERR_INVALID_ARG;
+        }
+
+        EntityConfig *e = &items[count++];
+        e->type = (EntityType)type;
+        e->name = f[1];
+        e->state_topic = f[2];
+        e->cmd_topic = (type == ENTITY_SENSOR) ? NULL : opt(f[3]);
+        if (type == ENTITY_SENSOR) {
+            e->unit = opt(f[4]);
+        } else if (type == ENTITY_LIGHT) {
+            e->brightness_state_topic = opt(f[4]);
+            e->brightness_cmd_topic = opt(f[5]);
+        }
+
+        line = next;
+    }
+
+    if (count == 0) {
+        free(items);
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    out->items = items;
+    out->count = count;
+    return ESP_OK;
+}
+
+// ---------------- Loading ----------------
+esp_err_t entity_table_load(const char *path)
+{
+    esp_err_t err = ESP_FAIL;
+    char *text = NULL;
+
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        ESP_LOGW(TAG, "%s not found, using built-in entities", path);
+        err = ESP_ERR_NOT_FOUND;
+        goto fallback;
+    }
+
+    text = malloc(ENTITY_FILE_MAX);
+    if (!text) {
+        fclose(f);
+        err = ESP_ERR_NO_MEM;
+        goto fallback;
+    }
+    size_t n = fread(text, 1, ENTITY_FILE_MAX - 1, f);
+    fclose(f);
+    text[n] = '\0';
+
+    // Keep only what was read: the table points into this buffer
+    char *shrunk = realloc(text, n + 1);
+    if (shrunk) text = shrunk;
+
+    EntityTable t;
+    err = entity_table_parse(text, &t);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "%s: invalid entity file (0x%x), using built-in entities", path, err);
+        free(text);
+        goto fallback;
+    }
+
+    s_table = t;
+    ESP_LOGI(TAG, "%u entities loaded from %s", (unsigned)t.count, path);
+    return ESP_OK;
+
+fallback:
+    builtin_table(&s_table);
+    return err;
+}
+
+const EntityTable *entity_table_get(void)
+{
+    if (s_table.items == NULL) builtin_table(&s_table);
+    return &s_table;
+}
@@ -0,0 +1,45 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+#include "esp_err.h"
+
+typedef enum {
+  ENTITY_SWITCH,    // ON/OFF state, "TOGGLE" on click
+  ENTITY_SENSOR,    // read-only value + unit
+  ENTITY_LIGHT,     // switch + brightness (0..255)
+  ENTITY_COVER,     // open/closed/position, OPEN / STOP / CLOSE
+} EntityType;
+
+typedef struct {
+  EntityType type;
+  const char *name;
+  const char *state_topic;
+  const char *cmd_topic;                // NULL for sensors
+  const char *unit;                     // sensor only
+  const char *brightness_state_topic;   // light only
+  const char *brightness_cmd_topic;     // light only
+} EntityConfig;
+
+typedef struct {
+  const EntityConfig *items;
+  size_t count;
+} EntityTable;
+
+// Entity file on the `storage` partition, one entity per line ('#' = comment):
+//   type|name|state_topic|cmd_topic|extra|extra2
+//   switch|Lamp left|home/roo1panel/lamp_left/state|home/roo1panel/lamp_left/cmd
+//   sensor|Temperature|home/roo1panel/temperature||°C
+//   light|Ceiling|home/x/light/state|home/x/light/set|home/x/light/brightness|home/x/light/brightness/set
+//   cover|Shutter|home/x/cover/state|home/x/cover/set
+#define ENTITY_CONFIG_FILE "entities.cfg"
+
+// Load the table from `path`. On any error the built-in table (mqtt_config /
+// lamp_config: two lamps + temperature) is used and the error is returned.
+esp_err_t entity_table_load(const char *path);
+
+// Parse `text` in place (the buffer is kept and referenced by the table).
+esp_err_t entity_table_parse(char *text, EntityTable *out);
+
+// Table in use (built-in until entity_table_load() succeeds).
+const EntityTable *entity_table_get(void);
@@ -13,17 +13,25 @@
 #include <time.h>
 
 #include "esp_timer.h"
+#include "esp_heap_caps.h"
 #include "bsp/display.h" 
 
 // BSP Waveshare + LVGL
 #include "bsp/esp32_s3_touch_lcd_4.h"
 #include "lvgl.h"
+#include "src/draw/sw/lv_draw_sw.h"     // corner cache
 
 #include "mqtt_config.h"
-#include "lamp_config.h"
+#include "entity_config.h"
+#include "dashboard_ui.h"
+#include "bg_image.h"
+#include "image_cache.h"
+#include "mqtt_dispatch.h"
+#include "clock_service.h"
+#include "topic_registry.h"
+#include "lvgl_stats.h"
 
 static void screen_reset_timeout(void);
-static void screen_touch_cb(lv_event_t *e);
 
 // WiFi 
 extern void wifi_init_sta(void);
@@ -32,282 +40,40 @@ extern void wifi_wait_connected(void);
 
 static const char *TAG = "ws_lcd4";
 
-// ---- UI Globals ----
-static lv_obj_t *label_clock;
-static lv_obj_t *btn_left;
-static lv_obj_t *btn_right;
-static lv_obj_t *label_temp;
-
-static bool left_state  = false;
-static bool right_state = false;
-
-// Styles OFF/ON 
-static lv_style_t style_off;
-static lv_style_t style_on;
-static bool styles_inited = false;
-
 static esp_mqtt_client_handle_t g_mqtt = NULL;
 
 static char s_mqtt_uri[96];
 
 
-#define ICON_LAMP "\uE21E" // Unicode Material Icons: lamp
-#define COLOR_LAMP_ON   lv_color_hex(0xFF9800)
-#define COLOR_LAMP_OFF  lv_color_hex(0x607D8B)
-
 #define SCREEN_TIMEOUT_MS  (120000)  // 2 minutes
 
 
-LV_IMAGE_DECLARE(floor_lamp); 
-LV_IMG_DECLARE(backg_room1); 
-LV_IMG_DECLARE(ui_img_clock_icon);
-LV_IMG_DECLARE(ui_thermostat_icon);
-
 static esp_timer_handle_t screen_timer;
 static bool screen_dimmed = false;
 
 
-// ---------------- UI helpers ----------------
-static void init_button_styles_once(void)
-{
-    if (styles_inited) return;
-    styles_inited = true;
-
-    lv_style_init(&style_off);
-    lv_style_set_bg_color(&style_off, lv_palette_main(LV_PALETTE_GREY));
-    lv_style_set_bg_opa(&style_off, LV_OPA_COVER);
-    lv_style_set_radius(&style_off, 10);
-
-    lv_style_init(&style_on);
-    lv_style_set_bg_color(&style_on, COLOR_LAMP_ON);
-    lv_style_set_bg_opa(&style_on, LV_OPA_COVER);
-    lv_style_set_radius(&style_on, 10);
-}
-
-static void set_btn_state(lv_obj_t *btn, bool on)
-{
-    if (on) {
-        lv_obj_add_state(btn, LV_STATE_CHECKED);
-        lv_obj_set_style_bg_color(btn, COLOR_LAMP_ON, LV_PART_MAIN);
-    } else {
-        lv_obj_clear_state(btn, LV_STATE_CHECKED);
-        lv_obj_set_style_bg_color(btn, COLOR_LAMP_OFF, LV_PART_MAIN);
-    }
-}
-
-static void ui_set_left(bool on)
-{
-    if (on == left_state) return;
-    left_state = on;
-
-    bsp_display_lock(0);
-    set_btn_state(btn_left, left_state);
-    bsp_display_unlock();
-}
-
-static void ui_set_right(bool on)
-{
-    if (on == right_state) return;
-    right_state = on;
-
-    bsp_display_lock(0);
-    set_btn_state(btn_right, right_state);
-    bsp_display_unlock();
-}
-
 static inline void mqtt_publish(const char *topic, const char *payload, int qos, int retain)
 {
     if (!g_mqtt || !topic) return;
     esp_mqtt_client_publish(g_mqtt, topic, payload, 0, qos, retain);
 }
 
-static inline void send_toggle_left(void)
+// ---------------- UI callbacks ----------------
+static void on_command(const char *topic, const char *payload)
 {
-    mqtt_publish(mqtt_config.topic_left_cmd, "TOGGLE", 1, 0);
+    mqtt_publish(topic, payload, 1, 0);
 }
 
-static inline void send_toggle_right(void)
-{
-    mqtt_publish(mqtt_config.topic_right_cmd, "TOGGLE", 1, 0);
-}
-
-// ---------------- Button callback ----------------
-static void btn_event_cb(lv_event_t *e)
-{
-    screen_reset_timeout();
-    if (lv_event_get_code(e) != LV_EVENT_CLICKED) return;
-
-    const char *name = (const char *)lv_event_get_user_data(e);
-    ESP_LOGI(TAG, "Button clicked: %s", name);
-
-    if (strcmp(name, "lamp_left") == 0) {
-        send_toggle_left();
-    } else if (strcmp(name, "lamp_right") == 0) {
-        send_toggle_right();
-    }
-}
-
-// ---------------- UI create ----------------
-static void ui_create(void)
-{
-#if LVGL_VERSION_MAJOR >= 9
-    lv_obj_t *scr = lv_screen_active();
-#else
-    lv_obj_t *scr = lv_scr_act();
-#endif
-
-    // --- ADDING THE BACKGROUND IMAGE ---
-    // We create the image first so that it is in the background.
-    lv_obj_t * bg = lv_img_create(scr);
-    lv_img_set_src(bg, &backg_room1);
-    lv_obj_center(bg); 
-
-    init_button_styles_once();
-
-     // --- CREAT CREATION OF THE CLOCK BADGE ---
-    lv_obj_t * clock_badge = lv_obj_create(scr);
-    lv_obj_set_size(clock_badge, 100, 40);
-    lv_obj_align(clock_badge, LV_ALIGN_TOP_MID, 0, 10);
-    
-    // 1. Apply the COLOR_LAMP_OFF color
-    lv_obj_set_style_bg_color(clock_badge, lv_color_hex(0x607D8B), 0);
-    lv_obj_set_style_bg_opa(clock_badge, LV_OPA_COVER, 0); // Make the background fully opaque
-    
-    // 2. Optional: Harmonize borders and rounding
-    lv_obj_set_style_border_width(clock_badge, 0, 0);      // Remove the default border
-    lv_obj_set_style_radius(clock_badge, 10, 0);           // Rounded corners matching the buttons
-    
-    lv_obj_set_style_pad_all(clock_badge, 5, 0);
-    lv_obj_set_layout(clock_badge, 0); 
-    lv_obj_clear_flag(clock_badge, LV_OBJ_FLAG_SCROLLABLE);
-
-    lv_obj_t * icon_clock = lv_img_create(clock_badge);
-    lv_img_set_src(icon_clock, &ui_img_clock_icon);
-    lv_obj_align(icon_clock, LV_ALIGN_LEFT_MID, 8, 0);
-
-    label_clock = lv_label_create(clock_badge);
-    lv_label_set_text(label_clock, "--:--");
-    lv_obj_set_style_text_color(label_clock, lv_color_white(), 0); // Text in white
-    lv_obj_set_style_text_font(label_clock, &lv_font_montserrat_14, 0); 
-    lv_obj_align(label_clock, LV_ALIGN_RIGHT_MID, -10, 0);
-
-    // =========================
-    // Left button
-    // =========================
-    btn_left = lv_btn_create(scr);
-    lv_obj_set_size(btn_left, 200, 130);
-    lv_obj_align(btn_left, LV_ALIGN_LEFT_MID, 20, 0);
-    lv_obj_add_event_cb(btn_left, btn_event_cb, LV_EVENT_CLICKED, (void*)"lamp_left");
-
-    lv_obj_add_style(btn_left, &style_off, 0);
-    lv_obj_add_style(btn_left, &style_on, LV_STATE_CHECKED);
-
-    lv_obj_t *icon_left = lv_image_create(btn_left);
-    lv_image_set_src(icon_left, &floor_lamp);
-    lv_obj_align(icon_left, LV_ALIGN_TOP_MID, 0, 8);
-  
-    // Label (bottom)
-    lv_obj_t *text_left = lv_label_create(btn_left);
-    lv_label_set_text(text_left, lamp_config.left_label);
-    lv_obj_set_style_text_align(text_left, LV_TEXT_ALIGN_CENTER, 0);
-    lv_obj_align(text_left, LV_ALIGN_BOTTOM_MID, 0, -10);
-
-
-    // =========================
-    // Right button
-    // =========================
-    btn_right = lv_btn_create(scr);
-
-    lv_obj_set_size(btn_right, 200, 130);
-    lv_obj_align(btn_right, LV_ALIGN_RIGHT_MID, -20, 0);
-    lv_obj_add_event_cb(btn_right, btn_event_cb, LV_EVENT_CLICKED, (void*)"lamp_right");
-
-    lv_obj_add_style(btn_right, &style_off, 0);
-    lv_obj_add_style(btn_right, &style_on, LV_STATE_CHECKED);
-
-    lv_obj_t *icon_right = lv_image_create(btn_right);
-    lv_image_set_src(icon_right, &floor_lamp); 
-    lv_obj_align(icon_right, LV_ALIGN_TOP_MID, 0, 8);
-
-    // Label (bottom)
-    lv_obj_t *text_right = lv_label_create(btn_right);
-    lv_label_set_text(text_right, lamp_config.right_label);
-    lv_obj_set_style_text_align(text_right, LV_TEXT_ALIGN_CENTER, 0);
-    lv_obj_align(text_right, LV_ALIGN_BOTTOM_MID, 0, -10);
-
-    // Initial states (will be updated by MQTT retain)
-    set_btn_state(btn_left, left_state);
-    set_btn_state(btn_right, right_state);
+static const DashboardUiCallbacks ui_cbs = {
+    .on_command  = on_command,
+    .on_activity = screen_reset_timeout,
+};
 
-    
-    // --- CREATION OF THE TEMPERATURE BADGE ---
-    lv_obj_t * temp_badge = lv_obj_create(scr);
-    lv_obj_set_size(temp_badge, 100, 40); 
-    lv_obj_align(temp_badge, LV_ALIGN_BOTTOM_MID, 0, -15); // A bit higher from the edge
-    
-    // Style of the badge (Color 0x607D8B consistent with the buttons)
-    lv_obj_set_style_bg_color(temp_badge, lv_color_hex(0x607D8B), 0);
-    lv_obj_set_style_bg_opa(temp_badge, LV_OPA_COVER, 0);
-    lv_obj_set_style_border_width(temp_badge, 0, 0);
-    lv_obj_set_style_radius(temp_badge, 10, 0);
-    lv_obj_set_style_pad_all(temp_badge, 5, 0);
-    lv_obj_set_layout(temp_badge, 0); 
-    lv_obj_clear_flag(temp_badge, LV_OBJ_FLAG_SCROLLABLE);
-
-    // Add thermostat icon
-    lv_obj_t * icon_temp = lv_img_create(temp_badge);
-    lv_img_set_src(icon_temp, &ui_thermostat_icon);
-    lv_obj_align(icon_temp, LV_ALIGN_LEFT_MID, 5, 0);
-
-    // Temperature label (Uses the global variable label_temp)
-    label_temp = lv_label_create(temp_badge);
-    lv_label_set_text(label_temp, "--.- °C");
-    
-    lv_obj_set_style_text_color(label_temp, lv_color_white(), 0); 
-    lv_obj_set_style_text_font(label_temp, &lv_font_montserrat_14, 0); 
-    
-    lv_obj_align(label_temp, LV_ALIGN_RIGHT_MID, -8, 0);
-
-    // --- SCREEN TOUCH EVENT TO RESET TIMEOUT ---
-    #if LVGL_VERSION_MAJOR >= 9
-    lv_obj_t *scr2 = lv_screen_active();
-    #else
-    lv_obj_t *scr2 = lv_scr_act();
-    #endif
-    lv_obj_add_event_cb(scr2, screen_touch_cb, LV_EVENT_PRESSED, NULL);
-    lv_obj_add_event_cb(scr2, screen_touch_cb, LV_EVENT_CLICKED, NULL);
-}
 // ---------------- MQTT handling ----------------
-static void handle_state_msg(const char *topic, const char *data, int len)
+static void mqtt_subscribe_topic(const char *topic, void *arg)
 {
-    bool on = (len >= 2 && data[0] == 'O' && data[1] == 'N');
-
-    if (mqtt_config.topic_left_state && strcmp(topic, mqtt_config.topic_left_state) == 0) {
-        ui_set_left(on);
-        return;
-    }
-    if (mqtt_config.topic_right_state && strcmp(topic, mqtt_config.topic_right_state) == 0) {
-        ui_set_right(on);
-        return;
-    }
-   
-    if (mqtt_config.topic_temperature && strcmp(topic, mqtt_config.topic_temperature) == 0) {
-        if (data == NULL || len <= 0) return;
-
-        char buf[16];
-        int copy_len = (len < sizeof(buf) - 1) ? len : sizeof(buf) - 1;
-        memcpy(buf, data, copy_len);
-        buf[copy_len] = '\0';
-
-        ESP_LOGI(TAG, "Affichage Temp: %s", buf);
-
-        bsp_display_lock(0);
-        if (label_temp != NULL) {
-            lv_label_set_text_fmt(label_temp, "%s °C", buf);
-        }
-        bsp_display_unlock();
-    }
-   
+    (void)arg;
+    esp_mqtt_client_subscribe(g_mqtt, topic, 1);
 }
 
 static void mqtt_event_handler(void *handler_args, esp_event_base_t base, int32_t event_id, void *event_data)
@@ -318,14 +84,9 @@ static void mqtt_event_handler(void *handler_args, esp_event_base_t base, int32_
     case MQTT_EVENT_CONNECTED:
         ESP_LOGI(TAG, "MQTT connected");
 
-        if (mqtt_config.topic_left_state)  esp_mqtt_client_subscribe(g_mqtt, mqtt_config.topic_left_state, 1);
-        if (mqtt_config.topic_right_state) esp_mqtt_client_subscribe(g_mqtt, mqtt_config.topic_right_state, 1);
-       /* if (mqtt_config.topic_temperature) esp_mqtt_client_subscribe(g_mqtt, mqtt_config.topic_temperature, 1);*/
-
-         if (mqtt_config.topic_temperature) {
-      //  ESP_LOGI(TAG, "Sub: %s", mqtt_config.topic_temperature);
-        esp_mqtt_client_subscribe(g_mqtt, mqtt_config.topic_temperature, 1);
-    }
+        // Build the topic table once, then subscribe to every registered topic
+        mqtt_dispatch_init();
+        topic_registry_foreach(mqtt_subscribe_topic, NULL);
 
         // online (retain)
         if (mqtt_config.topic_status) mqtt_publish(mqtt_config.topic_status, "online", 1, 1);
@@ -335,18 +96,12 @@ static void mqtt_event_handler(void *handler_args, esp_event_base_t base, int32_
         ESP_LOGW(TAG, "MQTT disconnected");
         break;
 
-    case MQTT_EVENT_DATA: {
-       char t[192];
-        int tn = (e->topic_len < (int)sizeof(t) - 1) ? e->topic_len : (int)sizeof(t) - 1;
-        memcpy(t, e->topic, tn);
-        t[tn] = 0;
+    case MQTT_EVENT_DATA:
+        ESP_LOGI(TAG, "MQTT rx topic=%.*s data=%.*s", e->topic_len, e->topic, e->data_len, e->data);
 
-        ESP_LOGI(TAG, "MQTT rx topic=%s data=%.*s", t, e->data_len, e->data);
-
-        // 2. On envoie tout à handle_state_msg (qui gère maintenant lampes ET température)
-        handle_state_msg(t, e->data, e->data_len);
+        // Lookup directly on the topic slice, no copy
+        handle_state_msg(e->topic, e->topic_len, e->data, e->data_len);
         break;
-    }
 
     default:
         break;
@@ -375,6 +130,9 @@ static void mqtt_start(void)
     };
 
     g_mqtt = esp_mqtt_client_init(&cfg);
+#if CONFIG_DASHBOARD_LVGL_STATS
+    lvgl_stats_set_mqtt(g_mqtt);
+#endif
     esp_mqtt_client_register_event(g_mqtt, ESP_EVENT_ANY_ID, mqtt_event_handler, NULL);
     esp_mqtt_client_start(g_mqtt);
 }
@@ -389,20 +147,6 @@ void init_clock_sync() {
     tzset();
 }
 
-void update_clock_label() {
-    time_t now;
-    struct tm timeinfo;
-    time(&now);
-    localtime_r(&now, &timeinfo);
-
-    // Si l'année est < 2020, l'heure n'est pas encore synchronisée
-    if (timeinfo.tm_year > 120) {
-        char buf[8];
-        strftime(buf, sizeof(buf), "%H:%M", &timeinfo);
-        lv_label_set_text(label_clock, buf);
-    }
-}
-
 static void lcd_sleep(void)
 {
     if (screen_dimmed) return;
@@ -410,6 +154,12 @@ static void lcd_sleep(void)
 
     // Éteint le rétroéclairage via BSP (0%)
     bsp_display_backlight_off();
+#if CONFIG_DASHBOARD_LVGL_EVENT_DRIVEN && CONFIG_DASHBOARD_TOUCH_SLEEP_POLL_MS
+    // Polled touch reads are the idle LVGL task's wakeups: fewer while nothing is shown
+    bsp_display_lock(0);
+    lvgl_port_set_touch_idle_poll_ms(CONFIG_DASHBOARD_TOUCH_SLEEP_POLL_MS);
+    bsp_display_unlock();
+#endif
 }
 
 static void lcd_wake(void)
@@ -422,6 +172,9 @@ static void lcd_wake(void)
 
     // Optionnel: invalide l'écran pour forcer un redraw
     bsp_display_lock(0);
+#if CONFIG_DASHBOARD_LVGL_EVENT_DRIVEN && CONFIG_DASHBOARD_TOUCH_SLEEP_POLL_MS
+    lvgl_port_set_touch_idle_poll_ms(CONFIG_DASHBOARD_TOUCH_IDLE_POLL_MS);
+#endif
 #if LVGL_VERSION_MAJOR >= 9
     lv_obj_invalidate(lv_screen_active());
 #else
@@ -444,11 +197,34 @@ static void screen_reset_timeout(void)
     esp_timer_start_once(screen_timer, (uint64_t)SCREEN_TIMEOUT_MS * 1000ULL);
 }
 
-static void screen_touch_cb(lv_event_t *e)
+// Allocators of the LVGL caches and pools kept out of its 64 KB heap, the call sites say why in which RAM
+#if CONFIG_DASHBOARD_LVGL_CORNER_CACHE_KB || CONFIG_DASHBOARD_LVGL_SPILL_POOL_KB
+static void *psram_malloc(size_t size)
+{
+    return heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+}
+#endif
+
+#if CONFIG_DASHBOARD_LVGL_GLYPH_CACHE_KB || CONFIG_DASHBOARD_LVGL_DRAW_POOL_KB || CONFIG_DASHBOARD_LVGL_SCREEN_ARENA_KB
+static void *internal_malloc(size_t size)
+{
+    return heap_caps_malloc(size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+}
+#endif
+
+#if CONFIG_DASHBOARD_LVGL_STATIC_LAYER
+// Static objects of the whole screen, copied under each redrawn area: PSRAM, like the frame buffers
+static void static_layer_start(void)
 {
-    (void)e;
-    screen_reset_timeout();
+    const uint32_t size = lv_draw_buf_width_to_stride(BSP_LCD_H_RES, LV_COLOR_FORMAT_RGB565) * BSP_LCD_V_RES;
+    void *buf = heap_caps_aligned_alloc(LV_DRAW_BUF_ALIGN, size, MALLOC_CAP_SPIRAM);
+    if (buf == NULL) {
+        ESP_LOGW(TAG, "No PSRAM for the static layer (%lu bytes)", (unsigned long)size);
+        return;
+    }
+    lv_display_set_static_layer(lv_display_get_default(), buf, size);
 }
+#endif
 
 // ---------------- Main ----------------
 void app_main(void)
@@ -458,14 +234,89 @@ void app_main(void)
     wifi_init_sta();
     wifi_wait_connected();
 
-    bsp_display_start();
+    // Entities (tiles, badges, topics) from the storage partition, built-in table otherwise
+    bool storage_ok = bsp_spiffs_mount() == ESP_OK;
+    if (storage_ok) {
+        entity_table_load(BSP_SPIFFS_MOUNT_POINT "/" ENTITY_CONFIG_FILE);
+    }
+    const EntityTable *entities = entity_table_get();
+
+    bsp_display_cfg_t disp_cfg = {
+        .lvgl_port_cfg = ESP_LVGL_PORT_INIT_CONFIG(),
+    };
+#if CONFIG_DASHBOARD_LVGL_EVENT_DRIVEN
+    // LVGL task sleeps until a timer is due, a redraw, a touch or a MQTT state (mqtt_dispatch wakes it)
+    disp_cfg.lvgl_port_cfg.flags.event_driven = 1;
+    disp_cfg.lvgl_port_cfg.touch_idle_poll_ms = CONFIG_DASHBOARD_TOUCH_IDLE_POLL_MS;
+#endif
+    bsp_display_start_with_config(&disp_cfg);
     bsp_display_backlight_on();   // important au boot
 
     bsp_display_lock(0);
-    ui_create();
+#if CONFIG_DASHBOARD_LVGL_SPILL_POOL_KB
+    // Heap beyond the 64 KB of internal RAM, taken a pool at a time: only large, rarely read blocks spill
+    lv_mem_set_spill_pools(CONFIG_DASHBOARD_LVGL_SPILL_POOL_KB * 1024, CONFIG_DASHBOARD_LVGL_SPILL_POOL_MAX,
+                           psram_malloc, heap_caps_free);
+    lv_mem_set_spill_policy(1024, 1U << LV_MEM_TAG_APP);   // large buffers, label texts and chart points
+#endif
+#if CONFIG_DASHBOARD_LVGL_CORNER_CACHE_KB
+    // Corners are a few hundred bytes read per repaint: PSRAM is fast enough
+    lv_draw_sw_corner_cache_set_size(CONFIG_DASHBOARD_LVGL_CORNER_CACHE_KB * 1024, psram_malloc, heap_caps_free);
+#endif
+#if CONFIG_DASHBOARD_LVGL_GLYPH_CACHE_KB
+    // Glyphs are read at every label redraw: internal RAM
+    lv_font_glyph_cache_set_size(CONFIG_DASHBOARD_LVGL_GLYPH_CACHE_KB * 1024, internal_malloc, heap_caps_free);
+#endif
+#if CONFIG_DASHBOARD_LVGL_DRAW_POOL_KB
+    // Draw tasks are created and freed at every refresh: internal RAM
+    lv_draw_pool_set_size(CONFIG_DASHBOARD_LVGL_DRAW_POOL_KB * 1024, internal_malloc, heap_caps_free);
+#endif
+    lv_font_fmt_txt_add_ascii_index(&lv_font_montserrat_14);   // clock, temperature and tile labels
+#if CONFIG_DASHBOARD_LVGL_STATIC_LAYER
+    static_layer_start();
+#endif
+#if CONFIG_DASHBOARD_LVGL_OCCLUSION_CULLING
+    lv_display_set_occlusion_culling(lv_display_get_default(), true);
+#endif
+#if CONFIG_DASHBOARD_LVGL_INV_JOIN_COST_PX
+    lv_display_set_inv_join(lv_display_get_default(), LV_DISPLAY_INV_JOIN_COST, CONFIG_DASHBOARD_LVGL_INV_JOIN_COST_PX);
+#endif
+    image_cache_start(CONFIG_DASHBOARD_LVGL_IMAGE_CACHE_KB * 1024);
+#if CONFIG_DASHBOARD_LVGL_SCREEN_ARENA_KB
+    // Objects are read at every refresh: internal RAM
+    lv_mem_arena_t *arena = lv_mem_arena_create(CONFIG_DASHBOARD_LVGL_SCREEN_ARENA_KB * 1024, internal_malloc,
+                                                heap_caps_free);
+    lv_mem_arena_t *prev_arena = lv_mem_set_arena(arena);
+#endif
+    ui_create(entities, &ui_cbs);
+#if CONFIG_DASHBOARD_LVGL_SCREEN_ARENA_KB
+    lv_mem_set_arena(prev_arena);
+    if (arena) {
+        lv_mem_arena_stats_t as;
+        lv_mem_arena_get_stats(arena, &as);
+        ESP_LOGI(TAG, "Screen arena: %u of %u bytes, %u allocations, %u in the LVGL heap", (unsigned)as.used,
+                 (unsigned)as.size, (unsigned)as.cnt, (unsigned)as.fallbacks);
+        lv_mem_arena_release(arena);   // freed with the dashboard's last object
+    }
+#endif
+    const lv_image_dsc_t *bg;   // compressed in the storage partition, decoded per redrawn row
+    if (storage_ok && bg_image_load(BSP_SPIFFS_MOUNT_POINT "/" BG_IMAGE_DEFAULT, &bg) == ESP_OK) {
+        ui_set_background(bg);
+    }
+#if CONFIG_BSP_DISPLAY_LVGL_SCANOUT_TILES
+    // No frame buffer: tiles equal to the screen colour / room background take no memory
+    static UiBackgroundLayer bg_layer;
+    ui_get_background_layer(&bg_layer);
+    lvgl_port_set_scanout_background(lv_display_get_default(), ui_background_layer_line, &bg_layer);
+#endif
+    mqtt_dispatch_start_ui(entities);   // MQTT states reach the widgets through the mailbox
+    clock_service_start();              // clock label refreshed by an LVGL timer, once per minute
+#if CONFIG_DASHBOARD_LVGL_STATS
+    lvgl_stats_start();                 // logged once per minute by an LVGL timer
+#endif
     bsp_display_unlock();
 
-    // ---- timer veille écran (AVANT while) ----
+    // ---- timer veille écran ----
     const esp_timer_create_args_t targs = {
         .callback = &screen_timer_cb,
         .name = "screen_timeout",
@@ -476,8 +327,5 @@ void app_main(void)
     init_clock_sync();
     mqtt_start();
 
-    while (1) {
-        vTaskDelay(pdMS_TO_TICKS(10000));
-        update_clock_label();
-    }
+    // Nothing left to poll: LVGL, MQTT and the timers run in their own tasks
 }
\ No newline at end of file
@@ -0,0 +1,46 @@
+#include <stdio.h>
+
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+
+#include "lvgl.h"
+#include "src/draw/lv_draw_buf_private.h"   // lv_draw_buf_handlers_t
+#include "src/misc/cache/lv_cache.h"         // lv_image_cache_*
+
+#include "image_cache.h"
+
+static const char *TAG = "image_cache";
+
+// As LVGL's default: room to align the pixels to LV_DRAW_BUF_ALIGN
+static void *psram_buf_malloc(size_t size, lv_color_format_t cf)
+{
+    (void)cf;
+    return heap_caps_malloc(size + LV_DRAW_BUF_ALIGN - 1, MALLOC_CAP_SPIRAM);
+}
+
+static void psram_buf_free(void *buf)
+{
+    heap_caps_free(buf);
+}
+
+void image_cache_start(uint32_t budget)
+{
+    // Every buffer the image decoders create: the cached images and the ones
+    // decoded while the cache is disabled or too small for them
+    lv_draw_buf_handlers_t *handlers = lv_draw_buf_get_image_handlers();
+    handlers->buf_malloc_cb = psram_buf_malloc;
+    handlers->buf_free_cb = psram_buf_free;
+
+    lv_image_cache_resize(budget, false);
+    ESP_LOGI(TAG, "%u KB of decoded images in PSRAM", (unsigned)(budget / 1024));
+}
+
+int image_cache_stats_json(char *buf, size_t len, bool reset)
+{
+    lv_image_cache_stats_t st;
+    lv_image_cache_get_stats(&st, reset);
+    return snprintf(buf, len,
+                    "{\"hits\":%lu,\"misses\":%lu,\"evictions\":%lu,\"images\":%lu,\"bytes\":%lu,\"budget\":%lu}",
+                    (unsigned long)st.hits, (unsigned long)st.misses, (unsigned long)st.evictions,
+                    (unsigned long)st.entries, (unsigned long)st.size, (unsigned long)st.max_size);
+}
@@ -0,0 +1,18 @@
+#pragma once
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Decoded images in PSRAM: LVGL compressed assets of the storage partition
+// (e.g. a plain LZ4 room background, see bg_image.h) are decoded whole by
+// LVGL's bin decoder. Without a cache that happens at every draw; with it the
+// decoded pixels are kept in PSRAM within a byte budget, the largest image
+// among the ones used about as recently evicted first (lv_image_cache).
+
+// Decode into PSRAM and keep up to `budget` bytes of decoded images, 0 disables.
+// Call once, with the display lock held, after lv_init().
+void image_cache_start(uint32_t budget);
+
+// Hits, misses, evictions, images and bytes as one JSON object (for MQTT).
+// Returns the length written, as snprintf(). Call with the display lock held.
+int image_cache_stats_json(char *buf, size_t len, bool reset);
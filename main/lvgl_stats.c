@@ -0,0 +1,155 @@
+#include <stdio.h>
+
+#include "esp_log.h"
+#include "mqtt_client.h"
+
+#include "bsp/esp32_s3_touch_lcd_4.h"
+#include "lvgl.h"
+#include "src/draw/sw/lv_draw_sw.h"     // corner cache
+
+#include "mqtt_config.h"
+#include "image_cache.h"
+#include "lvgl_stats.h"
+
+#if CONFIG_DASHBOARD_LVGL_STATS
+
+static const char *TAG = "lvgl_stats";
+
+static esp_mqtt_client_handle_t s_mqtt;
+
+static void lvgl_stats_timer_cb(lv_timer_t *t)
+{
+    (void)t;
+    lvgl_port_stats_t st;
+    lvgl_port_get_stats(&st, true);
+    uint64_t total_us = st.busy_us + st.idle_us;
+    ESP_LOGI(TAG, "LVGL task: %lu wakeups (timer %lu, display %lu, touch %lu, vsync %lu, user %lu), busy %llu us (%.2f%%)",
+             (unsigned long)st.wakeups, (unsigned long)st.wakeups_timer, (unsigned long)st.wakeups_display,
+             (unsigned long)st.wakeups_touch, (unsigned long)st.wakeups_vsync, (unsigned long)st.wakeups_user,
+             (unsigned long long)st.busy_us,
+             total_us ? 100.0 * (double)st.busy_us / (double)total_us : 0.0);
+
+#if CONFIG_BSP_DISPLAY_LVGL_VSYNC_PACED
+    lvgl_port_frame_stats_t frs;
+    if (lvgl_port_get_frame_stats(lv_display_get_default(), &frs, true) == ESP_OK) {
+        ESP_LOGI(TAG, "Frames: %lu on %lu VSYNC, %lu late, %lu scanouts dropped",
+                 (unsigned long)frs.frames, (unsigned long)frs.vsyncs, (unsigned long)frs.late,
+                 (unsigned long)frs.dropped);
+    }
+#endif
+#if CONFIG_BSP_DISPLAY_LVGL_SCANOUT_RLE_LINES
+    // Compressed lines replace the 450 KB frame buffer, their bytes read replace its scanouts
+    lvgl_port_scanout_stats_t ss;
+    if (lvgl_port_get_scanout_stats(lv_display_get_default(), &ss, true) == ESP_OK && ss.lines > 0) {
+        const uint64_t fb_bytes = (uint64_t)BSP_LCD_H_RES * BSP_LCD_V_RES * 2;
+        const uint64_t read_per_scanout = ss.bytes_read * BSP_LCD_V_RES / ss.lines;
+        ESP_LOGI(TAG, "Scanout: lines %lu RLE, %lu raw, %lu bytes (%llu%% of the frame buffer, %lu not stored), %llu bytes read per scanout (%llu%% saved)",
+                 (unsigned long)ss.lines_rle, (unsigned long)ss.lines_raw, (unsigned long)ss.bytes,
+                 (unsigned long long)(ss.bytes * 100 / fb_bytes), (unsigned long)ss.alloc_failures,
+                 (unsigned long long)read_per_scanout,
+                 (unsigned long long)(read_per_scanout < fb_bytes ? 100 - read_per_scanout * 100 / fb_bytes : 0));
+    }
+#elif CONFIG_BSP_DISPLAY_LVGL_SCANOUT
+    // Tile store memory replaces the 450 KB frame buffer, bytes read replace its scanouts
+    lvgl_port_scanout_stats_t ss;
+    if (lvgl_port_get_scanout_stats(lv_display_get_default(), &ss, true) == ESP_OK) {
+        ESP_LOGI(TAG, "Scanout: tiles %lu background, %lu solid, %lu pixels (%lu bytes, %lu not stored), %lu lines (%lu with background), %llu bytes read",
+                 (unsigned long)ss.tiles_bg, (unsigned long)ss.tiles_solid, (unsigned long)ss.tiles_pixels,
+                 (unsigned long)ss.bytes, (unsigned long)ss.alloc_failures, (unsigned long)ss.lines,
+                 (unsigned long)ss.bg_lines, (unsigned long long)ss.bytes_read);
+    }
+#endif
+#if CONFIG_DASHBOARD_LVGL_CORNER_CACHE_KB
+    lv_draw_sw_corner_cache_stats_t cs;
+    lv_draw_sw_corner_cache_get_stats(&cs, true);
+    ESP_LOGI(TAG, "Corner cache: %lu hits, %lu misses (%.1f%% hit), %lu evicted, %lu uncached, %lu corners in %lu bytes",
+             (unsigned long)cs.hits, (unsigned long)cs.misses,
+             cs.hits + cs.misses ? 100.0 * cs.hits / (cs.hits + cs.misses) : 0.0,
+             (unsigned long)cs.evictions, (unsigned long)cs.uncached, (unsigned long)cs.entries, (unsigned long)cs.size);
+#endif
+#if CONFIG_DASHBOARD_LVGL_GLYPH_CACHE_KB
+    lv_font_glyph_cache_stats_t gs;
+    lv_font_glyph_cache_get_stats(&gs, true);
+    ESP_LOGI(TAG, "Glyph cache: %lu hits, %lu misses (%.1f%% hit), %lu evicted, %lu uncached, %lu of %lu slots",
+             (unsigned long)gs.hits, (unsigned long)gs.misses,
+             gs.hits + gs.misses ? 100.0 * gs.hits / (gs.hits + gs.misses) : 0.0,
+             (unsigned long)gs.evictions, (unsigned long)gs.uncached, (unsigned long)gs.entries, (unsigned long)gs.slots);
+#endif
+#if CONFIG_DASHBOARD_LVGL_DRAW_POOL_KB
+    lv_draw_pool_stats_t ps = {0};
+    for (int cls = 0; cls < LV_DRAW_POOL_CNT; cls++) {
+        lv_draw_pool_stats_t st;
+        lv_draw_pool_get_stats(cls, &st, true);
+        ps.hits += st.hits;
+        ps.fallbacks += st.fallbacks;
+        ps.peak += st.peak;
+        ps.slots += st.slots;
+    }
+    ESP_LOGI(TAG, "Draw pool: %lu hits, %lu fallbacks, peak %lu of %lu slots",
+             (unsigned long)ps.hits, (unsigned long)ps.fallbacks, (unsigned long)ps.peak, (unsigned long)ps.slots);
+#endif
+#if CONFIG_DASHBOARD_LVGL_SPILL_POOL_KB
+    lv_mem_monitor_t mm, sm;
+    lv_mem_monitor_heap(LV_MEM_HEAP_MAIN, &mm);
+    lv_mem_monitor_heap(LV_MEM_HEAP_SPILL, &sm);
+    lv_mem_spill_stats_t ms;
+    lv_mem_get_spill_stats(&ms, true);
+    ESP_LOGI(TAG, "LVGL heap: %lu bytes used (%u%% frag), spill %lu bytes used in %lu pools (peak %lu, %u%% frag), %lu taken, %lu given back, %lu failed",
+             (unsigned long)(mm.total_size - mm.free_size), mm.frag_pct, (unsigned long)(sm.total_size - sm.free_size),
+             (unsigned long)ms.pools, (unsigned long)ms.max_pools, sm.frag_pct, (unsigned long)ms.added,
+             (unsigned long)ms.removed, (unsigned long)ms.failed);
+#endif
+#if CONFIG_LV_USE_MEM_TAGS
+    static const char *const tag_names[] = {"app", "objects", "styles", "draw", "cache"};
+    for (int tag = 0; tag < LV_MEM_TAG_CNT; tag++) {
+        lv_mem_tag_stats_t ts;
+        lv_mem_get_tag_stats(tag, &ts, true);
+        ESP_LOGI(TAG, "LVGL heap %s: %lu bytes (peak %lu, %lu spilled) in %lu allocations", tag_names[tag],
+                 (unsigned long)ts.used, (unsigned long)ts.max_used, (unsigned long)ts.spill_used, (unsigned long)ts.cnt);
+    }
+#endif
+#if CONFIG_DASHBOARD_LVGL_STATIC_LAYER
+    lv_display_static_layer_stats_t ls;
+    lv_display_get_static_layer_stats(lv_display_get_default(), &ls, true);
+    ESP_LOGI(TAG, "Static layer: %lu areas composited, %lu drawn again in full, %lu renders (%lu pixels)",
+             (unsigned long)ls.composited, (unsigned long)ls.fallbacks, (unsigned long)ls.renders,
+             (unsigned long)ls.rendered_px);
+#endif
+    lv_display_overdraw_stats_t os;
+    lv_display_get_overdraw_stats(lv_display_get_default(), &os, true);
+    ESP_LOGI(TAG, "Overdraw: %.2f over %lu frames (peak %.2f), %lu objects culled, %lu hidden, %lu areas flushed",
+             os.flushed_px ? (double)os.drawn_px / (double)os.flushed_px : 0.0, (unsigned long)os.frames,
+             os.peak_x100 / 100.0, (unsigned long)os.culled_objs, (unsigned long)os.hidden_objs,
+             (unsigned long)os.flushes);
+    // Decoded image cache: logged and published for the Home Assistant side
+    char json[128];
+    char topic[64];
+    image_cache_stats_json(json, sizeof(json), true);
+    ESP_LOGI(TAG, "Image cache: %s", json);
+    snprintf(topic, sizeof(topic), "%s/diag/image_cache", mqtt_config.base);
+    if (s_mqtt) {
+        // Stored in the outbox and sent by the MQTT task: a publish could block on the socket
+        esp_mqtt_client_enqueue(s_mqtt, topic, json, 0, 0, 0, true);
+    }
+#if BSP_LVGL_ASYNC_FLUSH
+    // copy - wait = copy time hidden behind the rendering of the next area
+    lvgl_port_flush_stats_t fs;
+    if (lvgl_port_get_flush_stats(lv_display_get_default(), &fs, true) == ESP_OK) {
+        ESP_LOGI(TAG, "Flush: %lu DMA (%llu bytes) + %lu CPU, copy %llu us (max %lu us), waited %llu us",
+                 (unsigned long)fs.flushes, (unsigned long long)fs.bytes, (unsigned long)fs.cpu_flushes,
+                 (unsigned long long)fs.copy_us, (unsigned long)fs.copy_us_max, (unsigned long long)fs.wait_us);
+    }
+#endif
+}
+
+void lvgl_stats_start(void)
+{
+    lv_timer_create(lvgl_stats_timer_cb, 60000, NULL);
+}
+
+void lvgl_stats_set_mqtt(esp_mqtt_client_handle_t client)
+{
+    s_mqtt = client;
+}
+
+#endif
@@ -0,0 +1,12 @@
+#pragma once
+#include "mqtt_client.h"
+
+// LVGL statistics (CONFIG_DASHBOARD_LVGL_STATS): task wakeups, frames, caches, heap and overdraw,
+// logged once per minute by an LVGL timer. The image cache statistics are also published as JSON
+// on <base>/diag/image_cache, queued for the MQTT task so the LVGL task never waits on the socket.
+
+// Create the timer. Call once, with the display lock held, after ui_create().
+void lvgl_stats_start(void);
+
+// Publish through `client` from now on. Before, the statistics are only logged.
+void lvgl_stats_set_mqtt(esp_mqtt_client_handle_t client);
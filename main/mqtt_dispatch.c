@@ -0,0 +1,95 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "esp_log.h"
+#include "esp_lvgl_port.h"
+#include "lvgl.h"
+
+#include "dashboard_ui.h"
+#include "topic_registry.h"
+#include "state_mailbox.h"
+#include "mqtt_dispatch.h"
+
+static const char *TAG = "mqtt_dispatch";
+
+// Mailbox slots: [0, count) = state of entity i,
+// [count, count + n_bright) = brightness of light s_bright_entity[slot - count]
+static const EntityTable *s_entities;
+static uint16_t *s_bright_entity;
+static size_t s_bright_cnt;
+
+// ---------------- UI side (LVGL task) ----------------
+static void apply_state(int slot, const char *data, int len)
+{
+    if ((size_t)slot < s_entities->count) {
+        ui_entity_set_state((size_t)slot, data, len);
+    } else {
+        ui_entity_set_brightness(s_bright_entity[(size_t)slot - s_entities->count], data, len);
+    }
+}
+
+static void mailbox_drain_cb(void *ctx)
+{
+    (void)ctx;
+    state_mailbox_drain();
+}
+
+void mqtt_dispatch_start_ui(const EntityTable *entities)
+{
+    s_entities = entities;
+
+    for (size_t i = 0; i < entities->count; i++) {
+        if (entities->items[i].brightness_state_topic) s_bright_cnt++;
+    }
+    if (s_bright_cnt) {
+        s_bright_entity = malloc(s_bright_cnt * sizeof(uint16_t));
+        if (!s_bright_entity) {
+            ESP_LOGE(TAG, "No memory for brightness slots, brightness updates disabled");
+            s_bright_cnt = 0;
+        }
+        size_t n = 0;
+        for (size_t i = 0; i < entities->count && n < s_bright_cnt; i++) {
+            if (entities->items[i].brightness_state_topic) s_bright_entity[n++] = (uint16_t)i;
+        }
+    }
+
+    ESP_ERROR_CHECK(state_mailbox_init(entities->count + s_bright_cnt, apply_state));
+    // Drained when post_state() wakes the LVGL task, no timer polling an empty mailbox
+    ESP_ERROR_CHECK(lvgl_port_set_user_event_cb(mailbox_drain_cb, NULL));
+}
+
+// ---------------- MQTT side (MQTT task) ----------------
+static void post_state(const char *data, int len, void *ctx)
+{
+    if (state_mailbox_post((int)(intptr_t)ctx, data, len)) {
+        // Wakes of a burst merge in the event group until the LVGL task runs
+        lvgl_port_task_wake(LVGL_PORT_EVENT_USER, NULL);
+    }
+}
+
+void mqtt_dispatch_init(void)
+{
+    topic_registry_clear();
+    if (!s_entities) return;
+
+    size_t bright = 0;
+    for (size_t i = 0; i < s_entities->count; i++) {
+        const EntityConfig *e = &s_entities->items[i];
+
+        topic_registry_add(e->state_topic, post_state, (void *)(intptr_t)i);
+        if (e->brightness_state_topic && bright < s_bright_cnt) {
+            topic_registry_add(e->brightness_state_topic, post_state, (void *)(intptr_t)(s_entities->count + bright++));
+        }
+    }
+
+    ESP_LOGI(TAG, "%u topics registered", (unsigned)topic_registry_count());
+}
+
+void handle_state_msg(const char *topic, int topic_len, const char *data, int len)
+{
+    if (!topic_registry_dispatch(topic, topic_len, data, len)) {
+        ESP_LOGD(TAG, "No handler for %.*s", topic_len, topic);
+    }
+}
@@ -0,0 +1,15 @@
+#pragma once
+
+#include "entity_config.h"
+
+// Create the state mailbox for `entities`, drained by the LVGL task when a state is posted.
+// Call once from app_main, with the display lock held, after ui_create() and before mqtt_start().
+void mqtt_dispatch_start_ui(const EntityTable *entities);
+
+// Register the state topics of every entity in the topic registry.
+// Call once after connecting, then subscribe with topic_registry_foreach().
+void mqtt_dispatch_init(void);
+
+// Route an incoming MQTT message to the UI (MQTT task, never takes the display lock).
+// `topic` and `data` are slices as delivered by esp-mqtt (not NUL-terminated).
+void handle_state_msg(const char *topic, int topic_len, const char *data, int len);
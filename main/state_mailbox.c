@@ -0,0 +1,120 @@
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "esp_log.h"
+
+#include "state_mailbox.h"
+
+static const char *TAG = "state_mailbox";
+
+// Each slot is a seqlock: odd sequence = write in progress.
+// The dirty bit is set only once the write is complete, so a torn read on
+// the consumer side can simply be skipped: the bit is already set again.
+typedef struct {
+    _Atomic uint32_t seq;
+    uint8_t len;
+    char value[STATE_MAILBOX_VALUE_MAX];
+} StateSlot;
+
+static StateSlot *s_slots;
+static _Atomic uint32_t *s_dirty;       // one bit per slot
+static size_t s_slot_cnt;
+static size_t s_dirty_words;
+static StateApplyFn s_apply;
+
+static _Atomic uint32_t s_received;
+static _Atomic uint32_t s_coalesced;
+static _Atomic uint32_t s_applied;
+
+esp_err_t state_mailbox_init(size_t slots, StateApplyFn apply)
+{
+    if (slots == 0 || !apply) return ESP_ERR_INVALID_ARG;
+    if (s_slots) return ESP_ERR_INVALID_STATE;
+
+    size_t words = (slots + 31) / 32;
+    StateSlot *sl = calloc(slots, sizeof(StateSlot));
+    _Atomic uint32_t *dirty = calloc(words, sizeof(*dirty));
+    if (!sl || !dirty) {
+        free(sl);
+        free(dirty);
+        return ESP_ERR_NO_MEM;
+    }
+
+    s_slots = sl;
+    s_dirty = dirty;
+    s_slot_cnt = slots;
+    s_dirty_words = words;
+    s_apply = apply;
+
+    ESP_LOGI(TAG, "%u slots, %u bytes", (unsigned)slots, (unsigned)(slots * sizeof(StateSlot) + words * 4));
+    return ESP_OK;
+}
+
+// ---------------- Producer ----------------
+bool state_mailbox_post(int slot, const char *value, int len)
+{
+    if (!s_slots || slot < 0 || (size_t)slot >= s_slot_cnt) return false;
+    if (len < 0) len = 0;
+    if (len > STATE_MAILBOX_VALUE_MAX) len = STATE_MAILBOX_VALUE_MAX;
+
+    StateSlot *s = &s_slots[slot];
+    uint32_t seq = atomic_load_explicit(&s->seq, memory_order_relaxed);
+
+    atomic_store_explicit(&s->seq, seq + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    if (len) memcpy(s->value, value, len);
+    s->len = (uint8_t)len;
+    atomic_store_explicit(&s->seq, seq + 2, memory_order_release);
+
+    uint32_t bit = 1u << (slot & 31);
+    uint32_t prev = atomic_fetch_or_explicit(&s_dirty[slot >> 5], bit, memory_order_release);
+
+    atomic_fetch_add_explicit(&s_received, 1, memory_order_relaxed);
+    if (prev & bit) atomic_fetch_add_explicit(&s_coalesced, 1, memory_order_relaxed);
+    return true;
+}
+
+// ---------------- Consumer ----------------
+uint32_t state_mailbox_drain(void)
+{
+    uint32_t applied = 0;
+
+    for (size_t w = 0; w < s_dirty_words; w++) {
+        if (atomic_load_explicit(&s_dirty[w], memory_order_relaxed) == 0) continue;
+
+        uint32_t bits = atomic_exchange_explicit(&s_dirty[w], 0, memory_order_acquire);
+        while (bits) {
+            int slot = (int)(w * 32) + __builtin_ctz(bits);
+            bits &= bits - 1;
+
+            StateSlot *s = &s_slots[slot];
+            char value[STATE_MAILBOX_VALUE_MAX];
+
+            uint32_t seq0 = atomic_load_explicit(&s->seq, memory_order_acquire);
+            uint8_t len = s->len;
+            memcpy(value, s->value, len);
+            atomic_thread_fence(memory_order_acquire);
+            uint32_t seq1 = atomic_load_explicit(&s->seq, memory_order_relaxed);
+
+            if ((seq0 & 1) || seq0 != seq1) {
+                // Producer is rewriting this slot; it re-flags it when done
+                atomic_fetch_add_explicit(&s_coalesced, 1, memory_order_relaxed);
+                continue;
+            }
+
+            s_apply(slot, value, len);
+            applied++;
+        }
+    }
+
+    if (applied) atomic_fetch_add_explicit(&s_applied, applied, memory_order_relaxed);
+    return applied;
+}
+
+void state_mailbox_get_stats(StateMailboxStats *out)
+{
+    out->received = atomic_load_explicit(&s_received, memory_order_relaxed);
+    out->coalesced = atomic_load_explicit(&s_coalesced, memory_order_relaxed);
+    out->applied = atomic_load_explicit(&s_applied, memory_order_relaxed);
+}
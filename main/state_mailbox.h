@@ -0,0 +1,32 @@
+#pragma once
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "esp_err.h"
+
+// Latest-value mailbox between the MQTT task (single producer) and the
+// LVGL task (single consumer). One slot per entity: posting overwrites the
+// pending value, draining applies each dirty slot once. Lock-free on both sides.
+
+#define STATE_MAILBOX_VALUE_MAX 32      // longer payloads are truncated
+
+// Called from state_mailbox_drain() for each slot that changed since the last drain.
+typedef void (*StateApplyFn)(int slot, const char *value, int len);
+
+typedef struct {
+    uint32_t received;      // state_mailbox_post() calls accepted
+    uint32_t coalesced;     // values overwritten before being applied
+    uint32_t applied;       // values handed to the apply callback
+} StateMailboxStats;
+
+// Allocate `slots` entries. Call once, before the producer and consumer start.
+esp_err_t state_mailbox_init(size_t slots, StateApplyFn apply);
+
+// Producer side (MQTT task). Never blocks. Returns false for an unknown slot.
+bool state_mailbox_post(int slot, const char *value, int len);
+
+// Consumer side (LVGL task, e.g. from an lv_timer). Returns the number of slots applied.
+uint32_t state_mailbox_drain(void);
+
+void state_mailbox_get_stats(StateMailboxStats *out);
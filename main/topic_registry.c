@@ -0,0 +1,155 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "esp_log.h"
+
+#include "topic_registry.h"
+
+static const char *TAG = "topic_registry";
+
+// Open addressing, linear probing. Capacity is a power of two and kept
+// at most half full so a miss stops after a couple of probes.
+typedef struct {
+    const char *topic;      // NULL = empty slot
+    uint32_t hash;
+    uint16_t len;
+    TopicHandler handler;
+    void *ctx;
+    uint32_t more;          // 1 + index in s_links of the next handler, 0 = none
+} TopicEntry;
+
+// Further handlers of a topic shared by several entities, in registration order
+typedef struct {
+    TopicHandler handler;
+    void *ctx;
+    uint32_t next;          // as TopicEntry.more
+} TopicLink;
+
+#define TOPIC_REGISTRY_MIN_CAP 16
+
+static TopicEntry *s_slots;
+static uint32_t s_cap;      // power of two
+static uint32_t s_count;
+static TopicLink *s_links;
+static uint32_t s_link_cnt;
+static uint32_t s_link_cap;
+
+// FNV-1a, 32 bit
+static inline uint32_t topic_hash(const char *s, size_t len)
+{
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < len; i++) {
+        h ^= (uint8_t)s[i];
+        h *= 16777619u;
+    }
+    return h;
+}
+
+static TopicEntry *find_slot(TopicEntry *slots, uint32_t cap, const char *topic, size_t len, uint32_t hash)
+{
+    uint32_t mask = cap - 1;
+    for (uint32_t i = hash & mask;; i = (i + 1) & mask) {
+        TopicEntry *e = &slots[i];
+        if (e->topic == NULL) return e;
+        if (e->hash == hash && e->len == len && memcmp(e->topic, topic, len) == 0) return e;
+    }
+}
+
+static esp_err_t grow(void)
+{
+    uint32_t cap = s_cap ? s_cap * 2 : TOPIC_REGISTRY_MIN_CAP;
+    TopicEntry *slots = calloc(cap, sizeof(TopicEntry));
+    if (!slots) return ESP_ERR_NO_MEM;
+
+    for (uint32_t i = 0; i < s_cap; i++) {
+        const TopicEntry *e = &s_slots[i];
+        if (e->topic) *find_slot(slots, cap, e->topic, e->len, e->hash) = *e;
+    }
+
+    free(s_slots);
+    s_slots = slots;
+    s_cap = cap;
+    return ESP_OK;
+}
+
+static esp_err_t add_link(TopicEntry *e, TopicHandler handler, void *ctx)
+{
+    if (s_link_cnt == s_link_cap) {
+        uint32_t cap = s_link_cap ? s_link_cap * 2 : 4;
+        TopicLink *links = realloc(s_links, cap * sizeof(TopicLink));
+        if (!links) return ESP_ERR_NO_MEM;
+        s_links = links;
+        s_link_cap = cap;
+    }
+
+    uint32_t *tail = &e->more;
+    while (*tail) tail = &s_links[*tail - 1].next;
+    s_links[s_link_cnt] = (TopicLink){.handler = handler, .ctx = ctx, .next = 0};
+    *tail = ++s_link_cnt;
+    return ESP_OK;
+}
+
+esp_err_t topic_registry_add(const char *topic, TopicHandler handler, void *ctx)
+{
+    if (!topic || !handler) return ESP_ERR_INVALID_ARG;
+
+    size_t len = strlen(topic);
+    if (len == 0 || len > UINT16_MAX) return ESP_ERR_INVALID_ARG;
+
+    if ((s_count + 1) * 2 > s_cap) {
+        esp_err_t err = grow();
+        if (err != ESP_OK) return err;
+    }
+
+    uint32_t hash = topic_hash(topic, len);
+    TopicEntry *e = find_slot(s_slots, s_cap, topic, len, hash);
+    if (e->topic) {
+        ESP_LOGD(TAG, "Topic %s shared by another handler", topic);
+        return add_link(e, handler, ctx);
+    }
+
+    s_count++;
+    e->topic = topic;
+    e->hash = hash;
+    e->len = (uint16_t)len;
+    e->handler = handler;
+    e->ctx = ctx;
+    e->more = 0;
+    return ESP_OK;
+}
+
+bool topic_registry_dispatch(const char *topic, int topic_len, const char *data, int data_len)
+{
+    if (s_count == 0 || !topic || topic_len <= 0) return false;
+
+    const TopicEntry *e = find_slot(s_slots, s_cap, topic, (size_t)topic_len, topic_hash(topic, (size_t)topic_len));
+    if (!e->topic) return false;
+
+    e->handler(data, data_len, e->ctx);
+    for (uint32_t i = e->more; i; i = s_links[i - 1].next) s_links[i - 1].handler(data, data_len, s_links[i - 1].ctx);
+    return true;
+}
+
+void topic_registry_foreach(void (*cb)(const char *topic, void *arg), void *arg)
+{
+    for (uint32_t i = 0; i < s_cap; i++) {
+        if (s_slots[i].topic) cb(s_slots[i].topic, arg);
+    }
+}
+
+size_t topic_registry_count(void)
+{
+    return s_count;
+}
+
+void topic_registry_clear(void)
+{
+    free(s_slots);
+    free(s_links);
+    s_slots = NULL;
+    s_cap = 0;
+    s_count = 0;
+    s_links = NULL;
+    s_link_cnt = 0;
+    s_link_cap = 0;
+}
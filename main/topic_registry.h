@@ -0,0 +1,29 @@
+#pragma once
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "esp_err.h"
+
+// Handler for one registered topic. `data` is not NUL-terminated.
+typedef void (*TopicHandler)(const char *data, int len, void *ctx);
+
+// Hash-indexed topic -> handler table.
+// Topic strings are NOT copied: they must outlive the registry (config tables, literals).
+// Matching is done on the (topic, topic_len) slice as delivered by esp-mqtt, no copy.
+
+// Register a topic. Registering the same topic again adds a handler: a message on it calls
+// every handler in registration order (two entities showing the same state topic).
+esp_err_t topic_registry_add(const char *topic, TopicHandler handler, void *ctx);
+
+// Look up the slice and call its handler. Returns false if the topic is unknown.
+bool topic_registry_dispatch(const char *topic, int topic_len, const char *data, int data_len);
+
+// Call `cb` once for every registered topic (e.g. to subscribe after connect).
+void topic_registry_foreach(void (*cb)(const char *topic, void *arg), void *arg);
+
+// Number of distinct topics.
+size_t topic_registry_count(void);
+
+// Drop all entries and free the table.
+void topic_registry_clear(void);
@@ -34,6 +34,7 @@ extern "C" {
 typedef enum {
     LVGL_PORT_EVENT_DISPLAY = 0x01,
     LVGL_PORT_EVENT_TOUCH   = 0x02,
+    LVGL_PORT_EVENT_VSYNC   = 0x04,
     LVGL_PORT_EVENT_USER    = 0x80,
 } lvgl_port_event_type_t;
 
@@ -55,8 +56,33 @@ typedef struct {
     int task_max_sleep_ms;    /*!< Maximum sleep in LVGL task */
     unsigned task_stack_caps; /*!< LVGL task stack memory capabilities (see esp_heap_caps.h) */
     int timer_period_ms;      /*!< LVGL timer tick period in ms */
+    int touch_idle_poll_ms;   /*!< Read period of a touch without interrupt pin after 1 s without touch, 0 keeps the LVGL read period (LVGL 9 only) */
+    struct {
+        unsigned int event_driven: 1; /*!< LVGL task sleeps until the next LVGL timer, an event or a wake, LVGL tick read from esp_timer (LVGL 9 only) */
+    } flags;
 } lvgl_port_cfg_t;
 
+#if LVGL_VERSION_MAJOR >= 9
+/**
+ * @brief LVGL task statistics
+ */
+typedef struct {
+    uint32_t wakeups;         /*!< LVGL task loop runs */
+    uint32_t wakeups_timer;   /*!< Runs started by a timeout (next LVGL timer or task_max_sleep_ms) */
+    uint32_t wakeups_display; /*!< Runs started by LVGL_PORT_EVENT_DISPLAY */
+    uint32_t wakeups_touch;   /*!< Runs started by LVGL_PORT_EVENT_TOUCH */
+    uint32_t wakeups_vsync;   /*!< Runs started by LVGL_PORT_EVENT_VSYNC (VSYNC paced RGB display) */
+    uint32_t wakeups_user;    /*!< Runs started by LVGL_PORT_EVENT_USER */
+    uint64_t busy_us;         /*!< Time spent reading input devices and in lv_timer_handler() */
+    uint64_t idle_us;         /*!< Time spent waiting for an event or timeout */
+} lvgl_port_stats_t;
+
+/**
+ * @brief Callback called from the LVGL task, with the LVGL mutex taken, after a LVGL_PORT_EVENT_USER wake
+ */
+typedef void (*lvgl_port_user_event_cb_t)(void *user_ctx);
+#endif
+
 /**
  * @brief LVGL port configuration structure
  *
@@ -141,6 +167,43 @@ esp_err_t lvgl_port_stop(void);
  */
 esp_err_t lvgl_port_resume(void);
 
+#if LVGL_VERSION_MAJOR >= 9
+/**
+ * @brief Set the callback run by the LVGL task after lvgl_port_task_wake(LVGL_PORT_EVENT_USER, ...)
+ *
+ * @note Wakes of other tasks are merged until the LVGL task runs, the callback is called once for them.
+ * Call it after lvgl_port_init(), with the LVGL mutex taken.
+ *
+ * @param cb        callback, NULL to remove it
+ * @param user_ctx  argument of the callback
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_STATE if the LVGL port is not initialized
+ */
+esp_err_t lvgl_port_set_user_event_cb(lvgl_port_user_event_cb_t cb, void *user_ctx);
+
+/**
+ * @brief Change the read period of a touch without interrupt pin after 1 s without touch (touch_idle_poll_ms)
+ *
+ * @note For example a slower one while the backlight is off. Applied at the next read of the touch.
+ * Call it with the LVGL mutex taken.
+ *
+ * @param ms    read period, 0 to keep the LVGL read period
+ */
+void lvgl_port_set_touch_idle_poll_ms(int ms);
+
+/**
+ * @brief Get LVGL task statistics, counted since lvgl_port_init() or the last reset
+ *
+ * @param stats     statistics output
+ * @param reset     true to clear the statistics after reading them
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_ARG if stats is NULL
+ */
+esp_err_t lvgl_port_get_stats(lvgl_port_stats_t *stats, bool reset);
+#endif
+
 /**
  * @brief Notify LVGL task, that display need reload
  *
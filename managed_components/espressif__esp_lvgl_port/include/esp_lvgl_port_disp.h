@@ -15,6 +15,7 @@
 #include "esp_lcd_panel_io.h"
 #include "esp_lcd_panel_ops.h"
 #include "lvgl.h"
+#include "esp_lvgl_port_scanout.h"
 
 #if LVGL_VERSION_MAJOR == 8
 #include "esp_lvgl_port_compatibility.h"
@@ -73,7 +74,11 @@ typedef struct {
     struct {
         unsigned int bb_mode: 1;        /*!< 1: Use bounce buffer mode */
         unsigned int avoid_tearing: 1;  /*!< 1: Use internal RGB buffers as a LVGL draw buffers to avoid tearing effect, enabling this option requires over two LCD buffers and may reduce the frame rate */
+        unsigned int async_flush: 1;    /*!< 1: Copy the draw buffer into the frame buffer with the async memcpy (GDMA) engine, LVGL renders the next area meanwhile. Partial mode only, requires double_buffer and buff_dma (ESP32-S3, IDF 5.4+) */
+        unsigned int vsync_paced: 1;    /*!< 1: Refresh the display on the panel VSYNC, at most one frame per scanout, instead of every LV_DEF_REFR_PERIOD (LVGL 9.4+) */
+        unsigned int no_fb: 1;          /*!< 1: The panel has no frame buffer (esp_lcd_rgb_panel_config_t no_fb): LVGL areas are kept in a store (scanout_format) the bounce buffers are filled from. Requires bb_mode, partial mode and RGB565 (ESP32-S3, IDF 5.1.2+) */
     } flags;
+    lvgl_port_scanout_format_t scanout_format;  /*!< Store of a display without frame buffer: tiles over a background or RLE compressed lines */
 } lvgl_port_display_rgb_cfg_t;
 
 /**
@@ -117,6 +122,86 @@ lv_display_t *lvgl_port_add_disp_dsi(const lvgl_port_display_cfg_t *disp_cfg, co
  */
 lv_display_t *lvgl_port_add_disp_rgb(const lvgl_port_display_cfg_t *disp_cfg, const lvgl_port_display_rgb_cfg_t *rgb_cfg);
 
+#if LVGL_VERSION_MAJOR >= 9
+/**
+ * @brief Flush statistics of a display with async flush (see lvgl_port_display_rgb_cfg_t)
+ *
+ * copy_us - wait_us is the copy time overlapped with rendering.
+ */
+typedef struct {
+    uint32_t flushes;       /*!< Areas copied by the async memcpy engine */
+    uint32_t cpu_flushes;   /*!< Areas copied by the CPU (not aligned for the DMA, e.g. SW rotation) */
+    uint64_t bytes;         /*!< Bytes copied by the async memcpy engine */
+    uint64_t copy_us;       /*!< Time from the flush to the end of the copy, summed */
+    uint32_t copy_us_max;   /*!< Longest copy */
+    uint64_t wait_us;       /*!< Time LVGL waited for a copy to end before the next flush, summed */
+} lvgl_port_flush_stats_t;
+
+/**
+ * @brief Get the flush statistics of a display
+ *
+ * @param disp LVGL display
+ * @param stats Filled with the statistics since start or since the last reset
+ * @param reset Clear the statistics after reading
+ * @return
+ *      - ESP_OK                    on success
+ *      - ESP_ERR_NOT_SUPPORTED     the display does not use the async flush
+ */
+esp_err_t lvgl_port_get_flush_stats(lv_display_t *disp, lvgl_port_flush_stats_t *stats, bool reset);
+
+/**
+ * @brief Frame statistics of a VSYNC paced display (see lvgl_port_display_rgb_cfg_t)
+ *
+ * A frame is due at the VSYNC following the one that started it: with avoid_tearing, it is shown then.
+ */
+typedef struct {
+    uint32_t vsyncs;        /*!< Panel VSYNCs (scanouts) */
+    uint32_t frames;        /*!< Frames rendered */
+    uint32_t late;          /*!< Frames that missed their VSYNC */
+    uint32_t dropped;       /*!< Scanouts missed by late frames: the previous frame was shown again */
+} lvgl_port_frame_stats_t;
+
+/**
+ * @brief Get the frame statistics of a display
+ *
+ * @param disp LVGL display
+ * @param stats Filled with the statistics since start or since the last reset
+ * @param reset Clear the statistics after reading
+ * @return
+ *      - ESP_OK                    on success
+ *      - ESP_ERR_NOT_SUPPORTED     the display is not VSYNC paced
+ */
+esp_err_t lvgl_port_get_frame_stats(lv_display_t *disp, lvgl_port_frame_stats_t *stats, bool reset);
+
+/**
+ * @brief Set the background of a display without frame buffer (see lvgl_port_display_rgb_cfg_t)
+ *
+ * Tiles equal to the background take no memory: it should be what LVGL draws below everything
+ * (e.g. the screen colour and a wallpaper). The active screen is invalidated. Not used by the
+ * RLE lines (LVGL_PORT_SCANOUT_RLE_LINES).
+ *
+ * @param disp LVGL display
+ * @param cb Line of the background, called from the bounce buffer interrupt (NULL: black)
+ * @param user_ctx User context given to the callback
+ * @return
+ *      - ESP_OK                    on success
+ *      - ESP_ERR_NOT_SUPPORTED     the display has a frame buffer
+ */
+esp_err_t lvgl_port_set_scanout_background(lv_display_t *disp, lvgl_port_scanout_bg_cb_t cb, void *user_ctx);
+
+/**
+ * @brief Get the store statistics of a display without frame buffer
+ *
+ * @param disp LVGL display
+ * @param stats Filled with the tile or line counts and the counters since start or since the last reset
+ * @param reset Clear the counters after reading
+ * @return
+ *      - ESP_OK                    on success
+ *      - ESP_ERR_NOT_SUPPORTED     the display has a frame buffer
+ */
+esp_err_t lvgl_port_get_scanout_stats(lv_display_t *disp, lvgl_port_scanout_stats_t *stats, bool reset);
+#endif
+
 /**
  * @brief Remove display handling from LVGL
  *
@@ -32,6 +32,21 @@ extern "C" {
     _lv_color_blend_to_rgb565_esp(dsc)
 #endif
 
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_RGB565_WITH_OPA
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB565_WITH_OPA(dsc) \
+    _lv_color_blend_to_rgb565_with_opa_esp(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_RGB565_WITH_MASK
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB565_WITH_MASK(dsc) \
+    _lv_color_blend_to_rgb565_with_mask_esp(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_RGB565_MIX_MASK_OPA
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB565_MIX_MASK_OPA(dsc) \
+    _lv_color_blend_to_rgb565_mix_mask_opa_esp(dsc)
+#endif
+
 #ifndef LV_DRAW_SW_COLOR_BLEND_TO_RGB888
 #define LV_DRAW_SW_COLOR_BLEND_TO_RGB888(dsc, dest_px_size) \
     _lv_color_blend_to_rgb888_esp(dsc, dest_px_size)
@@ -42,6 +57,41 @@ extern "C" {
     _lv_rgb565_blend_normal_to_rgb565_esp(dsc)
 #endif
 
+#ifndef LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_WITH_OPA
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_WITH_OPA(dsc)  \
+    _lv_rgb565_blend_normal_to_rgb565_with_opa_esp(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_WITH_MASK
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_WITH_MASK(dsc)  \
+    _lv_rgb565_blend_normal_to_rgb565_with_mask_esp(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA(dsc)  \
+    _lv_rgb565_blend_normal_to_rgb565_mix_mask_opa_esp(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565(dsc)  \
+    _lv_argb8888_blend_normal_to_rgb565_esp(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_WITH_OPA
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_WITH_OPA(dsc)  \
+    _lv_argb8888_blend_normal_to_rgb565_with_opa_esp(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_WITH_MASK
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_WITH_MASK(dsc)  \
+    _lv_argb8888_blend_normal_to_rgb565_with_mask_esp(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA(dsc)  \
+    _lv_argb8888_blend_normal_to_rgb565_mix_mask_opa_esp(dsc)
+#endif
+
 #ifndef LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB888
 #define LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB888(dsc, dest_px_size, src_px_size)  \
     _lv_rgb888_blend_normal_to_rgb888_esp(dsc, dest_px_size, src_px_size)
@@ -63,13 +113,25 @@ typedef struct {
     uint32_t mask_stride;
 } asm_dsc_t;
 
+/*
+ * Blend descriptors of the LVGL version including this file: `_lv_draw_sw_blend_*_dsc_t` in 9.1,
+ * `lv_draw_sw_blend_*_dsc_t` from 9.2 on, defined by lv_draw_sw_blend_private.h with the same fields
+ */
+#ifdef LV_DRAW_SW_BLEND_PRIVATE_H
+typedef lv_draw_sw_blend_fill_dsc_t lv_port_blend_fill_dsc_t;
+typedef lv_draw_sw_blend_image_dsc_t lv_port_blend_image_dsc_t;
+#else
+typedef _lv_draw_sw_blend_fill_dsc_t lv_port_blend_fill_dsc_t;
+typedef _lv_draw_sw_blend_image_dsc_t lv_port_blend_image_dsc_t;
+#endif
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
 
 extern int lv_color_blend_to_argb8888_esp(asm_dsc_t *asm_dsc);
 
-static inline lv_result_t _lv_color_blend_to_argb8888_esp(_lv_draw_sw_blend_fill_dsc_t *dsc)
+static inline lv_result_t _lv_color_blend_to_argb8888_esp(lv_port_blend_fill_dsc_t *dsc)
 {
     asm_dsc_t asm_dsc = {
         .dst_buf = dsc->dest_buf,
@@ -84,7 +146,7 @@ static inline lv_result_t _lv_color_blend_to_argb8888_esp(_lv_draw_sw_blend_fill
 
 extern int lv_color_blend_to_rgb565_esp(asm_dsc_t *asm_dsc);
 
-static inline lv_result_t _lv_color_blend_to_rgb565_esp(_lv_draw_sw_blend_fill_dsc_t *dsc)
+static inline lv_result_t _lv_color_blend_to_rgb565_esp(lv_port_blend_fill_dsc_t *dsc)
 {
     asm_dsc_t asm_dsc = {
         .dst_buf = dsc->dest_buf,
@@ -97,9 +159,80 @@ static inline lv_result_t _lv_color_blend_to_rgb565_esp(_lv_draw_sw_blend_fill_d
     return lv_color_blend_to_rgb565_esp(&asm_dsc);
 }
 
+/*
+ * RGB565 opacity and mask variants: esp32s3 only (PIE), esp32 keeps the ANSI code.
+ * The kernels take the color already converted to RGB565 in src_buf.
+ */
+#if CONFIG_IDF_TARGET_ESP32S3
+extern int lv_color_blend_to_rgb565_with_opa_esp(asm_dsc_t *asm_dsc);
+extern int lv_color_blend_to_rgb565_with_mask_esp(asm_dsc_t *asm_dsc);
+extern int lv_color_blend_to_rgb565_mix_mask_opa_esp(asm_dsc_t *asm_dsc);
+#endif
+
+static inline lv_result_t _lv_color_blend_to_rgb565_with_opa_esp(lv_port_blend_fill_dsc_t *dsc)
+{
+#if CONFIG_IDF_TARGET_ESP32S3
+    uint16_t color16 = lv_color_to_u16(dsc->color);
+    asm_dsc_t asm_dsc = {
+        .opa = dsc->opa,
+        .dst_buf = dsc->dest_buf,
+        .dst_w = dsc->dest_w,
+        .dst_h = dsc->dest_h,
+        .dst_stride = dsc->dest_stride,
+        .src_buf = &color16,
+    };
+
+    return lv_color_blend_to_rgb565_with_opa_esp(&asm_dsc);
+#else
+    return LV_RESULT_INVALID;
+#endif
+}
+
+static inline lv_result_t _lv_color_blend_to_rgb565_with_mask_esp(lv_port_blend_fill_dsc_t *dsc)
+{
+#if CONFIG_IDF_TARGET_ESP32S3
+    uint16_t color16 = lv_color_to_u16(dsc->color);
+    asm_dsc_t asm_dsc = {
+        .opa = dsc->opa,
+        .dst_buf = dsc->dest_buf,
+        .dst_w = dsc->dest_w,
+        .dst_h = dsc->dest_h,
+        .dst_stride = dsc->dest_stride,
+        .src_buf = &color16,
+        .mask_buf = dsc->mask_buf,
+        .mask_stride = dsc->mask_stride,
+    };
+
+    return lv_color_blend_to_rgb565_with_mask_esp(&asm_dsc);
+#else
+    return LV_RESULT_INVALID;
+#endif
+}
+
+static inline lv_result_t _lv_color_blend_to_rgb565_mix_mask_opa_esp(lv_port_blend_fill_dsc_t *dsc)
+{
+#if CONFIG_IDF_TARGET_ESP32S3
+    uint16_t color16 = lv_color_to_u16(dsc->color);
+    asm_dsc_t asm_dsc = {
+        .opa = dsc->opa,
+        .dst_buf = dsc->dest_buf,
+        .dst_w = dsc->dest_w,
+        .dst_h = dsc->dest_h,
+        .dst_stride = dsc->dest_stride,
+        .src_buf = &color16,
+        .mask_buf = dsc->mask_buf,
+        .mask_stride = dsc->mask_stride,
+    };
+
+    return lv_color_blend_to_rgb565_mix_mask_opa_esp(&asm_dsc);
+#else
+    return LV_RESULT_INVALID;
+#endif
+}
+
 extern int lv_color_blend_to_rgb888_esp(asm_dsc_t *asm_dsc);
 
-static inline lv_result_t _lv_color_blend_to_rgb888_esp(_lv_draw_sw_blend_fill_dsc_t *dsc, uint32_t dest_px_size)
+static inline lv_result_t _lv_color_blend_to_rgb888_esp(lv_port_blend_fill_dsc_t *dsc, uint32_t dest_px_size)
 {
     if (dest_px_size != 3) {
         return LV_RESULT_INVALID;
@@ -117,7 +250,7 @@ static inline lv_result_t _lv_color_blend_to_rgb888_esp(_lv_draw_sw_blend_fill_d
 
 extern int lv_rgb565_blend_normal_to_rgb565_esp(asm_dsc_t *asm_dsc);
 
-static inline lv_result_t _lv_rgb565_blend_normal_to_rgb565_esp(_lv_draw_sw_blend_image_dsc_t *dsc)
+static inline lv_result_t _lv_rgb565_blend_normal_to_rgb565_esp(lv_port_blend_image_dsc_t *dsc)
 {
     asm_dsc_t asm_dsc = {
         .dst_buf = dsc->dest_buf,
@@ -131,9 +264,165 @@ static inline lv_result_t _lv_rgb565_blend_normal_to_rgb565_esp(_lv_draw_sw_blen
     return lv_rgb565_blend_normal_to_rgb565_esp(&asm_dsc);
 }
 
+#if CONFIG_IDF_TARGET_ESP32S3
+extern int lv_rgb565_blend_normal_to_rgb565_with_opa_esp(asm_dsc_t *asm_dsc);
+extern int lv_rgb565_blend_normal_to_rgb565_with_mask_esp(asm_dsc_t *asm_dsc);
+extern int lv_rgb565_blend_normal_to_rgb565_mix_mask_opa_esp(asm_dsc_t *asm_dsc);
+#endif
+
+static inline lv_result_t _lv_rgb565_blend_normal_to_rgb565_with_opa_esp(lv_port_blend_image_dsc_t *dsc)
+{
+#if CONFIG_IDF_TARGET_ESP32S3
+    asm_dsc_t asm_dsc = {
+        .opa = dsc->opa,
+        .dst_buf = dsc->dest_buf,
+        .dst_w = dsc->dest_w,
+        .dst_h = dsc->dest_h,
+        .dst_stride = dsc->dest_stride,
+        .src_buf = dsc->src_buf,
+        .src_stride = dsc->src_stride
+    };
+
+    return lv_rgb565_blend_normal_to_rgb565_with_opa_esp(&asm_dsc);
+#else
+    return LV_RESULT_INVALID;
+#endif
+}
+
+static inline lv_result_t _lv_rgb565_blend_normal_to_rgb565_with_mask_esp(lv_port_blend_image_dsc_t *dsc)
+{
+#if CONFIG_IDF_TARGET_ESP32S3
+    asm_dsc_t asm_dsc = {
+        .opa = dsc->opa,
+        .dst_buf = dsc->dest_buf,
+        .dst_w = dsc->dest_w,
+        .dst_h = dsc->dest_h,
+        .dst_stride = dsc->dest_stride,
+        .src_buf = dsc->src_buf,
+        .src_stride = dsc->src_stride,
+        .mask_buf = dsc->mask_buf,
+        .mask_stride = dsc->mask_stride
+    };
+
+    return lv_rgb565_blend_normal_to_rgb565_with_mask_esp(&asm_dsc);
+#else
+    return LV_RESULT_INVALID;
+#endif
+}
+
+static inline lv_result_t _lv_rgb565_blend_normal_to_rgb565_mix_mask_opa_esp(lv_port_blend_image_dsc_t *dsc)
+{
+#if CONFIG_IDF_TARGET_ESP32S3
+    asm_dsc_t asm_dsc = {
+        .opa = dsc->opa,
+        .dst_buf = dsc->dest_buf,
+        .dst_w = dsc->dest_w,
+        .dst_h = dsc->dest_h,
+        .dst_stride = dsc->dest_stride,
+        .src_buf = dsc->src_buf,
+        .src_stride = dsc->src_stride,
+        .mask_buf = dsc->mask_buf,
+        .mask_stride = dsc->mask_stride
+    };
+
+    return lv_rgb565_blend_normal_to_rgb565_mix_mask_opa_esp(&asm_dsc);
+#else
+    return LV_RESULT_INVALID;
+#endif
+}
+
+/*
+ * ARGB8888 image blend to RGB565: esp32s3 only (PIE), esp32 keeps the ANSI code.
+ */
+#if CONFIG_IDF_TARGET_ESP32S3
+extern int lv_argb8888_blend_normal_to_rgb565_esp(asm_dsc_t *asm_dsc);
+extern int lv_argb8888_blend_normal_to_rgb565_with_opa_esp(asm_dsc_t *asm_dsc);
+extern int lv_argb8888_blend_normal_to_rgb565_with_mask_esp(asm_dsc_t *asm_dsc);
+extern int lv_argb8888_blend_normal_to_rgb565_mix_mask_opa_esp(asm_dsc_t *asm_dsc);
+#endif
+
+static inline lv_result_t _lv_argb8888_blend_normal_to_rgb565_esp(lv_port_blend_image_dsc_t *dsc)
+{
+#if CONFIG_IDF_TARGET_ESP32S3
+    asm_dsc_t asm_dsc = {
+        .dst_buf = dsc->dest_buf,
+        .dst_w = dsc->dest_w,
+        .dst_h = dsc->dest_h,
+        .dst_stride = dsc->dest_stride,
+        .src_buf = dsc->src_buf,
+        .src_stride = dsc->src_stride
+    };
+
+    return lv_argb8888_blend_normal_to_rgb565_esp(&asm_dsc);
+#else
+    return LV_RESULT_INVALID;
+#endif
+}
+
+static inline lv_result_t _lv_argb8888_blend_normal_to_rgb565_with_opa_esp(lv_port_blend_image_dsc_t *dsc)
+{
+#if CONFIG_IDF_TARGET_ESP32S3
+    asm_dsc_t asm_dsc = {
+        .opa = dsc->opa,
+        .dst_buf = dsc->dest_buf,
+        .dst_w = dsc->dest_w,
+        .dst_h = dsc->dest_h,
+        .dst_stride = dsc->dest_stride,
+        .src_buf = dsc->src_buf,
+        .src_stride = dsc->src_stride
+    };
+
+    return lv_argb8888_blend_normal_to_rgb565_with_opa_esp(&asm_dsc);
+#else
+    return LV_RESULT_INVALID;
+#endif
+}
+
+static inline lv_result_t _lv_argb8888_blend_normal_to_rgb565_with_mask_esp(lv_port_blend_image_dsc_t *dsc)
+{
+#if CONFIG_IDF_TARGET_ESP32S3
+    asm_dsc_t asm_dsc = {
+        .opa = dsc->opa,
+        .dst_buf = dsc->dest_buf,
+        .dst_w = dsc->dest_w,
+        .dst_h = dsc->dest_h,
+        .dst_stride = dsc->dest_stride,
+        .src_buf = dsc->src_buf,
+        .src_stride = dsc->src_stride,
+        .mask_buf = dsc->mask_buf,
+        .mask_stride = dsc->mask_stride
+    };
+
+    return lv_argb8888_blend_normal_to_rgb565_with_mask_esp(&asm_dsc);
+#else
+    return LV_RESULT_INVALID;
+#endif
+}
+
+static inline lv_result_t _lv_argb8888_blend_normal_to_rgb565_mix_mask_opa_esp(lv_port_blend_image_dsc_t *dsc)
+{
+#if CONFIG_IDF_TARGET_ESP32S3
+    asm_dsc_t asm_dsc = {
+        .opa = dsc->opa,
+        .dst_buf = dsc->dest_buf,
+        .dst_w = dsc->dest_w,
+        .dst_h = dsc->dest_h,
+        .dst_stride = dsc->dest_stride,
+        .src_buf = dsc->src_buf,
+        .src_stride = dsc->src_stride,
+        .mask_buf = dsc->mask_buf,
+        .mask_stride = dsc->mask_stride
+    };
+
+    return lv_argb8888_blend_normal_to_rgb565_mix_mask_opa_esp(&asm_dsc);
+#else
+    return LV_RESULT_INVALID;
+#endif
+}
+
 extern int lv_rgb888_blend_normal_to_rgb888_esp(asm_dsc_t *asm_dsc);
 
-static inline lv_result_t _lv_rgb888_blend_normal_to_rgb888_esp(_lv_draw_sw_blend_image_dsc_t *dsc, uint32_t dest_px_size, uint32_t src_px_size)
+static inline lv_result_t _lv_rgb888_blend_normal_to_rgb888_esp(lv_port_blend_image_dsc_t *dsc, uint32_t dest_px_size, uint32_t src_px_size)
 {
     if (!(dest_px_size == 3 && src_px_size == 3)) {
         return LV_RESULT_INVALID;
@@ -0,0 +1,63 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief ESP LVGL port framebuffer-less scanout
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief How a display without frame buffer keeps the screen
+ */
+typedef enum {
+    LVGL_PORT_SCANOUT_TILES,        /*!< 32x16 tiles: the background, one colour, or the pixels */
+    LVGL_PORT_SCANOUT_RLE_LINES,    /*!< Every line RLE compressed, raw when it does not compress */
+} lvgl_port_scanout_format_t;
+
+/**
+ * @brief Fill one line of the background of a framebuffer-less display
+ *
+ * @note Called from the RGB bounce buffer interrupt and from the LVGL flush: it must be fast,
+ *       must not block and must always give the same pixels for the same line.
+ *
+ * @param user_ctx  User context given with the callback
+ * @param y         Line of the screen
+ * @param row       Filled with the hres RGB565 pixels of the line
+ */
+typedef void (*lvgl_port_scanout_bg_cb_t)(void *user_ctx, int32_t y, uint16_t *row);
+
+/**
+ * @brief Store statistics of a framebuffer-less display (see lvgl_port_display_rgb_cfg_t)
+ *
+ * LVGL_PORT_SCANOUT_TILES: a tile equal to the background costs nothing, a tile of one colour costs
+ * its colour, any other tile keeps its pixels.
+ * LVGL_PORT_SCANOUT_RLE_LINES: bytes / (hres * vres * 2) is the compression ratio, bytes_read per
+ * scanout against hres * vres * 2 the scanout bandwidth saved.
+ */
+typedef struct {
+    uint32_t tiles_bg;          /*!< Tiles showing the background */
+    uint32_t tiles_solid;       /*!< Tiles of one colour */
+    uint32_t tiles_pixels;      /*!< Tiles stored as pixels */
+    uint32_t lines_rle;         /*!< Lines stored RLE compressed */
+    uint32_t lines_raw;         /*!< Lines stored raw, they do not compress */
+    uint32_t bytes;             /*!< Memory of the store: index, tiles and pixels or lines */
+    uint32_t alloc_failures;    /*!< Tiles or lines left stale, no memory for their pixels */
+    uint32_t lines;             /*!< Lines filled into the bounce buffers */
+    uint32_t bg_lines;          /*!< Lines which needed a background line */
+    uint64_t bytes_read;        /*!< Bytes of stored pixels or lines read into the bounce buffers */
+} lvgl_port_scanout_stats_t;
+
+#ifdef __cplusplus
+}
+#endif
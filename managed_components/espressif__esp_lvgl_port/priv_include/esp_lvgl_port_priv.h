@@ -29,6 +29,8 @@ typedef enum {
  */
 typedef struct {
     unsigned int avoid_tearing: 1;    /*!< Use internal RGB buffers as a LVGL draw buffers to avoid tearing effect */
+    unsigned int async_flush: 1;      /*!< Copy the draw buffer into the RGB frame buffer with the async memcpy engine */
+    unsigned int vsync_paced: 1;      /*!< Refresh on the RGB panel VSYNC */
 } lvgl_port_disp_priv_cfg_t;
 
 /**
@@ -42,6 +44,21 @@ typedef struct {
  */
 bool lvgl_port_task_notify(uint32_t value);
 
+/**
+ * @brief Read period of a touch without interrupt pin, when it is not touched
+ *
+ * @return
+ *      - touch_idle_poll_ms of the LVGL port configuration or lvgl_port_set_touch_idle_poll_ms(), 0 to keep the LVGL read period
+ */
+int lvgl_port_get_touch_idle_poll_ms(void);
+
+/**
+ * @brief Refresh the VSYNC paced displays which had a VSYNC since their last refresh
+ *
+ * @note It is called from the LVGL task, with the LVGL mutex taken, after a LVGL_PORT_EVENT_VSYNC wake
+ */
+void lvgl_port_disp_vsync_refresh(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,521 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "lcd_scanout.h"
+
+#define TILE_W  LVGL_PORT_SCANOUT_TILE_W
+#define TILE_H  LVGL_PORT_SCANOUT_TILE_H
+#define TILE_PX (TILE_W * TILE_H)
+
+/* A tile is one word, read by the bounce buffer interrupt in one load:
+ *  - 0: the background
+ *  - colour << 16 | 1: one colour
+ *  - pointer to TILE_W x TILE_H pixels (edge tiles keep the full stride) */
+#define TILE_BG                 ((uintptr_t)0)
+#define TILE_SOLID(color)       (((uintptr_t)(color) << 16) | 1)
+#define TILE_IS_SOLID(tile)     ((tile) & 1)
+#define TILE_COLOR(tile)        ((uint16_t)((tile) >> 16))
+#define TILE_PIXELS(tile)       ((uint16_t *)(tile))
+
+/* A line is NULL (black) or a block: one header unit, then its units.
+ *  - header LINE_RAW: hres pixels
+ *  - header n: n units of RLE, a control unit followed by one pixel (RLE_REPEAT | count) or count pixels */
+#define LINE_RAW                0x8000
+#define LINE_UNITS(hdr)         ((hdr) & 0x7FFF)
+#define RLE_REPEAT              0x8000
+#define RLE_COUNT(ctrl)         ((ctrl) & 0x7FFF)
+#define RLE_COUNT_MAX           0x7FFF
+#define RLE_MIN_RUN             3       /* Shorter runs stay in the literals */
+
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+#define MAX(a, b) ((a) > (b) ? (a) : (b))
+
+typedef struct {
+    lvgl_port_scanout_bg_cb_t cb;
+    void *user_ctx;
+} lvgl_port_scanout_bg_t;
+
+struct lvgl_port_scanout_t {
+    uint32_t            hres;
+    uint32_t            vres;
+    uint32_t            cols;           /* Tiles per tile row */
+    uint32_t            rows;           /* Tile rows */
+    uint32_t            pixel_caps;
+    lvgl_port_scanout_format_t format;
+    uintptr_t           *tiles;         /* cols * rows tiles, see TILE_* */
+    uint32_t            *bg_tiles;      /* Tiles showing the background, per tile row */
+    lvgl_port_scanout_bg_t bg_slots[2]; /* The interrupt reads the one bg points to */
+    const lvgl_port_scanout_bg_t *bg;
+    uint16_t            *bg_lines;      /* Background of the tile row being written */
+    uint16_t            tile[TILE_PX];  /* Tile being written */
+    uint16_t            **line_index;   /* RLE lines: vres lines, see LINE_* */
+    uint16_t            *line_cap;      /* Units the block of each line has room for */
+    uint16_t            *line_px;       /* Line being written */
+    uint16_t            *line_enc;      /* Its RLE */
+    uint32_t            alloc_failures;
+    uint32_t            lines;
+    uint32_t            bg_filled;
+    uint64_t            bytes_read;
+};
+
+static const char *TAG = "LVGL";
+
+/*******************************************************************************
+* Private functions
+*******************************************************************************/
+
+static void scanout_bg_line(lvgl_port_scanout_t *s, const lvgl_port_scanout_bg_t *bg, int32_t y, uint16_t *row)
+{
+    if (bg->cb) {
+        bg->cb(bg->user_ctx, y, row);
+    } else {
+        memset(row, 0, s->hres * sizeof(uint16_t));
+    }
+}
+
+static void scanout_fill_color(uint16_t *dst, uint16_t color, int len)
+{
+    for (int i = 0; i < len; i++) {
+        dst[i] = color;
+    }
+}
+
+/* What the tile shows now, into s->tile */
+static void scanout_tile_read(lvgl_port_scanout_t *s, uintptr_t tile, int tx0, int tw, int th)
+{
+    for (int r = 0; r < th; r++) {
+        uint16_t *dst = s->tile + r * TILE_W;
+        if (tile == TILE_BG) {
+            memcpy(dst, s->bg_lines + r * s->hres + tx0, tw * sizeof(uint16_t));
+        } else if (TILE_IS_SOLID(tile)) {
+            scanout_fill_color(dst, TILE_COLOR(tile), tw);
+        } else {
+            memcpy(dst, TILE_PIXELS(tile) + r * TILE_W, tw * sizeof(uint16_t));
+        }
+    }
+}
+
+static bool scanout_tile_is_bg(const lvgl_port_scanout_t *s, int tx0, int tw, int th)
+{
+    for (int r = 0; r < th; r++) {
+        if (memcmp(s->tile + r * TILE_W, s->bg_lines + r * s->hres + tx0, tw * sizeof(uint16_t)) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool scanout_tile_is_solid(const lvgl_port_scanout_t *s, int tw, int th)
+{
+    const uint16_t color = s->tile[0];
+    for (int r = 0; r < th; r++) {
+        const uint16_t *px = s->tile + r * TILE_W;
+        for (int i = 0; i < tw; i++) {
+            if (px[i] != color) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static void scanout_tile_write(lvgl_port_scanout_t *s, uint32_t tx, uint32_t ty, int x1, int y1, int x2, int y2, const uint16_t *px)
+{
+    const int tx0 = tx * TILE_W;
+    const int ty0 = ty * TILE_H;
+    const int tw = MIN(TILE_W, (int)s->hres - tx0);
+    const int th = MIN(TILE_H, (int)s->vres - ty0);
+    const int stride = x2 - x1 + 1;
+
+    /* Part of the tile covered by the area, in tile coordinates */
+    const int ax1 = MAX(x1, tx0) - tx0;
+    const int ax2 = MIN(x2, tx0 + tw - 1) - tx0;
+    const int ay1 = MAX(y1, ty0) - ty0;
+    const int ay2 = MIN(y2, ty0 + th - 1) - ty0;
+
+    uintptr_t *entry = &s->tiles[ty * s->cols + tx];
+    const uintptr_t old = *entry;
+
+    /* The rest of the tile keeps what it shows */
+    if (ax1 > 0 || ax2 < tw - 1 || ay1 > 0 || ay2 < th - 1) {
+        scanout_tile_read(s, old, tx0, tw, th);
+    }
+    for (int r = ay1; r <= ay2; r++) {
+        memcpy(s->tile + r * TILE_W + ax1, px + (ty0 + r - y1) * stride + (tx0 + ax1 - x1), (ax2 - ax1 + 1) * sizeof(uint16_t));
+    }
+
+    uintptr_t tile;
+    if (scanout_tile_is_bg(s, tx0, tw, th)) {
+        tile = TILE_BG;
+    } else if (scanout_tile_is_solid(s, tw, th)) {
+        tile = TILE_SOLID(s->tile[0]);
+    } else if (old != TILE_BG && !TILE_IS_SOLID(old)) {
+        /* Updated in place: a line scanned out meanwhile may mix both, as with a single frame buffer */
+        memcpy(TILE_PIXELS(old), s->tile, TILE_W * th * sizeof(uint16_t));
+        return;
+    } else {
+        uint16_t *pixels = heap_caps_malloc(TILE_PX * sizeof(uint16_t), s->pixel_caps);
+        if (pixels == NULL) {
+            if (s->alloc_failures++ == 0) {
+                ESP_LOGW(TAG, "Scanout: no memory for the tile pixels, the screen is not up to date!");
+            }
+            return;
+        }
+        memcpy(pixels, s->tile, TILE_W * th * sizeof(uint16_t));
+        tile = (uintptr_t)pixels;
+    }
+
+    if (tile == old) {
+        return;
+    }
+    /* The tile row counts a background tile before it shows and after it stops showing */
+    if (tile == TILE_BG) {
+        __atomic_fetch_add(&s->bg_tiles[ty], 1, __ATOMIC_RELEASE);
+    }
+    __atomic_store_n(entry, tile, __ATOMIC_RELEASE);
+    if (old == TILE_BG) {
+        __atomic_fetch_sub(&s->bg_tiles[ty], 1, __ATOMIC_RELEASE);
+    } else if (!TILE_IS_SOLID(old)) {
+        free(TILE_PIXELS(old));
+    }
+}
+
+/* Units of the RLE of the line or -1 when it needs more than max */
+static int scanout_rle_encode(const uint16_t *px, int n, uint16_t *enc, int max)
+{
+    int len = 0;
+    int i = 0;
+    while (i < n) {
+        int run = 1;
+        while (i + run < n && run < RLE_COUNT_MAX && px[i + run] == px[i]) {
+            run++;
+        }
+        if (run >= RLE_MIN_RUN) {
+            if (len + 2 > max) {
+                return -1;
+            }
+            enc[len++] = RLE_REPEAT | run;
+            enc[len++] = px[i];
+            i += run;
+            continue;
+        }
+        /* Literals up to the next run */
+        const int start = i;
+        while (i < n && i - start < RLE_COUNT_MAX
+                && !(i + 2 < n && px[i] == px[i + 1] && px[i] == px[i + 2])) {
+            i++;
+        }
+        if (len + 1 + (i - start) > max) {
+            return -1;
+        }
+        enc[len++] = i - start;
+        memcpy(enc + len, px + start, (i - start) * sizeof(uint16_t));
+        len += i - start;
+    }
+    return len;
+}
+
+/* Bounded by both ends: a line updated in place while the interrupt reads it may mix two encodings */
+static void scanout_rle_decode(const uint16_t *enc, int units, uint16_t *out, int n)
+{
+    const uint16_t *enc_end = enc + units;
+    const uint16_t *out_end = out + n;
+    while (enc < enc_end && out < out_end) {
+        const uint16_t ctrl = *enc++;
+        if (ctrl & RLE_REPEAT) {
+            if (enc == enc_end) {
+                break;
+            }
+            const int count = MIN(RLE_COUNT(ctrl), out_end - out);
+            scanout_fill_color(out, *enc++, count);
+            out += count;
+        } else {
+            const int count = MIN(MIN(RLE_COUNT(ctrl), out_end - out), enc_end - enc);
+            memcpy(out, enc, count * sizeof(uint16_t));
+            enc += RLE_COUNT(ctrl);
+            out += count;
+        }
+    }
+}
+
+/* What the line shows now, into s->line_px */
+static void scanout_line_read(lvgl_port_scanout_t *s, uint32_t y)
+{
+    const uint16_t *line = s->line_index[y];
+    if (line == NULL) {
+        memset(s->line_px, 0, s->hres * sizeof(uint16_t));
+    } else if (line[0] & LINE_RAW) {
+        memcpy(s->line_px, line + 1, s->hres * sizeof(uint16_t));
+    } else {
+        scanout_rle_decode(line + 1, LINE_UNITS(line[0]), s->line_px, s->hres);
+    }
+}
+
+static void scanout_line_store(lvgl_port_scanout_t *s, uint32_t y, const uint16_t *px)
+{
+    /* Raw when the RLE is not smaller */
+    int units = scanout_rle_encode(px, s->hres, s->line_enc, s->hres - 1);
+    uint16_t hdr = units;
+    const uint16_t *data = s->line_enc;
+    if (units < 0) {
+        units = s->hres;
+        hdr = LINE_RAW;
+        data = px;
+    }
+
+    /* Updated in place while the block fits and is not twice too big */
+    uint16_t *old = s->line_index[y];
+    if (old != NULL && units <= s->line_cap[y] && units >= s->line_cap[y] / 2) {
+        memcpy(old + 1, data, units * sizeof(uint16_t));
+        __atomic_store_n(&old[0], hdr, __ATOMIC_RELEASE);
+        return;
+    }
+    uint16_t *line = heap_caps_malloc((units + 1) * sizeof(uint16_t), s->pixel_caps);
+    if (line == NULL) {
+        if (s->alloc_failures++ == 0) {
+            ESP_LOGW(TAG, "Scanout: no memory for the line, the screen is not up to date!");
+        }
+        return;
+    }
+    line[0] = hdr;
+    memcpy(line + 1, data, units * sizeof(uint16_t));
+    s->line_cap[y] = units;
+    __atomic_store_n(&s->line_index[y], line, __ATOMIC_RELEASE);
+    free(old);
+}
+
+static void scanout_rle_write(lvgl_port_scanout_t *s, int x1, int y1, int x2, int y2, const uint16_t *px)
+{
+    const int stride = x2 - x1 + 1;
+    for (int y = y1; y <= y2; y++, px += stride) {
+        if (stride == (int)s->hres) {
+            scanout_line_store(s, y, px);
+            continue;
+        }
+        scanout_line_read(s, y);
+        memcpy(s->line_px + x1, px, stride * sizeof(uint16_t));
+        scanout_line_store(s, y, s->line_px);
+    }
+}
+
+static void scanout_rle_fill(lvgl_port_scanout_t *s, uint32_t y, uint32_t y_end, uint16_t *out)
+{
+    uint32_t bytes_read = 0;
+    for (; y < y_end; y++, out += s->hres) {
+        const uint16_t *line = __atomic_load_n(&s->line_index[y], __ATOMIC_ACQUIRE);
+        if (line == NULL) {
+            memset(out, 0, s->hres * sizeof(uint16_t));
+            continue;
+        }
+        const uint16_t hdr = __atomic_load_n(&line[0], __ATOMIC_ACQUIRE);
+        if (hdr & LINE_RAW) {
+            memcpy(out, line + 1, s->hres * sizeof(uint16_t));
+            bytes_read += (s->hres + 1) * sizeof(uint16_t);
+        } else {
+            scanout_rle_decode(line + 1, LINE_UNITS(hdr), out, s->hres);
+            bytes_read += (LINE_UNITS(hdr) + 1) * sizeof(uint16_t);
+        }
+    }
+    s->bytes_read += bytes_read;
+}
+
+/*******************************************************************************
+* Public API functions
+*******************************************************************************/
+
+lvgl_port_scanout_handle_t lvgl_port_scanout_create(const lvgl_port_scanout_cfg_t *cfg)
+{
+    assert(cfg != NULL);
+    assert(cfg->hres > 0 && cfg->vres > 0);
+    assert(cfg->hres <= RLE_COUNT_MAX);
+
+    lvgl_port_scanout_t *s = calloc(1, sizeof(lvgl_port_scanout_t));
+    if (s == NULL) {
+        return NULL;
+    }
+    s->hres = cfg->hres;
+    s->vres = cfg->vres;
+    s->cols = (cfg->hres + TILE_W - 1) / TILE_W;
+    s->rows = (cfg->vres + TILE_H - 1) / TILE_H;
+    s->pixel_caps = cfg->pixel_caps ? cfg->pixel_caps : MALLOC_CAP_DEFAULT;
+    s->format = cfg->format;
+    s->bg = &s->bg_slots[0];
+
+    if (s->format == LVGL_PORT_SCANOUT_RLE_LINES) {
+        /* Read by the interrupt at every line: internal RAM */
+        s->line_index = heap_caps_calloc(s->vres, sizeof(uint16_t *), MALLOC_CAP_INTERNAL);
+        s->line_cap = heap_caps_calloc(s->vres, sizeof(uint16_t), MALLOC_CAP_DEFAULT);
+        s->line_px = heap_caps_malloc(s->hres * sizeof(uint16_t), MALLOC_CAP_DEFAULT);
+        s->line_enc = heap_caps_malloc(s->hres * sizeof(uint16_t), MALLOC_CAP_DEFAULT);
+        if (s->line_index == NULL || s->line_cap == NULL || s->line_px == NULL || s->line_enc == NULL) {
+            lvgl_port_scanout_delete(s);
+            return NULL;
+        }
+        return s;
+    }
+
+    /* Read by the interrupt at every line: internal RAM */
+    s->tiles = heap_caps_calloc(s->cols * s->rows, sizeof(uintptr_t), MALLOC_CAP_INTERNAL);
+    s->bg_tiles = heap_caps_calloc(s->rows, sizeof(uint32_t), MALLOC_CAP_INTERNAL);
+    s->bg_lines = heap_caps_malloc(TILE_H * s->hres * sizeof(uint16_t), MALLOC_CAP_DEFAULT);
+    if (s->tiles == NULL || s->bg_tiles == NULL || s->bg_lines == NULL) {
+        lvgl_port_scanout_delete(s);
+        return NULL;
+    }
+    for (uint32_t ty = 0; ty < s->rows; ty++) {
+        s->bg_tiles[ty] = s->cols;
+    }
+    return s;
+}
+
+void lvgl_port_scanout_delete(lvgl_port_scanout_handle_t handle)
+{
+    assert(handle != NULL);
+    if (handle->tiles) {
+        for (uint32_t i = 0; i < handle->cols * handle->rows; i++) {
+            const uintptr_t tile = handle->tiles[i];
+            if (tile != TILE_BG && !TILE_IS_SOLID(tile)) {
+                free(TILE_PIXELS(tile));
+            }
+        }
+    }
+    if (handle->line_index) {
+        for (uint32_t y = 0; y < handle->vres; y++) {
+            free(handle->line_index[y]);
+        }
+    }
+    free(handle->tiles);
+    free(handle->bg_tiles);
+    free(handle->bg_lines);
+    free(handle->line_index);
+    free(handle->line_cap);
+    free(handle->line_px);
+    free(handle->line_enc);
+    free(handle);
+}
+
+void lvgl_port_scanout_set_bg(lvgl_port_scanout_handle_t handle, lvgl_port_scanout_bg_cb_t cb, void *user_ctx)
+{
+    assert(handle != NULL);
+    /* Callback and context switched together: the interrupt may be filling a line with the other slot */
+    lvgl_port_scanout_bg_t *slot = (handle->bg == &handle->bg_slots[0]) ? &handle->bg_slots[1] : &handle->bg_slots[0];
+    slot->cb = cb;
+    slot->user_ctx = user_ctx;
+    __atomic_store_n(&handle->bg, slot, __ATOMIC_RELEASE);
+}
+
+void lvgl_port_scanout_write(lvgl_port_scanout_handle_t handle, int x1, int y1, int x2, int y2, const uint16_t *px)
+{
+    assert(handle != NULL);
+    assert(px != NULL);
+    assert(x1 >= 0 && y1 >= 0 && x2 < (int)handle->hres && y2 < (int)handle->vres && x1 <= x2 && y1 <= y2);
+    if (handle->format == LVGL_PORT_SCANOUT_RLE_LINES) {
+        scanout_rle_write(handle, x1, y1, x2, y2, px);
+        return;
+    }
+    const lvgl_port_scanout_bg_t *bg = handle->bg;
+
+    for (uint32_t ty = y1 / TILE_H; ty <= (uint32_t)y2 / TILE_H; ty++) {
+        const uint32_t ty0 = ty * TILE_H;
+        const uint32_t th = MIN(TILE_H, handle->vres - ty0);
+        for (uint32_t r = 0; r < th; r++) {
+            scanout_bg_line(handle, bg, ty0 + r, handle->bg_lines + r * handle->hres);
+        }
+        for (uint32_t tx = x1 / TILE_W; tx <= (uint32_t)x2 / TILE_W; tx++) {
+            scanout_tile_write(handle, tx, ty, x1, y1, x2, y2, px);
+        }
+    }
+}
+
+void lvgl_port_scanout_fill(lvgl_port_scanout_handle_t handle, uint32_t pos_px, uint32_t len_px, uint16_t *out)
+{
+    assert(handle != NULL);
+    const uint32_t y_end = MIN(pos_px / handle->hres + len_px / handle->hres, handle->vres);
+    handle->lines += y_end - pos_px / handle->hres;
+    if (handle->format == LVGL_PORT_SCANOUT_RLE_LINES) {
+        scanout_rle_fill(handle, pos_px / handle->hres, y_end, out);
+        return;
+    }
+    const lvgl_port_scanout_bg_t *bg = __atomic_load_n(&handle->bg, __ATOMIC_ACQUIRE);
+    uint32_t bytes_read = 0;
+
+    for (uint32_t y = pos_px / handle->hres; y < y_end; y++, out += handle->hres) {
+        const uint32_t ty = y / TILE_H;
+        const uint32_t r = y % TILE_H;
+        const uintptr_t *tiles = &handle->tiles[ty * handle->cols];
+
+        if (__atomic_load_n(&handle->bg_tiles[ty], __ATOMIC_ACQUIRE) > 0) {
+            scanout_bg_line(handle, bg, y, out);
+            handle->bg_filled++;
+        }
+        for (uint32_t tx = 0; tx < handle->cols; tx++) {
+            const uintptr_t tile = __atomic_load_n(&tiles[tx], __ATOMIC_ACQUIRE);
+            if (tile == TILE_BG) {
+                continue;
+            }
+            const int tw = MIN(TILE_W, handle->hres - tx * TILE_W);
+            if (TILE_IS_SOLID(tile)) {
+                scanout_fill_color(out + tx * TILE_W, TILE_COLOR(tile), tw);
+            } else {
+                memcpy(out + tx * TILE_W, TILE_PIXELS(tile) + r * TILE_W, tw * sizeof(uint16_t));
+                bytes_read += tw * sizeof(uint16_t);
+            }
+        }
+    }
+    handle->bytes_read += bytes_read;
+}
+
+void lvgl_port_scanout_get_stats(lvgl_port_scanout_handle_t handle, lvgl_port_scanout_stats_t *stats, bool reset)
+{
+    assert(handle != NULL);
+    assert(stats != NULL);
+    memset(stats, 0, sizeof(lvgl_port_scanout_stats_t));
+
+    if (handle->format == LVGL_PORT_SCANOUT_RLE_LINES) {
+        stats->bytes = handle->vres * (sizeof(uint16_t *) + sizeof(uint16_t)) + 2 * handle->hres * sizeof(uint16_t);
+        for (uint32_t y = 0; y < handle->vres; y++) {
+            const uint16_t *line = handle->line_index[y];
+            if (line == NULL) {
+                continue;
+            }
+            if (line[0] & LINE_RAW) {
+                stats->lines_raw++;
+            } else {
+                stats->lines_rle++;
+            }
+            stats->bytes += (handle->line_cap[y] + 1) * sizeof(uint16_t);
+        }
+    } else {
+        for (uint32_t i = 0; i < handle->cols * handle->rows; i++) {
+            const uintptr_t tile = handle->tiles[i];
+            if (tile == TILE_BG) {
+                stats->tiles_bg++;
+            } else if (TILE_IS_SOLID(tile)) {
+                stats->tiles_solid++;
+            } else {
+                stats->tiles_pixels++;
+            }
+        }
+        stats->bytes = handle->cols * handle->rows * sizeof(uintptr_t) + handle->rows * sizeof(uint32_t)
+                       + TILE_H * handle->hres * sizeof(uint16_t) + stats->tiles_pixels * TILE_PX * sizeof(uint16_t);
+    }
+    stats->alloc_failures = handle->alloc_failures;
+    stats->lines = handle->lines;
+    stats->bg_lines = handle->bg_filled;
+    stats->bytes_read = handle->bytes_read;
+
+    if (reset) {
+        handle->alloc_failures = 0;
+        handle->lines = 0;
+        handle->bg_filled = 0;
+        handle->bytes_read = 0;
+    }
+}
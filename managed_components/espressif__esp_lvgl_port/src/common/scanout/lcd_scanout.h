@@ -0,0 +1,89 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief LCD scanout store
+ *
+ * Retained copy of the screen for a panel without frame buffer: LVGL flushes RGB565 areas into it,
+ * the RGB bounce buffers are filled from it line by line. Kept as tiles over a background or as
+ * RLE lines (lvgl_port_scanout_format_t). No dependency on the LCD driver.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_lvgl_port_scanout.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define LVGL_PORT_SCANOUT_TILE_W    32  /* Tile width in pixels */
+#define LVGL_PORT_SCANOUT_TILE_H    16  /* Tile height in lines */
+
+typedef struct lvgl_port_scanout_t lvgl_port_scanout_t;
+typedef lvgl_port_scanout_t *lvgl_port_scanout_handle_t;
+
+/**
+ * @brief Init configuration structure
+ */
+typedef struct {
+    uint32_t hres;          /*!< Screen width (at most 32767) */
+    uint32_t vres;          /*!< Screen height */
+    lvgl_port_scanout_format_t format;  /*!< Tiles or RLE lines */
+    uint32_t pixel_caps;    /*!< Heap capabilities of the tile pixels or lines (e.g. MALLOC_CAP_SPIRAM) */
+} lvgl_port_scanout_cfg_t;
+
+/**
+ * @brief Create a store: tiles showing the background (black until one is set) or black lines
+ *
+ * @return Store handle or NULL when out of memory
+ */
+lvgl_port_scanout_handle_t lvgl_port_scanout_create(const lvgl_port_scanout_cfg_t *cfg);
+
+/**
+ * @brief Delete a store and its pixels
+ */
+void lvgl_port_scanout_delete(lvgl_port_scanout_handle_t handle);
+
+/**
+ * @brief Set the background of the tiles
+ *
+ * @note The tiles showing the background show the new one at once: the whole screen must be written again.
+ *       Not used by the RLE lines.
+ */
+void lvgl_port_scanout_set_bg(lvgl_port_scanout_handle_t handle, lvgl_port_scanout_bg_cb_t cb, void *user_ctx);
+
+/**
+ * @brief Store a rendered area
+ *
+ * @note Not reentrant, the bounce buffers may be filled meanwhile.
+ *
+ * @param px RGB565 pixels of the area, (x2 - x1 + 1) per line
+ */
+void lvgl_port_scanout_write(lvgl_port_scanout_handle_t handle, int x1, int y1, int x2, int y2, const uint16_t *px);
+
+/**
+ * @brief Fill whole lines of a bounce buffer
+ *
+ * @param pos_px First pixel of the buffer in the frame, on a line start
+ * @param len_px Pixels to fill, whole lines
+ * @param out    Bounce buffer
+ */
+void lvgl_port_scanout_fill(lvgl_port_scanout_handle_t handle, uint32_t pos_px, uint32_t len_px, uint16_t *out);
+
+/**
+ * @brief Get the statistics of a store
+ *
+ * @param reset Clear the counters after reading (the tile and line counts are the current state)
+ */
+void lvgl_port_scanout_get_stats(lvgl_port_scanout_handle_t handle, lvgl_port_scanout_stats_t *stats, bool reset);
+
+#ifdef __cplusplus
+}
+#endif
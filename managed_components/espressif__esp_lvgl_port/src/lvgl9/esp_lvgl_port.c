@@ -19,6 +19,9 @@
 #include "esp_lvgl_port.h"
 #include "esp_lvgl_port_priv.h"
 #include "lvgl.h"
+#if LV_USE_OS == LV_OS_FREERTOS
+#include "src/core/lv_global.h"
+#endif
 
 static const char *TAG = "LVGL";
 
@@ -35,18 +38,27 @@ typedef struct lvgl_port_ctx_s {
     bool                running;
     int                 task_max_sleep_ms;
     int                 timer_period_ms;
+    int                 touch_idle_poll_ms;
+    bool                event_driven;
+    bool                timers_stopped;
+    lvgl_port_user_event_cb_t user_event_cb;
+    void                *user_event_ctx;
+    lvgl_port_stats_t   stats;
 } lvgl_port_ctx_t;
 
 /*******************************************************************************
 * Local variables
 *******************************************************************************/
 static lvgl_port_ctx_t lvgl_port_ctx;
+static portMUX_TYPE lvgl_port_stats_lock = portMUX_INITIALIZER_UNLOCKED;
 
 /*******************************************************************************
 * Function definitions
 *******************************************************************************/
 static void lvgl_port_task(void *arg);
 static esp_err_t lvgl_port_tick_init(void);
+static uint32_t lvgl_port_tick_get(void);
+static void lvgl_port_stats_update(EventBits_t events, int64_t sleep_us, int64_t wake_us, int64_t done_us);
 static void lvgl_port_task_deinit(void);
 
 /*******************************************************************************
@@ -63,6 +75,8 @@ esp_err_t lvgl_port_init(const lvgl_port_cfg_t *cfg)
 
     /* Tick init */
     lvgl_port_ctx.timer_period_ms = cfg->timer_period_ms;
+    lvgl_port_ctx.event_driven = cfg->flags.event_driven;
+    lvgl_port_ctx.touch_idle_poll_ms = cfg->touch_idle_poll_ms;
     /* Create task */
     lvgl_port_ctx.task_max_sleep_ms = cfg->task_max_sleep_ms;
     if (lvgl_port_ctx.task_max_sleep_ms == 0) {
@@ -107,6 +121,11 @@ esp_err_t lvgl_port_resume(void)
     if (lvgl_port_ctx.tick_timer != NULL) {
         lv_timer_enable(true);
         ret = esp_timer_start_periodic(lvgl_port_ctx.tick_timer, lvgl_port_ctx.timer_period_ms * 1000);
+    } else if (lvgl_port_ctx.event_driven && lvgl_port_ctx.lvgl_events) {
+        /* No tick timer, LVGL tick is read from esp_timer. Wake the task to compute its next timeout. */
+        lv_timer_enable(true);
+        lvgl_port_ctx.timers_stopped = false;
+        ret = lvgl_port_task_wake(LVGL_PORT_EVENT_DISPLAY, NULL);
     }
 
     return ret;
@@ -119,6 +138,11 @@ esp_err_t lvgl_port_stop(void)
     if (lvgl_port_ctx.tick_timer != NULL) {
         lv_timer_enable(false);
         ret = esp_timer_stop(lvgl_port_ctx.tick_timer);
+    } else if (lvgl_port_ctx.event_driven && lvgl_port_ctx.lvgl_events) {
+        /* lv_timer_handler() returns 1 ms while disabled, the task sleeps till lvgl_port_resume() instead */
+        lv_timer_enable(false);
+        lvgl_port_ctx.timers_stopped = true;
+        ret = ESP_OK;
     }
 
     return ret;
@@ -134,18 +158,30 @@ esp_err_t lvgl_port_deinit(void)
     return ESP_OK;
 }
 
+/* With the FreeRTOS OSAL, LVGL locks its own recursive mutex in lv_timer_handler() and lv_lock().
+ * The port lock is that same mutex: a second one would be taken in both orders
+ * (lvgl_port_lock() then lv_lock() in the LVGL task, lv_lock() then lvgl_port_lock() elsewhere). */
+static SemaphoreHandle_t lvgl_port_get_mux(void)
+{
+#if LV_USE_OS == LV_OS_FREERTOS
+    return LV_GLOBAL_DEFAULT()->lv_general_mutex.xMutex;
+#else
+    return lvgl_port_ctx.lvgl_mux;
+#endif
+}
+
 bool lvgl_port_lock(uint32_t timeout_ms)
 {
     assert(lvgl_port_ctx.lvgl_mux && "lvgl_port_init must be called first");
 
     const TickType_t timeout_ticks = (timeout_ms == 0) ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
-    return xSemaphoreTakeRecursive(lvgl_port_ctx.lvgl_mux, timeout_ticks) == pdTRUE;
+    return xSemaphoreTakeRecursive(lvgl_port_get_mux(), timeout_ticks) == pdTRUE;
 }
 
 void lvgl_port_unlock(void)
 {
     assert(lvgl_port_ctx.lvgl_mux && "lvgl_port_init must be called first");
-    xSemaphoreGiveRecursive(lvgl_port_ctx.lvgl_mux);
+    xSemaphoreGiveRecursive(lvgl_port_get_mux());
 }
 
 esp_err_t lvgl_port_task_wake(lvgl_port_event_type_t event, void *param)
@@ -179,6 +215,44 @@ esp_err_t lvgl_port_task_wake(lvgl_port_event_type_t event, void *param)
     return ESP_OK;
 }
 
+esp_err_t lvgl_port_set_user_event_cb(lvgl_port_user_event_cb_t cb, void *user_ctx)
+{
+    if (!lvgl_port_ctx.lvgl_mux) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    lvgl_port_ctx.user_event_cb = cb;
+    lvgl_port_ctx.user_event_ctx = user_ctx;
+
+    return ESP_OK;
+}
+
+esp_err_t lvgl_port_get_stats(lvgl_port_stats_t *stats, bool reset)
+{
+    if (!stats) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    portENTER_CRITICAL(&lvgl_port_stats_lock);
+    *stats = lvgl_port_ctx.stats;
+    if (reset) {
+        memset(&lvgl_port_ctx.stats, 0, sizeof(lvgl_port_ctx.stats));
+    }
+    portEXIT_CRITICAL(&lvgl_port_stats_lock);
+
+    return ESP_OK;
+}
+
+int lvgl_port_get_touch_idle_poll_ms(void)
+{
+    return lvgl_port_ctx.touch_idle_poll_ms;
+}
+
+void lvgl_port_set_touch_idle_poll_ms(int ms)
+{
+    lvgl_port_ctx.touch_idle_poll_ms = ms;
+}
+
 IRAM_ATTR bool lvgl_port_task_notify(uint32_t value)
 {
     BaseType_t need_yield = pdFALSE;
@@ -209,17 +283,37 @@ static void lvgl_port_task(void *arg)
     /* LVGL is initialized, notify lvgl_port_init() function about it */
     xTaskNotifyGive(task_to_notify);
     /* Tick init */
-    lvgl_port_tick_init();
+    if (lvgl_port_ctx.event_driven) {
+        /* No periodic tick interrupt, LVGL reads the time when it needs it */
+        lv_tick_set_cb(lvgl_port_tick_get);
+    } else {
+        lvgl_port_tick_init();
+    }
 
-    ESP_LOGI(TAG, "Starting LVGL task");
+    ESP_LOGI(TAG, "Starting LVGL task%s", lvgl_port_ctx.event_driven ? " (event driven)" : "");
     lvgl_port_ctx.running = true;
     while (lvgl_port_ctx.running) {
         /* Wait for queue or timeout (sleep task) */
-        TickType_t wait = (pdMS_TO_TICKS(task_delay_ms) >= 1 ? pdMS_TO_TICKS(task_delay_ms) : 1);
+        TickType_t wait;
+        if (!lvgl_port_ctx.event_driven) {
+            wait = (pdMS_TO_TICKS(task_delay_ms) >= 1 ? pdMS_TO_TICKS(task_delay_ms) : 1);
+        } else if (task_delay_ms == LV_NO_TIMER_READY || lvgl_port_ctx.timers_stopped) {
+            wait = portMAX_DELAY;
+        } else {
+            /* Round up: waking before the LVGL timer is due would be a wasted wakeup */
+            wait = (task_delay_ms + portTICK_PERIOD_MS - 1) / portTICK_PERIOD_MS;
+        }
+        const int64_t sleep_us = esp_timer_get_time();
         events = xEventGroupWaitBits(lvgl_port_ctx.lvgl_events, 0xFF, pdTRUE, pdFALSE, wait);
+        const int64_t wake_us = esp_timer_get_time();
 
         if (lv_display_get_default() && lvgl_port_lock(0)) {
 
+            /* Work posted by other tasks */
+            if ((events & LVGL_PORT_EVENT_USER) && lvgl_port_ctx.user_event_cb) {
+                lvgl_port_ctx.user_event_cb(lvgl_port_ctx.user_event_ctx);
+            }
+
             /* Call read input devices */
             if (events & LVGL_PORT_EVENT_TOUCH) {
                 xSemaphoreTake(lvgl_port_ctx.timer_mux, portMAX_DELAY);
@@ -231,6 +325,11 @@ static void lvgl_port_task(void *arg)
                 xSemaphoreGive(lvgl_port_ctx.timer_mux);
             }
 
+            /* Frames of the VSYNC paced displays, with the work posted and the touch read above */
+            if (events & LVGL_PORT_EVENT_VSYNC) {
+                lvgl_port_disp_vsync_refresh();
+            }
+
             /* Handle LVGL */
             task_delay_ms = lv_timer_handler();
             lvgl_port_unlock();
@@ -238,6 +337,13 @@ static void lvgl_port_task(void *arg)
             task_delay_ms = 1; /*Keep trying*/
         }
 
+        lvgl_port_stats_update(events, sleep_us, wake_us, esp_timer_get_time());
+
+        if (lvgl_port_ctx.event_driven) {
+            /* Events set while LVGL was running are still in the event group, no need to yield a tick */
+            continue;
+        }
+
         if (task_delay_ms == LV_NO_TIMER_READY) {
             task_delay_ms = lvgl_port_ctx.task_max_sleep_ms;
         }
@@ -288,6 +394,36 @@ static void lvgl_port_tick_increment(void *arg)
     xSemaphoreGive(lvgl_port_ctx.timer_mux);
 }
 
+static uint32_t lvgl_port_tick_get(void)
+{
+    return (uint32_t)(esp_timer_get_time() / 1000);
+}
+
+static void lvgl_port_stats_update(EventBits_t events, int64_t sleep_us, int64_t wake_us, int64_t done_us)
+{
+    portENTER_CRITICAL(&lvgl_port_stats_lock);
+    lvgl_port_stats_t *stats = &lvgl_port_ctx.stats;
+    stats->wakeups++;
+    if (events == 0) {
+        stats->wakeups_timer++;
+    }
+    if (events & LVGL_PORT_EVENT_DISPLAY) {
+        stats->wakeups_display++;
+    }
+    if (events & LVGL_PORT_EVENT_TOUCH) {
+        stats->wakeups_touch++;
+    }
+    if (events & LVGL_PORT_EVENT_VSYNC) {
+        stats->wakeups_vsync++;
+    }
+    if (events & LVGL_PORT_EVENT_USER) {
+        stats->wakeups_user++;
+    }
+    stats->idle_us += wake_us - sleep_us;
+    stats->busy_us += done_us - wake_us;
+    portEXIT_CRITICAL(&lvgl_port_stats_lock);
+}
+
 static esp_err_t lvgl_port_tick_init(void)
 {
     // Tick interface for LVGL (using esp_timer to generate 2ms periodic event)
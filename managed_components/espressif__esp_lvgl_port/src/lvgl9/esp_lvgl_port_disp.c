@@ -33,6 +33,34 @@
 #include "esp_lcd_mipi_dsi.h"
 #endif
 
+#if CONFIG_IDF_TARGET_ESP32S3 && ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 4, 0)
+#define LVGL_PORT_ASYNC_FLUSH 1
+#include "esp_async_memcpy.h"
+#include "esp_cache.h"
+#include "esp_timer.h"
+#else
+#define LVGL_PORT_ASYNC_FLUSH 0
+#endif
+
+/* Async flush: rows are copied by the GDMA in whole bursts, draw buffer and frame buffer rows aligned on them */
+#define LVGL_PORT_ASYNC_FLUSH_ALIGN 64
+
+/* Refresh on VSYNC: display refreshed by the port, animations run on LV_EVENT_VSYNC (LVGL 9.4) */
+#if CONFIG_IDF_TARGET_ESP32S3 && ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0) && (LVGL_VERSION_MAJOR > 9 || (LVGL_VERSION_MAJOR == 9 && LVGL_VERSION_MINOR >= 4))
+#define LVGL_PORT_VSYNC_PACED 1
+#include "src/misc/lv_anim_private.h"
+#else
+#define LVGL_PORT_VSYNC_PACED 0
+#endif
+
+/* Framebuffer-less scanout: the bounce buffers are filled from a tile or RLE line store (no_fb RGB panel) */
+#if CONFIG_IDF_TARGET_ESP32S3 && ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 1, 2)
+#define LVGL_PORT_SCANOUT 1
+#include "../common/scanout/lcd_scanout.h"
+#else
+#define LVGL_PORT_SCANOUT 0
+#endif
+
 #if (ESP_IDF_VERSION < ESP_IDF_VERSION_VAL(4, 4, 4)) || (ESP_IDF_VERSION == ESP_IDF_VERSION_VAL(5, 0, 0))
 #define LVGL_PORT_HANDLE_FLUSH_READY 0
 #else
@@ -49,7 +77,7 @@ static const char *TAG = "LVGL";
 * Types definitions
 *******************************************************************************/
 
-typedef struct {
+typedef struct lvgl_port_display_ctx_s {
     lvgl_port_disp_type_t     disp_type;    /* Display type */
     esp_lcd_panel_io_handle_t io_handle;      /* LCD panel IO handle */
     esp_lcd_panel_handle_t    panel_handle;   /* LCD panel handle */
@@ -63,12 +91,40 @@ typedef struct {
 #if LVGL_PORT_PPA
     lvgl_port_ppa_handle_t    ppa_handle;
 #endif //LVGL_PORT_PPA
+#if LVGL_PORT_ASYNC_FLUSH
+    struct {
+        async_memcpy_handle_t   handle;     /* Async memcpy engine, NULL when the CPU copies */
+        SemaphoreHandle_t       done_sem;   /* Given when the last row of an area is copied */
+        uint8_t                 *fb;        /* RGB frame buffer */
+        uint32_t                fb_stride;  /* Frame buffer row in bytes */
+        uint32_t                align_px;   /* Horizontal granularity of the invalidated areas */
+        volatile uint32_t       transfers_left; /* Transactions of the current area not finished yet */
+        int64_t                 start_us;   /* Flush time of the current area */
+        portMUX_TYPE            lock;       /* Protects transfers_left and stats (ISR) */
+        lvgl_port_flush_stats_t stats;
+    } async;
+#endif
+#if LVGL_PORT_VSYNC_PACED
+    struct {
+        struct lvgl_port_display_ctx_s *next; /* Next VSYNC paced display */
+        volatile bool           refr_pending;   /* Invalidated since the last refresh */
+        volatile bool           requested;      /* LVGL wants LV_EVENT_VSYNC (animations) */
+        volatile uint32_t       count;          /* VSYNCs since start (ISR) */
+        uint32_t                handled;        /* Last VSYNC handled by the LVGL task */
+        lvgl_port_frame_stats_t stats;          /* Without vsyncs, read from count */
+        uint32_t                stats_count;    /* count at the last stats reset */
+    } vsync;
+#endif
+#if LVGL_PORT_SCANOUT
+    lvgl_port_scanout_handle_t scanout;     /* Store of a panel without frame buffer */
+#endif
     struct {
         unsigned int monochrome: 1;  /* True, if display is monochrome and using 1bit for 1px */
         unsigned int swap_bytes: 1;  /* Swap bytes in RGB656 (16-bit) before send to LCD driver */
         unsigned int full_refresh: 1;   /* Always make the whole screen redrawn */
         unsigned int direct_mode: 1;    /* Use screen-sized buffers and draw to absolute coordinates */
         unsigned int sw_rotate: 1;    /* Use software rotation (slower) or PPA if available */
+        unsigned int vsync_paced: 1;  /* Refreshed by the port on the RGB VSYNC */
     } flags;
 } lvgl_port_display_ctx_t;
 
@@ -90,6 +146,21 @@ static void lvgl_port_flush_callback(lv_display_t *drv, const lv_area_t *area, u
 static void lvgl_port_disp_size_update_callback(lv_event_t *e);
 static void lvgl_port_disp_rotation_update(lvgl_port_display_ctx_t *disp_ctx);
 static void lvgl_port_display_invalidate_callback(lv_event_t *e);
+#if LVGL_PORT_ASYNC_FLUSH
+static esp_err_t lvgl_port_async_flush_init(lvgl_port_display_ctx_t *disp_ctx, const lvgl_port_display_cfg_t *disp_cfg);
+static void lvgl_port_async_flush(lvgl_port_display_ctx_t *disp_ctx, int x1, int y1, int x2, int y2, uint8_t *color_map);
+static void lvgl_port_async_flush_wait_callback(lv_display_t *disp);
+#endif
+#if LVGL_PORT_SCANOUT
+static bool lvgl_port_scanout_bounce_empty_callback(esp_lcd_panel_handle_t panel, void *bounce_buf, int pos_px, int len_bytes, void *user_ctx);
+#endif
+#if LVGL_PORT_VSYNC_PACED
+static void lvgl_port_vsync_init(lvgl_port_display_ctx_t *disp_ctx);
+static void lvgl_port_vsync_remove(lvgl_port_display_ctx_t *disp_ctx);
+
+/* Displays refreshed on VSYNC, accessed with the LVGL mutex */
+static lvgl_port_display_ctx_t *lvgl_port_vsync_displays = NULL;
+#endif
 
 /*******************************************************************************
 * Public API functions
@@ -161,10 +232,16 @@ lv_display_t *lvgl_port_add_disp_dsi(const lvgl_port_display_cfg_t *disp_cfg, co
 
 lv_display_t *lvgl_port_add_disp_rgb(const lvgl_port_display_cfg_t *disp_cfg, const lvgl_port_display_rgb_cfg_t *rgb_cfg)
 {
-    lvgl_port_lock(0);
     assert(rgb_cfg != NULL);
+    /* No frame buffer to draw into or copy into: LVGL renders RGB565 areas, stored as tiles */
+    ESP_RETURN_ON_FALSE(!rgb_cfg->flags.no_fb || (rgb_cfg->flags.bb_mode && !rgb_cfg->flags.avoid_tearing && !disp_cfg->flags.direct_mode && !disp_cfg->flags.full_refresh &&
+                        (disp_cfg->color_format == 0 || disp_cfg->color_format == LV_COLOR_FORMAT_RGB565)),
+                        NULL, TAG, "A panel without frame buffer needs the bounce buffer mode, the partial mode and RGB565!");
+    lvgl_port_lock(0);
     const lvgl_port_disp_priv_cfg_t priv_cfg = {
         .avoid_tearing = rgb_cfg->flags.avoid_tearing,
+        .async_flush = rgb_cfg->flags.async_flush && !rgb_cfg->flags.avoid_tearing && !rgb_cfg->flags.no_fb,
+        .vsync_paced = rgb_cfg->flags.vsync_paced,
     };
     lv_disp_t *disp = lvgl_port_add_disp_priv(disp_cfg, &priv_cfg);
 
@@ -179,7 +256,7 @@ lv_display_t *lvgl_port_add_disp_rgb(const lvgl_port_display_cfg_t *disp_cfg, co
             .on_vsync = lvgl_port_flush_rgb_vsync_ready_callback,
         };
 
-        const esp_lcd_rgb_panel_event_callbacks_t bb_cbs = {
+        esp_lcd_rgb_panel_event_callbacks_t bb_cbs = {
 #if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(6, 0, 0)
             .on_frame_buf_complete = lvgl_port_flush_rgb_vsync_ready_callback,
 #elif ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 1, 2)
@@ -187,6 +264,29 @@ lv_display_t *lvgl_port_add_disp_rgb(const lvgl_port_display_cfg_t *disp_cfg, co
 #endif
         };
 
+        if (rgb_cfg->flags.no_fb) {
+#if LVGL_PORT_SCANOUT
+            const lvgl_port_scanout_cfg_t scanout_cfg = {
+                .hres = disp_cfg->hres,
+                .vres = disp_cfg->vres,
+                .format = rgb_cfg->scanout_format,
+#if CONFIG_SPIRAM
+                .pixel_caps = MALLOC_CAP_SPIRAM,
+#endif
+            };
+            disp_ctx->scanout = lvgl_port_scanout_create(&scanout_cfg);
+            if (disp_ctx->scanout == NULL) {
+                ESP_LOGE(TAG, "Not enough memory for the scanout store!");
+                lvgl_port_unlock();
+                lvgl_port_remove_disp(disp);
+                return NULL;
+            }
+            bb_cbs.on_bounce_empty = lvgl_port_scanout_bounce_empty_callback;
+#else
+            ESP_LOGE(TAG, "A panel without frame buffer is supported only on ESP32S3 and from IDF 5.1.2!");
+#endif
+        }
+
         if (rgb_cfg->flags.bb_mode && (ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 1, 2))) {
             ESP_ERROR_CHECK(esp_lcd_rgb_panel_register_event_callbacks(disp_ctx->panel_handle, &bb_cbs, disp_ctx->disp_drv));
         } else {
@@ -196,6 +296,24 @@ lv_display_t *lvgl_port_add_disp_rgb(const lvgl_port_display_cfg_t *disp_cfg, co
         ESP_RETURN_ON_FALSE(false, NULL, TAG, "RGB is supported only on ESP32S3 and from IDF 5.0!");
 #endif
 
+        if (priv_cfg.async_flush) {
+#if LVGL_PORT_ASYNC_FLUSH
+            if (lvgl_port_async_flush_init(disp_ctx, disp_cfg) != ESP_OK) {
+                ESP_LOGW(TAG, "Async flush not available, the CPU copies the draw buffer");
+            }
+#else
+            ESP_LOGW(TAG, "Async flush is supported only on ESP32S3 and from IDF 5.4!");
+#endif
+        }
+
+        if (priv_cfg.vsync_paced) {
+#if LVGL_PORT_VSYNC_PACED
+            lvgl_port_vsync_init(disp_ctx);
+#else
+            ESP_LOGW(TAG, "VSYNC paced refresh is supported only on ESP32S3 and from LVGL 9.4!");
+#endif
+        }
+
         /* Apply rotation from initial display configuration */
         lvgl_port_disp_rotation_update(disp_ctx);
     }
@@ -210,6 +328,9 @@ esp_err_t lvgl_port_remove_disp(lv_display_t *disp)
     lvgl_port_display_ctx_t *disp_ctx = (lvgl_port_display_ctx_t *)lv_display_get_driver_data(disp);
 
     lvgl_port_lock(0);
+#if LVGL_PORT_VSYNC_PACED
+    lvgl_port_vsync_remove(disp_ctx);
+#endif
     lv_disp_remove(disp);
     lvgl_port_unlock();
 
@@ -232,6 +353,19 @@ esp_err_t lvgl_port_remove_disp(lv_display_t *disp)
     if (disp_ctx->trans_sem) {
         vSemaphoreDelete(disp_ctx->trans_sem);
     }
+#if LVGL_PORT_ASYNC_FLUSH
+    if (disp_ctx->async.handle) {
+        esp_async_memcpy_uninstall(disp_ctx->async.handle);
+        vSemaphoreDelete(disp_ctx->async.done_sem);
+    }
+#endif
+#if LVGL_PORT_SCANOUT
+    if (disp_ctx->scanout) {
+        esp_lcd_rgb_panel_event_callbacks_t cbs = {0};
+        esp_lcd_rgb_panel_register_event_callbacks(disp_ctx->panel_handle, &cbs, NULL);
+        lvgl_port_scanout_delete(disp_ctx->scanout);
+    }
+#endif
 #if LVGL_PORT_PPA
     if (disp_ctx->ppa_handle) {
         lvgl_port_ppa_delete(disp_ctx->ppa_handle);
@@ -249,6 +383,84 @@ void lvgl_port_flush_ready(lv_display_t *disp)
     lv_disp_flush_ready(disp);
 }
 
+esp_err_t lvgl_port_get_flush_stats(lv_display_t *disp, lvgl_port_flush_stats_t *stats, bool reset)
+{
+    assert(disp);
+    assert(stats);
+#if LVGL_PORT_ASYNC_FLUSH
+    lvgl_port_display_ctx_t *disp_ctx = (lvgl_port_display_ctx_t *)lv_display_get_driver_data(disp);
+    ESP_RETURN_ON_FALSE(disp_ctx && disp_ctx->async.handle, ESP_ERR_NOT_SUPPORTED, TAG, "Display without async flush");
+
+    portENTER_CRITICAL(&disp_ctx->async.lock);
+    *stats = disp_ctx->async.stats;
+    if (reset) {
+        memset(&disp_ctx->async.stats, 0, sizeof(disp_ctx->async.stats));
+    }
+    portEXIT_CRITICAL(&disp_ctx->async.lock);
+    return ESP_OK;
+#else
+    return ESP_ERR_NOT_SUPPORTED;
+#endif
+}
+
+esp_err_t lvgl_port_get_frame_stats(lv_display_t *disp, lvgl_port_frame_stats_t *stats, bool reset)
+{
+    assert(disp);
+    assert(stats);
+#if LVGL_PORT_VSYNC_PACED
+    lvgl_port_display_ctx_t *disp_ctx = (lvgl_port_display_ctx_t *)lv_display_get_driver_data(disp);
+    ESP_RETURN_ON_FALSE(disp_ctx && disp_ctx->flags.vsync_paced, ESP_ERR_NOT_SUPPORTED, TAG, "Display not VSYNC paced");
+
+    lvgl_port_lock(0);
+    *stats = disp_ctx->vsync.stats;
+    const uint32_t count = disp_ctx->vsync.count;
+    stats->vsyncs = count - disp_ctx->vsync.stats_count;
+    if (reset) {
+        memset(&disp_ctx->vsync.stats, 0, sizeof(disp_ctx->vsync.stats));
+        disp_ctx->vsync.stats_count = count;
+    }
+    lvgl_port_unlock();
+    return ESP_OK;
+#else
+    return ESP_ERR_NOT_SUPPORTED;
+#endif
+}
+
+esp_err_t lvgl_port_set_scanout_background(lv_display_t *disp, lvgl_port_scanout_bg_cb_t cb, void *user_ctx)
+{
+    assert(disp);
+#if LVGL_PORT_SCANOUT
+    lvgl_port_display_ctx_t *disp_ctx = (lvgl_port_display_ctx_t *)lv_display_get_driver_data(disp);
+    ESP_RETURN_ON_FALSE(disp_ctx && disp_ctx->scanout, ESP_ERR_NOT_SUPPORTED, TAG, "Display with a frame buffer");
+
+    lvgl_port_lock(0);
+    lvgl_port_scanout_set_bg(disp_ctx->scanout, cb, user_ctx);
+    /* The tiles which showed the old background must be compared with the new one */
+    lv_obj_invalidate(lv_display_get_screen_active(disp));
+    lvgl_port_unlock();
+    return ESP_OK;
+#else
+    return ESP_ERR_NOT_SUPPORTED;
+#endif
+}
+
+esp_err_t lvgl_port_get_scanout_stats(lv_display_t *disp, lvgl_port_scanout_stats_t *stats, bool reset)
+{
+    assert(disp);
+    assert(stats);
+#if LVGL_PORT_SCANOUT
+    lvgl_port_display_ctx_t *disp_ctx = (lvgl_port_display_ctx_t *)lv_display_get_driver_data(disp);
+    ESP_RETURN_ON_FALSE(disp_ctx && disp_ctx->scanout, ESP_ERR_NOT_SUPPORTED, TAG, "Display with a frame buffer");
+
+    lvgl_port_lock(0);
+    lvgl_port_scanout_get_stats(disp_ctx->scanout, stats, reset);
+    lvgl_port_unlock();
+    return ESP_OK;
+#else
+    return ESP_ERR_NOT_SUPPORTED;
+#endif
+}
+
 /*******************************************************************************
 * Private functions
 *******************************************************************************/
@@ -330,10 +542,15 @@ static lv_display_t *lvgl_port_add_disp_priv(const lvgl_port_display_cfg_t *disp
     } else {
         /* alloc draw buffers used by LVGL */
         /* it's recommended to choose the size of the draw buffer(s) to be at least 1/10 screen sized */
-        buf1 = heap_caps_aligned_alloc(CONFIG_LV_DRAW_BUF_ALIGN, buffer_size * color_bytes, buff_caps);
+        size_t buff_align = CONFIG_LV_DRAW_BUF_ALIGN;
+        if (priv_cfg && priv_cfg->async_flush && buff_align < LVGL_PORT_ASYNC_FLUSH_ALIGN) {
+            /* Rows copied by the GDMA start on a burst */
+            buff_align = LVGL_PORT_ASYNC_FLUSH_ALIGN;
+        }
+        buf1 = heap_caps_aligned_alloc(buff_align, buffer_size * color_bytes, buff_caps);
         ESP_GOTO_ON_FALSE(buf1, ESP_ERR_NO_MEM, err, TAG, "Not enough memory for LVGL buffer (buf1) allocation!");
         if (disp_cfg->double_buffer) {
-            buf2 = heap_caps_aligned_alloc(CONFIG_LV_DRAW_BUF_ALIGN, buffer_size * color_bytes, buff_caps);
+            buf2 = heap_caps_aligned_alloc(buff_align, buffer_size * color_bytes, buff_caps);
             ESP_GOTO_ON_FALSE(buf2, ESP_ERR_NO_MEM, err, TAG, "Not enough memory for LVGL buffer (buf2) allocation!");
         }
 
@@ -495,11 +712,34 @@ static bool lvgl_port_flush_rgb_vsync_ready_callback(esp_lcd_panel_handle_t pane
         xSemaphoreGiveFromISR(disp_ctx->trans_sem, &need_yield);
     }
 
+#if LVGL_PORT_VSYNC_PACED
+    if (disp_ctx->flags.vsync_paced) {
+        disp_ctx->vsync.count++;
+        /* Wake the LVGL task only when there is something to render or animate */
+        if (disp_ctx->vsync.refr_pending || disp_ctx->vsync.requested) {
+            lvgl_port_task_wake(LVGL_PORT_EVENT_VSYNC, disp_drv);
+        }
+    }
+#endif
+
     return (need_yield == pdTRUE);
 }
 #endif
 #endif
 
+#if LVGL_PORT_SCANOUT
+static bool lvgl_port_scanout_bounce_empty_callback(esp_lcd_panel_handle_t panel, void *bounce_buf, int pos_px, int len_bytes, void *user_ctx)
+{
+    lv_display_t *disp_drv = (lv_display_t *)user_ctx;
+    assert(disp_drv != NULL);
+    lvgl_port_display_ctx_t *disp_ctx = (lvgl_port_display_ctx_t *)lv_display_get_driver_data(disp_drv);
+    assert(disp_ctx != NULL);
+
+    lvgl_port_scanout_fill(disp_ctx->scanout, pos_px, len_bytes / sizeof(uint16_t), bounce_buf);
+    return false;
+}
+#endif
+
 static void _lvgl_port_transform_monochrome(lv_display_t *display, const lv_area_t *area, uint8_t **color_map)
 {
     assert(color_map);
@@ -679,6 +919,23 @@ static void lvgl_port_flush_callback(lv_display_t *drv, const lv_area_t *area, u
         _lvgl_port_transform_monochrome(drv, area, &color_map);
     }
 
+#if LVGL_PORT_SCANOUT
+    if (disp_ctx->scanout) {
+        /* No frame buffer: the area is stored as tiles, read by the bounce buffer interrupt */
+        lvgl_port_scanout_write(disp_ctx->scanout, offsetx1, offsety1, offsetx2, offsety2, (const uint16_t *)color_map);
+        lv_disp_flush_ready(drv);
+        return;
+    }
+#endif
+
+#if LVGL_PORT_ASYNC_FLUSH
+    if (disp_ctx->async.handle) {
+        /* lv_disp_flush_ready() is called when the copy ends */
+        lvgl_port_async_flush(disp_ctx, offsetx1, offsety1, offsetx2, offsety2, color_map);
+        return;
+    }
+#endif
+
     if ((disp_ctx->disp_type == LVGL_PORT_DISP_TYPE_RGB || disp_ctx->disp_type == LVGL_PORT_DISP_TYPE_DSI) && (disp_ctx->flags.direct_mode || disp_ctx->flags.full_refresh)) {
         if (lv_disp_flush_is_last(drv)) {
             /* If the interface is I80 or SPI, this step cannot be used for drawing. */
@@ -751,6 +1008,249 @@ static void lvgl_port_disp_size_update_callback(lv_event_t *e)
 
 static void lvgl_port_display_invalidate_callback(lv_event_t *e)
 {
+    lvgl_port_display_ctx_t *disp_ctx = (lvgl_port_display_ctx_t *)lv_event_get_user_data(e);
+    assert(disp_ctx != NULL);
+
+#if LVGL_PORT_ASYNC_FLUSH
+    lv_area_t *area = (lv_area_t *)lv_event_get_param(e);
+    if (disp_ctx->async.handle && area && lv_event_get_code(e) == LV_EVENT_INVALIDATE_AREA) {
+        /* Redraw whole GDMA bursts, so that every row of the area can be copied by the DMA */
+        area->x1 &= ~(int32_t)(disp_ctx->async.align_px - 1);
+        area->x2 |= (int32_t)(disp_ctx->async.align_px - 1);
+    }
+#endif
+
+    if (disp_ctx->flags.vsync_paced) {
+#if LVGL_PORT_VSYNC_PACED
+        /* Rendered at the next VSYNC, which wakes the LVGL task */
+        if (lv_event_get_code(e) == LV_EVENT_REFR_REQUEST) {
+            disp_ctx->vsync.refr_pending = true;
+        }
+#endif
+        return;
+    }
+
     /* Wake LVGL task, if needed */
     lvgl_port_task_wake(LVGL_PORT_EVENT_DISPLAY, NULL);
 }
+
+#if LVGL_PORT_VSYNC_PACED
+static void lvgl_port_vsync_request_callback(lv_event_t *e)
+{
+    lvgl_port_display_ctx_t *disp_ctx = (lvgl_port_display_ctx_t *)lv_event_get_user_data(e);
+    /* The display is the parameter when the first LV_EVENT_VSYNC callback is added, NULL when the last one is removed */
+    disp_ctx->vsync.requested = (lv_event_get_param(e) != NULL);
+}
+
+static void lvgl_port_vsync_init(lvgl_port_display_ctx_t *disp_ctx)
+{
+    lv_display_t *disp = disp_ctx->disp_drv;
+
+    /* The port refreshes the display instead of the LV_DEF_REFR_PERIOD timer */
+    lv_display_delete_refr_timer(disp);
+    lv_display_add_event_cb(disp, lvgl_port_vsync_request_callback, LV_EVENT_VSYNC_REQUEST, disp_ctx);
+    disp_ctx->vsync.refr_pending = true;
+    disp_ctx->vsync.next = lvgl_port_vsync_displays;
+    lvgl_port_vsync_displays = disp_ctx;
+    disp_ctx->flags.vsync_paced = 1;
+
+    /* Animations step on the VSYNC of the default display, right before its frame */
+    if (lv_display_get_default() == disp) {
+        lv_anim_enable_vsync_mode(true);
+    }
+}
+
+static void lvgl_port_vsync_remove(lvgl_port_display_ctx_t *disp_ctx)
+{
+    if (!disp_ctx->flags.vsync_paced) {
+        return;
+    }
+
+    for (lvgl_port_display_ctx_t **p = &lvgl_port_vsync_displays; *p != NULL; p = &(*p)->vsync.next) {
+        if (*p == disp_ctx) {
+            *p = disp_ctx->vsync.next;
+            break;
+        }
+    }
+    disp_ctx->flags.vsync_paced = 0;
+
+    if (lv_display_get_default() == disp_ctx->disp_drv) {
+        lv_anim_enable_vsync_mode(false);
+    }
+}
+
+void lvgl_port_disp_vsync_refresh(void)
+{
+    for (lvgl_port_display_ctx_t *disp_ctx = lvgl_port_vsync_displays; disp_ctx != NULL; disp_ctx = disp_ctx->vsync.next) {
+        const uint32_t start = disp_ctx->vsync.count;
+        if (start == disp_ctx->vsync.handled) {
+            /* Woken by the VSYNC of another display */
+            continue;
+        }
+        /* VSYNCs passed while the previous frame rendered are skipped, not queued */
+        disp_ctx->vsync.handled = start;
+
+        /* Animations step now and invalidate what they move */
+        lv_display_send_vsync_event(disp_ctx->disp_drv, NULL);
+        if (!disp_ctx->vsync.refr_pending) {
+            continue;
+        }
+        disp_ctx->vsync.refr_pending = false;
+
+        lv_display_t *default_disp = lv_display_get_default();
+        lv_display_set_default(disp_ctx->disp_drv);
+        lv_display_refr_timer(NULL);
+        lv_display_set_default(default_disp);
+
+        /* Due at the next VSYNC. With avoid_tearing, the flush waited for it: one VSYNC is on time. */
+        const uint32_t elapsed = disp_ctx->vsync.count - start;
+        const uint32_t due = disp_ctx->trans_sem ? 1 : 0;
+        disp_ctx->vsync.stats.frames++;
+        if (elapsed > due) {
+            disp_ctx->vsync.stats.late++;
+            disp_ctx->vsync.stats.dropped += elapsed - due;
+        }
+    }
+}
+#else
+void lvgl_port_disp_vsync_refresh(void)
+{
+}
+#endif
+
+#if LVGL_PORT_ASYNC_FLUSH
+static esp_err_t lvgl_port_async_flush_init(lvgl_port_display_ctx_t *disp_ctx, const lvgl_port_display_cfg_t *disp_cfg)
+{
+    esp_err_t ret = ESP_OK;
+    const uint32_t fb_stride = disp_cfg->hres * sizeof(uint16_t);
+
+    ESP_RETURN_ON_FALSE(!disp_cfg->flags.direct_mode && !disp_cfg->flags.full_refresh && !disp_cfg->monochrome, ESP_ERR_INVALID_ARG, TAG, "Async flush is for partial mode only!");
+    ESP_RETURN_ON_FALSE(disp_cfg->double_buffer && disp_cfg->flags.buff_dma && !disp_cfg->flags.buff_spiram, ESP_ERR_INVALID_ARG, TAG, "Async flush needs two DMA capable draw buffers in internal RAM!");
+    ESP_RETURN_ON_FALSE((fb_stride % LVGL_PORT_ASYNC_FLUSH_ALIGN) == 0, ESP_ERR_INVALID_ARG, TAG, "Async flush needs %d bytes aligned frame buffer rows!", LVGL_PORT_ASYNC_FLUSH_ALIGN);
+    ESP_RETURN_ON_ERROR(esp_lcd_rgb_panel_get_frame_buffer(disp_ctx->panel_handle, 1, (void *)&disp_ctx->async.fb), TAG, "Get RGB buffer failed");
+    ESP_RETURN_ON_FALSE(((uintptr_t)disp_ctx->async.fb % LVGL_PORT_ASYNC_FLUSH_ALIGN) == 0, ESP_ERR_INVALID_ARG, TAG, "Async flush needs a %d bytes aligned frame buffer (psram_trans_align)!", LVGL_PORT_ASYNC_FLUSH_ALIGN);
+
+    disp_ctx->async.done_sem = xSemaphoreCreateBinary();
+    ESP_RETURN_ON_FALSE(disp_ctx->async.done_sem, ESP_ERR_NO_MEM, TAG, "Failed to create async flush Semaphore");
+
+    /* One transaction per row of a partial area: up to the screen height in flight */
+    async_memcpy_config_t config = ASYNC_MEMCPY_DEFAULT_CONFIG();
+    config.backlog = disp_cfg->vres;
+    config.dma_burst_size = LVGL_PORT_ASYNC_FLUSH_ALIGN;
+    ESP_GOTO_ON_ERROR(esp_async_memcpy_install(&config, &disp_ctx->async.handle), err, TAG, "Async memcpy install failed");
+
+    disp_ctx->async.fb_stride = fb_stride;
+    disp_ctx->async.align_px = LVGL_PORT_ASYNC_FLUSH_ALIGN / sizeof(uint16_t);
+    portMUX_INITIALIZE(&disp_ctx->async.lock);
+    lv_display_set_flush_wait_cb(disp_ctx->disp_drv, lvgl_port_async_flush_wait_callback);
+    ESP_LOGI(TAG, "Async flush: draw buffer copied by the GDMA, areas rounded to %lu px", (unsigned long)disp_ctx->async.align_px);
+
+err:
+    if (ret != ESP_OK) {
+        vSemaphoreDelete(disp_ctx->async.done_sem);
+        disp_ctx->async.done_sem = NULL;
+        disp_ctx->async.handle = NULL;
+    }
+    return ret;
+}
+
+/* Called from the copy done ISR, or from the LVGL task when rows were copied by the CPU */
+static bool lvgl_port_async_flush_done(lvgl_port_display_ctx_t *disp_ctx, uint32_t transactions)
+{
+    BaseType_t need_yield = pdFALSE;
+    bool last = false;
+
+    portENTER_CRITICAL_SAFE(&disp_ctx->async.lock);
+    disp_ctx->async.transfers_left -= transactions;
+    if (disp_ctx->async.transfers_left == 0) {
+        uint32_t copy_us = (uint32_t)(esp_timer_get_time() - disp_ctx->async.start_us);
+        disp_ctx->async.stats.copy_us += copy_us;
+        if (copy_us > disp_ctx->async.stats.copy_us_max) {
+            disp_ctx->async.stats.copy_us_max = copy_us;
+        }
+        last = true;
+    }
+    portEXIT_CRITICAL_SAFE(&disp_ctx->async.lock);
+
+    if (last) {
+        lv_disp_flush_ready(disp_ctx->disp_drv);
+        if (xPortInIsrContext()) {
+            xSemaphoreGiveFromISR(disp_ctx->async.done_sem, &need_yield);
+        } else {
+            xSemaphoreGive(disp_ctx->async.done_sem);
+        }
+    }
+    return (need_yield == pdTRUE);
+}
+
+static bool lvgl_port_async_flush_copy_done_callback(async_memcpy_handle_t mcp, async_memcpy_event_t *event, void *cb_args)
+{
+    lvgl_port_display_ctx_t *disp_ctx = (lvgl_port_display_ctx_t *)cb_args;
+    assert(disp_ctx != NULL);
+    return lvgl_port_async_flush_done(disp_ctx, 1);
+}
+
+/* Rows the GDMA cannot copy (not aligned, no free transaction) */
+static void lvgl_port_async_flush_cpu(lvgl_port_display_ctx_t *disp_ctx, int x1, int y1, int x2, int y2, uint8_t *color_map)
+{
+    /* The rows may still be cached from an earlier CPU copy and changed since by the DMA: drop the clean lines first */
+    esp_cache_msync(disp_ctx->async.fb + y1 * disp_ctx->async.fb_stride, (y2 - y1 + 1) * disp_ctx->async.fb_stride, ESP_CACHE_MSYNC_FLAG_DIR_M2C);
+    esp_lcd_panel_draw_bitmap(disp_ctx->panel_handle, x1, y1, x2 + 1, y2 + 1, color_map);
+}
+
+static void lvgl_port_async_flush(lvgl_port_display_ctx_t *disp_ctx, int x1, int y1, int x2, int y2, uint8_t *color_map)
+{
+    const uint32_t fb_stride = disp_ctx->async.fb_stride;
+    const uint32_t row_bytes = (x2 - x1 + 1) * sizeof(uint16_t);
+    const uint32_t rows = y2 - y1 + 1;
+    uint8_t *dst = disp_ctx->async.fb + y1 * fb_stride + x1 * sizeof(uint16_t);
+
+    /* Full width areas are contiguous in the frame buffer: a single transaction */
+    const bool full_width = (row_bytes == fb_stride);
+    const uint32_t transactions = full_width ? 1 : rows;
+    const uint32_t transaction_bytes = full_width ? rows * fb_stride : row_bytes;
+
+    disp_ctx->async.start_us = esp_timer_get_time();
+
+    if (((uintptr_t)dst % LVGL_PORT_ASYNC_FLUSH_ALIGN) || (row_bytes % LVGL_PORT_ASYNC_FLUSH_ALIGN) || ((uintptr_t)color_map % LVGL_PORT_ASYNC_FLUSH_ALIGN)) {
+        lvgl_port_async_flush_cpu(disp_ctx, x1, y1, x2, y2, color_map);
+        portENTER_CRITICAL(&disp_ctx->async.lock);
+        disp_ctx->async.stats.cpu_flushes++;
+        portEXIT_CRITICAL(&disp_ctx->async.lock);
+        lv_disp_flush_ready(disp_ctx->disp_drv);
+        return;
+    }
+
+    portENTER_CRITICAL(&disp_ctx->async.lock);
+    disp_ctx->async.transfers_left = transactions;
+    disp_ctx->async.stats.flushes++;
+    disp_ctx->async.stats.bytes += (uint64_t)rows * row_bytes;
+    portEXIT_CRITICAL(&disp_ctx->async.lock);
+
+    for (uint32_t i = 0; i < transactions; i++) {
+        if (esp_async_memcpy(disp_ctx->async.handle, dst + i * fb_stride, color_map + i * row_bytes, transaction_bytes,
+                             lvgl_port_async_flush_copy_done_callback, disp_ctx) != ESP_OK) {
+            ESP_LOGW(TAG, "Async memcpy busy, the CPU copies %lu rows", (unsigned long)(rows - i));
+            lvgl_port_async_flush_cpu(disp_ctx, x1, y1 + i, x2, y2, color_map + i * row_bytes);
+            lvgl_port_async_flush_done(disp_ctx, transactions - i);
+            break;
+        }
+    }
+}
+
+static void lvgl_port_async_flush_wait_callback(lv_display_t *disp)
+{
+    lvgl_port_display_ctx_t *disp_ctx = (lvgl_port_display_ctx_t *)lv_display_get_driver_data(disp);
+    assert(disp_ctx != NULL);
+
+    /* The semaphore may be left given by a copy LVGL did not wait for */
+    int64_t start_us = esp_timer_get_time();
+    while (disp_ctx->async.transfers_left > 0) {
+        xSemaphoreTake(disp_ctx->async.done_sem, portMAX_DELAY);
+    }
+
+    portENTER_CRITICAL(&disp_ctx->async.lock);
+    disp_ctx->async.stats.wait_us += esp_timer_get_time() - start_us;
+    portEXIT_CRITICAL(&disp_ctx->async.lock);
+}
+#endif
@@ -9,11 +9,15 @@
 #include "esp_check.h"
 #include "esp_lcd_touch.h"
 #include "esp_lvgl_port.h"
+#include "esp_lvgl_port_priv.h"
 #include "esp_timer.h"
 #include "sdkconfig.h"
 
 static const char *TAG = "LVGL";
 
+/* Time without touch after which a polled touch is read every touch_idle_poll_ms */
+#define LVGL_PORT_TOUCH_IDLE_AFTER_MS   1000
+
 /*******************************************************************************
 * Types definitions
 *******************************************************************************/
@@ -25,6 +29,10 @@ typedef struct {
         float x;
         float y;
     } scale;                            /* Touch scale */
+    uint32_t                idle_poll_ms;   /* Read period set when the touch went idle */
+    uint32_t                last_touch_ms;  /* LVGL tick of the last read with a touch */
+    bool                    polled;         /* No interrupt pin: read by the LVGL read timer */
+    bool                    idle;           /* Read timer slowed down to idle_poll_ms */
 } lvgl_port_touch_ctx_t;
 
 /*******************************************************************************
@@ -33,6 +41,7 @@ typedef struct {
 
 static void lvgl_port_touchpad_read(lv_indev_t *indev_drv, lv_indev_data_t *data);
 static void lvgl_port_touch_interrupt_callback(esp_lcd_touch_handle_t tp);
+static void lvgl_port_touch_update_poll_period(lvgl_port_touch_ctx_t *touch_ctx, bool touched);
 
 /*******************************************************************************
 * Public API functions
@@ -55,6 +64,9 @@ lv_indev_t *lvgl_port_add_touch(const lvgl_port_touch_cfg_t *touch_cfg)
     touch_ctx->handle = touch_cfg->handle;
     touch_ctx->scale.x = (touch_cfg->scale.x ? touch_cfg->scale.x : 1);
     touch_ctx->scale.y = (touch_cfg->scale.y ? touch_cfg->scale.y : 1);
+    touch_ctx->idle_poll_ms = 0;
+    touch_ctx->polled = false;
+    touch_ctx->idle = false;
 
     if (touch_ctx->handle->config.int_gpio_num != GPIO_NUM_NC) {
         /* Register touch interrupt callback */
@@ -69,6 +81,10 @@ lv_indev_t *lvgl_port_add_touch(const lvgl_port_touch_cfg_t *touch_cfg)
     /* Event mode can be set only, when touch interrupt enabled */
     if (touch_ctx->handle->config.int_gpio_num != GPIO_NUM_NC) {
         lv_indev_set_mode(indev, LV_INDEV_MODE_EVENT);
+    } else {
+        /* Polled by the LVGL read timer: slow it down while nobody touches the screen */
+        touch_ctx->polled = true;
+        touch_ctx->last_touch_ms = lv_tick_get();
     }
     lv_indev_set_read_cb(indev, lvgl_port_touchpad_read);
     lv_indev_set_disp(indev, touch_cfg->disp);
@@ -159,6 +175,38 @@ static void lvgl_port_touchpad_read(lv_indev_t *indev_drv, lv_indev_data_t *data
     } else {
         data->state = LV_INDEV_STATE_RELEASED;
     }
+
+    if (touch_ctx->polled) {
+        lvgl_port_touch_update_poll_period(touch_ctx, touch_cnt > 0);
+    }
+}
+
+static void lvgl_port_touch_update_poll_period(lvgl_port_touch_ctx_t *touch_ctx, bool touched)
+{
+    lv_timer_t *read_timer = lv_indev_get_read_timer(touch_ctx->indev);
+    if (read_timer == NULL) {
+        return;
+    }
+
+    const uint32_t idle_poll_ms = lvgl_port_get_touch_idle_poll_ms();
+    if (touched) {
+        touch_ctx->last_touch_ms = lv_tick_get();
+        if (touch_ctx->idle) {
+            /* First touch is seen at most idle_poll_ms late, then back to the LVGL read period */
+            lv_timer_set_period(read_timer, LV_DEF_REFR_PERIOD);
+            touch_ctx->idle = false;
+        }
+    } else if (touch_ctx->idle) {
+        /* Idle period changed by lvgl_port_set_touch_idle_poll_ms() meanwhile */
+        if (touch_ctx->idle_poll_ms != idle_poll_ms) {
+            lv_timer_set_period(read_timer, idle_poll_ms ? idle_poll_ms : LV_DEF_REFR_PERIOD);
+            touch_ctx->idle_poll_ms = idle_poll_ms;
+        }
+    } else if (idle_poll_ms && lv_tick_elaps(touch_ctx->last_touch_ms) >= LVGL_PORT_TOUCH_IDLE_AFTER_MS) {
+        lv_timer_set_period(read_timer, idle_poll_ms);
+        touch_ctx->idle_poll_ms = idle_poll_ms;
+        touch_ctx->idle = true;
+    }
 }
 
 static void IRAM_ATTR lvgl_port_touch_interrupt_callback(esp_lcd_touch_handle_t tp)
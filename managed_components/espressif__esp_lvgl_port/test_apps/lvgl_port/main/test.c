@@ -16,6 +16,9 @@
 #include "esp_lcd_panel_ops.h"
 #include "esp_lvgl_port.h"
 #include "esp_lcd_ili9341.h"
+#include "esp_timer.h"
+#include "esp_random.h"
+#include "esp_heap_caps.h"
 
 #include "esp_lcd_touch_gt911.h"
 
@@ -372,6 +375,101 @@ TEST_CASE("Main test LVGL port", "[lvgl port]")
 
 }
 
+#if LVGL_VERSION_MAJOR >= 9
+/* Render time only: 480x480 display without panel, partial mode, flushed at once */
+#define PERF_H_RES          (480)
+#define PERF_V_RES          (480)
+#define PERF_BUFF_HEIGHT    (40)
+#define PERF_FRAMES         (20)
+#define PERF_CHART_POINTS   (10 << 5)    /* LVGL test_cases_perf/test_chart doubles 10 times: 5 fit the 64 KB LVGL heap */
+
+static void perf_flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map)
+{
+    lv_display_flush_ready(disp);
+}
+
+static lv_obj_t *perf_label_screen(void)
+{
+    /* LVGL test_cases_perf/test_label */
+    lv_obj_t *scr = lv_obj_create(NULL);
+    lv_obj_t *label = lv_label_create(scr);
+    lv_obj_set_width(label, lv_pct(100));
+    lv_label_set_text(label, "Lorem ipsum dolor sit amet, consectetur adipiscing elit. Ut auctor sed dui interdum convallis. Proin in ante magna. Pellentesque placerat condimentum erat ac laoreet. Cras mi eros, convallis vitae massa ac, blandit sodales urna. Proin tincidunt fermentum leo a volutpat. Donec ut blandit tortor. Duis elementum nibh nec consequat sagittis. Lutrae sunt praeclarae");
+    return scr;
+}
+
+static lv_obj_t *perf_chart_screen(void)
+{
+    lv_obj_t *scr = lv_obj_create(NULL);
+    lv_obj_t *chart = lv_chart_create(scr);
+    lv_obj_set_size(chart, lv_pct(100), lv_pct(100));
+    lv_chart_set_point_count(chart, PERF_CHART_POINTS);
+    lv_chart_series_t *ser = lv_chart_add_series(chart, lv_palette_main(LV_PALETTE_RED), LV_CHART_AXIS_PRIMARY_Y);
+    for (int i = 0; i < PERF_CHART_POINTS; i++) {
+        lv_chart_set_next_value(chart, ser, (int32_t)(esp_random() % 100));
+    }
+    return scr;
+}
+
+static lv_obj_t *perf_grid_screen(void)
+{
+    /* Independent areas: the best case of parallel draw units */
+    lv_obj_t *scr = lv_obj_create(NULL);
+    lv_obj_set_flex_flow(scr, LV_FLEX_FLOW_ROW_WRAP);
+    for (int i = 0; i < 16; i++) {
+        lv_obj_t *btn = lv_button_create(scr);
+        lv_obj_set_size(btn, 102, 102);
+        lv_obj_t *label = lv_label_create(btn);
+        lv_label_set_text_fmt(label, "Button %d", i + 1);
+        lv_obj_center(label);
+    }
+    return scr;
+}
+
+TEST_CASE("Draw units frame time", "[lvgl port][perf]")
+{
+    const lvgl_port_cfg_t lvgl_cfg = ESP_LVGL_PORT_INIT_CONFIG();
+    TEST_ASSERT_EQUAL(lvgl_port_init(&lvgl_cfg), ESP_OK);
+
+    lvgl_port_lock(0);
+    const size_t buf_size = PERF_H_RES * PERF_BUFF_HEIGHT * sizeof(uint16_t);
+    void *buf = heap_caps_malloc(buf_size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    TEST_ASSERT_NOT_NULL(buf);
+    lv_display_t *disp = lv_display_create(PERF_H_RES, PERF_V_RES);
+    lv_display_set_color_format(disp, LV_COLOR_FORMAT_RGB565);
+    lv_display_set_buffers(disp, buf, NULL, buf_size, LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_cb(disp, perf_flush_cb);
+    lv_display_set_default(disp);
+
+    const struct {
+        const char *name;
+        lv_obj_t *scr;
+    } scenes[] = {
+        {"test_label", perf_label_screen()},
+        {"test_chart", perf_chart_screen()},
+        {"button grid", perf_grid_screen()},
+    };
+
+    printf("%d SW draw unit(s), %dx%d, %d lines buffer\n", LV_DRAW_SW_DRAW_UNIT_CNT, PERF_H_RES, PERF_V_RES, PERF_BUFF_HEIGHT);
+    for (int i = 0; i < sizeof(scenes) / sizeof(scenes[0]); i++) {
+        lv_screen_load(scenes[i].scr);
+        lv_refr_now(disp);
+        const int64_t start = esp_timer_get_time();
+        for (int f = 0; f < PERF_FRAMES; f++) {
+            lv_obj_invalidate(scenes[i].scr);
+            lv_refr_now(disp);
+        }
+        printf("%-12s %8lld us/frame\n", scenes[i].name, (esp_timer_get_time() - start) / PERF_FRAMES);
+    }
+
+    lv_display_delete(disp);
+    free(buf);
+    lvgl_port_unlock();
+    TEST_ASSERT_EQUAL(lvgl_port_deinit(), ESP_OK);
+    vTaskDelay(1000 / portTICK_PERIOD_MS);
+}
+#endif
+
 void app_main(void)
 {
     printf("TEST ESP LVGL port\n\r");
@@ -0,0 +1,540 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+Portable reference of the esp32s3 RGB565 mix kernels (opacity and mask variants) and of the
+esp32s3 ARGB8888 to RGB565 image blend kernels
+
+Replaces the assembly on a host: the functions have the names and the asm_dsc_t interface of the
+esp32s3 kernels in src/lvgl9/simd and follow them step by step, the Q registers being modelled as
+8 x 16-bit lanes and every PIE instruction by a helper with the same name:
+    - lv_color_blend_to_rgb565_with_opa_esp32s3.S
+    - lv_color_blend_to_rgb565_with_mask_esp32s3.S
+    - lv_color_blend_to_rgb565_mix_mask_opa_esp32s3.S
+    - lv_rgb565_blend_normal_to_rgb565_with_opa_esp32s3.S
+    - lv_rgb565_blend_normal_to_rgb565_with_mask_esp32s3.S
+    - lv_rgb565_blend_normal_to_rgb565_mix_mask_opa_esp32s3.S
+    - lv_argb8888_blend_normal_to_rgb565_esp32s3.S
+    - lv_argb8888_blend_normal_to_rgb565_with_opa_esp32s3.S
+    - lv_argb8888_blend_normal_to_rgb565_with_mask_esp32s3.S
+    - lv_argb8888_blend_normal_to_rgb565_mix_mask_opa_esp32s3.S
+so the lane arithmetic can be checked against the ANSI blend API without the target.
+
+The simple fill and the RGB565 copy kernels are plain C here, only to link the hard copy of the
+blend API with all the RGB565 hooks enabled.
+*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include "lv_color.h"
+#include "lv_draw_sw_blend.h"
+#include "esp_lvgl_port_lv_blend.h"
+
+// ------------------------------------------------- Macros and Types --------------------------------------------------
+
+#define LANES 8                         // 16-bit lanes of a 128-bit Q register
+#define MIX_565_MASK 0x7E0F81F          // RGB565 spread over 32 bits: G in the upper half, R and B in the lower
+
+typedef struct {
+    uint16_t lane[LANES];
+} q_reg_t;
+
+typedef enum {
+    MIX_OPA,                            // mix = opa
+    MIX_MASK,                           // mix = mask[x]
+    MIX_MASK_OPA,                       // mix = mask[x] * opa >> 8
+} mix_src_t;
+
+// ------------------------------------------------ PIE instruction models ---------------------------------------------
+
+static uint32_t sar;                    // SAR special register, the shift of ee.vmul
+
+// ee.vmul.u16: unsigned 16 x 16 bit product, shifted right by SAR, lower 16 bits kept
+static void ee_vmul_u16(q_reg_t *qz, const q_reg_t *qx, const q_reg_t *qy)
+{
+    for (int i = 0; i < LANES; i++) {
+        qz->lane[i] = (uint16_t)(((uint32_t)qx->lane[i] * qy->lane[i]) >> sar);
+    }
+}
+
+// ee.vmul.s16: signed 16 x 16 bit product, arithmetic shift right by SAR, lower 16 bits kept
+static void ee_vmul_s16(q_reg_t *qz, const q_reg_t *qx, const q_reg_t *qy)
+{
+    for (int i = 0; i < LANES; i++) {
+        qz->lane[i] = (uint16_t)(((int32_t)(int16_t)qx->lane[i] * (int16_t)qy->lane[i]) >> sar);
+    }
+}
+
+static int16_t saturate_s16(int32_t v)
+{
+    return (int16_t)(v > INT16_MAX ? INT16_MAX : (v < INT16_MIN ? INT16_MIN : v));
+}
+
+// ee.vadds.s16: signed saturating add
+static void ee_vadds_s16(q_reg_t *qa, const q_reg_t *qx, const q_reg_t *qy)
+{
+    for (int i = 0; i < LANES; i++) {
+        qa->lane[i] = (uint16_t)saturate_s16((int16_t)qx->lane[i] + (int16_t)qy->lane[i]);
+    }
+}
+
+// ee.vsubs.s16: signed saturating subtract
+static void ee_vsubs_s16(q_reg_t *qa, const q_reg_t *qx, const q_reg_t *qy)
+{
+    for (int i = 0; i < LANES; i++) {
+        qa->lane[i] = (uint16_t)saturate_s16((int16_t)qx->lane[i] - (int16_t)qy->lane[i]);
+    }
+}
+
+// ee.orq
+static void ee_orq(q_reg_t *qa, const q_reg_t *qx, const q_reg_t *qy)
+{
+    for (int i = 0; i < LANES; i++) {
+        qa->lane[i] = qx->lane[i] | qy->lane[i];
+    }
+}
+
+// ee.vcmp.eq.s16: 0xFFFF (-1) in the lanes where qx == qy, 0 elsewhere
+static void ee_vcmp_eq_s16(q_reg_t *qa, const q_reg_t *qx, const q_reg_t *qy)
+{
+    for (int i = 0; i < LANES; i++) {
+        qa->lane[i] = qx->lane[i] == qy->lane[i] ? 0xFFFF : 0;
+    }
+}
+
+// ee.vunzip.8: even bytes of {qs0, qs1} to qs0, odd bytes to qs1
+static void ee_vunzip_8(q_reg_t *qs0, q_reg_t *qs1)
+{
+    uint8_t bytes[4 * LANES];
+    uint8_t even[2 * LANES];
+    uint8_t odd[2 * LANES];
+
+    memcpy(bytes, qs0, sizeof(*qs0));
+    memcpy(bytes + sizeof(*qs0), qs1, sizeof(*qs1));
+    for (int i = 0; i < 2 * LANES; i++) {
+        even[i] = bytes[2 * i];
+        odd[i] = bytes[2 * i + 1];
+    }
+    memcpy(qs0, even, sizeof(*qs0));
+    memcpy(qs1, odd, sizeof(*qs1));
+}
+
+// ee.vldbc.16: broadcast a 16-bit value to all the lanes
+static void ee_vldbc_16(q_reg_t *qu, uint16_t value)
+{
+    for (int i = 0; i < LANES; i++) {
+        qu->lane[i] = value;
+    }
+}
+
+// ee.ld.128.usar.ip + ee.vld.128.ip + ee.src.q: 8 unaligned RGB565 pixels, read byte by byte
+static void ee_ld_unaligned_u16(q_reg_t *qu, const uint8_t *src)
+{
+    for (int i = 0; i < LANES; i++) {
+        qu->lane[i] = (uint16_t)(src[2 * i] | (src[2 * i + 1] << 8));
+    }
+}
+
+// ee.ld.128.usar.ip + ee.vld.128.ip + ee.src.q + ee.zero.q + ee.vzip.8: 8 unaligned mask bytes zero-extended to 16 bits
+static void ee_ld_unaligned_u8_zip(q_reg_t *qu, const uint8_t *mask)
+{
+    for (int i = 0; i < LANES; i++) {
+        qu->lane[i] = mask[i];
+    }
+}
+
+// ------------------------------------------------ Kernel model -------------------------------------------------------
+
+/*
+macro_rgb565_mix_px: one pixel, the same SWAR as lv_color_16_16_mix()
+The early returns of lv_color_16_16_mix() are not needed: mix 0 gives mix5 0 (bg), mix 255 gives mix5 32 (fg)
+and fg == bg gives bg
+*/
+static uint16_t rgb565_mix_px(uint32_t fg, uint32_t bg, uint32_t mix)
+{
+    const uint32_t mix5 = (mix + 4) >> 3;
+    fg = (fg | (fg << 16)) & MIX_565_MASK;
+    bg = (bg | (bg << 16)) & MIX_565_MASK;
+    uint32_t res = ((((fg - bg) * mix5) >> 5) + bg) & MIX_565_MASK;
+    return (uint16_t)(res | (res >> 16));
+}
+
+/*
+macro_rgb565_mix_q8: 8 pixels
+    q0 - destination (background), result
+    q1 - source (foreground), destroyed
+    q2 - mix5 = (mix + 4) >> 3 per lane, 0..32
+    q3 - 2048 in all the lanes, multiplying by it with SAR = n is a shift by (11 - n)
+    q4 - q7 destroyed
+
+Each channel is mixed in its own lane as bg + ((fg - bg) * mix5 >> 5), which is what the SWAR above gives
+per channel. Multiplications replace the missing 16-bit lane shifts, so the only constant is q3
+*/
+static void rgb565_mix_q8(q_reg_t *q)
+{
+    sar = 16;
+    ee_vmul_u16(&q[4], &q[0], &q[3]);       // q4 = bg >> 5: R and G of bg
+    ee_vmul_u16(&q[5], &q[1], &q[3]);       // q5 = fg >> 5: R and G of fg
+    sar = 6;
+    ee_vmul_u16(&q[6], &q[4], &q[3]);       // q6 = (bg >> 5) << 5
+    ee_vmul_u16(&q[7], &q[5], &q[3]);       // q7 = (fg >> 5) << 5
+    ee_vsubs_s16(&q[6], &q[0], &q[6]);      // q6 = B of bg
+    ee_vsubs_s16(&q[7], &q[1], &q[7]);      // q7 = B of fg
+    ee_vsubs_s16(&q[7], &q[7], &q[6]);      // q7 = B fg - bg
+    sar = 5;
+    ee_vmul_s16(&q[7], &q[7], &q[2]);       // q7 = (B fg - bg) * mix5 >> 5
+    ee_vadds_s16(&q[6], &q[6], &q[7]);      // q6 = B result
+    sar = 17;
+    ee_vmul_u16(&q[7], &q[4], &q[3]);       // q7 = R of bg
+    ee_vmul_u16(&q[1], &q[5], &q[3]);       // q1 = R of fg
+    sar = 5;
+    ee_vmul_u16(&q[0], &q[7], &q[3]);       // q0 = R of bg << 6
+    ee_vsubs_s16(&q[0], &q[4], &q[0]);      // q0 = G of bg
+    ee_vmul_u16(&q[4], &q[1], &q[3]);       // q4 = R of fg << 6
+    ee_vsubs_s16(&q[4], &q[5], &q[4]);      // q4 = G of fg
+    ee_vsubs_s16(&q[1], &q[1], &q[7]);      // q1 = R fg - bg
+    ee_vmul_s16(&q[1], &q[1], &q[2]);       // q1 = (R fg - bg) * mix5 >> 5
+    ee_vadds_s16(&q[7], &q[7], &q[1]);      // q7 = R result
+    ee_vsubs_s16(&q[4], &q[4], &q[0]);      // q4 = G fg - bg
+    ee_vmul_s16(&q[4], &q[4], &q[2]);       // q4 = (G fg - bg) * mix5 >> 5
+    ee_vadds_s16(&q[0], &q[0], &q[4]);      // q0 = G result
+    sar = 0;
+    ee_vmul_u16(&q[7], &q[7], &q[3]);       // q7 = R << 11
+    sar = 6;
+    ee_vmul_u16(&q[0], &q[0], &q[3]);       // q0 = G << 5
+    ee_orq(&q[0], &q[0], &q[7]);
+    ee_orq(&q[0], &q[0], &q[6]);            // q0 = R | G | B
+}
+
+static int rgb565_mix_kernel(asm_dsc_t *asm_dsc, bool color_fill, mix_src_t mix_src)
+{
+    uint8_t *dest_buf = asm_dsc->dst_buf;
+    const uint8_t *src_buf = asm_dsc->src_buf;
+    const uint8_t *mask_buf = asm_dsc->mask_buf;
+    const uint32_t opa = asm_dsc->opa;
+    const uint16_t color16 = color_fill ? *(const uint16_t *)asm_dsc->src_buf : 0;
+    q_reg_t q[8];
+
+    // RGB565 destination has to be 2-byte aligned, short rows are left to the ANSI code
+    if (asm_dsc->dst_w < 8 || ((uintptr_t)dest_buf & 1) || (asm_dsc->dst_stride & 1)) {
+        return LV_RESULT_INVALID;
+    }
+
+    ee_vldbc_16(&q[3], 2048);
+    if (mix_src == MIX_OPA) {
+        ee_vldbc_16(&q[2], (opa + 4) >> 3);  // mix5 is the same for all the pixels
+    }
+
+    for (uint32_t y = 0; y < asm_dsc->dst_h; y++) {
+        uint16_t *dest = (uint16_t *)dest_buf;
+        const uint8_t *src = src_buf;
+        const uint8_t *mask = mask_buf;
+        uint32_t x = asm_dsc->dst_w;
+        uint32_t n;
+
+        // One pixel: fg, mix and bg to the scalar mix
+#define MIX_PX() do {                                                                           \
+            uint32_t fg = color_fill ? color16 : (uint32_t)(src[0] | (src[1] << 8));            \
+            uint32_t mix = (mix_src == MIX_OPA) ? opa : mask[0];                                \
+            if (mix_src == MIX_MASK_OPA) {                                                      \
+                mix = (mix * opa) >> 8;                                                         \
+            }                                                                                   \
+            *dest = rgb565_mix_px(fg, *dest, mix);                                              \
+            dest++;                                                                             \
+            src += 2;                                                                           \
+            mask++;                                                                             \
+        } while (0)
+
+        // Mix pixel by pixel until dest_buff is 16-byte aligned
+        while (x > 0 && ((uintptr_t)dest & 0xf)) {
+            MIX_PX();
+            x--;
+        }
+
+        // Main loop, 8 pixels
+        for (n = x >> 3; n > 0; n--) {
+            memcpy(&q[0], dest, sizeof(q[0]));                          // ee.vld.128.ip, aligned
+            if (color_fill) {
+                ee_vldbc_16(&q[1], color16);
+            } else {
+                ee_ld_unaligned_u16(&q[1], src);
+            }
+            if (mix_src != MIX_OPA) {
+                ee_ld_unaligned_u8_zip(&q[2], mask);
+                if (mix_src == MIX_MASK_OPA) {
+                    ee_vldbc_16(&q[4], opa);
+                    sar = 8;
+                    ee_vmul_u16(&q[2], &q[2], &q[4]);                   // mix = mask * opa >> 8
+                }
+                ee_vldbc_16(&q[4], 4);
+                ee_vadds_s16(&q[2], &q[2], &q[4]);
+                sar = 14;
+                ee_vmul_u16(&q[2], &q[2], &q[3]);                       // mix5 = (mix + 4) >> 3
+            }
+            rgb565_mix_q8(q);
+            memcpy(dest, &q[0], sizeof(q[0]));                          // ee.vst.128.ip
+            dest += LANES;
+            src += LANES * 2;
+            mask += LANES;
+        }
+
+        // Remaining pixels
+        for (n = x & 7; n > 0; n--) {
+            MIX_PX();
+        }
+#undef MIX_PX
+
+        dest_buf += asm_dsc->dst_stride;
+        src_buf += asm_dsc->src_stride;
+        mask_buf += asm_dsc->mask_stride;
+    }
+    return LV_RESULT_OK;
+}
+
+/*
+macro_argb8888_mix_next_px: one pixel, lv_color_24_16_mix() without its early returns
+(fg * mix + bg * mix_inv) >> 8 per channel gives them when mix 255 is raised to 256 and so is mix_inv of mix 0
+*/
+static uint16_t argb8888_mix_px(const uint8_t *fg, uint32_t bg, uint32_t mix)
+{
+    uint32_t mix_inv = 255 - mix;
+    mix += (mix + 1) >> 8;
+    mix_inv += (mix_inv + 1) >> 8;
+
+    uint32_t b = ((fg[0] >> 3) * mix + (bg & 0x1F) * mix_inv) >> 8;
+    uint32_t g = ((fg[1] >> 2) * mix + ((bg >> 5) & 0x3F) * mix_inv) >> 8;
+    uint32_t r = ((fg[2] >> 3) * mix + ((bg >> 11) & 0x1F) * mix_inv) >> 8;
+    return (uint16_t)((r << 11) | (g << 5) | b);
+}
+
+/*
+macro_argb8888_mix_q8: 8 pixels
+    q0 - destination (background), result
+    q1 - B | R << 8 of the foreground per lane, destroyed
+    q2 - G | A << 8 of the foreground per lane, destroyed
+    q3 - 2048 in all the lanes
+    q4 - mix per lane, 0..255, destroyed
+    q5 - 255 in all the lanes, destroyed
+    q6, q7 destroyed
+*/
+static void argb8888_mix_q8(q_reg_t *q)
+{
+    ee_vsubs_s16(&q[6], &q[5], &q[4]);      // q6 = mix_inv = 255 - mix
+    ee_vcmp_eq_s16(&q[7], &q[4], &q[5]);
+    ee_vsubs_s16(&q[4], &q[4], &q[7]);      // q4 = mix + (mix == 255)
+    ee_vcmp_eq_s16(&q[7], &q[6], &q[5]);
+    ee_vsubs_s16(&q[6], &q[6], &q[7]);      // q6 = mix_inv + (mix_inv == 255)
+    sar = 3;
+    ee_vmul_u16(&q[5], &q[1], &q[3]);       // q5 = B << 8 of fg
+    sar = 0;
+    ee_vmul_u16(&q[7], &q[0], &q[3]);       // q7 = B << 11 of bg
+    sar = 22;
+    ee_vmul_u16(&q[5], &q[5], &q[3]);       // q5 = B >> 3 of fg
+    ee_vmul_u16(&q[7], &q[7], &q[3]);       // q7 = B of bg
+    sar = 0;
+    ee_vmul_u16(&q[5], &q[5], &q[4]);
+    ee_vmul_u16(&q[7], &q[7], &q[6]);
+    ee_vadds_s16(&q[5], &q[5], &q[7]);
+    sar = 19;
+    ee_vmul_u16(&q[5], &q[5], &q[3]);       // q5 = B result
+    sar = 3;
+    ee_vmul_u16(&q[2], &q[2], &q[3]);       // q2 = G << 8 of fg
+    sar = 6;
+    ee_vmul_u16(&q[7], &q[0], &q[3]);       // q7 = G << 10 | B << 5 of bg
+    sar = 21;
+    ee_vmul_u16(&q[2], &q[2], &q[3]);       // q2 = G >> 2 of fg
+    ee_vmul_u16(&q[7], &q[7], &q[3]);       // q7 = G of bg
+    sar = 0;
+    ee_vmul_u16(&q[2], &q[2], &q[4]);
+    ee_vmul_u16(&q[7], &q[7], &q[6]);
+    ee_vadds_s16(&q[2], &q[2], &q[7]);
+    sar = 19;
+    ee_vmul_u16(&q[2], &q[2], &q[3]);       // q2 = G result
+    sar = 6;
+    ee_vmul_u16(&q[2], &q[2], &q[3]);       // q2 = G << 5
+    ee_orq(&q[5], &q[5], &q[2]);
+    sar = 22;
+    ee_vmul_u16(&q[1], &q[1], &q[3]);       // q1 = R >> 3 of fg
+    ee_vmul_u16(&q[7], &q[0], &q[3]);       // q7 = R of bg
+    sar = 0;
+    ee_vmul_u16(&q[1], &q[1], &q[4]);
+    ee_vmul_u16(&q[7], &q[7], &q[6]);
+    ee_vadds_s16(&q[1], &q[1], &q[7]);
+    sar = 19;
+    ee_vmul_u16(&q[1], &q[1], &q[3]);       // q1 = R result
+    sar = 0;
+    ee_vmul_u16(&q[1], &q[1], &q[3]);       // q1 = R << 11
+    ee_orq(&q[0], &q[5], &q[1]);            // q0 = R | G | B
+}
+
+static int argb8888_mix_kernel(asm_dsc_t *asm_dsc, bool with_opa, bool with_mask)
+{
+    uint8_t *dest_buf = asm_dsc->dst_buf;
+    const uint8_t *src_buf = asm_dsc->src_buf;
+    const uint8_t *mask_buf = asm_dsc->mask_buf;
+    const uint32_t opa = asm_dsc->opa;
+    q_reg_t q[8];
+
+    // RGB565 destination has to be 2-byte aligned, short rows are left to the ANSI code
+    if (asm_dsc->dst_w < 8 || ((uintptr_t)dest_buf & 1) || (asm_dsc->dst_stride & 1)) {
+        return LV_RESULT_INVALID;
+    }
+
+    ee_vldbc_16(&q[3], 2048);
+
+    for (uint32_t y = 0; y < asm_dsc->dst_h; y++) {
+        uint16_t *dest = (uint16_t *)dest_buf;
+        const uint8_t *src = src_buf;
+        const uint8_t *mask = mask_buf;
+        uint32_t x = asm_dsc->dst_w;
+        uint32_t n;
+
+        // One pixel: mix from alpha, mask and opa, then the scalar mix
+#define MIX_PX() do {                                                                           \
+            uint32_t mix = src[3];                                                              \
+            if (with_mask) {                                                                    \
+                mix = with_opa ? (mix * mask[0] * opa) >> 16 : (mix * mask[0]) >> 8;            \
+            } else if (with_opa) {                                                              \
+                mix = (mix * opa) >> 8;                                                         \
+            }                                                                                   \
+            *dest = argb8888_mix_px(src, *dest, mix);                                           \
+            dest++;                                                                             \
+            src += 4;                                                                           \
+            mask++;                                                                             \
+        } while (0)
+
+        // Mix pixel by pixel until dest_buff is 16-byte aligned
+        while (x > 0 && ((uintptr_t)dest & 0xf)) {
+            MIX_PX();
+            x--;
+        }
+
+        // Main loop, 8 pixels
+        for (n = x >> 3; n > 0; n--) {
+            memcpy(&q[0], dest, sizeof(q[0]));                          // ee.vld.128.ip, aligned
+            ee_ld_unaligned_u16(&q[1], src);                            // pixels 0 - 3
+            ee_ld_unaligned_u16(&q[2], src + 16);                       // pixels 4 - 7
+            ee_vunzip_8(&q[1], &q[2]);                                  // q1 = B | R << 8, q2 = G | A << 8
+            sar = 19;
+            ee_vmul_u16(&q[4], &q[2], &q[3]);                           // mix = A
+            if (with_mask) {
+                ee_ld_unaligned_u8_zip(&q[5], mask);
+                if (with_opa) {
+                    sar = 0;
+                    ee_vmul_u16(&q[4], &q[4], &q[5]);                   // A * mask
+                    ee_vldbc_16(&q[5], opa);
+                    sar = 16;
+                    ee_vmul_u16(&q[4], &q[4], &q[5]);                   // mix = A * mask * opa >> 16
+                } else {
+                    sar = 8;
+                    ee_vmul_u16(&q[4], &q[4], &q[5]);                   // mix = A * mask >> 8
+                }
+            } else if (with_opa) {
+                ee_vldbc_16(&q[5], opa);
+                sar = 8;
+                ee_vmul_u16(&q[4], &q[4], &q[5]);                       // mix = A * opa >> 8
+            }
+            ee_vldbc_16(&q[5], 255);
+            argb8888_mix_q8(q);
+            memcpy(dest, &q[0], sizeof(q[0]));                          // ee.vst.128.ip
+            dest += LANES;
+            src += LANES * 4;
+            mask += LANES;
+        }
+
+        // Remaining pixels
+        for (n = x & 7; n > 0; n--) {
+            MIX_PX();
+        }
+#undef MIX_PX
+
+        dest_buf += asm_dsc->dst_stride;
+        src_buf += asm_dsc->src_stride;
+        mask_buf += asm_dsc->mask_stride;
+    }
+    return LV_RESULT_OK;
+}
+
+// ------------------------------------------------ Kernels ------------------------------------------------------------
+
+int lv_color_blend_to_rgb565_with_opa_esp(asm_dsc_t *asm_dsc)
+{
+    return rgb565_mix_kernel(asm_dsc, true, MIX_OPA);
+}
+
+int lv_color_blend_to_rgb565_with_mask_esp(asm_dsc_t *asm_dsc)
+{
+    return rgb565_mix_kernel(asm_dsc, true, MIX_MASK);
+}
+
+int lv_color_blend_to_rgb565_mix_mask_opa_esp(asm_dsc_t *asm_dsc)
+{
+    return rgb565_mix_kernel(asm_dsc, true, MIX_MASK_OPA);
+}
+
+int lv_rgb565_blend_normal_to_rgb565_with_opa_esp(asm_dsc_t *asm_dsc)
+{
+    return rgb565_mix_kernel(asm_dsc, false, MIX_OPA);
+}
+
+int lv_rgb565_blend_normal_to_rgb565_with_mask_esp(asm_dsc_t *asm_dsc)
+{
+    return rgb565_mix_kernel(asm_dsc, false, MIX_MASK);
+}
+
+int lv_rgb565_blend_normal_to_rgb565_mix_mask_opa_esp(asm_dsc_t *asm_dsc)
+{
+    return rgb565_mix_kernel(asm_dsc, false, MIX_MASK_OPA);
+}
+
+int lv_argb8888_blend_normal_to_rgb565_esp(asm_dsc_t *asm_dsc)
+{
+    return argb8888_mix_kernel(asm_dsc, false, false);
+}
+
+int lv_argb8888_blend_normal_to_rgb565_with_opa_esp(asm_dsc_t *asm_dsc)
+{
+    return argb8888_mix_kernel(asm_dsc, true, false);
+}
+
+int lv_argb8888_blend_normal_to_rgb565_with_mask_esp(asm_dsc_t *asm_dsc)
+{
+    return argb8888_mix_kernel(asm_dsc, false, true);
+}
+
+int lv_argb8888_blend_normal_to_rgb565_mix_mask_opa_esp(asm_dsc_t *asm_dsc)
+{
+    return argb8888_mix_kernel(asm_dsc, true, true);
+}
+
+int lv_color_blend_to_rgb565_esp(asm_dsc_t *asm_dsc)
+{
+    const lv_color_t *color = asm_dsc->src_buf;
+    const uint16_t color16 = ((color->red & 0xF8) << 8) | ((color->green & 0xFC) << 3) | (color->blue >> 3);
+    uint8_t *dest_buf = asm_dsc->dst_buf;
+
+    for (uint32_t y = 0; y < asm_dsc->dst_h; y++) {
+        for (uint32_t x = 0; x < asm_dsc->dst_w; x++) {
+            memcpy(dest_buf + x * 2, &color16, 2);
+        }
+        dest_buf += asm_dsc->dst_stride;
+    }
+    return LV_RESULT_OK;
+}
+
+int lv_rgb565_blend_normal_to_rgb565_esp(asm_dsc_t *asm_dsc)
+{
+    uint8_t *dest_buf = asm_dsc->dst_buf;
+    const uint8_t *src_buf = asm_dsc->src_buf;
+
+    for (uint32_t y = 0; y < asm_dsc->dst_h; y++) {
+        memcpy(dest_buf, src_buf, asm_dsc->dst_w * 2);
+        dest_buf += asm_dsc->dst_stride;
+        src_buf += asm_dsc->src_stride;
+    }
+    return LV_RESULT_OK;
+}
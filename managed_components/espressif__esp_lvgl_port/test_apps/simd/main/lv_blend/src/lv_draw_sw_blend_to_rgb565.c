@@ -249,7 +249,7 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_color_to_rgb565(_lv_draw_sw_blend_fi
     }
     /*Opacity only*/
     else if (mask == NULL && opa < LV_OPA_MAX) {
-        if (LV_RESULT_INVALID == LV_DRAW_SW_COLOR_BLEND_TO_RGB565_WITH_OPA(dsc)) {
+        if (!dsc->use_asm || LV_RESULT_INVALID == LV_DRAW_SW_COLOR_BLEND_TO_RGB565_WITH_OPA(dsc)) {
             uint32_t last_dest32_color = dest_buf_u16[0] + 1; /*Set to value which is not equal to the first pixel*/
             uint32_t last_res32_color = 0;
 
@@ -290,7 +290,7 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_color_to_rgb565(_lv_draw_sw_blend_fi
 
     /*Masked with full opacity*/
     else if (mask && opa >= LV_OPA_MAX) {
-        if (LV_RESULT_INVALID == LV_DRAW_SW_COLOR_BLEND_TO_RGB565_WITH_MASK(dsc)) {
+        if (!dsc->use_asm || LV_RESULT_INVALID == LV_DRAW_SW_COLOR_BLEND_TO_RGB565_WITH_MASK(dsc)) {
             for (y = 0; y < h; y++) {
                 x = 0;
                 if ((lv_uintptr_t)(mask) & 0x1) {
@@ -320,7 +320,7 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_color_to_rgb565(_lv_draw_sw_blend_fi
     }
     /*Masked with opacity*/
     else if (mask && opa < LV_OPA_MAX) {
-        if (LV_RESULT_INVALID == LV_DRAW_SW_COLOR_BLEND_TO_RGB565_MIX_MASK_OPA(dsc)) {
+        if (!dsc->use_asm || LV_RESULT_INVALID == LV_DRAW_SW_COLOR_BLEND_TO_RGB565_MIX_MASK_OPA(dsc)) {
             for (y = 0; y < h; y++) {
                 for (x = 0; x < w; x++) {
                     dest_buf_u16[x] = lv_color_16_16_mix(color16, dest_buf_u16[x], LV_OPA_MIX2(mask[x], opa));
@@ -612,7 +612,7 @@ static void LV_ATTRIBUTE_FAST_MEM rgb565_image_blend(_lv_draw_sw_blend_image_dsc
                 }
             }
         } else if (mask_buf == NULL && opa < LV_OPA_MAX) {
-            if (LV_RESULT_INVALID == LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_WITH_OPA(dsc)) {
+            if (!dsc->use_asm || LV_RESULT_INVALID == LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_WITH_OPA(dsc)) {
                 for (y = 0; y < h; y++) {
                     for (x = 0; x < w; x++) {
                         dest_buf_u16[x] = lv_color_16_16_mix(src_buf_u16[x], dest_buf_u16[x], opa);
@@ -622,9 +622,34 @@ static void LV_ATTRIBUTE_FAST_MEM rgb565_image_blend(_lv_draw_sw_blend_image_dsc
                 }
             }
         } else if (mask_buf && opa >= LV_OPA_MAX) {
-            if (LV_RESULT_INVALID == LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_WITH_MASK(dsc)) {
+            if (!dsc->use_asm || LV_RESULT_INVALID == LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_WITH_MASK(dsc)) {
+                /*The mask is mostly 0x00 or 0xFF (e.g. the alpha map of RGB565A8 images)
+                 *so check 4 mask bytes at once and skip or copy those pixels without mixing*/
                 for (y = 0; y < h; y++) {
-                    for (x = 0; x < w; x++) {
+                    x = 0;
+                    for (; x < w && ((lv_uintptr_t)&mask_buf[x] & 0x3); x++) {
+                        dest_buf_u16[x] = lv_color_16_16_mix(src_buf_u16[x], dest_buf_u16[x], mask_buf[x]);
+                    }
+
+                    for (; x < w - 3; x += 4) {
+                        uint32_t mask32 = *(const uint32_t *)&mask_buf[x];
+                        if (mask32 == 0x00000000) {
+                            continue;
+                        }
+                        if (mask32 == 0xFFFFFFFF) {
+                            dest_buf_u16[x + 0] = src_buf_u16[x + 0];
+                            dest_buf_u16[x + 1] = src_buf_u16[x + 1];
+                            dest_buf_u16[x + 2] = src_buf_u16[x + 2];
+                            dest_buf_u16[x + 3] = src_buf_u16[x + 3];
+                            continue;
+                        }
+                        dest_buf_u16[x + 0] = lv_color_16_16_mix(src_buf_u16[x + 0], dest_buf_u16[x + 0], mask_buf[x + 0]);
+                        dest_buf_u16[x + 1] = lv_color_16_16_mix(src_buf_u16[x + 1], dest_buf_u16[x + 1], mask_buf[x + 1]);
+                        dest_buf_u16[x + 2] = lv_color_16_16_mix(src_buf_u16[x + 2], dest_buf_u16[x + 2], mask_buf[x + 2]);
+                        dest_buf_u16[x + 3] = lv_color_16_16_mix(src_buf_u16[x + 3], dest_buf_u16[x + 3], mask_buf[x + 3]);
+                    }
+
+                    for (; x < w; x++) {
                         dest_buf_u16[x] = lv_color_16_16_mix(src_buf_u16[x], dest_buf_u16[x], mask_buf[x]);
                     }
                     dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
@@ -633,7 +658,7 @@ static void LV_ATTRIBUTE_FAST_MEM rgb565_image_blend(_lv_draw_sw_blend_image_dsc
                 }
             }
         } else {
-            if (LV_RESULT_INVALID == LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA(dsc)) {
+            if (!dsc->use_asm || LV_RESULT_INVALID == LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA(dsc)) {
                 for (y = 0; y < h; y++) {
                     for (x = 0; x < w; x++) {
                         dest_buf_u16[x] = lv_color_16_16_mix(src_buf_u16[x], dest_buf_u16[x], LV_OPA_MIX2(mask_buf[x], opa));
@@ -828,7 +853,7 @@ static void LV_ATTRIBUTE_FAST_MEM argb8888_image_blend(_lv_draw_sw_blend_image_d
 
     if (dsc->blend_mode == LV_BLEND_MODE_NORMAL) {
         if (mask_buf == NULL && opa >= LV_OPA_MAX) {
-            if (LV_RESULT_INVALID == LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565(dsc)) {
+            if (!dsc->use_asm || LV_RESULT_INVALID == LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565(dsc)) {
                 for (y = 0; y < h; y++) {
                     for (dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x += 4) {
                         dest_buf_u16[dest_x] = lv_color_24_16_mix(&src_buf_u8[src_x], dest_buf_u16[dest_x], src_buf_u8[src_x + 3]);
@@ -838,7 +863,7 @@ static void LV_ATTRIBUTE_FAST_MEM argb8888_image_blend(_lv_draw_sw_blend_image_d
                 }
             }
         } else if (mask_buf == NULL && opa < LV_OPA_MAX) {
-            if (LV_RESULT_INVALID == LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_WITH_OPA(dsc)) {
+            if (!dsc->use_asm || LV_RESULT_INVALID == LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_WITH_OPA(dsc)) {
                 for (y = 0; y < h; y++) {
                     for (dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x += 4) {
                         dest_buf_u16[dest_x] = lv_color_24_16_mix(&src_buf_u8[src_x], dest_buf_u16[dest_x], LV_OPA_MIX2(src_buf_u8[src_x + 3],
@@ -849,7 +874,7 @@ static void LV_ATTRIBUTE_FAST_MEM argb8888_image_blend(_lv_draw_sw_blend_image_d
                 }
             }
         } else if (mask_buf && opa >= LV_OPA_MAX) {
-            if (LV_RESULT_INVALID == LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_WITH_MASK(dsc)) {
+            if (!dsc->use_asm || LV_RESULT_INVALID == LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_WITH_MASK(dsc)) {
                 for (y = 0; y < h; y++) {
                     for (dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x += 4) {
                         dest_buf_u16[dest_x] = lv_color_24_16_mix(&src_buf_u8[src_x], dest_buf_u16[dest_x],
@@ -861,7 +886,7 @@ static void LV_ATTRIBUTE_FAST_MEM argb8888_image_blend(_lv_draw_sw_blend_image_d
                 }
             }
         } else if (mask_buf && opa < LV_OPA_MAX) {
-            if (LV_RESULT_INVALID == LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA(dsc)) {
+            if (!dsc->use_asm || LV_RESULT_INVALID == LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA(dsc)) {
                 for (y = 0; y < h; y++) {
                     for (dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x += 4) {
                         dest_buf_u16[dest_x] = lv_color_24_16_mix(&src_buf_u8[src_x], dest_buf_u16[dest_x],
@@ -8,6 +8,7 @@
 
 #include "esp_err.h"
 #include <stdint.h>
+#include <stdbool.h>
 #include "lv_color.h"
 #include "lv_draw_sw_blend.h"
 
@@ -52,6 +53,10 @@ typedef struct {
     unsigned int dest_h;                                    // Destination buffer height
     unsigned int dest_stride;                               // Destination buffer stride
     unsigned int unalign_byte;                              // Destination buffer memory unalignment
+    lv_opa_t opa;                                           // Fill opacity, 0 for LV_OPA_MAX (no opacity)
+    bool use_mask;                                          // Fill through a mask of dest_stride long rows
+    lv_opa_t *mask_buf;                                     // Working mask buf, with the destination buffer unalignment
+    void *mask_alloc;                                       // Beginning of the memory allocated for the mask, used in free()
 } func_test_case_params_t;
 
 /**
@@ -68,6 +73,8 @@ typedef struct {
     void *array_align1;                                     // test array with 1 byte alignment - testing worst case
     void (*blend_api_func)(_lv_draw_sw_blend_fill_dsc_t *);              // pointer to LVGL API function
     void (*blend_api_px_func)(_lv_draw_sw_blend_fill_dsc_t *, uint32_t); // pointer to LVGL API function with dest_px_size argument
+    lv_opa_t opa;                                           // Fill opacity, 0 for LV_OPA_MAX (no opacity)
+    lv_opa_t *mask_buf;                                     // Mask of stride long rows, NULL for no mask
 } bench_test_case_params_t;
 
 #ifdef __cplusplus
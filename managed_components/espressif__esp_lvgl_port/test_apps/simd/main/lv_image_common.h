@@ -23,6 +23,8 @@ extern "C" {
 typedef enum {
     OPERATION_FILL,
     OPERATION_FILL_WITH_OPA,
+    OPERATION_FILL_WITH_MASK,
+    OPERATION_FILL_WITH_MASK_OPA,
 } blend_operation_t;
 
 /**
@@ -70,6 +72,8 @@ typedef struct {
         void *p_dest_ansi;                                    /*!< pointer to the destination ANSI test buf */
         void *p_dest_asm_alloc;                               /*!< pointer to the beginning of the memory allocated for the destination ASM test buf, used in free() */
         void *p_dest_ansi_alloc;                              /*!< pointer to the beginning of the memory allocated for the destination ANSI test buf, used in free() */
+        lv_opa_t *p_mask;                                     /*!< pointer to the mask test buf (common for both the ANSI and ASM), NULL for operations without mask */
+        void *p_mask_alloc;                                   /*!< pointer to the beginning of the memory allocated for the mask test buf, used in free() */
     } buf;
     void (*blend_api_func)(_lv_draw_sw_blend_image_dsc_t *);                    /*!< pointer to LVGL API function */
     void (*blend_api_func_px_size)(_lv_draw_sw_blend_image_dsc_t *, uint32_t);  /*!< pointer to LVGL API function, with additional parameter: pixel size */
@@ -109,8 +113,32 @@ typedef struct {
     void (*blend_api_func)(_lv_draw_sw_blend_image_dsc_t *);                     /*!< pointer to LVGL API function */
     void (*blend_api_func_px_size)(_lv_draw_sw_blend_image_dsc_t *, uint32_t);   /*!< pointer to LVGL API function, with additional parameter: pixel size */
     lv_color_format_t color_format;                           /*!< LV color format */
+    lv_opa_t opa;                                             /*!< Blend opacity, 0 for LV_OPA_MAX (no opacity) */
+    lv_opa_t *mask_buf;                                       /*!< Mask of dest_stride pixels long rows, NULL for no mask */
 } bench_test_case_lv_image_params_t;
 
+/**
+ * @brief Per-pixel RGB565 blend through an 8-bit mask (RGB565A8 image to RGB565)
+ *
+ * The ANSI loop LVGL used before the word-wise mask fast path of rgb565_image_blend(),
+ * kept as the reference and the baseline for the RGB565A8 tests
+ */
+static inline void lv_image_rgb565_blend_with_mask_per_pixel(const _lv_draw_sw_blend_image_dsc_t *dsc)
+{
+    uint16_t *dest_buf_u16 = dsc->dest_buf;
+    const uint16_t *src_buf_u16 = dsc->src_buf;
+    const lv_opa_t *mask_buf = dsc->mask_buf;
+
+    for (int32_t y = 0; y < dsc->dest_h; y++) {
+        for (int32_t x = 0; x < dsc->dest_w; x++) {
+            dest_buf_u16[x] = lv_color_16_16_mix(src_buf_u16[x], dest_buf_u16[x], mask_buf[x]);
+        }
+        dest_buf_u16 = (uint16_t *)((uint8_t *)dest_buf_u16 + dsc->dest_stride);
+        src_buf_u16 = (const uint16_t *)((const uint8_t *)src_buf_u16 + dsc->src_stride);
+        mask_buf += dsc->mask_stride;
+    }
+}
+
 #ifdef __cplusplus
 } /*extern "C"*/
 #endif
@@ -40,6 +40,11 @@ static lv_color_t test_color = {
  */
 static void lv_fill_benchmark_init(bench_test_case_params_t *test_params);
 
+/**
+ * @brief Run the RGB565 benchmark test with opacity, mask or both
+ */
+static void lv_fill_benchmark_rgb565_mix(lv_opa_t opa, bool use_mask);
+
 /**
  * @brief Run the benchmark test
  */
@@ -117,6 +122,24 @@ TEST_CASE("LV Fill benchmark RGB565", "[fill][benchmark][RGB565]")
     free(dest_array_align16);
 }
 
+TEST_CASE("LV Fill benchmark RGB565 with opa", "[fill][benchmark][RGB565][opa]")
+{
+    ESP_LOGI(TAG_LV_FILL_BENCH, "running test for RGB565 color format with opa");
+    lv_fill_benchmark_rgb565_mix(LV_OPA_60, false);
+}
+
+TEST_CASE("LV Fill benchmark RGB565 with mask", "[fill][benchmark][RGB565][mask]")
+{
+    ESP_LOGI(TAG_LV_FILL_BENCH, "running test for RGB565 color format with mask");
+    lv_fill_benchmark_rgb565_mix(0, true);
+}
+
+TEST_CASE("LV Fill benchmark RGB565 with mask and opa", "[fill][benchmark][RGB565][mask][opa]")
+{
+    ESP_LOGI(TAG_LV_FILL_BENCH, "running test for RGB565 color format with mask and opa");
+    lv_fill_benchmark_rgb565_mix(LV_OPA_60, true);
+}
+
 TEST_CASE("LV Fill benchmark RGB888", "[fill][benchmark][RGB888]")
 {
     uint8_t *dest_array_align16  = (uint8_t *)memalign(16, STRIDE * HEIGHT * sizeof(uint8_t) * 3 + UNALIGN_BYTES);
@@ -143,6 +166,43 @@ TEST_CASE("LV Fill benchmark RGB888", "[fill][benchmark][RGB888]")
 }
 // ------------------------------------------------ Static test functions ----------------------------------------------
 
+static void lv_fill_benchmark_rgb565_mix(lv_opa_t opa, bool use_mask)
+{
+    uint16_t *dest_array_align16  = (uint16_t *)memalign(16, STRIDE * HEIGHT * sizeof(uint16_t) + UNALIGN_BYTES);
+    TEST_ASSERT_NOT_EQUAL(NULL, dest_array_align16);
+
+    // Apply byte unalignment for the worst-case test scenario
+    uint16_t *dest_array_align1 = dest_array_align16 + UNALIGN_BYTES;
+
+    // Antialiased edge like mask: every value, transparent and opaque runs included
+    lv_opa_t *mask = NULL;
+    if (use_mask) {
+        mask = (lv_opa_t *)malloc(STRIDE * HEIGHT);
+        TEST_ASSERT_NOT_EQUAL(NULL, mask);
+        for (int i = 0; i < STRIDE * HEIGHT; i++) {
+            mask[i] = (lv_opa_t)i;
+        }
+    }
+
+    bench_test_case_params_t test_params = {
+        .height = HEIGHT,
+        .width = WIDTH,
+        .stride = STRIDE * sizeof(uint16_t),
+        .cc_height = HEIGHT - 1,
+        .cc_width = WIDTH - 1,
+        .benchmark_cycles = BENCHMARK_CYCLES,
+        .array_align16 = (void *)dest_array_align16,
+        .array_align1 = (void *)dest_array_align1,
+        .blend_api_func = &lv_draw_sw_blend_color_to_rgb565,
+        .opa = opa,
+        .mask_buf = mask,
+    };
+
+    lv_fill_benchmark_init(&test_params);
+    free(mask);
+    free(dest_array_align16);
+}
+
 static void lv_fill_benchmark_init(bench_test_case_params_t *test_params)
 {
     // Init structure for LVGL blend API, to call the Assembly API
@@ -151,9 +211,10 @@ static void lv_fill_benchmark_init(bench_test_case_params_t *test_params)
         .dest_w = test_params->width,
         .dest_h = test_params->height,
         .dest_stride = test_params->stride,  // stride * sizeof()
-        .mask_buf = NULL,
+        .mask_buf = test_params->mask_buf,
+        .mask_stride = STRIDE,
         .color = test_color,
-        .opa = LV_OPA_MAX,
+        .opa = test_params->opa ? test_params->opa : LV_OPA_MAX,
         .use_asm = true,
     };
 
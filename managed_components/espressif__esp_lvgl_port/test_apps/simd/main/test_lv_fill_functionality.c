@@ -155,6 +155,82 @@ TEST_CASE("Test fill functionality RGB565", "[fill][functionality][RGB565]")
     functionality_test_matrix(&test_matrix, &test_case);
 }
 
+TEST_CASE("Test fill functionality RGB565 with opa", "[fill][functionality][RGB565][opa]")
+{
+    test_matrix_params_t test_matrix = {
+        .min_w = 8,             // 8 is the lower limit for the esp32s3 asm implementation, otherwise ANSI is executed
+        .min_h = 1,
+        .max_w = 24,
+        .max_h = 4,
+        .min_unalign_byte = 0,
+        .max_unalign_byte = 16,
+        .unalign_step = 1,
+        .dest_stride_step = 1,
+        .test_combinations_count = 0,
+    };
+
+    func_test_case_params_t test_case = {
+        .blend_api_func = &lv_draw_sw_blend_color_to_rgb565,
+        .color_format = LV_COLOR_FORMAT_RGB565,
+        .data_type_size = sizeof(uint16_t),
+        .opa = LV_OPA_60,
+    };
+
+    ESP_LOGI(TAG_LV_FILL_FUNC, "running test for RGB565 color format with opa");
+    functionality_test_matrix(&test_matrix, &test_case);
+}
+
+TEST_CASE("Test fill functionality RGB565 with mask", "[fill][functionality][RGB565][mask]")
+{
+    test_matrix_params_t test_matrix = {
+        .min_w = 8,             // 8 is the lower limit for the esp32s3 asm implementation, otherwise ANSI is executed
+        .min_h = 1,
+        .max_w = 24,
+        .max_h = 4,
+        .min_unalign_byte = 0,
+        .max_unalign_byte = 16,
+        .unalign_step = 1,
+        .dest_stride_step = 1,
+        .test_combinations_count = 0,
+    };
+
+    func_test_case_params_t test_case = {
+        .blend_api_func = &lv_draw_sw_blend_color_to_rgb565,
+        .color_format = LV_COLOR_FORMAT_RGB565,
+        .data_type_size = sizeof(uint16_t),
+        .use_mask = true,
+    };
+
+    ESP_LOGI(TAG_LV_FILL_FUNC, "running test for RGB565 color format with mask");
+    functionality_test_matrix(&test_matrix, &test_case);
+}
+
+TEST_CASE("Test fill functionality RGB565 with mask and opa", "[fill][functionality][RGB565][mask][opa]")
+{
+    test_matrix_params_t test_matrix = {
+        .min_w = 8,             // 8 is the lower limit for the esp32s3 asm implementation, otherwise ANSI is executed
+        .min_h = 1,
+        .max_w = 24,
+        .max_h = 4,
+        .min_unalign_byte = 0,
+        .max_unalign_byte = 16,
+        .unalign_step = 1,
+        .dest_stride_step = 1,
+        .test_combinations_count = 0,
+    };
+
+    func_test_case_params_t test_case = {
+        .blend_api_func = &lv_draw_sw_blend_color_to_rgb565,
+        .color_format = LV_COLOR_FORMAT_RGB565,
+        .data_type_size = sizeof(uint16_t),
+        .opa = LV_OPA_60,
+        .use_mask = true,
+    };
+
+    ESP_LOGI(TAG_LV_FILL_FUNC, "running test for RGB565 color format with mask and opa");
+    functionality_test_matrix(&test_matrix, &test_case);
+}
+
 TEST_CASE("Test fill functionality RGB888", "[fill][functionality][RGB888]")
 {
     test_matrix_params_t test_matrix = {
@@ -215,9 +291,10 @@ static void lv_fill_functionality(func_test_case_params_t *test_case)
         .dest_w = test_case->dest_w,
         .dest_h = test_case->dest_h,
         .dest_stride = test_case->dest_stride * test_case->data_type_size,  // stride * sizeof()
-        .mask_buf = NULL,
+        .mask_buf = test_case->mask_buf,
+        .mask_stride = test_case->dest_stride,
         .color = test_color,
-        .opa = LV_OPA_MAX,
+        .opa = test_case->opa ? test_case->opa : LV_OPA_MAX,
         .use_asm = true,
     };
 
@@ -263,7 +340,7 @@ static void lv_fill_functionality(func_test_case_params_t *test_case)
 
     free(test_case->buf.p_asm_alloc);
     free(test_case->buf.p_ansi_alloc);
-
+    free(test_case->mask_alloc);
 }
 
 static void fill_test_bufs(func_test_case_params_t *test_case)
@@ -298,6 +375,18 @@ static void fill_test_bufs(func_test_case_params_t *test_case)
         dest_buf_ansi[i * data_type_size] = (uint8_t)(i % 255);
     }
 
+    // Mask with the same unalignment, one byte per destination pixel: transparent, opaque and antialiased runs
+    test_case->mask_buf = NULL;
+    test_case->mask_alloc = NULL;
+    if (test_case->use_mask) {
+        test_case->mask_alloc = memalign(16, active_buf_len + unalign_byte);
+        TEST_ASSERT_NOT_NULL_MESSAGE(test_case->mask_alloc, "Lack of memory");
+        test_case->mask_buf = (lv_opa_t *)test_case->mask_alloc + unalign_byte;
+        for (int i = 0; i < active_buf_len; i++) {
+            test_case->mask_buf[i] = (i / 8) % 3 == 0 ? LV_OPA_TRANSP : ((i / 8) % 3 == 1 ? LV_OPA_COVER : (uint8_t)(i * 37));
+        }
+    }
+
     // Shift array pointers by Canary Bytes amount
     dest_buf_asm += CANARY_BYTES * data_type_size;
     dest_buf_ansi += CANARY_BYTES * data_type_size;
@@ -40,6 +40,26 @@ static void lv_image_benchmark_init(bench_test_case_lv_image_params_t *test_para
  */
 static float lv_image_benchmark_run(bench_test_case_lv_image_params_t *test_params, _lv_draw_sw_blend_image_dsc_t *dsc);
 
+/**
+ * @brief Fill an icon-like alpha mask: opaque disc, antialiased edge, transparent corners
+ */
+static void lv_image_benchmark_icon_mask(uint8_t *mask, int w, int h, int stride);
+
+/**
+ * @brief Run the RGB565 benchmark test with opacity, an icon-like mask or both
+ */
+static void lv_image_benchmark_rgb565_mix(lv_opa_t opa, bool use_mask);
+
+/**
+ * @brief Run the ARGB8888 to RGB565 benchmark test on an icon-like alpha, with opacity, an icon-like mask or both
+ */
+static void lv_image_benchmark_argb8888(lv_opa_t opa, bool use_mask);
+
+/**
+ * @brief Run the RGB565A8 benchmark: LVGL blend API (assembly or ANSI mask fast path, by dsc->use_asm) or the per-pixel reference
+ */
+static float lv_image_benchmark_run_mask(_lv_draw_sw_blend_image_dsc_t *dsc, bool per_pixel);
+
 // ------------------------------------------------ Test cases ---------------------------------------------------------
 
 /*
@@ -111,6 +131,48 @@ TEST_CASE("LV Image benchmark RGB565 blend to RGB565", "[image][benchmark][RGB56
     free(src_array_align16);
 }
 
+TEST_CASE("LV Image benchmark RGB565 blend to RGB565 with opa", "[image][benchmark][RGB565][opa]")
+{
+    ESP_LOGI(TAG_LV_IMAGE_BENCH, "running test for RGB565 color format with opa");
+    lv_image_benchmark_rgb565_mix(LV_OPA_60, false);
+}
+
+TEST_CASE("LV Image benchmark RGB565 blend to RGB565 with mask", "[image][benchmark][RGB565][mask]")
+{
+    ESP_LOGI(TAG_LV_IMAGE_BENCH, "running test for RGB565 color format with mask");
+    lv_image_benchmark_rgb565_mix(0, true);
+}
+
+TEST_CASE("LV Image benchmark RGB565 blend to RGB565 with mask and opa", "[image][benchmark][RGB565][mask][opa]")
+{
+    ESP_LOGI(TAG_LV_IMAGE_BENCH, "running test for RGB565 color format with mask and opa");
+    lv_image_benchmark_rgb565_mix(LV_OPA_60, true);
+}
+
+TEST_CASE("LV Image benchmark ARGB8888 blend to RGB565", "[image][benchmark][ARGB8888]")
+{
+    ESP_LOGI(TAG_LV_IMAGE_BENCH, "running test for ARGB8888 color format");
+    lv_image_benchmark_argb8888(0, false);
+}
+
+TEST_CASE("LV Image benchmark ARGB8888 blend to RGB565 with opa", "[image][benchmark][ARGB8888][opa]")
+{
+    ESP_LOGI(TAG_LV_IMAGE_BENCH, "running test for ARGB8888 color format with opa");
+    lv_image_benchmark_argb8888(LV_OPA_60, false);
+}
+
+TEST_CASE("LV Image benchmark ARGB8888 blend to RGB565 with mask", "[image][benchmark][ARGB8888][mask]")
+{
+    ESP_LOGI(TAG_LV_IMAGE_BENCH, "running test for ARGB8888 color format with mask");
+    lv_image_benchmark_argb8888(0, true);
+}
+
+TEST_CASE("LV Image benchmark ARGB8888 blend to RGB565 with mask and opa", "[image][benchmark][ARGB8888][mask][opa]")
+{
+    ESP_LOGI(TAG_LV_IMAGE_BENCH, "running test for ARGB8888 color format with mask and opa");
+    lv_image_benchmark_argb8888(LV_OPA_60, true);
+}
+
 TEST_CASE("LV Image benchmark RGB888 blend to RGB888", "[image][benchmark][RGB888]")
 {
     uint8_t *dest_array_align16  = (uint8_t *)memalign(16, (STRIDE * HEIGHT * sizeof(uint8_t) * 3) + UNALIGN_BYTES);
@@ -143,8 +205,164 @@ TEST_CASE("LV Image benchmark RGB888 blend to RGB888", "[image][benchmark][RGB88
     free(dest_array_align16);
     free(src_array_align16);
 }
+/*
+RGB565A8 icons (RGB565 plane + 8-bit alpha plane) are blended by LVGL as an RGB565 image through a mask:
+the LVGL blend API with the assembly (RGB565 blend with mask) and with the ANSI word-wise mask fast path
+is compared with the per-pixel ANSI loop the fast path replaced, on an icon-like mask, in the same ideal
+and corner cases
+*/
+TEST_CASE("LV Image benchmark RGB565A8 blend to RGB565", "[image][benchmark][RGB565A8]")
+{
+    uint16_t *dest_array_align16  = (uint16_t *)memalign(16, STRIDE * HEIGHT * sizeof(uint16_t) + UNALIGN_BYTES);
+    uint16_t *src_array_align16  = (uint16_t *)memalign(16, STRIDE * HEIGHT * sizeof(uint16_t) + UNALIGN_BYTES);
+    uint8_t *mask_array_align16  = (uint8_t *)memalign(16, STRIDE * HEIGHT * sizeof(uint8_t) + UNALIGN_BYTES);
+    TEST_ASSERT_NOT_EQUAL_MESSAGE(NULL, dest_array_align16, "Lack of memory");
+    TEST_ASSERT_NOT_EQUAL_MESSAGE(NULL, src_array_align16, "Lack of memory");
+    TEST_ASSERT_NOT_EQUAL_MESSAGE(NULL, mask_array_align16, "Lack of memory");
+
+    // Apply byte unalignment (different for each array) for the worst-case test scenario
+    uint16_t *dest_array_align1 = (uint16_t *)((uint8_t *)dest_array_align16 + UNALIGN_BYTES - 1);
+    uint16_t *src_array_align1 = (uint16_t *)((uint8_t *)src_array_align16 + UNALIGN_BYTES);
+    uint8_t *mask_array_align1 = mask_array_align16 + 1;
+
+    for (int i = 0; i < STRIDE * HEIGHT; i++) {
+        src_array_align16[i] = i + ((i & 1) ? 0x55AA : 0xAA55);
+    }
+    lv_image_benchmark_icon_mask(mask_array_align16, WIDTH, HEIGHT, STRIDE);
+
+    _lv_draw_sw_blend_image_dsc_t dsc = {
+        .dest_buf = dest_array_align16,
+        .dest_w = WIDTH,
+        .dest_h = HEIGHT,
+        .dest_stride = STRIDE * sizeof(uint16_t),
+        .mask_buf = mask_array_align16,
+        .mask_stride = STRIDE,          // LVGL uses half of the RGB565 stride for the alpha plane
+        .src_buf = src_array_align16,
+        .src_stride = STRIDE * sizeof(uint16_t),
+        .src_color_format = LV_COLOR_FORMAT_RGB565,
+        .opa = LV_OPA_MAX,
+        .blend_mode = LV_BLEND_MODE_NORMAL,
+        .use_asm = false,
+    };
+
+    _lv_draw_sw_blend_image_dsc_t dsc_cc = dsc;
+    dsc_cc.dest_buf = dest_array_align1;
+    dsc_cc.dest_w = WIDTH - 1;
+    dsc_cc.src_buf = src_array_align1;
+    dsc_cc.mask_buf = mask_array_align1;
+
+    static const char *mask_func[] = {"ASM", "fast path", "per-pixel"};
+
+    ESP_LOGI(TAG_LV_IMAGE_BENCH, "running test for RGB565A8 color format");
+    for (int i = 0; i < 3; i++) {
+        dsc.use_asm = (i == 0);
+        dsc_cc.use_asm = (i == 0);
+
+        float cycles = lv_image_benchmark_run_mask(&dsc, i == 2);
+        float per_sample = cycles / ((float)(dsc.dest_w * dsc.dest_h));
+        ESP_LOGI(TAG_LV_IMAGE_BENCH, " %s ideal case: %.3f cycles for %"PRIi32"x%"PRIi32" matrix, %.3f cycles per sample", mask_func[i], cycles, dsc.dest_w, dsc.dest_h, per_sample);
+
+        cycles = lv_image_benchmark_run_mask(&dsc_cc, i == 2);
+        per_sample = cycles / ((float)(dsc_cc.dest_w * dsc_cc.dest_h));
+        ESP_LOGI(TAG_LV_IMAGE_BENCH, " %s corner case: %.3f cycles for %"PRIi32"x%"PRIi32" matrix, %.3f cycles per sample\n", mask_func[i], cycles, dsc_cc.dest_w, dsc_cc.dest_h, per_sample);
+    }
+
+    free(dest_array_align16);
+    free(src_array_align16);
+    free(mask_array_align16);
+}
+
 // ------------------------------------------------ Static test functions ----------------------------------------------
 
+static void lv_image_benchmark_rgb565_mix(lv_opa_t opa, bool use_mask)
+{
+    uint16_t *dest_array_align16  = (uint16_t *)memalign(16, STRIDE * HEIGHT * sizeof(uint16_t) + UNALIGN_BYTES);
+    uint16_t *src_array_align16  = (uint16_t *)memalign(16, STRIDE * HEIGHT * sizeof(uint16_t) + UNALIGN_BYTES);
+    TEST_ASSERT_NOT_EQUAL_MESSAGE(NULL, dest_array_align16, "Lack of memory");
+    TEST_ASSERT_NOT_EQUAL_MESSAGE(NULL, src_array_align16, "Lack of memory");
+
+    // Apply byte unalignment (different for each array) for the worst-case test scenario
+    uint16_t *dest_array_align1 = (uint16_t *)((uint8_t *)dest_array_align16 + UNALIGN_BYTES - 1);
+    uint16_t *src_array_align1 = (uint16_t *)((uint8_t *)src_array_align16 + UNALIGN_BYTES);
+
+    uint8_t *mask = NULL;
+    if (use_mask) {
+        mask = (uint8_t *)memalign(16, STRIDE * HEIGHT);
+        TEST_ASSERT_NOT_EQUAL_MESSAGE(NULL, mask, "Lack of memory");
+        lv_image_benchmark_icon_mask(mask, WIDTH, HEIGHT, STRIDE);
+    }
+
+    bench_test_case_lv_image_params_t test_params = {
+        .height = HEIGHT,
+        .width = WIDTH,
+        .dest_stride = STRIDE * sizeof(uint16_t),
+        .src_stride = STRIDE * sizeof(uint16_t),
+        .cc_height = HEIGHT,
+        .cc_width = WIDTH - 1,
+        .benchmark_cycles = BENCHMARK_CYCLES,
+        .src_array_align16 = (void *)src_array_align16,
+        .src_array_align1 = (void *)src_array_align1,
+        .dest_array_align16 = (void *)dest_array_align16,
+        .dest_array_align1 = (void *)dest_array_align1,
+        .blend_api_func = &lv_draw_sw_blend_image_to_rgb565,
+        .color_format = LV_COLOR_FORMAT_RGB565,
+        .opa = opa,
+        .mask_buf = mask,
+    };
+
+    lv_image_benchmark_init(&test_params);
+    free(mask);
+    free(dest_array_align16);
+    free(src_array_align16);
+}
+
+static void lv_image_benchmark_argb8888(lv_opa_t opa, bool use_mask)
+{
+    uint16_t *dest_array_align16  = (uint16_t *)memalign(16, STRIDE * HEIGHT * sizeof(uint16_t) + UNALIGN_BYTES);
+    uint8_t *src_array_align16  = (uint8_t *)memalign(16, STRIDE * HEIGHT * sizeof(uint32_t) + UNALIGN_BYTES);
+    uint8_t *icon = (uint8_t *)memalign(16, STRIDE * HEIGHT);
+    TEST_ASSERT_NOT_EQUAL_MESSAGE(NULL, dest_array_align16, "Lack of memory");
+    TEST_ASSERT_NOT_EQUAL_MESSAGE(NULL, src_array_align16, "Lack of memory");
+    TEST_ASSERT_NOT_EQUAL_MESSAGE(NULL, icon, "Lack of memory");
+
+    // Apply byte unalignment (different for each array) for the worst-case test scenario
+    uint16_t *dest_array_align1 = (uint16_t *)((uint8_t *)dest_array_align16 + UNALIGN_BYTES - 1);
+    uint8_t *src_array_align1 = src_array_align16 + UNALIGN_BYTES;
+
+    // Icon-like alpha channel: the ANSI code takes shortcuts for transparent and opaque pixels, so the mix matters
+    // The same disc is the mask of the mask variants
+    lv_image_benchmark_icon_mask(icon, WIDTH, HEIGHT, STRIDE);
+    for (int i = 0; i < STRIDE * HEIGHT; i++) {
+        src_array_align16[i * 4 + 0] = i + ((i & 1) ? 0x55 : 0xAA);
+        src_array_align16[i * 4 + 1] = i * 3;
+        src_array_align16[i * 4 + 2] = i * 5;
+        src_array_align16[i * 4 + 3] = icon[i];
+    }
+
+    bench_test_case_lv_image_params_t test_params = {
+        .height = HEIGHT,
+        .width = WIDTH,
+        .dest_stride = STRIDE * sizeof(uint16_t),
+        .src_stride = STRIDE * sizeof(uint32_t),
+        .cc_height = HEIGHT,
+        .cc_width = WIDTH - 1,
+        .benchmark_cycles = BENCHMARK_CYCLES,
+        .src_array_align16 = (void *)src_array_align16,
+        .src_array_align1 = (void *)src_array_align1,
+        .dest_array_align16 = (void *)dest_array_align16,
+        .dest_array_align1 = (void *)dest_array_align1,
+        .blend_api_func = &lv_draw_sw_blend_image_to_rgb565,
+        .color_format = LV_COLOR_FORMAT_ARGB8888,
+        .opa = opa,
+        .mask_buf = use_mask ? icon : NULL,
+    };
+
+    lv_image_benchmark_init(&test_params);
+    free(icon);
+    free(dest_array_align16);
+    free(src_array_align16);
+}
+
 static void lv_image_benchmark_init(bench_test_case_lv_image_params_t *test_params)
 {
     // Init structure for LVGL blend API, to call the Assembly API
@@ -153,11 +371,12 @@ static void lv_image_benchmark_init(bench_test_case_lv_image_params_t *test_para
         .dest_w = test_params->width,
         .dest_h = test_params->height,
         .dest_stride = test_params->dest_stride,  // stride * sizeof()
-        .mask_buf = NULL,
+        .mask_buf = test_params->mask_buf,
+        .mask_stride = STRIDE,
         .src_buf = test_params->src_array_align16,
         .src_stride = test_params->src_stride,
         .src_color_format = test_params->color_format,
-        .opa = LV_OPA_MAX,
+        .opa = test_params->opa ? test_params->opa : LV_OPA_MAX,
         .blend_mode = LV_BLEND_MODE_NORMAL,
         .use_asm = true,
     };
@@ -221,3 +440,46 @@ static float lv_image_benchmark_run(bench_test_case_lv_image_params_t *test_para
     const float cycles = total_b / (test_params->benchmark_cycles);
     return cycles;
 }
+
+static void lv_image_benchmark_icon_mask(uint8_t *mask, int w, int h, int stride)
+{
+    // Disc of radius 3/8 of the width with a 2 pixels wide antialiased edge, like the tile icons
+    const int r = w * 3 / 8;
+    for (int y = 0; y < h; y++) {
+        for (int x = 0; x < w; x++) {
+            const int dx = x - w / 2;
+            const int dy = y - h / 2;
+            const int d2 = dx * dx + dy * dy;
+            if (d2 <= (r - 2) * (r - 2)) {
+                mask[y * stride + x] = LV_OPA_COVER;
+            } else if (d2 >= r * r) {
+                mask[y * stride + x] = LV_OPA_TRANSP;
+            } else {
+                mask[y * stride + x] = (uint8_t)(255 * (r * r - d2) / (r * r - (r - 2) * (r - 2)));
+            }
+        }
+    }
+}
+
+static float lv_image_benchmark_run_mask(_lv_draw_sw_blend_image_dsc_t *dsc, bool per_pixel)
+{
+    // Call the DUT function for the first time to init the benchmark test
+    if (per_pixel) {
+        lv_image_rgb565_blend_with_mask_per_pixel(dsc);
+    } else {
+        lv_draw_sw_blend_image_to_rgb565(dsc);
+    }
+
+    // Run the benchmark
+    const unsigned int start_b = xthal_get_ccount();
+    for (int i = 0; i < BENCHMARK_CYCLES; i++) {
+        if (per_pixel) {
+            lv_image_rgb565_blend_with_mask_per_pixel(dsc);
+        } else {
+            lv_draw_sw_blend_image_to_rgb565(dsc);
+        }
+    }
+    const unsigned int end_b = xthal_get_ccount();
+
+    return (float)(end_b - start_b) / BENCHMARK_CYCLES;
+}
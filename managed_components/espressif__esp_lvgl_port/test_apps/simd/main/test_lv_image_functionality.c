@@ -109,6 +109,17 @@ static void test_eval_image_16bit_data(func_test_case_lv_image_params_t *test_ca
  */
 static void test_eval_image_24bit_data(func_test_case_lv_image_params_t *test_case);
 
+/**
+ * @brief RGB565A8 functionality test: LVGL blend API with an 8-bit mask against the per-pixel reference
+ *
+ * @param[in] dest_w Destination buffer width
+ * @param[in] dest_h Destination buffer height
+ * @param[in] mask_unalign_byte Memory unalignment of the mask buffer
+ * @param[in] dest_unalign_byte Memory unalignment of the destination buffers
+ * @param[in] use_asm Run the LVGL blend API with the assembly
+ */
+static void lv_image_mask_functionality(int dest_w, int dest_h, int mask_unalign_byte, int dest_unalign_byte, bool use_asm);
+
 // ------------------------------------------------ Test cases ---------------------------------------------------------
 
 /*
@@ -146,6 +157,132 @@ TEST_CASE("LV Image functionality RGB565 blend to RGB565", "[image][functionalit
     functionality_test_matrix(&test_matrix, &test_case);
 }
 
+TEST_CASE("LV Image functionality RGB565 blend to RGB565 with opa", "[image][functionality][RGB565][opa]")
+{
+    test_matrix_lv_image_params_t test_matrix = default_test_matrix_image_blend;
+
+    func_test_case_lv_image_params_t test_case = {
+        .blend_api_func = &lv_draw_sw_blend_image_to_rgb565,
+        .color_format = LV_COLOR_FORMAT_RGB565,
+        .canary_pixels = CANARY_PIXELS_RGB565,
+        .memory_alignment_offset = 0,
+        .src_data_type_size = sizeof(uint16_t),
+        .dest_data_type_size = sizeof(uint16_t),
+        .operation_type = OPERATION_FILL_WITH_OPA,
+    };
+
+    ESP_LOGI(TAG_LV_IMAGE_FUNC, "running test for RGB565 color format with opa");
+    functionality_test_matrix(&test_matrix, &test_case);
+}
+
+TEST_CASE("LV Image functionality RGB565 blend to RGB565 with mask", "[image][functionality][RGB565][mask]")
+{
+    test_matrix_lv_image_params_t test_matrix = default_test_matrix_image_blend;
+
+    func_test_case_lv_image_params_t test_case = {
+        .blend_api_func = &lv_draw_sw_blend_image_to_rgb565,
+        .color_format = LV_COLOR_FORMAT_RGB565,
+        .canary_pixels = CANARY_PIXELS_RGB565,
+        .memory_alignment_offset = 0,
+        .src_data_type_size = sizeof(uint16_t),
+        .dest_data_type_size = sizeof(uint16_t),
+        .operation_type = OPERATION_FILL_WITH_MASK,
+    };
+
+    ESP_LOGI(TAG_LV_IMAGE_FUNC, "running test for RGB565 color format with mask");
+    functionality_test_matrix(&test_matrix, &test_case);
+}
+
+TEST_CASE("LV Image functionality RGB565 blend to RGB565 with mask and opa", "[image][functionality][RGB565][mask][opa]")
+{
+    test_matrix_lv_image_params_t test_matrix = default_test_matrix_image_blend;
+
+    func_test_case_lv_image_params_t test_case = {
+        .blend_api_func = &lv_draw_sw_blend_image_to_rgb565,
+        .color_format = LV_COLOR_FORMAT_RGB565,
+        .canary_pixels = CANARY_PIXELS_RGB565,
+        .memory_alignment_offset = 0,
+        .src_data_type_size = sizeof(uint16_t),
+        .dest_data_type_size = sizeof(uint16_t),
+        .operation_type = OPERATION_FILL_WITH_MASK_OPA,
+    };
+
+    ESP_LOGI(TAG_LV_IMAGE_FUNC, "running test for RGB565 color format with mask and opa");
+    functionality_test_matrix(&test_matrix, &test_case);
+}
+
+TEST_CASE("LV Image functionality ARGB8888 blend to RGB565", "[image][functionality][ARGB8888]")
+{
+    test_matrix_lv_image_params_t test_matrix = default_test_matrix_image_blend;
+
+    func_test_case_lv_image_params_t test_case = {
+        .blend_api_func = &lv_draw_sw_blend_image_to_rgb565,
+        .color_format = LV_COLOR_FORMAT_ARGB8888,
+        .canary_pixels = CANARY_PIXELS_RGB565,
+        .memory_alignment_offset = 0,
+        .src_data_type_size = sizeof(uint32_t),
+        .dest_data_type_size = sizeof(uint16_t),
+        .operation_type = OPERATION_FILL,
+    };
+
+    ESP_LOGI(TAG_LV_IMAGE_FUNC, "running test for ARGB8888 color format");
+    functionality_test_matrix(&test_matrix, &test_case);
+}
+
+TEST_CASE("LV Image functionality ARGB8888 blend to RGB565 with opa", "[image][functionality][ARGB8888][opa]")
+{
+    test_matrix_lv_image_params_t test_matrix = default_test_matrix_image_blend;
+
+    func_test_case_lv_image_params_t test_case = {
+        .blend_api_func = &lv_draw_sw_blend_image_to_rgb565,
+        .color_format = LV_COLOR_FORMAT_ARGB8888,
+        .canary_pixels = CANARY_PIXELS_RGB565,
+        .memory_alignment_offset = 0,
+        .src_data_type_size = sizeof(uint32_t),
+        .dest_data_type_size = sizeof(uint16_t),
+        .operation_type = OPERATION_FILL_WITH_OPA,
+    };
+
+    ESP_LOGI(TAG_LV_IMAGE_FUNC, "running test for ARGB8888 color format with opa");
+    functionality_test_matrix(&test_matrix, &test_case);
+}
+
+TEST_CASE("LV Image functionality ARGB8888 blend to RGB565 with mask", "[image][functionality][ARGB8888][mask]")
+{
+    test_matrix_lv_image_params_t test_matrix = default_test_matrix_image_blend;
+
+    func_test_case_lv_image_params_t test_case = {
+        .blend_api_func = &lv_draw_sw_blend_image_to_rgb565,
+        .color_format = LV_COLOR_FORMAT_ARGB8888,
+        .canary_pixels = CANARY_PIXELS_RGB565,
+        .memory_alignment_offset = 0,
+        .src_data_type_size = sizeof(uint32_t),
+        .dest_data_type_size = sizeof(uint16_t),
+        .operation_type = OPERATION_FILL_WITH_MASK,
+    };
+
+    ESP_LOGI(TAG_LV_IMAGE_FUNC, "running test for ARGB8888 color format with mask");
+    functionality_test_matrix(&test_matrix, &test_case);
+}
+
+TEST_CASE("LV Image functionality ARGB8888 blend to RGB565 with mask and opa", "[image][functionality][ARGB8888][mask][opa]")
+{
+    test_matrix_lv_image_params_t test_matrix = default_test_matrix_image_blend;
+
+    func_test_case_lv_image_params_t test_case = {
+        .blend_api_func = &lv_draw_sw_blend_image_to_rgb565,
+        .color_format = LV_COLOR_FORMAT_ARGB8888,
+        .canary_pixels = CANARY_PIXELS_RGB565,
+        .memory_alignment_offset = 0,
+        .src_data_type_size = sizeof(uint32_t),
+        .dest_data_type_size = sizeof(uint16_t),
+        .operation_type = OPERATION_FILL_WITH_MASK_OPA,
+    };
+
+    ESP_LOGI(TAG_LV_IMAGE_FUNC, "running test for ARGB8888 color format with mask and opa");
+    functionality_test_matrix(&test_matrix, &test_case);
+}
+
 TEST_CASE("LV Image functionality RGB888 blend to RGB888", "[image][functionality][RGB888]")
 {
     test_matrix_lv_image_params_t test_matrix = default_test_matrix_image_blend;
@@ -164,6 +301,30 @@ TEST_CASE("LV Image functionality RGB888 blend to RGB888", "[image][functionalit
     functionality_test_matrix(&test_matrix, &test_case);
 }
 
+/*
+RGB565A8 images are blended as RGB565 through the alpha plane used as a mask. Both the ANSI word-wise
+mask fast path and the esp32s3 assembly (RGB565 blend with mask) must give the same result as the
+per-pixel ANSI loop, whatever the mask alignment and the mix of transparent/opaque/partial pixels
+*/
+TEST_CASE("LV Image functionality RGB565A8 blend to RGB565", "[image][functionality][RGB565A8]")
+{
+    unsigned int test_combinations_count = 0;
+
+    ESP_LOGI(TAG_LV_IMAGE_FUNC, "running test for RGB565A8 color format");
+    for (int dest_w = 1; dest_w <= 24; dest_w++) {
+        for (int dest_h = 1; dest_h <= 2; dest_h++) {
+            for (int mask_unalign_byte = 0; mask_unalign_byte < 4; mask_unalign_byte++) {
+                for (int dest_unalign_byte = 0; dest_unalign_byte < 4; dest_unalign_byte += 2) {
+                    lv_image_mask_functionality(dest_w, dest_h, mask_unalign_byte, dest_unalign_byte, false);
+                    lv_image_mask_functionality(dest_w, dest_h, mask_unalign_byte, dest_unalign_byte, true);
+                    test_combinations_count += 2;
+                }
+            }
+        }
+    }
+    ESP_LOGI(TAG_LV_IMAGE_FUNC, "test combinations: %d\n", test_combinations_count);
+}
+
 // ------------------------------------------------ Static test functions ----------------------------------------------
 
 static void functionality_test_matrix(test_matrix_lv_image_params_t *test_matrix, func_test_case_lv_image_params_t *test_case)
@@ -208,12 +369,12 @@ static void lv_image_functionality(func_test_case_lv_image_params_t *test_case)
         .dest_w = test_case->dest_w,
         .dest_h = test_case->dest_h,
         .dest_stride = test_case->dest_stride * test_case->dest_data_type_size,  // dest_stride * sizeof(data_type)
-        .mask_buf = NULL,
-        .mask_stride = 0,
+        .mask_buf = test_case->buf.p_mask,
+        .mask_stride = test_case->dest_stride,
         .src_buf = test_case->buf.p_src,
         .src_stride = test_case->src_stride * test_case->src_data_type_size,     // src_stride * sizeof(data_type)
         .src_color_format = test_case->color_format,
-        .opa = LV_OPA_MAX,
+        .opa = (test_case->operation_type == OPERATION_FILL_WITH_OPA || test_case->operation_type == OPERATION_FILL_WITH_MASK_OPA) ? LV_OPA_60 : LV_OPA_MAX,
         .blend_mode = LV_BLEND_MODE_NORMAL,
         .use_asm = true,
     };
@@ -245,6 +406,7 @@ static void lv_image_functionality(func_test_case_lv_image_params_t *test_case)
 #endif
     switch (test_case->color_format) {
     case LV_COLOR_FORMAT_RGB565:
+    case LV_COLOR_FORMAT_ARGB8888:      // ARGB8888 source is blended to RGB565
         test_eval_image_16bit_data(test_case);
         break;
     case LV_COLOR_FORMAT_RGB888:
@@ -259,6 +421,7 @@ static void lv_image_functionality(func_test_case_lv_image_params_t *test_case)
     free(test_case->buf.p_dest_asm_alloc);
     free(test_case->buf.p_dest_ansi_alloc);
     free(test_case->buf.p_src_alloc);
+    free(test_case->buf.p_mask_alloc);
 }
 
 static void fill_test_bufs(func_test_case_lv_image_params_t *test_case)
@@ -293,11 +456,27 @@ static void fill_test_bufs(func_test_case_lv_image_params_t *test_case)
 
     // Set the whole buffer to 0, including the Canary pixels part
     memset(src_buf_common, 0, src_buf_len * src_data_type_size);
-    memset(dest_buf_asm, 0, total_dest_buf_len * src_data_type_size);
-    memset(dest_buf_ansi, 0, total_dest_buf_len * src_data_type_size);
+    memset(dest_buf_asm, 0, total_dest_buf_len * dest_data_type_size);
+    memset(dest_buf_ansi, 0, total_dest_buf_len * dest_data_type_size);
+
+    // Mask of dest_stride long rows, sharing the source unalignment: transparent, opaque and antialiased runs
+    test_case->buf.p_mask = NULL;
+    test_case->buf.p_mask_alloc = NULL;
+    if (test_case->operation_type == OPERATION_FILL_WITH_MASK || test_case->operation_type == OPERATION_FILL_WITH_MASK_OPA) {
+        void *mask_mem = memalign(16, active_dest_buf_len + src_unalign_byte);
+        TEST_ASSERT_NOT_NULL_MESSAGE(mask_mem, "Lack of memory");
+        test_case->buf.p_mask_alloc = mask_mem;
+        test_case->buf.p_mask = (lv_opa_t *)mask_mem + src_unalign_byte;
+        for (int i = 0; i < active_dest_buf_len; i++) {
+            test_case->buf.p_mask[i] = (i / 8) % 3 == 0 ? LV_OPA_TRANSP : ((i / 8) % 3 == 1 ? LV_OPA_COVER : (uint8_t)(i * 37));
+        }
+    }
 
     switch (test_case->operation_type) {
     case OPERATION_FILL:
+    case OPERATION_FILL_WITH_OPA:
+    case OPERATION_FILL_WITH_MASK:
+    case OPERATION_FILL_WITH_MASK_OPA:
         // Fill the actual part of the destination buffers with known values,
         // Values must be same, because of the stride
 
@@ -318,6 +497,26 @@ static void fill_test_bufs(func_test_case_lv_image_params_t *test_case)
             }
         }
 
+        if (test_case->color_format == LV_COLOR_FORMAT_ARGB8888) {
+            uint16_t *dest_buf_asm_uint16 = (uint16_t *)dest_buf_asm;
+            uint16_t *dest_buf_ansi_uint16 = (uint16_t *)dest_buf_ansi;
+            uint8_t *src_buf_uint8 = src_buf_common;
+
+            // Fill RGB565 destination buffers
+            for (int i = 0; i < active_dest_buf_len; i++) {
+                dest_buf_asm_uint16[canary_pixels + i] = i + ((i & 1) ? 0x6699 : 0x9966);
+                dest_buf_ansi_uint16[canary_pixels + i] = dest_buf_asm_uint16[canary_pixels + i];
+            }
+
+            // Fill source buffer, alpha in runs of transparent, opaque and antialiased pixels, as icons are
+            for (int i = 0; i < src_buf_len; i++) {
+                src_buf_uint8[i * 4 + 0] = i + ((i & 1) ? 0x55 : 0xAA);
+                src_buf_uint8[i * 4 + 1] = i * 3 + ((i & 1) ? 0x66 : 0x99);
+                src_buf_uint8[i * 4 + 2] = i * 5 + ((i & 1) ? 0x33 : 0xCC);
+                src_buf_uint8[i * 4 + 3] = (i / 8) % 3 == 0 ? LV_OPA_TRANSP : ((i / 8) % 3 == 1 ? LV_OPA_COVER : (uint8_t)(i * 37));
+            }
+        }
+
         if (test_case->color_format == LV_COLOR_FORMAT_RGB888) {
             uint8_t *dest_buf_asm_uint8 = dest_buf_asm;
             uint8_t *dest_buf_ansi_uint8 = dest_buf_ansi;
@@ -392,12 +591,15 @@ static void test_eval_image_16bit_data(func_test_case_lv_image_params_t *test_ca
     TEST_ASSERT_EQUAL_UINT16_ARRAY_MESSAGE((uint16_t *)test_case->buf.p_dest_ansi + canary_pixels, (uint16_t *)test_case->buf.p_dest_asm + canary_pixels, test_case->active_dest_buf_len, test_msg_buf);
 
     // Data part of the destination buffer and source buffer (not considering matrix padding) must be equal
-    uint16_t *dest_row_begin = (uint16_t *)test_case->buf.p_dest_asm + canary_pixels;
-    uint16_t *src_row_begin = (uint16_t *)test_case->buf.p_src;
-    for (int row = 0; row < test_case->dest_h; row++) {
-        TEST_ASSERT_EQUAL_UINT16_ARRAY_MESSAGE(dest_row_begin, src_row_begin, test_case->dest_w, test_msg_buf);
-        dest_row_begin += test_case->dest_stride;   // Move pointer of the destination buffer to the next row
-        src_row_begin += test_case->src_stride;     // Move pointer of the source buffer to the next row
+    // Only for a plain RGB565 copy, opacity, mask and alpha mix the source with the destination
+    if (test_case->operation_type == OPERATION_FILL && test_case->color_format == LV_COLOR_FORMAT_RGB565) {
+        uint16_t *dest_row_begin = (uint16_t *)test_case->buf.p_dest_asm + canary_pixels;
+        uint16_t *src_row_begin = (uint16_t *)test_case->buf.p_src;
+        for (int row = 0; row < test_case->dest_h; row++) {
+            TEST_ASSERT_EQUAL_UINT16_ARRAY_MESSAGE(dest_row_begin, src_row_begin, test_case->dest_w, test_msg_buf);
+            dest_row_begin += test_case->dest_stride;   // Move pointer of the destination buffer to the next row
+            src_row_begin += test_case->src_stride;     // Move pointer of the source buffer to the next row
+        }
     }
 
     // Canary pixels area must stay 0
@@ -457,3 +659,67 @@ static void test_eval_image_24bit_data(func_test_case_lv_image_params_t *test_ca
     TEST_ASSERT_EACH_EQUAL_UINT8_MESSAGE(0, (uint8_t *)test_case->buf.p_dest_ansi + ((test_case->total_dest_buf_len * 3) - (canary_pixels * 3)), canary_pixels * 3, test_msg_buf);
     TEST_ASSERT_EACH_EQUAL_UINT8_MESSAGE(0, (uint8_t *)test_case->buf.p_dest_asm + ((test_case->total_dest_buf_len * 3) - (canary_pixels * 3)), canary_pixels * 3, test_msg_buf);
 }
+
+static void lv_image_mask_functionality(int dest_w, int dest_h, int mask_unalign_byte, int dest_unalign_byte, bool use_asm)
+{
+    const int stride = dest_w + 3;      // Matrix padding, the padding must not be touched
+    const int canary_pixels = CANARY_PIXELS_RGB565;
+    const int total_dest_len = dest_h * stride + canary_pixels * 2;
+
+    uint16_t *src_buf = (uint16_t *)memalign(16, dest_h * stride * sizeof(uint16_t));
+    uint8_t *mask_mem = (uint8_t *)memalign(16, dest_h * stride + mask_unalign_byte);
+    uint8_t *dest_mem_ref = (uint8_t *)memalign(16, total_dest_len * sizeof(uint16_t) + dest_unalign_byte);
+    uint8_t *dest_mem_dut = (uint8_t *)memalign(16, total_dest_len * sizeof(uint16_t) + dest_unalign_byte);
+    TEST_ASSERT_NOT_NULL_MESSAGE(src_buf, "Lack of memory");
+    TEST_ASSERT_NOT_NULL_MESSAGE(mask_mem, "Lack of memory");
+    TEST_ASSERT_NOT_NULL_MESSAGE(dest_mem_ref, "Lack of memory");
+    TEST_ASSERT_NOT_NULL_MESSAGE(dest_mem_dut, "Lack of memory");
+
+    uint8_t *mask_buf = mask_mem + mask_unalign_byte;
+    uint16_t *dest_ref = (uint16_t *)(dest_mem_ref + dest_unalign_byte);
+    uint16_t *dest_dut = (uint16_t *)(dest_mem_dut + dest_unalign_byte);
+
+    // Mask in runs of transparent, opaque and partial pixels, so every 4-byte group type is hit
+    static const uint8_t mask_pattern[] = {0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0x40, 0x00, 0x00};
+    for (int i = 0; i < dest_h * stride; i++) {
+        src_buf[i] = i + ((i & 1) ? 0x55AA : 0xAA55);
+        mask_buf[i] = mask_pattern[i % sizeof(mask_pattern)];
+    }
+    memset(dest_ref, 0, total_dest_len * sizeof(uint16_t));
+    for (int i = 0; i < dest_h * stride; i++) {
+        dest_ref[canary_pixels + i] = i + ((i & 1) ? 0x6699 : 0x9966);
+    }
+    memcpy(dest_dut, dest_ref, total_dest_len * sizeof(uint16_t));
+
+    _lv_draw_sw_blend_image_dsc_t dsc = {
+        .dest_buf = dest_dut + canary_pixels,
+        .dest_w = dest_w,
+        .dest_h = dest_h,
+        .dest_stride = stride * sizeof(uint16_t),
+        .mask_buf = mask_buf,
+        .mask_stride = stride,
+        .src_buf = src_buf,
+        .src_stride = stride * sizeof(uint16_t),
+        .src_color_format = LV_COLOR_FORMAT_RGB565,
+        .opa = LV_OPA_MAX,
+        .blend_mode = LV_BLEND_MODE_NORMAL,
+        .use_asm = use_asm,
+    };
+    lv_draw_sw_blend_image_to_rgb565(&dsc);
+
+    dsc.dest_buf = dest_ref + canary_pixels;
+    lv_image_rgb565_blend_with_mask_per_pixel(&dsc);
+
+    sprintf(test_msg_buf, "Test case: dest_w = %d, dest_h = %d, stride = %d, mask_unalign_byte = %d, dest_unalign_byte = %d, use_asm = %d\n",
+            dest_w, dest_h, stride, mask_unalign_byte, dest_unalign_byte, use_asm);
+
+    // Canary pixels and matrix padding included: everything must match the reference
+    TEST_ASSERT_EACH_EQUAL_UINT16_MESSAGE(0, dest_dut, canary_pixels, test_msg_buf);
+    TEST_ASSERT_EQUAL_UINT16_ARRAY_MESSAGE(dest_ref, dest_dut, total_dest_len, test_msg_buf);
+    TEST_ASSERT_EACH_EQUAL_UINT16_MESSAGE(0, dest_dut + total_dest_len - canary_pixels, canary_pixels, test_msg_buf);
+
+    free(src_buf);
+    free(mask_mem);
+    free(dest_mem_ref);
+    free(dest_mem_dut);
+}
@@ -74,6 +74,9 @@
     /** Size of the memory expand for `lv_malloc()` in bytes */
     #define LV_MEM_POOL_EXPAND_SIZE 0
 
+    /** Count the allocations per subsystem (`lv_mem_get_tag_stats()`), in a header of each allocation */
+    #define LV_USE_MEM_TAGS 0
+
     /** Set an address for the memory pool instead of allocating it as a normal array. Can be in external SRAM too. */
     #define LV_MEM_ADR 0     /**< 0: unused*/
     /* Instead of an address give a memory allocator that will be called to get a memory pool for LVGL. E.g. my_malloc */
@@ -83,6 +86,9 @@
     #endif
 #endif  /*LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN*/
 
+/** Memory arenas at once (`lv_mem_arena_create()`): the objects and styles of a screen in one region, 0: disabled */
+#define LV_MEM_ARENA_CNT 0
+
 /*====================
    HAL SETTINGS
  *====================*/
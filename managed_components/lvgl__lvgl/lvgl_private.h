@@ -48,6 +48,7 @@ extern "C" {
 #include "src/drivers/libinput/lv_libinput_private.h"
 #include "src/drivers/evdev/lv_evdev_private.h"
 #include "src/font/lv_font_fmt_txt_private.h"
+#include "src/font/lv_font_glyph_cache_private.h"
 #include "src/themes/lv_theme_private.h"
 #include "src/core/lv_refr_private.h"
 #include "src/core/lv_obj_style_private.h"
@@ -31,9 +31,8 @@ extern "C" {
 #include "../others/sysmon/lv_sysmon.h"
 #include "../stdlib/builtin/lv_tlsf.h"
 
-#if LV_USE_FONT_COMPRESSED
 #include "../font/lv_font_fmt_txt_private.h"
-#endif
+#include "../font/lv_font_glyph_cache_private.h"
 
 #include "../tick/lv_tick.h"
 #include "../layouts/lv_layout.h"
@@ -44,10 +43,12 @@ extern "C" {
 #include "../misc/lv_anim_private.h"
 #include "../tick/lv_tick_private.h"
 #include "../draw/lv_draw_buf_private.h"
+#include "../draw/lv_draw_pool_private.h"
 #include "../draw/lv_draw_private.h"
 #include "../draw/sw/lv_draw_sw_private.h"
 #include "../draw/sw/lv_draw_sw_mask_private.h"
 #include "../stdlib/builtin/lv_tlsf_private.h"
+#include "../stdlib/lv_mem_private.h"
 #include "../others/sysmon/lv_sysmon_private.h"
 #include "../others/test/lv_test_private.h"
 #include "../layouts/lv_layout_private.h"
@@ -111,6 +112,13 @@ typedef struct _lv_global_t {
     bool layout_update_mutex;
 
     uint32_t memory_zero;
+    uint8_t memory_tag;             /**< `lv_mem_tag_t` of the next allocations, without `__thread` */
+#if LV_MEM_ARENA_CNT
+    lv_mem_arena_t memory_arenas[LV_MEM_ARENA_CNT];
+    lv_mutex_t memory_arena_lock;
+    volatile uint32_t memory_arena_live;    /**< Arenas with a region, read by `lv_free()` without the lock */
+    lv_mem_arena_t * memory_arena;  /**< Arena of the next allocations, without `__thread` */
+#endif
     uint32_t math_rand_seed;
 
     lv_event_t * event_header;
@@ -135,12 +143,14 @@ typedef struct _lv_global_t {
     lv_cache_t * img_header_cache;
 
     lv_draw_global_info_t draw_info;
+    lv_draw_pool_t draw_pool;
     lv_ll_t draw_sw_blend_handler_ll;
 #if defined(LV_DRAW_SW_SHADOW_CACHE_SIZE) && LV_DRAW_SW_SHADOW_CACHE_SIZE > 0
     lv_draw_sw_shadow_cache_t sw_shadow_cache;
 #endif
 #if LV_DRAW_SW_COMPLEX
     lv_draw_sw_mask_radius_circle_dsc_arr_t sw_circle_cache;
+    lv_draw_sw_corner_cache_t sw_corner_cache;
 #endif
 
 #if LV_USE_LOG
@@ -210,6 +220,8 @@ typedef struct _lv_global_t {
 #if LV_USE_FONT_COMPRESSED
     lv_font_fmt_rle_t font_fmt_rle;
 #endif
+    lv_font_fmt_txt_ascii_index_t font_fmt_ascii_index[LV_FONT_FMT_TXT_ASCII_INDEX_CNT];
+    lv_font_glyph_cache_t font_glyph_cache;
 
 #if LV_USE_SPAN != 0
     struct _snippet_stack * span_snippet_stack;
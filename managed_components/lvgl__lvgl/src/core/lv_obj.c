@@ -324,6 +324,17 @@ void lv_obj_set_flag(lv_obj_t * obj, lv_obj_flag_t f, bool v)
     else lv_obj_remove_flag(obj, f);
 }
 
+void lv_obj_set_static(lv_obj_t * obj, bool en)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    if(obj->is_static == en) return;
+
+    /*Invalidate while static: the static layer is rendered again with or without it*/
+    if(en) obj->is_static = 1;
+    lv_obj_invalidate(obj);
+    obj->is_static = en;
+}
+
 void lv_obj_add_state(lv_obj_t * obj, lv_state_t state)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
@@ -374,6 +385,13 @@ bool lv_obj_has_flag_any(const lv_obj_t * obj, lv_obj_flag_t f)
     return !!(obj->flags & f);
 }
 
+bool lv_obj_is_static(const lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    return obj->is_static;
+}
+
 lv_state_t lv_obj_get_state(const lv_obj_t * obj)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
@@ -405,7 +423,11 @@ void lv_obj_allocate_spec_attr(lv_obj_t * obj)
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
     if(obj->spec_attr == NULL) {
+        lv_mem_tag_t mem_tag = lv_mem_set_tag(LV_MEM_TAG_OBJ);
+        lv_mem_arena_t * arena = lv_mem_set_arena_for(obj);
         obj->spec_attr = lv_malloc_zeroed(sizeof(lv_obj_spec_attr_t));
+        lv_mem_set_arena(arena);
+        lv_mem_set_tag(mem_tag);
         LV_ASSERT_MALLOC(obj->spec_attr);
         if(obj->spec_attr == NULL) return;
 
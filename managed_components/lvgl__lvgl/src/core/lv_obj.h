@@ -214,6 +214,15 @@ void lv_obj_remove_flag(lv_obj_t * obj, lv_obj_flag_t f);
  */
 void lv_obj_set_flag(lv_obj_t * obj, lv_obj_flag_t f, bool v);
 
+/**
+ * Mark an object as static: it rarely changes and is kept rendered in the static layer of its
+ * display, if the display has one (see `lv_display_set_static_layer`). Its children are not static
+ * unless marked too.
+ * @param obj   pointer to an object
+ * @param en    true: static; false: drawn at every refresh of its area (the default)
+ */
+void lv_obj_set_static(lv_obj_t * obj, bool en);
+
 /**
  * Add one or more states to the object. The other state bits will remain unchanged.
  * If specified in the styles, transition animation will be started from the previous state to the current.
@@ -265,6 +274,13 @@ bool lv_obj_has_flag(const lv_obj_t * obj, lv_obj_flag_t f);
  */
 bool lv_obj_has_flag_any(const lv_obj_t * obj, lv_obj_flag_t f);
 
+/**
+ * Check if an object is static
+ * @param obj   pointer to an object
+ * @return      true: set by `lv_obj_set_static`
+ */
+bool lv_obj_is_static(const lv_obj_t * obj);
+
 /**
  * Get the state of an object
  * @param obj   pointer to an object
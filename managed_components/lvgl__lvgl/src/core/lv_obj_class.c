@@ -48,8 +48,12 @@ lv_obj_t * lv_obj_class_create_obj(const lv_obj_class_t * class_p, lv_obj_t * pa
 {
     LV_TRACE_OBJ_CREATE("Creating object with %p class on %p parent", (void *)class_p, (void *)parent);
     uint32_t s = get_instance_size(class_p);
+    lv_mem_tag_t mem_tag = lv_mem_set_tag(LV_MEM_TAG_OBJ);
     lv_obj_t * obj = lv_malloc_zeroed(s);
-    if(obj == NULL) return NULL;
+    if(obj == NULL) {
+        lv_mem_set_tag(mem_tag);
+        return NULL;
+    }
     obj->class_p = class_p;
     obj->parent = parent;
 
@@ -60,6 +64,7 @@ lv_obj_t * lv_obj_class_create_obj(const lv_obj_class_t * class_p, lv_obj_t * pa
         if(!disp) {
             LV_LOG_WARN("No display created yet. No place to assign the new screen");
             lv_free(obj);
+            lv_mem_set_tag(mem_tag);
             return NULL;
         }
 
@@ -67,10 +72,13 @@ lv_obj_t * lv_obj_class_create_obj(const lv_obj_class_t * class_p, lv_obj_t * pa
             disp->screen_cnt = 0;
         }
 
+        lv_mem_arena_t * arena = lv_mem_set_arena_for(disp);
         lv_obj_t ** screens = lv_realloc(disp->screens, sizeof(lv_obj_t *) * (disp->screen_cnt + 1));
+        lv_mem_set_arena(arena);
         LV_ASSERT_MALLOC(screens);
         if(screens == NULL) {
             lv_free(obj);
+            lv_mem_set_tag(mem_tag);
             return NULL;
         }
 
@@ -93,11 +101,14 @@ lv_obj_t * lv_obj_class_create_obj(const lv_obj_class_t * class_p, lv_obj_t * pa
         }
 
         parent->spec_attr->child_cnt++;
+        lv_mem_arena_t * arena = lv_mem_set_arena_for(parent);
         parent->spec_attr->children = lv_realloc(parent->spec_attr->children,
                                                  sizeof(lv_obj_t *) * parent->spec_attr->child_cnt);
+        lv_mem_set_arena(arena);
         parent->spec_attr->children[parent->spec_attr->child_cnt - 1] = obj;
     }
 
+    lv_mem_set_tag(mem_tag);
     return obj;
 }
 
@@ -105,6 +116,8 @@ void lv_obj_class_init_obj(lv_obj_t * obj)
 {
     if(obj == NULL) return;
 
+    /*What the constructors and the events of the creation allocate*/
+    lv_mem_tag_t mem_tag = lv_mem_set_tag(LV_MEM_TAG_OBJ);
     lv_obj_mark_layout_as_dirty(obj);
     lv_obj_enable_style_refresh(false);
 
@@ -131,6 +144,7 @@ void lv_obj_class_init_obj(lv_obj_t * obj)
         /*Invalidate the area if not screen created*/
         lv_obj_invalidate(obj);
     }
+    lv_mem_set_tag(mem_tag);
 }
 
 void lv_obj_destruct(lv_obj_t * obj)
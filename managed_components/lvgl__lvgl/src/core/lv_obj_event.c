@@ -104,7 +104,12 @@ lv_event_dsc_t * lv_obj_add_event_cb(lv_obj_t * obj, lv_event_cb_t event_cb, lv_
     LV_ASSERT_OBJ(obj, MY_CLASS);
     lv_obj_allocate_spec_attr(obj);
 
-    return lv_event_add(&obj->spec_attr->event_list, event_cb, filter, user_data);
+    lv_mem_tag_t mem_tag = lv_mem_set_tag(LV_MEM_TAG_OBJ);
+    lv_mem_arena_t * arena = lv_mem_set_arena_for(obj);
+    lv_event_dsc_t * dsc = lv_event_add(&obj->spec_attr->event_list, event_cb, filter, user_data);
+    lv_mem_set_arena(arena);
+    lv_mem_set_tag(mem_tag);
+    return dsc;
 }
 
 uint32_t lv_obj_get_event_count(lv_obj_t * obj)
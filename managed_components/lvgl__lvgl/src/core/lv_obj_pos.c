@@ -35,6 +35,7 @@ static int32_t calc_content_height(lv_obj_t * obj);
 static void layout_update_core(lv_obj_t * obj);
 static void transform_point_array(const lv_obj_t * obj, lv_point_t * p, size_t p_count, bool inv);
 static bool is_transformed(const lv_obj_t * obj);
+static bool obj_has_static(const lv_obj_t * obj);
 
 /**********************
  *  STATIC VARIABLES
@@ -856,6 +857,11 @@ void lv_obj_invalidate_area(const lv_obj_t * obj, const lv_area_t * area)
     }
 #endif
 
+    /*A static object (or a parent moving some) changed: render its area into the static layer again*/
+    if(disp && disp->static_layer.draw_buf.data && (obj->parent == NULL || obj_has_static(obj))) {
+        lv_inv_static_area(disp, &area_tmp);
+    }
+
     lv_inv_area(lv_obj_get_display(obj),  &area_tmp);
 }
 
@@ -1077,6 +1083,21 @@ const lv_matrix_t * lv_obj_get_transform(const lv_obj_t * obj)
  *   STATIC FUNCTIONS
  **********************/
 
+/**
+ * The object or one of its descendants is static
+ */
+static bool obj_has_static(const lv_obj_t * obj)
+{
+    if(obj->is_static) return true;
+
+    uint32_t i;
+    uint32_t child_cnt = lv_obj_get_child_count(obj);
+    for(i = 0; i < child_cnt; i++) {
+        if(obj_has_static(obj->spec_attr->children[i])) return true;
+    }
+    return false;
+}
+
 static bool is_transformed(const lv_obj_t * obj)
 {
     while(obj) {
@@ -76,6 +76,7 @@ struct _lv_obj_t {
     uint16_t h_layout   : 1;
     uint16_t w_layout   : 1;
     uint16_t is_deleting : 1;
+    uint16_t is_static : 1;     /**< Kept in the static layer of the display */
 };
 
 /**********************
@@ -115,7 +115,11 @@ void lv_obj_add_style(lv_obj_t * obj, const lv_style_t * style, lv_style_selecto
     /*Allocate space for the new style and shift the rest of the style to the end*/
     obj->style_cnt++;
     LV_ASSERT(obj->style_cnt != 0);
+    lv_mem_tag_t mem_tag = lv_mem_set_tag(LV_MEM_TAG_STYLE);
+    lv_mem_arena_t * arena = lv_mem_set_arena_for(obj);
     obj->styles = lv_realloc(obj->styles, obj->style_cnt * sizeof(lv_obj_style_t));
+    lv_mem_set_arena(arena);
+    lv_mem_set_tag(mem_tag);
     LV_ASSERT_MALLOC(obj->styles);
 
     uint32_t j;
@@ -725,6 +729,8 @@ static lv_style_t * get_local_style(lv_obj_t * obj, lv_style_selector_t selector
 
     obj->style_cnt++;
     LV_ASSERT(obj->style_cnt != 0);
+    lv_mem_tag_t mem_tag = lv_mem_set_tag(LV_MEM_TAG_STYLE);
+    lv_mem_arena_t * arena = lv_mem_set_arena_for(obj);
     obj->styles = lv_realloc(obj->styles, obj->style_cnt * sizeof(lv_obj_style_t));
     LV_ASSERT_MALLOC(obj->styles);
 
@@ -737,6 +743,8 @@ static lv_style_t * get_local_style(lv_obj_t * obj, lv_style_selector_t selector
 
     lv_memzero(&obj->styles[i], sizeof(lv_obj_style_t));
     obj->styles[i].style = lv_malloc_zeroed(sizeof(lv_style_t));
+    lv_mem_set_arena(arena);
+    lv_mem_set_tag(mem_tag);
     lv_style_init((lv_style_t *)obj->styles[i].style);
 
     obj->styles[i].is_local = 1;
@@ -763,6 +771,8 @@ static lv_obj_style_t * get_trans_style(lv_obj_t * obj,  lv_style_selector_t sel
 
     obj->style_cnt++;
     LV_ASSERT(obj->style_cnt != 0);
+    lv_mem_tag_t mem_tag = lv_mem_set_tag(LV_MEM_TAG_STYLE);
+    lv_mem_arena_t * arena = lv_mem_set_arena_for(obj);
     obj->styles = lv_realloc(obj->styles, obj->style_cnt * sizeof(lv_obj_style_t));
 
     for(i = obj->style_cnt - 1; i > 0 ; i--) {
@@ -771,6 +781,8 @@ static lv_obj_style_t * get_trans_style(lv_obj_t * obj,  lv_style_selector_t sel
 
     lv_memzero(&obj->styles[0], sizeof(lv_obj_style_t));
     obj->styles[0].style = lv_malloc(sizeof(lv_style_t));
+    lv_mem_set_arena(arena);
+    lv_mem_set_tag(mem_tag);
     lv_style_init((lv_style_t *)obj->styles[0].style);
 
     obj->styles[0].is_trans = 1;
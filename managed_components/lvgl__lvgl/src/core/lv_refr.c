@@ -21,6 +21,7 @@
 #include "../misc/lv_profiler.h"
 #include "../misc/lv_types.h"
 #include "../draw/lv_draw_private.h"
+#include "../draw/lv_draw_pool_private.h"
 #include "../font/lv_font_fmt_txt.h"
 #include "../stdlib/lv_string.h"
 #include "lv_global.h"
@@ -32,6 +33,9 @@
 /*Display being refreshed*/
 #define disp_refr LV_GLOBAL_DEFAULT()->disp_refresh
 
+/*Rectangles an object partly hidden by opaque objects can be drawn in, else it is drawn whole*/
+#define LV_REFR_VISIBLE_AREA_MAX    4
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -40,10 +44,23 @@
  *  STATIC PROTOTYPES
  **********************/
 static void lv_refr_join_area(void);
+static void lv_refr_join_area_cost(void);
 static void refr_invalid_areas(void);
 static void refr_sync_areas(void);
 static void refr_area(const lv_area_t * area_p, int32_t y_offset);
 static void refr_configured_layer(lv_layer_t * layer);
+static void refr_layer_over_static(lv_layer_t * layer);
+static void layer_wait_and_remove(lv_layer_t * layer);
+static void static_layer_update(void);
+static void static_layer_copy(lv_layer_t * layer);
+static bool static_layer_draws_obj(lv_layer_t * layer, lv_obj_t * obj);
+static bool static_layer_draws_post(void);
+static bool static_layer_begin_all(void);
+static void static_layer_end_all(void);
+static void occlusion_collect(lv_layer_t * layer, lv_obj_t * top_obj);
+static void occlusion_collect_obj(lv_obj_t * obj, const lv_area_t * clip_area);
+static uint32_t occlusion_get_visible_areas(lv_layer_t * layer, lv_obj_t * obj, lv_area_t areas[]);
+static void occlusion_frame_end(void);
 static void refr_obj_and_children(lv_layer_t * layer, lv_obj_t * top_obj);
 static uint32_t get_max_row(lv_display_t * disp, int32_t area_w, int32_t area_h);
 static void draw_buf_flush(lv_display_t * disp);
@@ -121,9 +138,20 @@ void lv_obj_redraw(lv_layer_t * layer, lv_obj_t * obj)
     /*If the object is visible on the current clip area*/
     layer->_clip_area = clip_coords_for_obj;
 
-    lv_obj_send_event(obj, LV_EVENT_DRAW_MAIN_BEGIN, layer);
-    lv_obj_send_event(obj, LV_EVENT_DRAW_MAIN, layer);
-    lv_obj_send_event(obj, LV_EVENT_DRAW_MAIN_END, layer);
+    bool draw_self = static_layer_draws_obj(layer, obj);
+    if(draw_self) {
+        /*Only the parts not hidden by the opaque objects drawn later, as if they were tiles*/
+        lv_area_t visible_areas[LV_REFR_VISIBLE_AREA_MAX];
+        uint32_t visible_cnt = occlusion_get_visible_areas(layer, obj, visible_areas);
+        uint32_t i;
+        for(i = 0; i < visible_cnt; i++) {
+            layer->_clip_area = visible_areas[i];
+            lv_obj_send_event(obj, LV_EVENT_DRAW_MAIN_BEGIN, layer);
+            lv_obj_send_event(obj, LV_EVENT_DRAW_MAIN, layer);
+            lv_obj_send_event(obj, LV_EVENT_DRAW_MAIN_END, layer);
+        }
+        layer->_clip_area = clip_coords_for_obj;
+    }
 #if LV_USE_REFR_DEBUG
     lv_color_t debug_color = lv_color_make(lv_rand(0, 0xFF), lv_rand(0, 0xFF), lv_rand(0, 0xFF));
     lv_draw_rect_dsc_t draw_dsc;
@@ -155,9 +183,11 @@ void lv_obj_redraw(lv_layer_t * layer, lv_obj_t * obj)
         if(child_cnt == 0) {
             /*If the object was visible on the clip area call the post draw events too*/
             /*If all the children are redrawn make 'post draw' draw*/
-            lv_obj_send_event(obj, LV_EVENT_DRAW_POST_BEGIN, layer);
-            lv_obj_send_event(obj, LV_EVENT_DRAW_POST, layer);
-            lv_obj_send_event(obj, LV_EVENT_DRAW_POST_END, layer);
+            if(draw_self) {
+                lv_obj_send_event(obj, LV_EVENT_DRAW_POST_BEGIN, layer);
+                lv_obj_send_event(obj, LV_EVENT_DRAW_POST, layer);
+                lv_obj_send_event(obj, LV_EVENT_DRAW_POST_END, layer);
+            }
         }
         else {
             layer->_clip_area = clip_coords_for_children;
@@ -177,11 +207,13 @@ void lv_obj_redraw(lv_layer_t * layer, lv_obj_t * obj)
 
                 /*If the object was visible on the clip area call the post draw events too*/
                 /*If all the children are redrawn make 'post draw' draw*/
-                lv_obj_send_event(obj, LV_EVENT_DRAW_POST_BEGIN, layer);
-                lv_obj_send_event(obj, LV_EVENT_DRAW_POST, layer);
-                lv_obj_send_event(obj, LV_EVENT_DRAW_POST_END, layer);
+                if(static_layer_draws_post()) {
+                    lv_obj_send_event(obj, LV_EVENT_DRAW_POST_BEGIN, layer);
+                    lv_obj_send_event(obj, LV_EVENT_DRAW_POST, layer);
+                    lv_obj_send_event(obj, LV_EVENT_DRAW_POST_END, layer);
+                }
             }
-            else {
+            else if(static_layer_begin_all()) {
                 lv_layer_t * layer_children;
                 lv_draw_mask_rect_dsc_t mask_draw_dsc;
                 lv_draw_mask_rect_dsc_init(&mask_draw_dsc);
@@ -254,6 +286,7 @@ void lv_obj_redraw(lv_layer_t * layer, lv_obj_t * obj)
 
                 }
 
+                static_layer_end_all();
             }
         }
     }
@@ -335,6 +368,30 @@ void lv_inv_area(lv_display_t * disp, const lv_area_t * area_p)
     lv_display_send_event(disp, LV_EVENT_REFR_REQUEST, NULL);
 }
 
+void lv_inv_static_area(lv_display_t * disp, const lv_area_t * area_p)
+{
+    if(!disp) disp = lv_display_get_default();
+    if(!disp) return;
+
+    lv_display_static_layer_t * sl = &disp->static_layer;
+    if(sl->draw_buf.data == NULL) return;
+
+    /*Save only if this area is not in one of the saved areas*/
+    uint32_t i;
+    for(i = 0; i < sl->dirty_cnt; i++) {
+        if(lv_area_is_in(area_p, &sl->dirty_areas[i], 0) != false) return;
+    }
+
+    if(sl->dirty_cnt >= LV_INV_BUF_SIZE) { /*If no place for the area render the screen*/
+        lv_area_set(&sl->dirty_areas[0], 0, 0, lv_display_get_horizontal_resolution(disp) - 1,
+                    lv_display_get_vertical_resolution(disp) - 1);
+        sl->dirty_cnt = 1;
+        return;
+    }
+    sl->dirty_areas[sl->dirty_cnt] = *area_p;
+    sl->dirty_cnt++;
+}
+
 /**
  * Get the display which is being refreshed
  * @return the display being refreshed
@@ -401,6 +458,8 @@ void lv_display_refr_timer(lv_timer_t * tmr)
     lv_obj_update_layout(disp_refr->sys_layer);
     LV_PROFILER_LAYOUT_END_TAG("layout");
 
+    lv_mem_tag_t mem_tag = lv_mem_set_tag(LV_MEM_TAG_DRAW);
+
     /*Do nothing if there is no active screen*/
     if(disp_refr->act_scr == NULL) {
         disp_refr->inv_p = 0;
@@ -435,6 +494,7 @@ refr_finish:
 #if LV_DRAW_SW_COMPLEX == 1
     lv_draw_sw_mask_cleanup();
 #endif
+    lv_mem_set_tag(mem_tag);
 
     lv_display_send_event(disp_refr, LV_EVENT_REFR_READY, NULL);
 
@@ -495,6 +555,17 @@ void lv_obj_refr(lv_layer_t * layer, lv_obj_t * obj)
     const lv_opa_t opa_layered = lv_obj_get_style_opa_layered(obj, LV_PART_MAIN);
     if(opa_layered <= LV_OPA_MIN) return;
 
+    /*The static layer keeps no layers: a layered widget is drawn whole with the other objects*/
+    lv_layer_type_t layer_type = lv_obj_get_layer_type(obj);
+    if(layer_type != LV_LAYER_TYPE_NONE && !static_layer_begin_all()) return;
+
+    /*Layers are blended or transformed later: what is in them is not culled*/
+    lv_layer_t * occlusion_layer = NULL;
+    if(layer_type != LV_LAYER_TYPE_NONE && disp_refr) {
+        occlusion_layer = disp_refr->occlusion.layer;
+        disp_refr->occlusion.layer = NULL;
+    }
+
     const lv_opa_t layer_opa_ori = layer->opa;
     const lv_color32_t layer_recolor = layer->recolor;
 
@@ -506,7 +577,6 @@ void lv_obj_refr(lv_layer_t * layer, lv_obj_t * obj)
 
     layer->recolor = lv_obj_style_apply_recolor(obj, LV_PART_MAIN, layer->recolor);
 
-    lv_layer_type_t layer_type = lv_obj_get_layer_type(obj);
     if(layer_type == LV_LAYER_TYPE_NONE) {
         lv_obj_redraw(layer, obj);
     }
@@ -520,7 +590,11 @@ void lv_obj_refr(lv_layer_t * layer, lv_obj_t * obj)
         lv_area_t layer_area_full;
         lv_area_t obj_draw_size;
         lv_result_t res = layer_get_area(layer, obj, layer_type, &layer_area_full, &obj_draw_size);
-        if(res != LV_RESULT_OK) return;
+        if(res != LV_RESULT_OK) {
+            static_layer_end_all();
+            if(occlusion_layer) disp_refr->occlusion.layer = occlusion_layer;
+            return;
+        }
 
         /*Simple layers can be subdivided into smaller layers*/
         uint32_t max_rgb_row_height = lv_area_get_height(&layer_area_full);
@@ -593,6 +667,9 @@ void lv_obj_refr(lv_layer_t * layer, lv_obj_t * obj)
         }
     }
 
+    if(layer_type != LV_LAYER_TYPE_NONE) static_layer_end_all();
+    if(occlusion_layer) disp_refr->occlusion.layer = occlusion_layer;
+
     /* Restore the original layer opa and recolor */
     layer->opa = layer_opa_ori;
     layer->recolor = layer_recolor;
@@ -607,6 +684,11 @@ void lv_obj_refr(lv_layer_t * layer, lv_obj_t * obj)
  */
 static void lv_refr_join_area(void)
 {
+    if(disp_refr->inv_join == LV_DISPLAY_INV_JOIN_COST) {
+        lv_refr_join_area_cost();
+        return;
+    }
+
     LV_PROFILER_REFR_BEGIN;
     uint32_t join_from;
     uint32_t join_in;
@@ -641,6 +723,40 @@ static void lv_refr_join_area(void)
     LV_PROFILER_REFR_END;
 }
 
+/**
+ * Join any two areas while their bounding box has fewer pixels than the two and the overhead of an area.
+ * A joined area can make an other join worth it: repeated until nothing joins.
+ */
+static void lv_refr_join_area_cost(void)
+{
+    LV_PROFILER_REFR_BEGIN;
+    lv_area_t * areas = disp_refr->inv_areas;
+    uint8_t * joined = disp_refr->inv_area_joined;
+    bool again = true;
+    while(again) {
+        again = false;
+        uint32_t join_in;
+        for(join_in = 0; join_in < disp_refr->inv_p; join_in++) {
+            if(joined[join_in]) continue;
+
+            uint32_t join_from;
+            for(join_from = join_in + 1; join_from < disp_refr->inv_p; join_from++) {
+                if(joined[join_from]) continue;
+
+                lv_area_t joined_area;
+                lv_area_join(&joined_area, &areas[join_in], &areas[join_from]);
+                if(lv_area_get_size(&joined_area) < lv_area_get_size(&areas[join_in]) +
+                   lv_area_get_size(&areas[join_from]) + disp_refr->inv_join_cost_px) {
+                    areas[join_in] = joined_area;
+                    joined[join_from] = 1;
+                    again = true;
+                }
+            }
+        }
+    }
+    LV_PROFILER_REFR_END;
+}
+
 /**
  * Refresh the sync areas
  */
@@ -768,6 +884,8 @@ static void refr_invalid_areas(void)
     disp_refr->last_part = 0;
     disp_refr->rendering_in_progress = true;
 
+    static_layer_update();
+
     for(i = 0; i < (int32_t)disp_refr->inv_p; i++) {
         /*Refresh the unjoined areas*/
         if(disp_refr->inv_area_joined[i]) continue;
@@ -820,6 +938,8 @@ static void refr_invalid_areas(void)
         }
     }
 
+    disp_refr->static_layer.pass = LV_DISPLAY_STATIC_PASS_NONE;
+    occlusion_frame_end();
     lv_display_send_event(disp_refr, LV_EVENT_RENDER_READY, NULL);
     disp_refr->rendering_in_progress = false;
     LV_PROFILER_REFR_END;
@@ -893,13 +1013,13 @@ static void refr_area(const lv_area_t * area_p, int32_t y_offset)
     }
 
     if(tile_cnt == 1) {
-        refr_configured_layer(layer);
+        refr_layer_over_static(layer);
     }
     else {
         /* Don't draw to the layers buffer of the display but create smaller dummy layers which are using the
          * display's layer buffer. These will be the tiles. By using tiles it's more likely that there will
          * be independent areas for each draw unit. */
-        lv_layer_t * tile_layers = lv_malloc(tile_cnt * sizeof(lv_layer_t));
+        lv_layer_t * tile_layers = lv_draw_pool_alloc(LV_DRAW_POOL_LAYER, tile_cnt * sizeof(lv_layer_t));
         LV_ASSERT_MALLOC(tile_layers);
         if(tile_layers == NULL) {
             disp_refr->refreshed_area = *area_p;
@@ -920,33 +1040,20 @@ static void refr_area(const lv_area_t * area_p, int32_t y_offset)
             lv_draw_layer_init(tile_layer, NULL, layer->color_format, &tile_area);
             tile_layer->buf_area = layer->buf_area; /*the buffer is still large*/
             tile_layer->draw_buf = layer->draw_buf;
-            refr_configured_layer(tile_layer);
+            refr_layer_over_static(tile_layer);
         }
 
 
         /*Wait until all tiles are ready and destroy remove them*/
         for(i = 0; i < tile_cnt; i++) {
-            lv_layer_t * tile_layer = &tile_layers[i];
-            while(tile_layer->draw_task_head) {
-                lv_draw_dispatch_wait_for_request();
-                lv_draw_dispatch();
-            }
-
-            lv_layer_t * layer_i = disp_refr->layer_head;
-            while(layer_i) {
-                if(layer_i->next == tile_layer) {
-                    layer_i->next = tile_layer->next;
-                    break;
-                }
-                layer_i = layer_i->next;
-            }
-
-            if(disp_refr->layer_deinit) disp_refr->layer_deinit(disp_refr, tile_layer);
+            layer_wait_and_remove(&tile_layers[i]);
         }
-        lv_free(tile_layers);
+        lv_draw_pool_free(tile_layers);
     }
 
     disp_refr->refreshed_area = *area_p;
+    disp_refr->occlusion.frame_flushed_px += lv_area_get_size(area_p);
+    disp_refr->occlusion.stats.flushes++;
     LV_PROFILER_REFR_END;
 }
 
@@ -1016,11 +1123,13 @@ static void refr_configured_layer(lv_layer_t * layer)
 
     /* In single buffered mode wait here until the buffer is freed.
      * Else we would draw into the buffer while it's still being transferred to the display*/
-    if(!lv_display_is_double_buffered(disp_refr)) {
+    const lv_display_static_pass_t pass = disp_refr->static_layer.pass;
+    if(!lv_display_is_double_buffered(disp_refr) && pass != LV_DISPLAY_STATIC_PASS_STATIC) {
         wait_for_flushing(disp_refr);
     }
-    /*If the screen is transparent initialize it when the flushing is ready*/
-    if(lv_color_format_has_alpha(disp_refr->color_format)) {
+    /*If the screen is transparent initialize it when the flushing is ready.
+     *Clear the static layer too: only the static objects are drawn there*/
+    if(lv_color_format_has_alpha(disp_refr->color_format) || pass == LV_DISPLAY_STATIC_PASS_STATIC) {
         lv_area_t clear_area = layer->_clip_area;
         lv_area_move(&clear_area, -layer->buf_area.x1, -layer->buf_area.y1);
         lv_draw_buf_clear(layer->draw_buf, &clear_area);
@@ -1029,12 +1138,23 @@ static void refr_configured_layer(lv_layer_t * layer)
     lv_obj_t * top_act_scr = NULL;
     lv_obj_t * top_prev_scr = NULL;
 
-    /*Get the most top object which is not covered by others*/
-    top_act_scr = lv_refr_get_top_obj(&layer->_clip_area, lv_display_get_screen_active(disp_refr));
-    if(disp_refr->prev_scr) {
-        top_prev_scr = lv_refr_get_top_obj(&layer->_clip_area, disp_refr->prev_scr);
+    /*Get the most top object which is not covered by others.
+     *The static layer is rendered from the screen: the objects covering the area may not be static*/
+    if(pass != LV_DISPLAY_STATIC_PASS_STATIC) {
+        top_act_scr = lv_refr_get_top_obj(&layer->_clip_area, lv_display_get_screen_active(disp_refr));
+        if(disp_refr->prev_scr) {
+            top_prev_scr = lv_refr_get_top_obj(&layer->_clip_area, disp_refr->prev_scr);
+        }
+    }
+
+    /*Start from the static objects, unless an other object covers them*/
+    if(pass == LV_DISPLAY_STATIC_PASS_DYNAMIC && (top_act_scr == NULL || top_act_scr->is_static)) {
+        static_layer_copy(layer);
     }
 
+    /*The opaque objects of the active screen, to cull what is under them*/
+    occlusion_collect(layer, top_act_scr);
+
     /*Draw a bottom layer background if there is no top object*/
     if(top_act_scr == NULL && top_prev_scr == NULL) {
         refr_obj_and_children(layer, lv_display_get_layer_bottom(disp_refr));
@@ -1065,6 +1185,7 @@ static void refr_configured_layer(lv_layer_t * layer)
     refr_obj_and_children(layer, lv_display_get_layer_top(disp_refr));
     refr_obj_and_children(layer, lv_display_get_layer_sys(disp_refr));
 
+    disp_refr->occlusion.layer = NULL;
     LV_PROFILER_REFR_END;
 }
 
@@ -1113,9 +1234,11 @@ static void refr_obj_and_children(lv_layer_t * layer, lv_obj_t * top_obj)
         }
 
         /*Call the post draw function of the parents of the to object*/
-        lv_obj_send_event(parent, LV_EVENT_DRAW_POST_BEGIN, (void *)layer);
-        lv_obj_send_event(parent, LV_EVENT_DRAW_POST, (void *)layer);
-        lv_obj_send_event(parent, LV_EVENT_DRAW_POST_END, (void *)layer);
+        if(static_layer_draws_post()) {
+            lv_obj_send_event(parent, LV_EVENT_DRAW_POST_BEGIN, (void *)layer);
+            lv_obj_send_event(parent, LV_EVENT_DRAW_POST, (void *)layer);
+            lv_obj_send_event(parent, LV_EVENT_DRAW_POST_END, (void *)layer);
+        }
 
         /*The new border will be the last parents,
          *so the 'younger' brothers of parent will be refreshed*/
@@ -1126,6 +1249,340 @@ static void refr_obj_and_children(lv_layer_t * layer, lv_obj_t * top_obj)
     LV_PROFILER_REFR_END;
 }
 
+/**
+ * Draw a layer over a copy of the static layer in the dynamic pass, else normally.
+ * If a static object is over an other object the copy cannot be under both: the layer is drawn again normally.
+ * @param layer  pointer to a layer configured as `refr_configured_layer` needs it
+ */
+static void refr_layer_over_static(lv_layer_t * layer)
+{
+    lv_display_static_layer_t * sl = &disp_refr->static_layer;
+    if(sl->pass != LV_DISPLAY_STATIC_PASS_DYNAMIC) {
+        refr_configured_layer(layer);
+        return;
+    }
+
+    sl->dyn_drawn = 0;
+    sl->order_error = 0;
+    refr_configured_layer(layer);
+    if(sl->order_error == 0) {
+        sl->stats.composited++;
+        return;
+    }
+
+    while(layer->draw_task_head) {
+        lv_draw_dispatch_wait_for_request();
+        lv_draw_dispatch();
+    }
+    sl->pass = LV_DISPLAY_STATIC_PASS_NONE;
+    refr_configured_layer(layer);
+    sl->pass = LV_DISPLAY_STATIC_PASS_DYNAMIC;
+    sl->stats.fallbacks++;
+}
+
+/**
+ * Wait until the draw tasks of a layer are ready and remove it from the display
+ * @param layer  pointer to a layer created with `lv_draw_layer_init(layer, NULL, ...)`
+ */
+static void layer_wait_and_remove(lv_layer_t * layer)
+{
+    while(layer->draw_task_head) {
+        lv_draw_dispatch_wait_for_request();
+        lv_draw_dispatch();
+    }
+
+    lv_layer_t * layer_i = disp_refr->layer_head;
+    while(layer_i) {
+        if(layer_i->next == layer) {
+            layer_i->next = layer->next;
+            break;
+        }
+        layer_i = layer_i->next;
+    }
+
+    if(disp_refr->layer_deinit) disp_refr->layer_deinit(disp_refr, layer);
+}
+
+/**
+ * Render the areas of the changed static objects into the static layer
+ * and select the pass of the invalidated areas
+ */
+static void static_layer_update(void)
+{
+    lv_display_static_layer_t * sl = &disp_refr->static_layer;
+    sl->pass = LV_DISPLAY_STATIC_PASS_NONE;
+    if(sl->draw_buf.data == NULL) return;
+
+    /*The static layer is a single, not rotated screen*/
+    if(disp_refr->prev_scr || lv_display_get_rotation(disp_refr) != LV_DISPLAY_ROTATION_0) return;
+
+    int32_t hor_res = lv_display_get_horizontal_resolution(disp_refr);
+    int32_t ver_res = lv_display_get_vertical_resolution(disp_refr);
+    lv_area_t scr_area;
+    lv_area_set(&scr_area, 0, 0, hor_res - 1, ver_res - 1);
+    if(sl->draw_buf.header.w != hor_res || sl->draw_buf.header.h != ver_res ||
+       sl->draw_buf.header.cf != disp_refr->color_format) {
+        if(lv_draw_buf_reshape(&sl->draw_buf, disp_refr->color_format, hor_res, ver_res, LV_STRIDE_AUTO) == NULL) return;
+        sl->dirty_areas[0] = scr_area;
+        sl->dirty_cnt = 1;
+    }
+
+    sl->pass = LV_DISPLAY_STATIC_PASS_STATIC;
+    uint32_t i;
+    for(i = 0; i < sl->dirty_cnt; i++) {
+        lv_layer_t layer;
+        lv_draw_layer_init(&layer, NULL, disp_refr->color_format, &sl->dirty_areas[i]);
+        layer.buf_area = scr_area;
+        layer.draw_buf = &sl->draw_buf;
+        refr_configured_layer(&layer);
+        layer_wait_and_remove(&layer);
+
+        sl->stats.renders++;
+        sl->stats.rendered_px += lv_area_get_size(&sl->dirty_areas[i]);
+    }
+    sl->dirty_cnt = 0;
+    sl->pass = LV_DISPLAY_STATIC_PASS_DYNAMIC;
+}
+
+/**
+ * Put the static objects of the clip area of a layer into its buffer
+ * @param layer  pointer to a layer of the dynamic pass
+ */
+static void static_layer_copy(lv_layer_t * layer)
+{
+    LV_PROFILER_REFR_BEGIN;
+    lv_area_t dest_area = layer->_clip_area;
+    lv_area_move(&dest_area, -layer->buf_area.x1, -layer->buf_area.y1);
+    lv_draw_buf_copy(layer->draw_buf, &dest_area, &disp_refr->static_layer.draw_buf, &layer->_clip_area);
+    disp_refr->occlusion.frame_drawn_px += lv_area_get_size(&layer->_clip_area);
+    LV_PROFILER_REFR_END;
+}
+
+/**
+ * Whether an object draws itself in the current pass. Its children are decided one by one.
+ * In the dynamic pass a static object is in the copy, under everything drawn so far:
+ * if it is over an other object the layer has to be drawn normally.
+ * @param layer  the layer, its clip area is the area of the object to draw
+ * @param obj    pointer to an object
+ * @return       true: draw the object
+ */
+static bool static_layer_draws_obj(lv_layer_t * layer, lv_obj_t * obj)
+{
+    if(disp_refr == NULL) return true;
+    lv_display_static_layer_t * sl = &disp_refr->static_layer;
+    if(sl->pass == LV_DISPLAY_STATIC_PASS_NONE || sl->all_depth > 0) return true;
+    if(sl->pass == LV_DISPLAY_STATIC_PASS_STATIC) return obj->is_static;
+
+    if(obj->is_static && sl->dyn_drawn && lv_area_is_on(&sl->dyn_area, &layer->_clip_area)) {
+        sl->order_error = 1;
+    }
+    return !obj->is_static;
+}
+
+/**
+ * Whether the post draw events of an object with children are sent in the current pass.
+ * They go over the children, which may not be static: never in the static layer.
+ * @return       true: send them
+ */
+static bool static_layer_draws_post(void)
+{
+    return disp_refr == NULL || disp_refr->static_layer.pass != LV_DISPLAY_STATIC_PASS_STATIC;
+}
+
+/**
+ * Start drawing a subtree in its own layers: the static layer keeps none,
+ * the whole subtree is drawn in the dynamic pass.
+ * @return  false: skip the subtree (in the static pass)
+ */
+static bool static_layer_begin_all(void)
+{
+    if(disp_refr == NULL) return true;
+    lv_display_static_layer_t * sl = &disp_refr->static_layer;
+    if(sl->pass == LV_DISPLAY_STATIC_PASS_STATIC) return false;
+    if(sl->pass == LV_DISPLAY_STATIC_PASS_DYNAMIC) sl->all_depth++;
+    return true;
+}
+
+static void static_layer_end_all(void)
+{
+    if(disp_refr == NULL) return;
+    lv_display_static_layer_t * sl = &disp_refr->static_layer;
+    if(sl->pass == LV_DISPLAY_STATIC_PASS_DYNAMIC) sl->all_depth--;
+}
+
+/**
+ * Find the opaque objects of a layer in the order `refr_obj_and_children` draws them
+ * @param layer     pointer to the layer about to be drawn
+ * @param top_obj   the object the drawing of the active screen starts from, NULL: the screen
+ */
+static void occlusion_collect(lv_layer_t * layer, lv_obj_t * top_obj)
+{
+    lv_display_occlusion_t * occ = &disp_refr->occlusion;
+    occ->layer = NULL;
+    occ->occluder_cnt = 0;
+    occ->occluder_next = 0;
+    if(!occ->enabled) return;
+
+    /*The previous screen or the rotation would be drawn over or under the areas*/
+    if(disp_refr->prev_scr || lv_display_get_rotation(disp_refr) != LV_DISPLAY_ROTATION_0) return;
+
+    if(top_obj == NULL) top_obj = lv_display_get_screen_active(disp_refr);
+    if(top_obj == NULL) return;
+
+    LV_PROFILER_REFR_BEGIN;
+    occlusion_collect_obj(top_obj, &layer->_clip_area);
+
+    /*The younger siblings of the parents are drawn after, in the whole area*/
+    lv_obj_t * border_p = top_obj;
+    lv_obj_t * parent = lv_obj_get_parent(top_obj);
+    while(parent) {
+        uint32_t i = lv_obj_get_index(border_p) + 1;
+        uint32_t child_cnt = lv_obj_get_child_count(parent);
+        for(; i < child_cnt; i++) {
+            occlusion_collect_obj(parent->spec_attr->children[i], &layer->_clip_area);
+        }
+        border_p = parent;
+        parent = lv_obj_get_parent(parent);
+    }
+
+    if(occ->occluder_cnt > 0) occ->layer = layer;
+    LV_PROFILER_REFR_END;
+}
+
+/**
+ * Add an object and its children to the occluders if they cover a part of the clip area.
+ * Mirrors `lv_obj_refr`: what is in layers, or under a rounded clip corner, is left out.
+ * @param obj           pointer to an object
+ * @param clip_area     the area the object is drawn in
+ */
+static void occlusion_collect_obj(lv_obj_t * obj, const lv_area_t * clip_area)
+{
+    lv_display_occlusion_t * occ = &disp_refr->occlusion;
+    if(occ->occluder_cnt >= LV_DISPLAY_OCCLUDER_MAX) return;
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) return;
+    if(lv_obj_get_layer_type(obj) != LV_LAYER_TYPE_NONE) return;
+    if(lv_obj_get_style_opa(obj, LV_PART_MAIN) < LV_OPA_MAX) return;
+
+    lv_area_t obj_clip_area;
+    lv_area_t obj_coords_ext;
+    lv_obj_get_coords(obj, &obj_coords_ext);
+    int32_t ext_draw_size = lv_obj_get_ext_draw_size(obj);
+    lv_area_increase(&obj_coords_ext, ext_draw_size, ext_draw_size);
+    if(!lv_area_intersect(&obj_clip_area, clip_area, &obj_coords_ext)) return;
+
+    /*Only the objects of the pass: in the dynamic pass a static object is in the copy*/
+    const lv_display_static_pass_t pass = disp_refr->static_layer.pass;
+    bool drawn = pass == LV_DISPLAY_STATIC_PASS_NONE || (pass == LV_DISPLAY_STATIC_PASS_STATIC) == obj->is_static;
+    lv_area_t cover_area;
+    if(drawn && lv_obj_get_style_blend_mode(obj, LV_PART_MAIN) == LV_BLEND_MODE_NORMAL &&
+       lv_area_intersect(&cover_area, &obj_clip_area, &obj->coords)) {
+        /*Of a rounded object only the band between the corners can be covered*/
+        int32_t radius = lv_obj_get_style_radius(obj, LV_PART_MAIN);
+        if(radius > 0) {
+            int32_t short_side = LV_MIN(lv_area_get_width(&obj->coords), lv_area_get_height(&obj->coords));
+            radius = LV_MIN(radius, short_side >> 1) + 1;
+            cover_area.y1 = LV_MAX(cover_area.y1, obj->coords.y1 + radius);
+            cover_area.y2 = LV_MIN(cover_area.y2, obj->coords.y2 - radius);
+        }
+
+        if(cover_area.y1 <= cover_area.y2) {
+            lv_cover_check_info_t info;
+            info.res = LV_COVER_RES_COVER;
+            info.area = &cover_area;
+            lv_obj_send_event(obj, LV_EVENT_COVER_CHECK, &info);
+            if(info.res == LV_COVER_RES_COVER) {
+                occ->occluders[occ->occluder_cnt].obj = obj;
+                occ->occluders[occ->occluder_cnt].area = cover_area;
+                occ->occluder_cnt++;
+            }
+        }
+    }
+
+    const lv_area_t * obj_coords = lv_obj_has_flag(obj, LV_OBJ_FLAG_OVERFLOW_VISIBLE) ? &obj_coords_ext : &obj->coords;
+    lv_area_t children_clip_area;
+    if(!lv_area_intersect(&children_clip_area, &obj_clip_area, obj_coords)) return;
+    if(lv_obj_get_style_clip_corner(obj, LV_PART_MAIN) && lv_obj_get_style_radius(obj, LV_PART_MAIN) > 0) return;
+
+    uint32_t i;
+    uint32_t child_cnt = lv_obj_get_child_count(obj);
+    for(i = 0; i < child_cnt; i++) {
+        occlusion_collect_obj(obj->spec_attr->children[i], &children_clip_area);
+    }
+}
+
+/**
+ * Get the parts of the clip area of an object not hidden by the occluders drawn after it
+ * @param layer     the layer, its clip area is the area of the object to draw
+ * @param obj       pointer to the object about to be drawn
+ * @param areas     filled with up to `LV_REFR_VISIBLE_AREA_MAX` rectangles
+ * @return          number of rectangles, 0: the object is hidden
+ */
+static uint32_t occlusion_get_visible_areas(lv_layer_t * layer, lv_obj_t * obj, lv_area_t areas[])
+{
+    areas[0] = layer->_clip_area;
+    if(disp_refr == NULL || disp_refr->occlusion.layer != layer) return 1;
+
+    /*The occluders before it are under the object, it does not hide itself*/
+    lv_display_occlusion_t * occ = &disp_refr->occlusion;
+    uint32_t i;
+    for(i = occ->occluder_next; i < occ->occluder_cnt; i++) {
+        if(occ->occluders[i].obj == obj) {
+            occ->occluder_next = i + 1;
+            break;
+        }
+    }
+
+    uint32_t cnt = 1;
+    bool culled = false;
+    for(i = occ->occluder_next; i < occ->occluder_cnt && cnt > 0; i++) {
+        lv_area_t remaining[LV_REFR_VISIBLE_AREA_MAX];
+        uint32_t remaining_cnt = 0;
+        bool cut = false;
+        uint32_t a;
+        for(a = 0; a < cnt; a++) {
+            lv_area_t parts[4];
+            int8_t part_cnt = lv_area_diff(parts, &areas[a], &occ->occluders[i].area);
+            if(part_cnt < 0) {
+                parts[0] = areas[a];
+                part_cnt = 1;
+            }
+            else {
+                cut = true;
+            }
+            if(remaining_cnt + part_cnt > LV_REFR_VISIBLE_AREA_MAX) break;
+            lv_memcpy(&remaining[remaining_cnt], parts, part_cnt * sizeof(lv_area_t));
+            remaining_cnt += part_cnt;
+        }
+
+        /*Too fragmented by this occluder: draw what it hides*/
+        if(a < cnt || !cut) continue;
+        lv_memcpy(areas, remaining, remaining_cnt * sizeof(lv_area_t));
+        cnt = remaining_cnt;
+        culled = true;
+    }
+
+    if(culled) occ->stats.culled_objs++;
+    if(cnt == 0) occ->stats.hidden_objs++;
+    return cnt;
+}
+
+/**
+ * Add the pixels drawn and refreshed by a frame to the overdraw
+ */
+static void occlusion_frame_end(void)
+{
+    lv_display_occlusion_t * occ = &disp_refr->occlusion;
+    if(occ->frame_flushed_px > 0) {
+        occ->stats.frames++;
+        occ->stats.drawn_px += occ->frame_drawn_px;
+        occ->stats.flushed_px += occ->frame_flushed_px;
+        uint32_t overdraw_x100 = (uint32_t)(occ->frame_drawn_px * 100 / occ->frame_flushed_px);
+        if(overdraw_x100 > occ->stats.peak_x100) occ->stats.peak_x100 = overdraw_x100;
+    }
+    occ->frame_drawn_px = 0;
+    occ->frame_flushed_px = 0;
+}
+
 static lv_result_t layer_get_area(lv_layer_t * layer, lv_obj_t * obj, lv_layer_type_t layer_type,
                                   lv_area_t * layer_area_out, lv_area_t * obj_draw_size_out)
 {
@@ -46,6 +46,14 @@ void lv_refr_deinit(void);
  */
 void lv_inv_area(lv_display_t * disp, const lv_area_t * area_p);
 
+/**
+ * Mark an area of the static layer of a display to render again, because a static object changed there.
+ * It is to be invalidated with `lv_inv_area` too.
+ * @param disp      pointer to display
+ * @param area_p    pointer to area, on the screen
+ */
+void lv_inv_static_area(lv_display_t * disp, const lv_area_t * area_p);
+
 /**
  * Get the display which is being refreshed
  * @return the display being refreshed
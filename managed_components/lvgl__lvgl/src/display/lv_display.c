@@ -591,6 +591,69 @@ uint32_t lv_display_get_tile_cnt(lv_display_t * disp)
     return disp->tile_cnt;
 }
 
+void lv_display_set_static_layer(lv_display_t * disp, void * buf, uint32_t buf_size)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return;
+
+    lv_display_static_layer_t * sl = &disp->static_layer;
+    int32_t hor_res = lv_display_get_horizontal_resolution(disp);
+    int32_t ver_res = lv_display_get_vertical_resolution(disp);
+    lv_memzero(&sl->draw_buf, sizeof(sl->draw_buf));
+    if(buf && lv_draw_buf_init(&sl->draw_buf, hor_res, ver_res, disp->color_format, LV_STRIDE_AUTO,
+                               buf, buf_size) != LV_RESULT_OK) {
+        LV_LOG_WARN("the buffer of the static layer is too small");
+        lv_memzero(&sl->draw_buf, sizeof(sl->draw_buf));
+    }
+
+    /*Render everything into it on the next refresh*/
+    lv_area_set(&sl->dirty_areas[0], 0, 0, hor_res - 1, ver_res - 1);
+    sl->dirty_cnt = 1;
+}
+
+void lv_display_get_static_layer_stats(lv_display_t * disp, lv_display_static_layer_stats_t * stats, bool reset)
+{
+    LV_ASSERT_NULL(stats);
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) {
+        lv_memzero(stats, sizeof(*stats));
+        return;
+    }
+
+    *stats = disp->static_layer.stats;
+    if(reset) lv_memzero(&disp->static_layer.stats, sizeof(disp->static_layer.stats));
+}
+
+void lv_display_set_occlusion_culling(lv_display_t * disp, bool en)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return;
+
+    disp->occlusion.enabled = en;
+}
+
+void lv_display_get_overdraw_stats(lv_display_t * disp, lv_display_overdraw_stats_t * stats, bool reset)
+{
+    LV_ASSERT_NULL(stats);
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) {
+        lv_memzero(stats, sizeof(*stats));
+        return;
+    }
+
+    *stats = disp->occlusion.stats;
+    if(reset) lv_memzero(&disp->occlusion.stats, sizeof(disp->occlusion.stats));
+}
+
+void lv_display_set_inv_join(lv_display_t * disp, lv_display_inv_join_t join, uint32_t area_cost_px)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return;
+
+    disp->inv_join = join;
+    disp->inv_join_cost_px = area_cost_px;
+}
+
 void lv_display_set_antialiasing(lv_display_t * disp, bool en)
 {
     LV_LOG_WARN("Disabling anti-aliasing is not supported since v9. This function will be removed.");
@@ -78,9 +78,31 @@ typedef enum {
     LV_SCREEN_LOAD_ANIM_OUT_BOTTOM,
 } lv_screen_load_anim_t;
 
+typedef enum {
+    LV_DISPLAY_INV_JOIN_OVERLAP,    /**< Join overlapping areas when the joined area is smaller (the default) */
+    LV_DISPLAY_INV_JOIN_COST,       /**< Join any areas when redrawing the joined area costs less than one more area */
+} lv_display_inv_join_t;
+
 typedef void (*lv_display_flush_cb_t)(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map);
 typedef void (*lv_display_flush_wait_cb_t)(lv_display_t * disp);
 
+typedef struct {
+    uint32_t composited;    /**< Areas drawn over a copy of the static layer */
+    uint32_t fallbacks;     /**< Areas drawn again without it: a static object over an other one */
+    uint32_t renders;       /**< Areas of changed static objects rendered into the static layer */
+    uint32_t rendered_px;   /**< Pixels of these areas */
+} lv_display_static_layer_stats_t;
+
+typedef struct {
+    uint32_t frames;        /**< Refreshes which drew something */
+    uint64_t drawn_px;      /**< Pixels written by the draw tasks and the copies of the static layer */
+    uint64_t flushed_px;    /**< Pixels of the refreshed areas */
+    uint32_t peak_x100;     /**< Highest overdraw (drawn / flushed) of a frame, x100 */
+    uint32_t culled_objs;   /**< Objects drawn without their parts under opaque objects */
+    uint32_t hidden_objs;   /**< Objects not drawn at all: under opaque objects in the whole area */
+    uint32_t flushes;       /**< Areas rendered and flushed */
+} lv_display_overdraw_stats_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -357,6 +379,57 @@ void lv_display_set_tile_cnt(lv_display_t * disp, uint32_t tile_cnt);
  */
 uint32_t lv_display_get_tile_cnt(lv_display_t * disp);
 
+/**
+ * Keep the static objects (`lv_obj_set_static()`) rendered in a screen sized buffer. An invalidated
+ * area starts from a copy of it and only the other objects are drawn. A static object changing,
+ * moving or being deleted renders its area into the buffer again on the next refresh.
+ * A static object drawn over an other object is not in the copy: such areas are drawn normally.
+ * Not used while the display is rotated or a screen load is animated.
+ * @param disp              pointer to a display (NULL to use the default display)
+ * @param buf               the buffer, e.g. in external RAM; NULL: no static layer (the default)
+ * @param buf_size          size of `buf` in bytes, at least the resolution in the color format of the display
+ */
+void lv_display_set_static_layer(lv_display_t * disp, void * buf, uint32_t buf_size);
+
+/**
+ * Get the statistics of the static layer of a display.
+ * @param disp              pointer to a display (NULL to use the default display)
+ * @param stats             filled with the counters since start or since the last reset
+ * @param reset             clear the counters after reading
+ */
+void lv_display_get_static_layer_stats(lv_display_t * disp, lv_display_static_layer_stats_t * stats, bool reset);
+
+/**
+ * Do not draw the parts of the objects hidden by opaque objects drawn after them in the same area,
+ * e.g. the screen under a background image. An object can be drawn in a few rectangles around
+ * the objects over it, or not at all. Objects in layers (opacity, transformations) are not culled,
+ * nor while the display is rotated or a screen load is animated.
+ * @param disp              pointer to a display (NULL to use the default display)
+ * @param en                true: cull the hidden parts; false: draw every object (the default)
+ */
+void lv_display_set_occlusion_culling(lv_display_t * disp, bool en);
+
+/**
+ * Get the overdraw of a display: pixels written by the draw tasks for each pixel refreshed.
+ * Counted with and without occlusion culling.
+ * @param disp              pointer to a display (NULL to use the default display)
+ * @param stats             filled with the counters since start or since the last reset
+ * @param reset             clear the counters after reading
+ */
+void lv_display_get_overdraw_stats(lv_display_t * disp, lv_display_overdraw_stats_t * stats, bool reset);
+
+/**
+ * Set how the invalidated areas are joined before a refresh. `LV_DISPLAY_INV_JOIN_OVERLAP` joins two
+ * overlapping areas when their bounding box is smaller than the two. `LV_DISPLAY_INV_JOIN_COST` joins
+ * any two areas while the bounding box has fewer pixels than the two plus `area_cost_px`: one area
+ * less saves its render and flush overhead, worth `area_cost_px` pixels, e.g. two labels close to each
+ * other are refreshed as one area, the clock and a badge across the screen stay two areas.
+ * @param disp              pointer to a display (NULL to use the default display)
+ * @param join              element of `lv_display_inv_join_t`
+ * @param area_cost_px      the overhead of an area in pixels, used with `LV_DISPLAY_INV_JOIN_COST`
+ */
+void lv_display_set_inv_join(lv_display_t * disp, lv_display_inv_join_t join, uint32_t area_cost_px);
+
 /**
  * Disabling anti-aliasing is not supported since v9. This function will be removed.
  * Enable anti-aliasing for the render engine
@@ -33,6 +33,43 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+typedef enum {
+    LV_DISPLAY_STATIC_PASS_NONE,        /**< Draw every object */
+    LV_DISPLAY_STATIC_PASS_STATIC,      /**< Draw only the static objects, into the static layer */
+    LV_DISPLAY_STATIC_PASS_DYNAMIC,     /**< Draw only the other objects, over a copy of the static layer */
+} lv_display_static_pass_t;
+
+typedef struct {
+    lv_draw_buf_t draw_buf;             /**< The whole screen, `data` NULL: no static layer */
+    lv_area_t dirty_areas[LV_INV_BUF_SIZE]; /**< Static objects changed since they were rendered */
+    uint32_t dirty_cnt;
+    lv_area_t dyn_area;                 /**< Bounding box of what the other objects drew in the dynamic pass */
+    uint32_t all_depth;                 /**< > 0: in a layer of the dynamic pass, draw every object */
+    uint8_t pass;                       /**< Element of `lv_display_static_pass_t` */
+    uint8_t dyn_drawn : 1;              /**< 1: `dyn_area` is set */
+    uint8_t order_error : 1;            /**< 1: a static object is over `dyn_area` */
+    lv_display_static_layer_stats_t stats;
+} lv_display_static_layer_t;
+
+/** Opaque objects kept per area for the occlusion culling */
+#define LV_DISPLAY_OCCLUDER_MAX     16
+
+typedef struct {
+    lv_obj_t * obj;
+    lv_area_t area;                     /**< Part of the area the object covers */
+} lv_display_occluder_t;
+
+typedef struct {
+    lv_layer_t * layer;                 /**< The layer being drawn with `occluders`, NULL: no culling */
+    lv_display_occluder_t occluders[LV_DISPLAY_OCCLUDER_MAX];   /**< In drawing order */
+    uint32_t occluder_cnt;
+    uint32_t occluder_next;             /**< First occluder not drawn yet: it and the next ones are over */
+    uint64_t frame_drawn_px;
+    uint64_t frame_flushed_px;
+    uint8_t enabled : 1;
+    lv_display_overdraw_stats_t stats;
+} lv_display_occlusion_t;
+
 struct _lv_display_t {
 
     /*---------------------
@@ -106,10 +143,18 @@ struct _lv_display_t {
     uint8_t inv_area_joined[LV_INV_BUF_SIZE];
     uint32_t inv_p;
     int32_t inv_en_cnt;
+    uint32_t inv_join_cost_px;      /**< Overhead of an area in pixels, see `lv_display_set_inv_join`*/
+    uint8_t inv_join;               /**< Element of `lv_display_inv_join_t`*/
 
     /** Double buffer sync areas (redrawn during last refresh) */
     lv_ll_t sync_areas;
 
+    /** Static objects rendered once, see `lv_display_set_static_layer`*/
+    lv_display_static_layer_t static_layer;
+
+    /** Opaque objects of the area being drawn and the overdraw, see `lv_display_set_occlusion_culling`*/
+    lv_display_occlusion_t occlusion;
+
     lv_draw_buf_t _static_buf1; /**< Used when user pass in a raw buffer as display draw buffer */
     lv_draw_buf_t _static_buf2;
     /*---------------------
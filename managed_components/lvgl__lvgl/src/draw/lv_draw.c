@@ -14,6 +14,7 @@
 #include "../misc/lv_assert.h"
 #include "../misc/lv_event_private.h"
 #include "lv_draw_private.h"
+#include "lv_draw_pool_private.h"
 #include "lv_draw_mask_private.h"
 #include "lv_draw_vector_private.h"
 #include "lv_draw_3d.h"
@@ -38,6 +39,7 @@
 static bool is_independent(lv_layer_t * layer, lv_draw_task_t * t_check, uint8_t draw_unit_id);
 static void cleanup_task(lv_draw_task_t * t, lv_display_t * disp);
 static inline size_t get_draw_dsc_size(lv_draw_task_type_t type);
+static inline lv_draw_pool_class_t get_draw_pool_class(lv_draw_task_type_t type);
 static lv_draw_task_t * get_first_available_task(lv_layer_t * layer);
 
 #if LV_LOG_LEVEL <= LV_LOG_LEVEL_INFO
@@ -64,6 +66,7 @@ void lv_draw_init(void)
 #if LV_USE_OS
     lv_thread_sync_init(&_draw_info.sync);
 #endif
+    lv_draw_pool_init();
 }
 
 void lv_draw_deinit(void)
@@ -81,6 +84,8 @@ void lv_draw_deinit(void)
         lv_free(cur_unit);
     }
     _draw_info.unit_head = NULL;
+
+    lv_draw_pool_deinit();
 }
 
 void * lv_draw_create_unit(size_t size)
@@ -102,7 +107,8 @@ lv_draw_task_t * lv_draw_add_task(lv_layer_t * layer, const lv_area_t * coords,
     LV_PROFILER_DRAW_BEGIN;
     size_t dsc_size = get_draw_dsc_size(type);
     LV_ASSERT_FORMAT_MSG(dsc_size > 0, "Draw task size is 0 for type %d", type);
-    lv_draw_task_t * new_task = lv_malloc_zeroed(LV_ALIGN_UP(sizeof(lv_draw_task_t), 8) + dsc_size);
+    lv_draw_task_t * new_task = lv_draw_pool_alloc(get_draw_pool_class(type),
+                                                   LV_ALIGN_UP(sizeof(lv_draw_task_t), 8) + dsc_size);
     LV_ASSERT_MALLOC(new_task);
     new_task->area = *coords;
     new_task->_real_area = *coords;
@@ -137,6 +143,21 @@ void lv_draw_finalize_task_creation(lv_layer_t * layer, lv_draw_task_t * t)
     lv_draw_dsc_base_t * base_dsc = t->draw_dsc;
     base_dsc->layer = layer;
 
+    lv_display_t * disp = lv_refr_get_disp_refreshing();
+    lv_area_t drawn_area;
+    if(disp && disp->rendering_in_progress && lv_area_intersect(&drawn_area, &t->_real_area, &t->clip_area)) {
+        /*Pixels written for the overdraw*/
+        disp->occlusion.frame_drawn_px += lv_area_get_size(&drawn_area);
+
+        /*Keep where the objects drawn over the static layer are: a static object there is not in the copy*/
+        if(disp->static_layer.pass == LV_DISPLAY_STATIC_PASS_DYNAMIC) {
+            lv_display_static_layer_t * sl = &disp->static_layer;
+            if(sl->dyn_drawn) lv_area_join(&sl->dyn_area, &sl->dyn_area, &drawn_area);
+            else sl->dyn_area = drawn_area;
+            sl->dyn_drawn = 1;
+        }
+    }
+
     lv_draw_global_info_t * info = &_draw_info;
 
     /*Send LV_EVENT_DRAW_TASK_ADDED and dispatch only on the "main" draw_task
@@ -429,7 +450,7 @@ void lv_layer_reset(lv_layer_t * layer)
 lv_layer_t * lv_draw_layer_create(lv_layer_t * parent_layer, lv_color_format_t color_format, const lv_area_t * area)
 {
     LV_PROFILER_DRAW_BEGIN;
-    lv_layer_t * new_layer = lv_malloc_zeroed(sizeof(lv_layer_t));
+    lv_layer_t * new_layer = lv_draw_pool_alloc(LV_DRAW_POOL_LAYER, sizeof(lv_layer_t));
     LV_ASSERT_MALLOC(new_layer);
     if(new_layer == NULL) {
         LV_PROFILER_DRAW_END;
@@ -498,7 +519,7 @@ void * lv_draw_layer_alloc_buf(lv_layer_t * layer)
     }
 #endif
 
-    layer->draw_buf = lv_draw_buf_create(w, h, layer->color_format, 0);
+    layer->draw_buf = lv_draw_pool_layer_buf_create(w, h, layer->color_format);
 
     if(layer->draw_buf == NULL) {
         LV_LOG_WARN("Allocating layer buffer failed. Try later");
@@ -652,7 +673,7 @@ static void cleanup_task(lv_draw_task_t * t, lv_display_t * disp)
                 LV_LOG_WARN("More layers were freed than allocated");
             }
             LV_LOG_INFO("Layer memory used: %" LV_PRIu32 " kB", get_layer_size_kb(_draw_info.used_memory_for_layers));
-            lv_draw_buf_destroy(layer_drawn->draw_buf);
+            lv_draw_pool_layer_buf_destroy(layer_drawn->draw_buf);
             layer_drawn->draw_buf = NULL;
         }
 
@@ -672,7 +693,7 @@ static void cleanup_task(lv_draw_task_t * t, lv_display_t * disp)
                 disp->layer_deinit(disp, layer_drawn);
                 LV_PROFILER_DRAW_END_TAG("layer_deinit");
             }
-            lv_free(layer_drawn);
+            lv_draw_pool_free(layer_drawn);
         }
     }
     lv_draw_label_dsc_t * draw_label_dsc = lv_draw_task_get_label_dsc(t);
@@ -681,10 +702,32 @@ static void cleanup_task(lv_draw_task_t * t, lv_display_t * disp)
         draw_label_dsc->text = NULL;
     }
 
-    lv_free(t);
+    lv_draw_pool_free(t);
     LV_PROFILER_DRAW_END;
 }
 
+/**
+ * Get the slab of the draw pool of a draw task
+ * @param type      type of the draw task
+ * @return          the slab, `LV_DRAW_POOL_OTHER` for the types which do not fit in it either
+ */
+static inline lv_draw_pool_class_t get_draw_pool_class(lv_draw_task_type_t type)
+{
+    switch(type) {
+        case LV_DRAW_TASK_TYPE_FILL:
+            return LV_DRAW_POOL_FILL;
+        case LV_DRAW_TASK_TYPE_BORDER:
+            return LV_DRAW_POOL_BORDER;
+        case LV_DRAW_TASK_TYPE_LABEL:
+            return LV_DRAW_POOL_LABEL;
+        case LV_DRAW_TASK_TYPE_IMAGE:
+        case LV_DRAW_TASK_TYPE_LAYER:
+            return LV_DRAW_POOL_IMAGE;
+        default:
+            return LV_DRAW_POOL_OTHER;
+    }
+}
+
 static lv_draw_task_t * get_first_available_task(lv_layer_t * layer)
 {
     LV_PROFILER_DRAW_BEGIN;
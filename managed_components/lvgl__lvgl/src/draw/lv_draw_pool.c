@@ -0,0 +1,250 @@
+/**
+ * @file lv_draw_pool.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_pool_private.h"
+#include "lv_draw_private.h"
+#include "lv_draw_rect_private.h"
+#include "lv_draw_label_private.h"
+#include "lv_draw_image_private.h"
+#include "lv_draw_line.h"
+#include "lv_draw_arc.h"
+#include "lv_draw_triangle_private.h"
+#include "lv_draw_mask_private.h"
+#include "../core/lv_global.h"
+#include "../misc/lv_assert.h"
+#include "../misc/lv_math.h"
+#include "../stdlib/lv_mem.h"
+#include "../stdlib/lv_string.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define _pool               LV_GLOBAL_DEFAULT()->draw_pool
+
+/*Class of a task or layer in front of it: a slab or `lv_malloc` (`LV_DRAW_POOL_CNT`)*/
+#define SLOT_HEADER         8
+#define CHUNK_HEADER        LV_ALIGN_UP(sizeof(lv_draw_pool_chunk_t), 8)
+#define TASK_SLOT(dsc_size) (SLOT_HEADER + LV_ALIGN_UP(sizeof(lv_draw_task_t), 8) + (dsc_size))
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+struct _lv_draw_pool_chunk_t {
+    lv_draw_pool_chunk_t * next;
+};
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void * slot_get(lv_draw_pool_slab_t * slab);
+static void slot_put(lv_draw_pool_slab_t * slab, void * slot);
+static bool slab_grow(lv_draw_pool_slab_t * slab);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_draw_pool_init(void)
+{
+    lv_mutex_init(&_pool.lock);
+    _pool.malloc_cb = lv_malloc;
+    _pool.free_cb = lv_free;
+
+    lv_draw_pool_slab_t * slabs = _pool.slabs;
+    slabs[LV_DRAW_POOL_FILL].slot_size = TASK_SLOT(sizeof(lv_draw_fill_dsc_t));
+    slabs[LV_DRAW_POOL_BORDER].slot_size = TASK_SLOT(sizeof(lv_draw_border_dsc_t));
+    slabs[LV_DRAW_POOL_LABEL].slot_size = TASK_SLOT(sizeof(lv_draw_label_dsc_t));
+    slabs[LV_DRAW_POOL_IMAGE].slot_size = TASK_SLOT(sizeof(lv_draw_image_dsc_t));
+    size_t other = LV_MAX(sizeof(lv_draw_box_shadow_dsc_t), sizeof(lv_draw_letter_dsc_t));
+    other = LV_MAX(other, LV_MAX(sizeof(lv_draw_line_dsc_t), sizeof(lv_draw_arc_dsc_t)));
+    other = LV_MAX(other, LV_MAX(sizeof(lv_draw_triangle_dsc_t), sizeof(lv_draw_mask_rect_dsc_t)));
+    slabs[LV_DRAW_POOL_OTHER].slot_size = TASK_SLOT(other);
+    slabs[LV_DRAW_POOL_LAYER].slot_size = SLOT_HEADER + LV_DRAW_POOL_LAYER_SLOT_CNT * sizeof(lv_layer_t);
+    /*The draw buffer, then its data aligned as any draw buffer*/
+    slabs[LV_DRAW_POOL_LAYER_BUF].slot_size = LV_ALIGN_UP(sizeof(lv_draw_buf_t) + LV_DRAW_LAYER_SIMPLE_BUF_SIZE +
+                                                          LV_DRAW_BUF_ALIGN - 1, 8);
+
+    uint32_t i;
+    for(i = 0; i < LV_DRAW_POOL_CNT; i++) {
+        slabs[i].slot_size = LV_ALIGN_UP(slabs[i].slot_size, 8);
+        slabs[i].chunk_slots = 8;
+    }
+    slabs[LV_DRAW_POOL_LAYER].chunk_slots = 4;
+    slabs[LV_DRAW_POOL_LAYER_BUF].chunk_slots = 1;
+}
+
+void lv_draw_pool_deinit(void)
+{
+    lv_draw_pool_set_size(0, NULL, NULL);
+    lv_mutex_delete(&_pool.lock);
+}
+
+void lv_draw_pool_set_size(uint32_t size, void * (*malloc_cb)(size_t size), void (*free_cb)(void * p))
+{
+    lv_mutex_lock(&_pool.lock);
+    uint32_t i;
+    for(i = 0; i < LV_DRAW_POOL_CNT; i++) {
+        lv_draw_pool_slab_t * slab = &_pool.slabs[i];
+        if(slab->stats.used) {
+            LV_LOG_WARN("slots of the draw pool are in use, not resized");
+            lv_mutex_unlock(&_pool.lock);
+            return;
+        }
+    }
+
+    /*The chunks were allocated by the previous allocator*/
+    for(i = 0; i < LV_DRAW_POOL_CNT; i++) {
+        lv_draw_pool_slab_t * slab = &_pool.slabs[i];
+        while(slab->chunks) {
+            lv_draw_pool_chunk_t * next = slab->chunks->next;
+            _pool.free_cb(slab->chunks);
+            slab->chunks = next;
+        }
+        slab->free_head = NULL;
+        slab->stats.slots = 0;
+    }
+    _pool.used_size = 0;
+    _pool.size = size;
+    _pool.malloc_cb = malloc_cb ? malloc_cb : lv_malloc;
+    _pool.free_cb = free_cb ? free_cb : lv_free;
+    lv_mutex_unlock(&_pool.lock);
+}
+
+void lv_draw_pool_get_stats(lv_draw_pool_class_t cls, lv_draw_pool_stats_t * stats, bool reset)
+{
+    LV_ASSERT_NULL(stats);
+    LV_ASSERT(cls < LV_DRAW_POOL_CNT);
+    lv_draw_pool_slab_t * slab = &_pool.slabs[cls];
+    lv_mutex_lock(&_pool.lock);
+    *stats = slab->stats;
+    if(reset) {
+        slab->stats.hits = 0;
+        slab->stats.fallbacks = 0;
+        slab->stats.peak = slab->stats.used;
+    }
+    lv_mutex_unlock(&_pool.lock);
+}
+
+void * lv_draw_pool_alloc(lv_draw_pool_class_t cls, size_t size)
+{
+    lv_draw_pool_slab_t * slab = &_pool.slabs[cls];
+    uint8_t * slot = NULL;
+    lv_mutex_lock(&_pool.lock);
+    if(SLOT_HEADER + size <= slab->slot_size) slot = slot_get(slab);
+    if(slot == NULL) slab->stats.fallbacks++;
+    lv_mutex_unlock(&_pool.lock);
+
+    if(slot == NULL) {
+        slot = lv_malloc(SLOT_HEADER + size);
+        if(slot == NULL) return NULL;
+        cls = LV_DRAW_POOL_CNT;
+    }
+    slot[0] = (uint8_t)cls;
+    lv_memzero(slot + SLOT_HEADER, size);
+    return slot + SLOT_HEADER;
+}
+
+void lv_draw_pool_free(void * p)
+{
+    if(p == NULL) return;
+
+    uint8_t * slot = (uint8_t *)p - SLOT_HEADER;
+    if(slot[0] == LV_DRAW_POOL_CNT) {
+        lv_free(slot);
+        return;
+    }
+    lv_mutex_lock(&_pool.lock);
+    slot_put(&_pool.slabs[slot[0]], slot);
+    lv_mutex_unlock(&_pool.lock);
+}
+
+lv_draw_buf_t * lv_draw_pool_layer_buf_create(uint32_t w, uint32_t h, lv_color_format_t cf)
+{
+    uint32_t stride = lv_draw_buf_width_to_stride(w, cf);
+    lv_draw_pool_slab_t * slab = &_pool.slabs[LV_DRAW_POOL_LAYER_BUF];
+    lv_draw_buf_t * draw_buf = NULL;
+    lv_mutex_lock(&_pool.lock);
+    if(stride * h <= LV_DRAW_LAYER_SIMPLE_BUF_SIZE) draw_buf = slot_get(slab);
+    if(draw_buf == NULL) slab->stats.fallbacks++;
+    lv_mutex_unlock(&_pool.lock);
+
+    if(draw_buf == NULL) return lv_draw_buf_create(w, h, cf, stride);
+
+    /*Not flagged as allocated: that is how the slot is told from a created buffer*/
+    void * data = lv_draw_buf_align((uint8_t *)draw_buf + sizeof(lv_draw_buf_t), cf);
+    lv_draw_buf_init(draw_buf, w, h, cf, stride, data, stride * h);
+    return draw_buf;
+}
+
+void lv_draw_pool_layer_buf_destroy(lv_draw_buf_t * draw_buf)
+{
+    if(draw_buf->header.flags & LV_IMAGE_FLAGS_ALLOCATED) {
+        lv_draw_buf_destroy(draw_buf);
+        return;
+    }
+    lv_mutex_lock(&_pool.lock);
+    slot_put(&_pool.slabs[LV_DRAW_POOL_LAYER_BUF], draw_buf);
+    lv_mutex_unlock(&_pool.lock);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * A free slot of the slab, from a new chunk if there is none and the budget allows it
+ */
+static void * slot_get(lv_draw_pool_slab_t * slab)
+{
+    if(slab->free_head == NULL && !slab_grow(slab)) return NULL;
+
+    void * slot = slab->free_head;
+    slab->free_head = *(void **)slot;
+    slab->stats.hits++;
+    slab->stats.used++;
+    if(slab->stats.used > slab->stats.peak) slab->stats.peak = slab->stats.used;
+    return slot;
+}
+
+static void slot_put(lv_draw_pool_slab_t * slab, void * slot)
+{
+    *(void **)slot = slab->free_head;
+    slab->free_head = slot;
+    slab->stats.used--;
+}
+
+static bool slab_grow(lv_draw_pool_slab_t * slab)
+{
+    uint32_t chunk_size = CHUNK_HEADER + slab->chunk_slots * slab->slot_size;
+    if(_pool.used_size + chunk_size > _pool.size) return false;
+
+    lv_draw_pool_chunk_t * chunk = _pool.malloc_cb(chunk_size);
+    if(chunk == NULL) return false;
+    chunk->next = slab->chunks;
+    slab->chunks = chunk;
+    _pool.used_size += chunk_size;
+
+    uint8_t * slot = (uint8_t *)chunk + CHUNK_HEADER;
+    uint32_t i;
+    for(i = 0; i < slab->chunk_slots; i++) {
+        *(void **)slot = slab->free_head;
+        slab->free_head = slot;
+        slot += slab->slot_size;
+    }
+    slab->stats.slots += slab->chunk_slots;
+    return true;
+}
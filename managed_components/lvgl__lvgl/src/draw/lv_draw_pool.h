@@ -0,0 +1,77 @@
+/**
+ * @file lv_draw_pool.h
+ *
+ */
+
+#ifndef LV_DRAW_POOL_H
+#define LV_DRAW_POOL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../misc/lv_types.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef enum {
+    LV_DRAW_POOL_FILL,          /**< Fill draw tasks */
+    LV_DRAW_POOL_BORDER,        /**< Border draw tasks */
+    LV_DRAW_POOL_LABEL,         /**< Label draw tasks */
+    LV_DRAW_POOL_IMAGE,         /**< Image and layer draw tasks */
+    LV_DRAW_POOL_OTHER,         /**< Box shadow, letter, line, arc, triangle and mask draw tasks */
+    LV_DRAW_POOL_LAYER,         /**< Layers of the objects, and the tile layers of a refreshed area */
+    LV_DRAW_POOL_LAYER_BUF,     /**< Layer buffers up to `LV_DRAW_LAYER_SIMPLE_BUF_SIZE` bytes */
+    LV_DRAW_POOL_CNT,
+} lv_draw_pool_class_t;
+
+typedef struct {
+    uint32_t hits;          /**< Allocations taken from a slot */
+    uint32_t fallbacks;     /**< Allocations left to `lv_malloc`: no pool, too large, or no slot and no budget */
+    uint32_t used;          /**< Slots in use */
+    uint32_t peak;          /**< Most slots in use at once */
+    uint32_t slots;         /**< Slots of the slabs */
+} lv_draw_pool_stats_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Allocate the draw tasks, the layers and the small layer buffers from slabs of fixed size slots,
+ * one slab per `lv_draw_pool_class_t`, instead of `lv_malloc`. A slab takes a chunk of slots
+ * from `malloc_cb` when it has no free slot, while the chunks fit in `size`. The slots freed
+ * at the end of a frame are used by the next ones; the chunks are kept until the pool is resized.
+ * Call it with the LVGL lock held, between two refreshes.
+ * @param size          bytes of all the chunks, 0: no pool (the default)
+ * @param malloc_cb     allocator of the chunks, e.g. in internal RAM out of the LVGL heap (NULL: `lv_malloc`)
+ * @param free_cb       free of `malloc_cb` (NULL: `lv_free`)
+ */
+void lv_draw_pool_set_size(uint32_t size, void * (*malloc_cb)(size_t size), void (*free_cb)(void * p));
+
+/**
+ * Get the statistics of a slab of the draw pool.
+ * @param cls           element of `lv_draw_pool_class_t`
+ * @param stats         filled with the counters since start or since the last reset, and the slots
+ * @param reset         clear the counters after reading
+ */
+void lv_draw_pool_get_stats(lv_draw_pool_class_t cls, lv_draw_pool_stats_t * stats, bool reset);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_DRAW_POOL_H*/
@@ -0,0 +1,99 @@
+/**
+ * @file lv_draw_pool_private.h
+ *
+ */
+
+#ifndef LV_DRAW_POOL_PRIVATE_H
+#define LV_DRAW_POOL_PRIVATE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_pool.h"
+#include "lv_draw_buf.h"
+#include "../osal/lv_os_private.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+/** Layers in a slot of `LV_DRAW_POOL_LAYER`: the tiles of an area drawn by every SW draw unit */
+#if LV_USE_DRAW_SW
+#define LV_DRAW_POOL_LAYER_SLOT_CNT     LV_DRAW_SW_DRAW_UNIT_CNT
+#else
+#define LV_DRAW_POOL_LAYER_SLOT_CNT     1
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct _lv_draw_pool_chunk_t lv_draw_pool_chunk_t;
+
+typedef struct {
+    void * free_head;               /**< Free slots, linked through their first word */
+    lv_draw_pool_chunk_t * chunks;
+    uint32_t slot_size;             /**< Bytes of a slot, its header included */
+    uint32_t chunk_slots;
+    lv_draw_pool_stats_t stats;
+} lv_draw_pool_slab_t;
+
+typedef struct {
+    lv_mutex_t lock;
+    lv_draw_pool_slab_t slabs[LV_DRAW_POOL_CNT];
+    uint32_t size;                  /**< Budget of the chunks */
+    uint32_t used_size;             /**< Bytes of the allocated chunks */
+    void * (*malloc_cb)(size_t size);
+    void (*free_cb)(void * p);
+} lv_draw_pool_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+void lv_draw_pool_init(void);
+
+void lv_draw_pool_deinit(void);
+
+/**
+ * Allocate zeroed memory from a slab, or with `lv_malloc` when it does not fit or no slot is left
+ * @param cls           the slab, element of `lv_draw_pool_class_t`
+ * @param size          bytes to allocate
+ * @return              the memory, released with `lv_draw_pool_free`, or NULL
+ */
+void * lv_draw_pool_alloc(lv_draw_pool_class_t cls, size_t size);
+
+/**
+ * Release the memory of `lv_draw_pool_alloc`
+ * @param p             the memory, NULL is ignored
+ */
+void lv_draw_pool_free(void * p);
+
+/**
+ * Create the buffer of a layer in a slot of `LV_DRAW_POOL_LAYER_BUF`, or with `lv_draw_buf_create`
+ * when it is larger than `LV_DRAW_LAYER_SIMPLE_BUF_SIZE` or no slot is left
+ * @param w             width in pixels
+ * @param h             height in pixels
+ * @param cf            color format of the layer
+ * @return              the draw buffer, released with `lv_draw_pool_layer_buf_destroy`, or NULL
+ */
+lv_draw_buf_t * lv_draw_pool_layer_buf_create(uint32_t w, uint32_t h, lv_color_format_t cf);
+
+/**
+ * Release the buffer of `lv_draw_pool_layer_buf_create`
+ * @param draw_buf      the draw buffer
+ */
+void lv_draw_pool_layer_buf_destroy(lv_draw_buf_t * draw_buf);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_DRAW_POOL_PRIVATE_H*/
@@ -857,8 +857,31 @@ static void LV_ATTRIBUTE_FAST_MEM rgb565_image_blend(lv_draw_sw_blend_image_dsc_
         }
         else if(mask_buf && opa >= LV_OPA_MAX) {
             if(LV_RESULT_INVALID == LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_WITH_MASK(dsc)) {
+                /*The mask is mostly 0x00 or 0xFF (e.g. the alpha map of RGB565A8 images)
+                 *so check 4 mask bytes at once and skip or copy those pixels without mixing*/
                 for(y = 0; y < h; y++) {
-                    for(x = 0; x < w; x++) {
+                    x = 0;
+                    for(; x < w && ((lv_uintptr_t)&mask_buf[x] & 0x3); x++) {
+                        dest_buf_u16[x] = lv_color_16_16_mix(src_buf_u16[x], dest_buf_u16[x], mask_buf[x]);
+                    }
+
+                    for(; x < w - 3; x += 4) {
+                        uint32_t mask32 = *(const uint32_t *)&mask_buf[x];
+                        if(mask32 == 0x00000000) continue;
+                        if(mask32 == 0xFFFFFFFF) {
+                            dest_buf_u16[x + 0] = src_buf_u16[x + 0];
+                            dest_buf_u16[x + 1] = src_buf_u16[x + 1];
+                            dest_buf_u16[x + 2] = src_buf_u16[x + 2];
+                            dest_buf_u16[x + 3] = src_buf_u16[x + 3];
+                            continue;
+                        }
+                        dest_buf_u16[x + 0] = lv_color_16_16_mix(src_buf_u16[x + 0], dest_buf_u16[x + 0], mask_buf[x + 0]);
+                        dest_buf_u16[x + 1] = lv_color_16_16_mix(src_buf_u16[x + 1], dest_buf_u16[x + 1], mask_buf[x + 1]);
+                        dest_buf_u16[x + 2] = lv_color_16_16_mix(src_buf_u16[x + 2], dest_buf_u16[x + 2], mask_buf[x + 2]);
+                        dest_buf_u16[x + 3] = lv_color_16_16_mix(src_buf_u16[x + 3], dest_buf_u16[x + 3], mask_buf[x + 3]);
+                    }
+
+                    for(; x < w; x++) {
                         dest_buf_u16[x] = lv_color_16_16_mix(src_buf_u16[x], dest_buf_u16[x], mask_buf[x]);
                     }
                     dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
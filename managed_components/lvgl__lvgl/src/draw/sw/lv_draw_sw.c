@@ -77,6 +77,7 @@ void lv_draw_sw_init(void)
 
 #if LV_DRAW_SW_COMPLEX == 1
     lv_draw_sw_mask_init();
+    lv_draw_sw_corner_cache_init();
 #endif
 
     lv_draw_sw_unit_t * draw_sw_unit = lv_draw_create_unit(sizeof(lv_draw_sw_unit_t));
@@ -95,8 +96,14 @@ void lv_draw_sw_init(void)
         lv_draw_sw_thread_dsc_t * thread_dsc = &draw_sw_unit->thread_dscs[i];
         thread_dsc->idx = i;
         thread_dsc->draw_unit = (void *) draw_sw_unit;
+#if LV_USE_OS == LV_OS_FREERTOS
+        /*One draw unit per core, whatever other threads were created before*/
+        lv_thread_init_pinned(&thread_dsc->thread, "swdraw", LV_DRAW_THREAD_PRIO, render_thread_cb,
+                              LV_DRAW_THREAD_STACK_SIZE, (int32_t)i, thread_dsc);
+#else
         lv_thread_init(&thread_dsc->thread, "swdraw", LV_DRAW_THREAD_PRIO, render_thread_cb,
                        LV_DRAW_THREAD_STACK_SIZE, thread_dsc);
+#endif
     }
 #endif
 
@@ -119,6 +126,7 @@ void lv_draw_sw_deinit(void)
 #endif
 
 #if LV_DRAW_SW_COMPLEX == 1
+    lv_draw_sw_corner_cache_deinit();
     lv_draw_sw_mask_deinit();
 #endif
 }
@@ -347,6 +355,7 @@ static void render_thread_cb(void * ptr)
     lv_draw_sw_thread_dsc_t * thread_dsc = ptr;
 
     lv_thread_sync_init(&thread_dsc->sync);
+    lv_mem_set_tag(LV_MEM_TAG_DRAW);
     thread_dsc->inited = true;
 
     while(1) {
@@ -33,6 +33,21 @@ extern "C" {
  *      DEFINES
  *********************/
 
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+#if LV_DRAW_SW_COMPLEX
+typedef struct {
+    uint32_t hits;          /**< Corners drawn from the cache */
+    uint32_t misses;        /**< Corners computed and added to the cache */
+    uint32_t uncached;      /**< Corners drawn without the cache: disabled, or full of corners in use */
+    uint32_t evictions;     /**< Corners removed to make room */
+    uint32_t entries;       /**< Corners in the cache */
+    uint32_t size;          /**< Bytes of the corners in the cache */
+} lv_draw_sw_corner_cache_stats_t;
+#endif
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -180,6 +195,26 @@ bool lv_draw_sw_unregister_blend_handler(lv_color_format_t dest_cf);
  */
 lv_draw_sw_blend_handler_t lv_draw_sw_get_blend_handler(lv_color_format_t dest_cf);
 
+#if LV_DRAW_SW_COMPLEX
+/**
+ * Keep the antialiased corners of the plain filled rounded rectangles, per radius and opacity.
+ * A cached row of a corner blends only its antialiased pixels through a mask, the rest of the row
+ * is filled. Least recently used corners are removed to stay in `size`.
+ * Call it with the LVGL lock held.
+ * @param size          bytes of corners to keep, 0: no cache (the default)
+ * @param malloc_cb     allocator of the corners, e.g. in external RAM (NULL: `lv_malloc`)
+ * @param free_cb       free of `malloc_cb` (NULL: `lv_free`)
+ */
+void lv_draw_sw_corner_cache_set_size(uint32_t size, void * (*malloc_cb)(size_t size), void (*free_cb)(void * p));
+
+/**
+ * Get the statistics of the corner cache.
+ * @param stats         filled with the counters since start or since the last reset, and the content
+ * @param reset         clear the counters after reading
+ */
+void lv_draw_sw_corner_cache_get_stats(lv_draw_sw_corner_cache_stats_t * stats, bool reset);
+#endif
+
 /***********************
  * GLOBAL VARIABLES
  ***********************/
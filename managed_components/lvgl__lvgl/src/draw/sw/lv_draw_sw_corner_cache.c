@@ -0,0 +1,257 @@
+/**
+ * @file lv_draw_sw_corner_cache.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_sw_private.h"
+#include "lv_draw_sw_mask_private.h"
+
+#if LV_USE_DRAW_SW && LV_DRAW_SW_COMPLEX
+#include "../../core/lv_global.h"
+#include "../../misc/lv_assert.h"
+#include "../../misc/lv_math.h"
+#include "../../stdlib/lv_mem.h"
+#include "../../stdlib/lv_string.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define _corner_cache   LV_GLOBAL_DEFAULT()->sw_corner_cache
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static lv_draw_sw_corner_t * corner_create(int32_t radius, lv_opa_t opa);
+static void corner_row_span(const lv_opa_t * mask, int32_t len, int32_t step, lv_opa_t opa,
+                            uint16_t * start, uint16_t * span_len);
+static void corner_delete(uint32_t i);
+static bool corner_make_room(uint32_t size);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_draw_sw_corner_cache_init(void)
+{
+    lv_mutex_init(&_corner_cache.lock);
+}
+
+void lv_draw_sw_corner_cache_deinit(void)
+{
+    lv_draw_sw_corner_cache_set_size(0, NULL, NULL);
+    lv_mutex_delete(&_corner_cache.lock);
+}
+
+void lv_draw_sw_corner_cache_set_size(uint32_t size, void * (*malloc_cb)(size_t size), void (*free_cb)(void * p))
+{
+    lv_mutex_lock(&_corner_cache.lock);
+    /*The corners were allocated by the previous allocator*/
+    uint32_t i;
+    for(i = 0; i < LV_DRAW_SW_CORNER_CACHE_CNT; i++) {
+        if(_corner_cache.entries[i]) corner_delete(i);
+    }
+    _corner_cache.size_max = size;
+    _corner_cache.malloc_cb = malloc_cb ? malloc_cb : lv_malloc;
+    _corner_cache.free_cb = free_cb ? free_cb : lv_free;
+    lv_mutex_unlock(&_corner_cache.lock);
+}
+
+void lv_draw_sw_corner_cache_get_stats(lv_draw_sw_corner_cache_stats_t * stats, bool reset)
+{
+    LV_ASSERT_NULL(stats);
+    lv_mutex_lock(&_corner_cache.lock);
+    *stats = _corner_cache.stats;
+    stats->entries = 0;
+    uint32_t i;
+    for(i = 0; i < LV_DRAW_SW_CORNER_CACHE_CNT; i++) {
+        if(_corner_cache.entries[i]) stats->entries++;
+    }
+    stats->size = _corner_cache.size;
+    if(reset) lv_memzero(&_corner_cache.stats, sizeof(_corner_cache.stats));
+    lv_mutex_unlock(&_corner_cache.lock);
+}
+
+lv_draw_sw_corner_t * lv_draw_sw_corner_cache_get(int32_t radius, lv_opa_t opa)
+{
+    lv_mutex_lock(&_corner_cache.lock);
+    _corner_cache.tick++;
+
+    uint32_t i;
+    for(i = 0; i < LV_DRAW_SW_CORNER_CACHE_CNT; i++) {
+        lv_draw_sw_corner_t * corner = _corner_cache.entries[i];
+        if(corner && corner->radius == radius && corner->opa == opa) {
+            corner->used_cnt++;
+            corner->last_used = _corner_cache.tick;
+            _corner_cache.stats.hits++;
+            lv_mutex_unlock(&_corner_cache.lock);
+            return corner;
+        }
+    }
+
+    lv_draw_sw_corner_t * corner = NULL;
+    if(_corner_cache.size_max > 0) corner = corner_create(radius, opa);
+    if(corner == NULL) {
+        _corner_cache.stats.uncached++;
+        lv_mutex_unlock(&_corner_cache.lock);
+        return NULL;
+    }
+
+    for(i = 0; i < LV_DRAW_SW_CORNER_CACHE_CNT; i++) {
+        if(_corner_cache.entries[i] == NULL) break;
+    }
+    _corner_cache.entries[i] = corner;
+    _corner_cache.size += corner->size;
+    corner->used_cnt = 1;
+    corner->last_used = _corner_cache.tick;
+    _corner_cache.stats.misses++;
+    lv_mutex_unlock(&_corner_cache.lock);
+    return corner;
+}
+
+void lv_draw_sw_corner_cache_release(lv_draw_sw_corner_t * corner)
+{
+    lv_mutex_lock(&_corner_cache.lock);
+    corner->used_cnt--;
+    lv_mutex_unlock(&_corner_cache.lock);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Compute the corners with the radius mask of LVGL on a rectangle with a covered middle column.
+ * The mask of a corner pixel only depends on its distance to the edges, so it is the same
+ * for every rectangle with this radius.
+ */
+static lv_draw_sw_corner_t * corner_create(int32_t radius, lv_opa_t opa)
+{
+    const int32_t w = 2 * radius + 2;
+    const int32_t half = w / 2;
+    lv_area_t rect = {0, 0, w - 1, w - 1};
+
+    lv_opa_t * line = lv_malloc(w);
+    LV_ASSERT_MALLOC(line);
+    if(line == NULL) return NULL;
+    lv_draw_sw_mask_radius_param_t param;
+    lv_draw_sw_mask_radius_init(&param, &rect, radius, false);
+    void * masks[2] = {&param, NULL};
+
+    /*Count the antialiased pixels first: one allocation per corner*/
+    lv_draw_sw_corner_row_t * rows = NULL;
+    lv_draw_sw_corner_t * corner = NULL;
+    uint32_t aa_cnt = 0;
+    uint32_t pass;
+    for(pass = 0; pass < 2; pass++) {
+        uint32_t ofs = 0;
+        int32_t h;
+        for(h = 0; h < radius; h++) {
+            lv_memset(line, opa, w);
+            lv_draw_sw_mask_res_t res = lv_draw_sw_mask_apply(masks, line, 0, h, w);
+            if(res == LV_DRAW_SW_MASK_RES_TRANSP) lv_memzero(line, w);
+
+            lv_draw_sw_corner_row_t row;
+            corner_row_span(line, half, 1, opa, &row.l_start, &row.l_len);
+            corner_row_span(line + w - 1, half, -1, opa, &row.r_start, &row.r_len);
+            row.ofs = ofs;
+            if(pass == 1) {
+                rows[h] = row;
+                lv_memcpy(corner->aa + ofs, line + row.l_start, row.l_len);
+                lv_memcpy(corner->aa + ofs + row.l_len, line + w - row.r_start - row.r_len, row.r_len);
+            }
+            ofs += row.l_len + row.r_len;
+        }
+        if(pass == 1) break;
+
+        aa_cnt = ofs;
+        uint32_t size = sizeof(lv_draw_sw_corner_t) + radius * sizeof(lv_draw_sw_corner_row_t) + aa_cnt;
+        if(!corner_make_room(size)) break;
+        lv_mem_tag_t mem_tag = lv_mem_set_tag(LV_MEM_TAG_CACHE);
+        corner = _corner_cache.malloc_cb(size);
+        lv_mem_set_tag(mem_tag);
+        if(corner == NULL) break;
+        lv_memzero(corner, sizeof(lv_draw_sw_corner_t));
+        corner->radius = radius;
+        corner->opa = opa;
+        corner->size = size;
+        rows = (lv_draw_sw_corner_row_t *)(corner + 1);
+        corner->rows = rows;
+        corner->aa = (lv_opa_t *)(rows + radius);
+    }
+
+    lv_draw_sw_mask_free_param(&param);
+    lv_free(line);
+    return corner;
+}
+
+/**
+ * Transparent pixels from an edge, then the antialiased pixels up to the last one not covered
+ * in the half of the row
+ */
+static void corner_row_span(const lv_opa_t * mask, int32_t len, int32_t step, lv_opa_t opa,
+                            uint16_t * start, uint16_t * span_len)
+{
+    int32_t i = 0;
+    while(i < len && mask[i * step] == 0) i++;
+    int32_t end = i;
+    int32_t k;
+    for(k = i; k < len; k++) {
+        if(mask[k * step] != opa) end = k + 1;
+    }
+    *start = (uint16_t)i;
+    *span_len = (uint16_t)(end - i);
+}
+
+static void corner_delete(uint32_t i)
+{
+    lv_draw_sw_corner_t * corner = _corner_cache.entries[i];
+    _corner_cache.size -= corner->size;
+    _corner_cache.entries[i] = NULL;
+    _corner_cache.free_cb(corner);
+}
+
+/**
+ * Remove the least recently used corners not in use until `size` more bytes and an entry are free
+ */
+static bool corner_make_room(uint32_t size)
+{
+    if(size > _corner_cache.size_max) return false;
+
+    while(true) {
+        uint32_t free_cnt = 0;
+        lv_draw_sw_corner_t * lru = NULL;
+        uint32_t lru_i = 0;
+        uint32_t i;
+        for(i = 0; i < LV_DRAW_SW_CORNER_CACHE_CNT; i++) {
+            lv_draw_sw_corner_t * corner = _corner_cache.entries[i];
+            if(corner == NULL) {
+                free_cnt++;
+            }
+            else if(corner->used_cnt == 0 && (lru == NULL || corner->last_used < lru->last_used)) {
+                lru = corner;
+                lru_i = i;
+            }
+        }
+        if(free_cnt > 0 && _corner_cache.size + size <= _corner_cache.size_max) return true;
+        if(lru == NULL) return false;
+        corner_delete(lru_i);
+        _corner_cache.stats.evictions++;
+    }
+}
+
+#endif /*LV_USE_DRAW_SW && LV_DRAW_SW_COMPLEX*/
@@ -14,6 +14,7 @@
 
 #include "blend/lv_draw_sw_blend_private.h"
 #include "lv_draw_sw_grad.h"
+#include "lv_draw_sw_private.h"
 #include "../../misc/lv_math.h"
 #include "../../misc/lv_text_ap.h"
 #include "../../core/lv_refr.h"
@@ -32,6 +33,10 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+#if LV_DRAW_SW_COMPLEX
+static void fill_corner_row(lv_draw_task_t * t, lv_draw_sw_blend_dsc_t * blend_dsc, const lv_draw_sw_corner_t * corner,
+                            int32_t h, int32_t y, const lv_area_t * coords, lv_opa_t opa);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -81,6 +86,32 @@ void lv_draw_sw_fill(lv_draw_task_t * t, lv_draw_fill_dsc_t * dsc, const lv_area
     int32_t short_side = LV_MIN(coords_bg_w, coords_bg_h);
     int32_t rout = LV_MIN(dsc->radius, short_side >> 1);
 
+    /*Plain color: the corners can come from the corner cache*/
+    if(rout > 0 && grad_dir == LV_GRAD_DIR_NONE) {
+        lv_draw_sw_corner_t * corner = lv_draw_sw_corner_cache_get(rout, opa);
+        if(corner) {
+            int32_t h;
+            for(h = 0; h < rout; h++) {
+                int32_t top_y = bg_coords.y1 + h;
+                int32_t bottom_y = bg_coords.y2 - h;
+                if(top_y >= clipped_coords.y1 && top_y <= clipped_coords.y2) {
+                    fill_corner_row(t, &blend_dsc, corner, h, top_y, &bg_coords, opa);
+                }
+                if(bottom_y >= clipped_coords.y1 && bottom_y <= clipped_coords.y2) {
+                    fill_corner_row(t, &blend_dsc, corner, h, bottom_y, &bg_coords, opa);
+                }
+            }
+            lv_draw_sw_corner_cache_release(corner);
+
+            lv_area_t center_area = {clipped_coords.x1, bg_coords.y1 + rout, clipped_coords.x2, bg_coords.y2 - rout};
+            blend_dsc.blend_area = &center_area;
+            blend_dsc.mask_buf = NULL;
+            blend_dsc.opa = opa;
+            lv_draw_sw_blend(t, &blend_dsc);
+            return;
+        }
+    }
+
     /*Add a radius mask if there is a radius*/
     int32_t clipped_w = lv_area_get_width(&clipped_coords);
     lv_opa_t * mask_buf = NULL;
@@ -347,4 +378,47 @@ void lv_draw_sw_fill(lv_draw_task_t * t, lv_draw_fill_dsc_t * dsc, const lv_area
 #endif
 }
 
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#if LV_DRAW_SW_COMPLEX
+/**
+ * A row of the corners: only the antialiased pixels are blended with a mask, covered in between
+ */
+static void fill_corner_row(lv_draw_task_t * t, lv_draw_sw_blend_dsc_t * blend_dsc, const lv_draw_sw_corner_t * corner,
+                            int32_t h, int32_t y, const lv_area_t * coords, lv_opa_t opa)
+{
+    const lv_draw_sw_corner_row_t * row = &corner->rows[h];
+    lv_area_t area;
+    area.y1 = y;
+    area.y2 = y;
+    blend_dsc->blend_area = &area;
+    blend_dsc->mask_area = &area;
+    blend_dsc->mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
+    blend_dsc->opa = LV_OPA_COVER;
+
+    if(row->l_len) {
+        area.x1 = coords->x1 + row->l_start;
+        area.x2 = area.x1 + row->l_len - 1;
+        blend_dsc->mask_buf = corner->aa + row->ofs;
+        lv_draw_sw_blend(t, blend_dsc);
+    }
+    if(row->r_len) {
+        area.x2 = coords->x2 - row->r_start;
+        area.x1 = area.x2 - row->r_len + 1;
+        blend_dsc->mask_buf = corner->aa + row->ofs + row->l_len;
+        lv_draw_sw_blend(t, blend_dsc);
+    }
+
+    area.x1 = coords->x1 + row->l_start + row->l_len;
+    area.x2 = coords->x2 - row->r_start - row->r_len;
+    if(area.x1 <= area.x2) {
+        blend_dsc->mask_buf = NULL;
+        blend_dsc->opa = opa;
+        lv_draw_sw_blend(t, blend_dsc);
+    }
+}
+#endif
+
 #endif /*LV_USE_DRAW_SW*/
@@ -23,6 +23,9 @@ extern "C" {
  *      DEFINES
  *********************/
 
+/** Corners kept at most by the corner cache (radius and opacity pairs) */
+#define LV_DRAW_SW_CORNER_CACHE_CNT 16
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -58,10 +61,58 @@ typedef struct {
 } lv_draw_sw_shadow_cache_t;
 #endif
 
+#if LV_DRAW_SW_COMPLEX
+/** Top row of a corner: the same for the bottom row at the same distance from the edge */
+typedef struct {
+    uint16_t l_start;       /**< Transparent pixels from x1 */
+    uint16_t l_len;         /**< Antialiased pixels after them, covered up to the right ones */
+    uint16_t r_start;       /**< Transparent pixels from x2 */
+    uint16_t r_len;         /**< Antialiased pixels before them */
+    uint32_t ofs;           /**< Index of the row's left then right antialiased pixels in `aa` */
+} lv_draw_sw_corner_row_t;
+
+typedef struct {
+    int32_t radius;
+    lv_opa_t opa;
+    uint32_t used_cnt;
+    uint32_t last_used;
+    uint32_t size;
+    lv_draw_sw_corner_row_t * rows;     /**< `radius` rows from the top edge */
+    lv_opa_t * aa;                      /**< Mask of the antialiased pixels, in x order, opacity applied */
+} lv_draw_sw_corner_t;
+
+typedef struct {
+    lv_mutex_t lock;
+    lv_draw_sw_corner_t * entries[LV_DRAW_SW_CORNER_CACHE_CNT];
+    uint32_t size_max;
+    uint32_t size;
+    uint32_t tick;
+    void * (*malloc_cb)(size_t size);
+    void (*free_cb)(void * p);
+    lv_draw_sw_corner_cache_stats_t stats;
+} lv_draw_sw_corner_cache_t;
+#endif
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
 
+#if LV_DRAW_SW_COMPLEX
+void lv_draw_sw_corner_cache_init(void);
+
+void lv_draw_sw_corner_cache_deinit(void);
+
+/**
+ * Get the corners of a plain filled rounded rectangle
+ * @param radius        radius of the rectangle, at most half of its shorter side
+ * @param opa           opacity of the fill
+ * @return              the corners or NULL to draw without cache. Released with `lv_draw_sw_corner_cache_release`
+ */
+lv_draw_sw_corner_t * lv_draw_sw_corner_cache_get(int32_t radius, lv_opa_t opa);
+
+void lv_draw_sw_corner_cache_release(lv_draw_sw_corner_t * corner);
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -8,6 +8,7 @@
  *********************/
 
 #include "lv_font.h"
+#include "lv_font_glyph_cache_private.h"
 #include "../misc/lv_text_private.h"
 #include "../misc/lv_utils.h"
 #include "../misc/lv_log.h"
@@ -53,7 +54,11 @@ const void * lv_font_get_glyph_bitmap(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf_t
 
     const uint8_t save_req = g_dsc->req_raw_bitmap;
     g_dsc->req_raw_bitmap = 0;
-    const void * bitmap = font_p->get_glyph_bitmap(g_dsc, draw_buf);
+
+    /*A glyph asked twice before its release keeps one slot*/
+    if(g_dsc->cache_slot) lv_font_glyph_cache_release(g_dsc);
+    const void * bitmap = lv_font_glyph_cache_get(g_dsc);
+    if(bitmap == NULL) bitmap = font_p->get_glyph_bitmap(g_dsc, draw_buf);
     g_dsc->req_raw_bitmap = save_req;
 
     return bitmap;
@@ -80,6 +85,7 @@ const void * lv_font_get_glyph_static_bitmap(lv_font_glyph_dsc_t * g_dsc)
 void lv_font_glyph_release_draw_data(lv_font_glyph_dsc_t * g_dsc)
 {
     LV_ASSERT_NULL(g_dsc);
+    if(g_dsc->cache_slot) lv_font_glyph_cache_release(g_dsc);
     if(!g_dsc->entry) {
         return;
     }
@@ -21,6 +21,7 @@
 #if LV_USE_FONT_COMPRESSED
     #define font_rle LV_GLOBAL_DEFAULT()->font_fmt_rle
 #endif /*LV_USE_FONT_COMPRESSED*/
+#define ascii_index LV_GLOBAL_DEFAULT()->font_fmt_ascii_index
 
 /**********************
  *      TYPEDEFS
@@ -34,6 +35,7 @@ typedef struct {
  *  STATIC PROTOTYPES
  **********************/
 static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter);
+static uint32_t find_glyph_dsc_id(const lv_font_t * font, uint32_t letter);
 static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t gid_right);
 static int unicode_list_compare(const void * ref, const void * element);
 static int kern_pair_8_compare(const void * ref, const void * element);
@@ -276,11 +278,46 @@ bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t *
     return true;
 }
 
+bool lv_font_fmt_txt_add_ascii_index(const lv_font_t * font)
+{
+    LV_ASSERT_NULL(font);
+    if(font->get_glyph_dsc != lv_font_get_glyph_dsc_fmt_txt) return false;
+
+    lv_font_fmt_txt_ascii_index_t * free_index = NULL;
+    uint32_t i;
+    for(i = 0; i < LV_FONT_FMT_TXT_ASCII_INDEX_CNT; i++) {
+        if(ascii_index[i].font == font) return true;
+        if(ascii_index[i].font == NULL && free_index == NULL) free_index = &ascii_index[i];
+    }
+    if(free_index == NULL) return false;
+
+    uint32_t letter;
+    for(letter = 0; letter < 128; letter++) {
+        free_index->gid[letter] = (uint16_t)find_glyph_dsc_id(font, letter);
+    }
+    /*Used by get_glyph_dsc_id from here*/
+    free_index->font = font;
+    return true;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
 
 static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter)
+{
+    /*The digits and letters of the indexed fonts: no cmap search*/
+    if(letter < 128) {
+        uint32_t i;
+        for(i = 0; i < LV_FONT_FMT_TXT_ASCII_INDEX_CNT; i++) {
+            if(ascii_index[i].font == font) return ascii_index[i].gid[letter];
+        }
+    }
+
+    return find_glyph_dsc_id(font, letter);
+}
+
+static uint32_t find_glyph_dsc_id(const lv_font_t * font, uint32_t letter)
 {
     if(letter == '\0') return 0;
 
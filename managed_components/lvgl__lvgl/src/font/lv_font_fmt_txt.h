@@ -19,6 +19,8 @@ extern "C" {
 /*********************
  *      DEFINES
  *********************/
+/** Fonts with an ASCII index, see `lv_font_fmt_txt_add_ascii_index`*/
+#define LV_FONT_FMT_TXT_ASCII_INDEX_CNT 2
 
 /**********************
  *      TYPEDEFS
@@ -224,6 +226,15 @@ const void * lv_font_get_bitmap_fmt_txt(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf
 bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t unicode_letter,
                                    uint32_t unicode_letter_next);
 
+/**
+ * Look up the glyphs of the ASCII letters of a font in a table instead of searching its cmaps.
+ * Meant for the font of frequently redrawn labels, at most `LV_FONT_FMT_TXT_ASCII_INDEX_CNT` fonts.
+ * Call it with the LVGL lock held, before the font is used by a draw unit. The font must not be deleted.
+ * @param font          a font in LVGL's native format (`lv_font_get_glyph_dsc_fmt_txt`)
+ * @return              true: added or already added; false: another font format or no free table
+ */
+bool lv_font_fmt_txt_add_ascii_index(const lv_font_t * font);
+
 /**********************
  *      MACROS
  **********************/
@@ -41,6 +41,11 @@ typedef struct {
 } lv_font_fmt_rle_t;
 #endif
 
+typedef struct {
+    const lv_font_t * font;     /**< NULL: free table */
+    uint16_t gid[128];          /**< Glyph index per ASCII letter, 0: not in the font */
+} lv_font_fmt_txt_ascii_index_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
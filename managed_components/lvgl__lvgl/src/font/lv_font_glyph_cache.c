@@ -0,0 +1,191 @@
+/**
+ * @file lv_font_glyph_cache.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_font_glyph_cache_private.h"
+#include "lv_font_fmt_txt.h"
+#include "../core/lv_global.h"
+#include "../misc/lv_assert.h"
+#include "../misc/lv_math.h"
+#include "../stdlib/lv_mem.h"
+#include "../stdlib/lv_string.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define _glyph_cache    LV_GLOBAL_DEFAULT()->font_glyph_cache
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static inline lv_font_glyph_cache_slot_t * slot_at(uint32_t i);
+static lv_font_glyph_cache_slot_t * slot_find_free(void);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_font_glyph_cache_init(void)
+{
+    lv_mutex_init(&_glyph_cache.lock);
+}
+
+void lv_font_glyph_cache_deinit(void)
+{
+    lv_font_glyph_cache_set_size(0, NULL, NULL);
+    lv_mutex_delete(&_glyph_cache.lock);
+}
+
+void lv_font_glyph_cache_set_size(uint32_t size, void * (*malloc_cb)(size_t size), void (*free_cb)(void * p))
+{
+    lv_mutex_lock(&_glyph_cache.lock);
+    /*The arena was allocated by the previous allocator*/
+    if(_glyph_cache.arena) _glyph_cache.free_cb(_glyph_cache.arena);
+    _glyph_cache.arena = NULL;
+    _glyph_cache.slots = NULL;
+    _glyph_cache.slot_cnt = 0;
+    _glyph_cache.malloc_cb = malloc_cb ? malloc_cb : lv_malloc;
+    _glyph_cache.free_cb = free_cb ? free_cb : lv_free;
+
+    /*The bitmaps must be aligned as any draw buffer*/
+    _glyph_cache.slot_size = LV_ROUND_UP(sizeof(lv_font_glyph_cache_slot_t), LV_DRAW_BUF_ALIGN) +
+                             LV_ROUND_UP(LV_FONT_GLYPH_CACHE_SLOT_PX, LV_DRAW_BUF_ALIGN);
+    uint32_t slot_cnt = size / _glyph_cache.slot_size;
+    if(slot_cnt > 0) {
+        lv_mem_tag_t mem_tag = lv_mem_set_tag(LV_MEM_TAG_CACHE);
+        _glyph_cache.arena = _glyph_cache.malloc_cb(slot_cnt * _glyph_cache.slot_size + LV_DRAW_BUF_ALIGN - 1);
+        lv_mem_set_tag(mem_tag);
+        LV_ASSERT_MALLOC(_glyph_cache.arena);
+    }
+    if(_glyph_cache.arena) {
+        _glyph_cache.slots = lv_draw_buf_align(_glyph_cache.arena, LV_COLOR_FORMAT_A8);
+        _glyph_cache.slot_cnt = slot_cnt;
+        uint32_t i;
+        for(i = 0; i < slot_cnt; i++) slot_at(i)->font = NULL;
+    }
+    lv_mutex_unlock(&_glyph_cache.lock);
+}
+
+void lv_font_glyph_cache_get_stats(lv_font_glyph_cache_stats_t * stats, bool reset)
+{
+    LV_ASSERT_NULL(stats);
+    lv_mutex_lock(&_glyph_cache.lock);
+    *stats = _glyph_cache.stats;
+    stats->entries = 0;
+    uint32_t i;
+    for(i = 0; i < _glyph_cache.slot_cnt; i++) {
+        if(slot_at(i)->font) stats->entries++;
+    }
+    stats->slots = _glyph_cache.slot_cnt;
+    if(reset) lv_memzero(&_glyph_cache.stats, sizeof(_glyph_cache.stats));
+    lv_mutex_unlock(&_glyph_cache.lock);
+}
+
+const lv_draw_buf_t * lv_font_glyph_cache_get(lv_font_glyph_dsc_t * g_dsc)
+{
+    const lv_font_t * font = g_dsc->resolved_font;
+    /*Only the built-in fonts: their glyph index and bitmap never change*/
+    if(font == NULL || font->get_glyph_bitmap != lv_font_get_bitmap_fmt_txt) return NULL;
+    if(g_dsc->format < LV_FONT_GLYPH_FORMAT_A1 || g_dsc->format > LV_FONT_GLYPH_FORMAT_A8) return NULL;
+
+    lv_mutex_lock(&_glyph_cache.lock);
+    if(_glyph_cache.slot_cnt == 0) {
+        lv_mutex_unlock(&_glyph_cache.lock);
+        return NULL;
+    }
+    _glyph_cache.tick++;
+
+    uint32_t gid = g_dsc->gid.index;
+    uint32_t i;
+    for(i = 0; i < _glyph_cache.slot_cnt; i++) {
+        lv_font_glyph_cache_slot_t * slot = slot_at(i);
+        if(slot->font == font && slot->gid == gid) {
+            slot->used_cnt++;
+            slot->last_used = _glyph_cache.tick;
+            _glyph_cache.stats.hits++;
+            g_dsc->cache_slot = slot;
+            lv_mutex_unlock(&_glyph_cache.lock);
+            return &slot->draw_buf;
+        }
+    }
+
+    lv_font_glyph_cache_slot_t * slot = NULL;
+    uint32_t stride = lv_draw_buf_width_to_stride(g_dsc->box_w, LV_COLOR_FORMAT_A8);
+    if(stride * g_dsc->box_h <= LV_FONT_GLYPH_CACHE_SLOT_PX) slot = slot_find_free();
+    if(slot == NULL) {
+        _glyph_cache.stats.uncached++;
+        lv_mutex_unlock(&_glyph_cache.lock);
+        return NULL;
+    }
+
+    /*Decode under the lock: the other draw unit may look for the same glyph*/
+    uint8_t * data = (uint8_t *)slot + LV_ROUND_UP(sizeof(lv_font_glyph_cache_slot_t), LV_DRAW_BUF_ALIGN);
+    lv_draw_buf_init(&slot->draw_buf, g_dsc->box_w, g_dsc->box_h, LV_COLOR_FORMAT_A8, stride,
+                     data, LV_FONT_GLYPH_CACHE_SLOT_PX);
+    if(font->get_glyph_bitmap(g_dsc, &slot->draw_buf) != &slot->draw_buf) {
+        _glyph_cache.stats.uncached++;
+        lv_mutex_unlock(&_glyph_cache.lock);
+        return NULL;
+    }
+
+    slot->font = font;
+    slot->gid = gid;
+    slot->used_cnt = 1;
+    slot->last_used = _glyph_cache.tick;
+    _glyph_cache.stats.misses++;
+    g_dsc->cache_slot = slot;
+    lv_mutex_unlock(&_glyph_cache.lock);
+    return &slot->draw_buf;
+}
+
+void lv_font_glyph_cache_release(lv_font_glyph_dsc_t * g_dsc)
+{
+    lv_mutex_lock(&_glyph_cache.lock);
+    g_dsc->cache_slot->used_cnt--;
+    g_dsc->cache_slot = NULL;
+    lv_mutex_unlock(&_glyph_cache.lock);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static inline lv_font_glyph_cache_slot_t * slot_at(uint32_t i)
+{
+    return (lv_font_glyph_cache_slot_t *)(_glyph_cache.slots + i * _glyph_cache.slot_size);
+}
+
+/**
+ * A free slot, else the least recently used one not being drawn, emptied
+ */
+static lv_font_glyph_cache_slot_t * slot_find_free(void)
+{
+    lv_font_glyph_cache_slot_t * lru = NULL;
+    uint32_t i;
+    for(i = 0; i < _glyph_cache.slot_cnt; i++) {
+        lv_font_glyph_cache_slot_t * slot = slot_at(i);
+        if(slot->font == NULL) return slot;
+        if(slot->used_cnt == 0 && (lru == NULL || slot->last_used < lru->last_used)) lru = slot;
+    }
+    if(lru) {
+        lru->font = NULL;
+        _glyph_cache.stats.evictions++;
+    }
+    return lru;
+}
@@ -0,0 +1,66 @@
+/**
+ * @file lv_font_glyph_cache.h
+ *
+ */
+
+#ifndef LV_FONT_GLYPH_CACHE_H
+#define LV_FONT_GLYPH_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_font.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    uint32_t hits;          /**< Bitmaps returned from the cache */
+    uint32_t misses;        /**< Bitmaps decoded into a free or evicted slot */
+    uint32_t uncached;      /**< Bitmaps decoded without the cache: disabled, too large, or all slots in use */
+    uint32_t evictions;     /**< Glyphs removed to make room */
+    uint32_t entries;       /**< Glyphs in the cache */
+    uint32_t slots;         /**< Slots of the arena */
+} lv_font_glyph_cache_stats_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Keep the decoded A8 bitmaps of the glyphs of the built-in (`lv_font_fmt_txt`) fonts, per font
+ * and glyph. The arena is allocated once and split into slots of `LV_FONT_GLYPH_CACHE_SLOT_PX`
+ * pixels: larger glyphs are decoded at every draw. Least recently used glyphs not being drawn
+ * are replaced.
+ * Call it with the LVGL lock held.
+ * @param size          bytes of the arena, 0: no cache (the default)
+ * @param malloc_cb     allocator of the arena, e.g. in internal RAM out of the LVGL heap (NULL: `lv_malloc`)
+ * @param free_cb       free of `malloc_cb` (NULL: `lv_free`)
+ */
+void lv_font_glyph_cache_set_size(uint32_t size, void * (*malloc_cb)(size_t size), void (*free_cb)(void * p));
+
+/**
+ * Get the statistics of the glyph cache.
+ * @param stats         filled with the counters since start or since the last reset, and the content
+ * @param reset         clear the counters after reading
+ */
+void lv_font_glyph_cache_get_stats(lv_font_glyph_cache_stats_t * stats, bool reset);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_FONT_GLYPH_CACHE_H*/
@@ -0,0 +1,78 @@
+/**
+ * @file lv_font_glyph_cache_private.h
+ *
+ */
+
+#ifndef LV_FONT_GLYPH_CACHE_PRIVATE_H
+#define LV_FONT_GLYPH_CACHE_PRIVATE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_font_glyph_cache.h"
+#include "../draw/lv_draw_buf_private.h"
+#include "../osal/lv_os_private.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+/** Pixels of a slot: the glyphs of the 14..16 px fonts fit, the symbols and larger fonts do not */
+#define LV_FONT_GLYPH_CACHE_SLOT_PX     192
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+struct _lv_font_glyph_cache_slot_t {
+    const lv_font_t * font;     /**< NULL: free slot */
+    uint32_t gid;
+    uint32_t used_cnt;
+    uint32_t last_used;
+    lv_draw_buf_t draw_buf;     /**< The A8 bitmap, in the slot after this header */
+};
+
+typedef struct _lv_font_glyph_cache_slot_t lv_font_glyph_cache_slot_t;
+
+typedef struct {
+    lv_mutex_t lock;
+    void * arena;
+    uint8_t * slots;            /**< The arena aligned for the bitmaps */
+    uint32_t slot_size;
+    uint32_t slot_cnt;
+    uint32_t tick;
+    void * (*malloc_cb)(size_t size);
+    void (*free_cb)(void * p);
+    lv_font_glyph_cache_stats_t stats;
+} lv_font_glyph_cache_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+void lv_font_glyph_cache_init(void);
+
+void lv_font_glyph_cache_deinit(void);
+
+/**
+ * Get the A8 bitmap of a glyph from the cache, decoding it on a miss
+ * @param g_dsc         the glyph descriptor, from `lv_font_get_glyph_dsc`
+ * @return              a draw buffer of the cache or NULL to decode without the cache.
+ *                      Released with `lv_font_glyph_cache_release`
+ */
+const lv_draw_buf_t * lv_font_glyph_cache_get(lv_font_glyph_dsc_t * g_dsc);
+
+void lv_font_glyph_cache_release(lv_font_glyph_dsc_t * g_dsc);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_FONT_GLYPH_CACHE_PRIVATE_H*/
@@ -203,6 +203,15 @@
         #endif
     #endif
 
+    /** Count the allocations per subsystem (`lv_mem_get_tag_stats()`), in a header of each allocation */
+    #ifndef LV_USE_MEM_TAGS
+        #ifdef CONFIG_LV_USE_MEM_TAGS
+            #define LV_USE_MEM_TAGS CONFIG_LV_USE_MEM_TAGS
+        #else
+            #define LV_USE_MEM_TAGS 0
+        #endif
+    #endif
+
     /** Set an address for the memory pool instead of allocating it as a normal array. Can be in external SRAM too. */
     #ifndef LV_MEM_ADR
         #ifdef CONFIG_LV_MEM_ADR
@@ -230,6 +239,15 @@
     #endif
 #endif  /*LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN*/
 
+/** Memory arenas at once (`lv_mem_arena_create()`): the objects and styles of a screen in one region, 0: disabled */
+#ifndef LV_MEM_ARENA_CNT
+    #ifdef CONFIG_LV_MEM_ARENA_CNT
+        #define LV_MEM_ARENA_CNT CONFIG_LV_MEM_ARENA_CNT
+    #else
+        #define LV_MEM_ARENA_CNT 0
+    #endif
+#endif
+
 /*====================
    HAL SETTINGS
  *====================*/
@@ -194,6 +194,9 @@ void lv_init(void)
     LV_GLOBAL_INIT(LV_GLOBAL_DEFAULT());
 
     lv_mem_init();
+#if LV_MEM_ARENA_CNT
+    lv_mem_arena_init();
+#endif
 
     lv_draw_buf_init_handlers();
 
@@ -230,6 +233,8 @@ void lv_init(void)
     lv_freetype_init(LV_FREETYPE_CACHE_FT_GLYPH_CNT);
 #endif
 
+    lv_font_glyph_cache_init();
+
     lv_draw_init();
 
 #if LV_USE_DRAW_SW
@@ -503,6 +508,8 @@ void lv_deinit(void)
 
     lv_draw_deinit();
 
+    lv_font_glyph_cache_deinit();
+
     lv_group_deinit();
 
     lv_anim_core_deinit();
@@ -533,6 +540,9 @@ void lv_deinit(void)
 
     lv_fs_deinit();
 
+#if LV_MEM_ARENA_CNT
+    lv_mem_arena_deinit();
+#endif
     lv_mem_deinit();
 
     lv_initialized = false;
@@ -69,6 +69,8 @@ struct _lv_lru_rb_t {
     lv_ll_t ll;
 
     get_data_size_cb_t * get_data_size_cb;
+
+    uint64_t inflation;     /*Size weighted: credit of the last victim*/
 };
 typedef struct _lv_lru_rb_t lv_lru_rb_t_;
 /**********************
@@ -78,6 +80,7 @@ typedef struct _lv_lru_rb_t lv_lru_rb_t_;
 static void * alloc_cb(void);
 static bool init_cnt_cb(lv_cache_t * cache);
 static bool init_size_cb(lv_cache_t * cache);
+static bool init_size_weighted_cb(lv_cache_t * cache);
 static void  destroy_cb(lv_cache_t * cache, void * user_data);
 
 static lv_cache_entry_t * get_cb(lv_cache_t * cache, const void * key, void * user_data);
@@ -86,11 +89,16 @@ static void remove_cb(lv_cache_t * cache, lv_cache_entry_t * entry, void * user_
 static void drop_cb(lv_cache_t * cache, const void * key, void * user_data);
 static void drop_all_cb(lv_cache_t * cache, void * user_data);
 static lv_cache_entry_t * get_victim_cb(lv_cache_t * cache, void * user_data);
+static lv_cache_entry_t * get_weighted_cb(lv_cache_t * cache, const void * key, void * user_data);
+static lv_cache_entry_t * add_weighted_cb(lv_cache_t * cache, const void * key, void * user_data);
+static lv_cache_entry_t * get_victim_weighted_cb(lv_cache_t * cache, void * user_data);
 static lv_cache_reserve_cond_res_t reserve_cond_cb(lv_cache_t * cache, const void * key, size_t reserved_size,
                                                    void * user_data);
 
 static void * alloc_new_node(lv_lru_rb_t_ * lru, void * key, void * user_data);
 inline static void ** get_lru_node(lv_lru_rb_t_ * lru, lv_rb_node_t * node);
+static void * get_credit(lv_lru_rb_t_ * lru, void * data);
+static void set_credit(lv_lru_rb_t_ * lru, lv_cache_entry_t * entry);
 
 static uint32_t cnt_get_data_size_cb(const void * data);
 static uint32_t size_get_data_size_cb(const void * data);
@@ -130,6 +138,21 @@ const lv_cache_class_t lv_cache_class_lru_rb_size = {
     .reserve_cond_cb = reserve_cond_cb,
     .iter_create_cb = cache_iter_create_cb,
 };
+
+const lv_cache_class_t lv_cache_class_lru_rb_size_weighted = {
+    .alloc_cb = alloc_cb,
+    .init_cb = init_size_weighted_cb,
+    .destroy_cb = destroy_cb,
+
+    .get_cb = get_weighted_cb,
+    .add_cb = add_weighted_cb,
+    .remove_cb = remove_cb,
+    .drop_cb = drop_cb,
+    .drop_all_cb = drop_all_cb,
+    .get_victim_cb = get_victim_weighted_cb,
+    .reserve_cond_cb = reserve_cond_cb,
+    .iter_create_cb = cache_iter_create_cb,
+};
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -245,6 +268,31 @@ static bool init_size_cb(lv_cache_t * cache)
     return true;
 }
 
+static bool init_size_weighted_cb(lv_cache_t * cache)
+{
+    lv_lru_rb_t_ * lru = (lv_lru_rb_t_ *)cache;
+
+    LV_ASSERT_NULL(lru->cache.ops.compare_cb);
+    LV_ASSERT_NULL(lru->cache.ops.free_cb);
+    LV_ASSERT(lru->cache.node_size > 0);
+
+    if(lru->cache.node_size <= 0 || lru->cache.ops.compare_cb == NULL || lru->cache.ops.free_cb == NULL) {
+        return false;
+    }
+
+    /*add the credit of the entry and void* to store the ll node pointer*/
+    if(!lv_rb_init(&lru->rb, lru->cache.ops.compare_cb,
+                   lv_cache_entry_get_size(lru->cache.node_size) + sizeof(uint64_t) + sizeof(void *))) {
+        return false;
+    }
+    lv_ll_init(&lru->ll, sizeof(void *));
+
+    lru->get_data_size_cb = size_get_data_size_cb;
+    lru->inflation = 0;
+
+    return true;
+}
+
 static void destroy_cb(lv_cache_t * cache, void * user_data)
 {
     LV_UNUSED(user_data);
@@ -434,6 +482,69 @@ static lv_cache_entry_t * get_victim_cb(lv_cache_t * cache, void * user_data)
     return NULL;
 }
 
+/**
+ * GreedyDual-Size with a cost of 1 per miss: an entry used or added gets the credit of the last
+ * victim plus the inverse of its size, the victim is the unused entry with the lowest credit.
+ * A large entry is evicted before the small ones used about as recently, and the credits of the
+ * entries not used for long fall behind as the victims' credits grow.
+ */
+static lv_cache_entry_t * get_weighted_cb(lv_cache_t * cache, const void * key, void * user_data)
+{
+    lv_cache_entry_t * entry = get_cb(cache, key, user_data);
+    if(entry) set_credit((lv_lru_rb_t_ *)cache, entry);
+    return entry;
+}
+
+static lv_cache_entry_t * add_weighted_cb(lv_cache_t * cache, const void * key, void * user_data)
+{
+    lv_cache_entry_t * entry = add_cb(cache, key, user_data);
+    if(entry) set_credit((lv_lru_rb_t_ *)cache, entry);
+    return entry;
+}
+
+static lv_cache_entry_t * get_victim_weighted_cb(lv_cache_t * cache, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_lru_rb_t_ * lru = (lv_lru_rb_t_ *)cache;
+
+    LV_ASSERT_NULL(lru);
+
+    /*From the tail: on equal credits the least recently used one*/
+    lv_cache_entry_t * victim = NULL;
+    uint64_t victim_credit = 0;
+    lv_rb_node_t ** tail;
+    LV_LL_READ_BACK(&lru->ll, tail) {
+        lv_rb_node_t * tail_node = *tail;
+        lv_cache_entry_t * entry = lv_cache_entry_get_entry(tail_node->data, cache->node_size);
+        if(lv_cache_entry_get_ref(entry) != 0) continue;
+
+        uint64_t credit;
+        lv_memcpy(&credit, get_credit(lru, tail_node->data), sizeof(credit));
+        if(victim == NULL || credit < victim_credit) {
+            victim = entry;
+            victim_credit = credit;
+        }
+    }
+
+    if(victim) lru->inflation = victim_credit;
+    return victim;
+}
+
+/*Not aligned for a uint64_t: copied in and out*/
+static void * get_credit(lv_lru_rb_t_ * lru, void * data)
+{
+    return (char *)data + lv_cache_entry_get_size(lru->cache.node_size);
+}
+
+static void set_credit(lv_lru_rb_t_ * lru, lv_cache_entry_t * entry)
+{
+    void * data = lv_cache_entry_get_data(entry);
+    uint32_t size = lru->get_data_size_cb(data);
+    uint64_t credit = lru->inflation + ((uint64_t)1 << 32) / (size > 0 ? size : 1);
+    lv_memcpy(get_credit(lru, data), &credit, sizeof(credit));
+}
+
 static lv_cache_reserve_cond_res_t reserve_cond_cb(lv_cache_t * cache, const void * key, size_t reserved_size,
                                                    void * user_data)
 {
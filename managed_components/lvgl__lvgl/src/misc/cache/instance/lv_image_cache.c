@@ -11,6 +11,7 @@
 #include "../../lv_assert.h"
 #include "../../../core/lv_global.h"
 #include "../../../misc/lv_iter.h"
+#include "../../../stdlib/lv_mem.h"
 
 #include "lv_image_cache.h"
 
@@ -58,7 +59,8 @@ lv_result_t lv_image_cache_init(uint32_t size)
         return LV_RESULT_OK;
     }
 
-    img_cache_p = lv_cache_create(&lv_cache_class_lru_rb_size,
+    /*Evict a large image before the small ones used about as recently: one decode instead of many*/
+    img_cache_p = lv_cache_create(&lv_cache_class_lru_rb_size_weighted,
     sizeof(lv_image_cache_data_t), size, (lv_cache_ops_t) {
         .compare_cb = (lv_cache_compare_cb_t) image_cache_compare_cb,
         .create_cb = NULL,
@@ -115,6 +117,33 @@ void lv_image_cache_dump(void)
     lv_iter_inspect(iter, iter_inspect_cb);
 }
 
+void lv_image_cache_get_stats(lv_image_cache_stats_t * stats, bool reset)
+{
+    LV_ASSERT_NULL(stats);
+    lv_memzero(stats, sizeof(lv_image_cache_stats_t));
+    if(img_cache_p == NULL) return;
+
+    lv_cache_stats_t cs;
+    lv_cache_get_stats(img_cache_p, &cs, reset);
+    stats->hits = cs.hits;
+    stats->misses = cs.misses;
+    stats->evictions = cs.evictions;
+
+    /*The draw units may add images meanwhile: count under the cache lock*/
+    void * elem = lv_malloc(lv_cache_entry_get_size(img_cache_p->node_size));
+    LV_ASSERT_MALLOC(elem);
+    lv_mutex_lock(&img_cache_p->lock);
+    lv_iter_t * iter = elem ? lv_cache_iter_create(img_cache_p) : NULL;
+    if(iter) {
+        while(lv_iter_next(iter, elem) == LV_RESULT_OK) stats->entries++;
+        lv_iter_destroy(iter);
+    }
+    stats->size = img_cache_p->size;
+    stats->max_size = img_cache_p->max_size;
+    lv_mutex_unlock(&img_cache_p->lock);
+    lv_free(elem);
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
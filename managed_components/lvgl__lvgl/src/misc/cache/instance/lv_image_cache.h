@@ -24,6 +24,18 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+/**
+ * Image cache statistics, see `lv_image_cache_get_stats()`
+ */
+typedef struct {
+    uint32_t hits;          /**< Opens served by a decoded image of the cache */
+    uint32_t misses;        /**< Images decoded and added to the cache */
+    uint32_t evictions;     /**< Images removed to stay in the budget */
+    uint32_t entries;       /**< Images in the cache */
+    uint32_t size;          /**< Bytes of the decoded images in the cache */
+    uint32_t max_size;      /**< Budget in bytes, 0: disabled */
+} lv_image_cache_stats_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -66,6 +78,14 @@ lv_iter_t * lv_image_cache_iter_create(void);
  */
 void lv_image_cache_dump(void);
 
+/**
+ * Get the statistics of the image cache.
+ * Images used directly (uncompressed variables) are neither hits nor misses.
+ * @param stats     filled with the counters since the last reset and the current content.
+ * @param reset     true: clear the hit, miss and eviction counters.
+ */
+void lv_image_cache_get_stats(lv_image_cache_stats_t * stats, bool reset);
+
 /*************************
  *    GLOBAL VARIABLES
  *************************/
@@ -56,6 +56,9 @@ lv_cache_t * lv_cache_create(const lv_cache_class_t * cache_class,
     cache->max_size = max_size;
     cache->size = 0;
     cache->ops = ops;
+    cache->hit_cnt = 0;
+    cache->miss_cnt = 0;
+    cache->evict_cnt = 0;
 
     if(cache->clz->init_cb(cache) == false) {
         LV_LOG_ERROR("Cache init failed");
@@ -98,6 +101,7 @@ lv_cache_entry_t * lv_cache_acquire(lv_cache_t * cache, const void * key, void *
     lv_cache_entry_t * entry = cache->clz->get_cb(cache, key, user_data);
     if(entry != NULL) {
         lv_cache_entry_acquire_data(entry);
+        cache->hit_cnt++;
     }
     lv_mutex_unlock(&cache->lock);
 
@@ -139,6 +143,7 @@ lv_cache_entry_t * lv_cache_add(lv_cache_t * cache, const void * key, void * use
     lv_cache_entry_t * entry = cache_add_internal_no_lock(cache, key, user_data);
     if(entry != NULL) {
         lv_cache_entry_acquire_data(entry);
+        cache->miss_cnt++;
     }
     lv_mutex_unlock(&cache->lock);
 
@@ -159,6 +164,7 @@ lv_cache_entry_t * lv_cache_acquire_or_create(lv_cache_t * cache, const void * k
         entry = cache->clz->get_cb(cache, key, user_data);
         if(entry != NULL) {
             lv_cache_entry_acquire_data(entry);
+            cache->hit_cnt++;
             lv_mutex_unlock(&cache->lock);
 
             LV_PROFILER_CACHE_END;
@@ -180,7 +186,9 @@ lv_cache_entry_t * lv_cache_acquire_or_create(lv_cache_t * cache, const void * k
         LV_PROFILER_CACHE_END;
         return NULL;
     }
+    lv_mem_tag_t mem_tag = lv_mem_set_tag(LV_MEM_TAG_CACHE);
     bool create_res = cache->ops.create_cb(lv_cache_entry_get_data(entry), user_data);
+    lv_mem_set_tag(mem_tag);
     if(create_res == false) {
         cache->clz->remove_cb(cache, entry, user_data);
         cache->ops.free_cb(lv_cache_entry_get_data(entry), user_data);
@@ -189,6 +197,7 @@ lv_cache_entry_t * lv_cache_acquire_or_create(lv_cache_t * cache, const void * k
     }
     else {
         lv_cache_entry_acquire_data(entry);
+        cache->miss_cnt++;
     }
     lv_mutex_unlock(&cache->lock);
 
@@ -303,6 +312,23 @@ lv_iter_t * lv_cache_iter_create(lv_cache_t * cache)
     return cache->clz->iter_create_cb(cache);
 }
 
+void lv_cache_get_stats(lv_cache_t * cache, lv_cache_stats_t * stats, bool reset)
+{
+    LV_ASSERT_NULL(cache);
+    LV_ASSERT_NULL(stats);
+
+    lv_mutex_lock(&cache->lock);
+    stats->hits = cache->hit_cnt;
+    stats->misses = cache->miss_cnt;
+    stats->evictions = cache->evict_cnt;
+    if(reset) {
+        cache->hit_cnt = 0;
+        cache->miss_cnt = 0;
+        cache->evict_cnt = 0;
+    }
+    lv_mutex_unlock(&cache->lock);
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -337,6 +363,7 @@ static bool cache_evict_one_internal_no_lock(lv_cache_t * cache, void * user_dat
     cache->clz->remove_cb(cache, victim, user_data);
     cache->ops.free_cb(lv_cache_entry_get_data(victim), user_data);
     lv_cache_entry_delete(victim);
+    cache->evict_cnt++;
     return true;
 }
 
@@ -353,7 +380,9 @@ static lv_cache_entry_t * cache_add_internal_no_lock(lv_cache_t * cache, const v
         if(cache_evict_one_internal_no_lock(cache, user_data) == false)
             return NULL;
 
+    lv_mem_tag_t mem_tag = lv_mem_set_tag(LV_MEM_TAG_CACHE);
     lv_cache_entry_t * entry = cache->clz->add_cb(cache, key, user_data);
+    lv_mem_set_tag(mem_tag);
 
     return entry;
 }
@@ -29,6 +29,15 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+/**
+ * Counters of a cache since its creation or the last reset
+ */
+typedef struct {
+    uint32_t hits;          /**< Lookups which found their entry */
+    uint32_t misses;        /**< Entries added: their data had to be created */
+    uint32_t evictions;     /**< Entries removed to make room for new ones */
+} lv_cache_stats_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -38,10 +47,12 @@ extern "C" {
  * @param cache_class   The class of the cache. Currently only support one two builtin classes:
  *                        - lv_cache_class_lru_rb_count for LRU-based cache with count-based eviction policy.
  *                        - lv_cache_class_lru_rb_size for LRU-based cache with size-based eviction policy.
+ *                        - lv_cache_class_lru_rb_size_weighted like lv_cache_class_lru_rb_size, evicting the
+ *                          largest entries first among the ones used about as recently (GreedyDual-Size).
  * @param node_size     The node size is the size of the data stored in the cache..
  * @param max_size      The max size is the maximum amount of memory or count that the cache can hold.
  *                        - lv_cache_class_lru_rb_count: max_size is the maximum count of nodes in the cache.
- *                        - lv_cache_class_lru_rb_size: max_size is the maximum size of the cache in bytes.
+ *                        - lv_cache_class_lru_rb_size(_weighted): max_size is the maximum size of the cache in bytes.
  * @param ops           A set of operations that can be performed on the cache. See lv_cache_ops_t for details.
  * @return              Returns a pointer to the created cache object on success, `NULL` on error.
  */
@@ -222,6 +233,14 @@ const char * lv_cache_get_name(lv_cache_t * cache);
  */
 lv_iter_t * lv_cache_iter_create(lv_cache_t * cache);
 
+/**
+ * Get the hit, miss and eviction counters of the cache.
+ * @param cache         The cache object pointer.
+ * @param stats         Filled with the counters.
+ * @param reset         true: clear the counters after reading them.
+ */
+void lv_cache_get_stats(lv_cache_t * cache, lv_cache_stats_t * stats, bool reset);
+
 /*************************
  *    GLOBAL VARIABLES
  *************************/
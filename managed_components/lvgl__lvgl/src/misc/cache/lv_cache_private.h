@@ -138,6 +138,10 @@ struct _lv_cache_t {
     lv_mutex_t lock;                  /**< Cache lock used to protect the cache in multithreading environments */
 
     const char * name;                /**< Name of the cache */
+
+    uint32_t hit_cnt;                 /**< Lookups which found their entry */
+    uint32_t miss_cnt;                /**< Entries added */
+    uint32_t evict_cnt;               /**< Entries evicted to make room */
 };
 
 /**
@@ -146,6 +150,7 @@ struct _lv_cache_t {
  * Examples:
  * - lv_cache_class_lru_rb_count for LRU-based cache with count-based eviction policy.
  * - lv_cache_class_lru_rb_size for LRU-based cache with size-based eviction policy.
+ * - lv_cache_class_lru_rb_size_weighted for size-based cache evicting the largest entries first (GreedyDual-Size).
  */
 struct _lv_cache_class_t {
     lv_cache_alloc_cb_t alloc_cb;                 /**< The allocation function for cache entries */
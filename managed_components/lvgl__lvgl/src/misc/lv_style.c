@@ -305,7 +305,11 @@ bool lv_style_remove_prop(lv_style_t * style, lv_style_prop_t prop)
             lv_style_value_t * old_values = (lv_style_value_t *)style->values_and_props;
 
             size_t size = (style->prop_cnt - 1) * (sizeof(lv_style_value_t) + sizeof(lv_style_prop_t));
+            lv_mem_tag_t mem_tag = lv_mem_set_tag(LV_MEM_TAG_STYLE);
+            lv_mem_arena_t * arena = lv_mem_set_arena_for(style);
             uint8_t * new_values_and_props = lv_malloc(size);
+            lv_mem_set_arena(arena);
+            lv_mem_set_tag(mem_tag);
             if(new_values_and_props == NULL) {
                 LV_PROFILER_STYLE_END;
                 return false;
@@ -364,7 +368,11 @@ void lv_style_set_prop(lv_style_t * style, lv_style_prop_t prop, lv_style_value_
     }
 
     size_t size = (style->prop_cnt + 1) * (sizeof(lv_style_value_t) + sizeof(lv_style_prop_t));
+    lv_mem_tag_t mem_tag = lv_mem_set_tag(LV_MEM_TAG_STYLE);
+    lv_mem_arena_t * arena = lv_mem_set_arena_for(style);
     uint8_t * values_and_props = lv_realloc(style->values_and_props, size);
+    lv_mem_set_arena(arena);
+    lv_mem_set_tag(mem_tag);
     if(values_and_props == NULL) {
         LV_PROFILER_STYLE_END;
         return;
@@ -86,10 +86,31 @@ lv_result_t lv_thread_init(lv_thread_t * pxThread,  const char * const name,
                            lv_thread_prio_t xSchedPriority,
                            void (*pvStartRoutine)(void *), size_t usStackSize,
                            void * xAttr)
+{
+    return lv_thread_init_pinned(pxThread, name, xSchedPriority, pvStartRoutine, usStackSize,
+                                 LV_THREAD_CORE_ANY, xAttr);
+}
+
+lv_result_t lv_thread_init_pinned(lv_thread_t * pxThread,  const char * const name,
+                                  lv_thread_prio_t xSchedPriority,
+                                  void (*pvStartRoutine)(void *), size_t usStackSize,
+                                  int32_t core, void * xAttr)
 {
     pxThread->pTaskArg = xAttr;
     pxThread->pvStartRoutine = pvStartRoutine;
 
+#if defined(ESP_PLATFORM) && (portNUM_PROCESSORS > 1)
+    BaseType_t xCoreID = core == LV_THREAD_CORE_ANY ? tskNO_AFFINITY : (BaseType_t)(core % portNUM_PROCESSORS);
+    BaseType_t xTaskCreateStatus = xTaskCreatePinnedToCore(
+                                       prvRunThread,
+                                       name,
+                                       (configSTACK_DEPTH_TYPE)(usStackSize / sizeof(StackType_t)),
+                                       (void *)pxThread,
+                                       tskIDLE_PRIORITY + xSchedPriority,
+                                       &pxThread->xTaskHandle,
+                                       xCoreID);
+#else
+    LV_UNUSED(core);
     BaseType_t xTaskCreateStatus = xTaskCreate(
                                        prvRunThread,
                                        name,
@@ -97,6 +118,7 @@ lv_result_t lv_thread_init(lv_thread_t * pxThread,  const char * const name,
                                        (void *)pxThread,
                                        tskIDLE_PRIORITY + xSchedPriority,
                                        &pxThread->xTaskHandle);
+#endif
 
     /* Ensure that the FreeRTOS task was successfully created. */
     if(xTaskCreateStatus != pdPASS) {
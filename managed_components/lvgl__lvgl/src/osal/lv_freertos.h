@@ -37,6 +37,9 @@ extern "C" {
  *      DEFINES
  *********************/
 
+/** `core` of `lv_thread_init_pinned()`: let the scheduler pick the core */
+#define LV_THREAD_CORE_ANY  (-1)
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -69,6 +72,22 @@ typedef struct {
  * GLOBAL PROTOTYPES
  **********************/
 
+/**
+ * Create a new thread pinned to a core. `lv_thread_init()` creates it on any core.
+ * @param thread        a variable in which the thread will be stored
+ * @param name          the name of the thread
+ * @param prio          priority of the thread
+ * @param callback      function of the thread
+ * @param stack_size    stack size in bytes
+ * @param core          the core, taken modulo the number of cores, or `LV_THREAD_CORE_ANY`;
+ *                      ignored on single core targets and outside ESP-IDF
+ * @param user_data     arbitrary data, will be available in the callback
+ * @return              LV_RESULT_OK: success; LV_RESULT_INVALID: failure
+ */
+lv_result_t lv_thread_init_pinned(lv_thread_t * thread, const char * const name,
+                                  lv_thread_prio_t prio, void (*callback)(void *), size_t stack_size,
+                                  int32_t core, void * user_data);
+
 /**
  * Set it for `traceTASK_SWITCHED_IN()` as
  * `lv_freertos_task_switch_in(pxCurrentTCB->pcTaskName)`
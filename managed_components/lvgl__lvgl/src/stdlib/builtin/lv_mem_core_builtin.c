@@ -38,14 +38,38 @@
 #endif
 #define state LV_GLOBAL_DEFAULT()->tlsf_state
 
+/*The tag of an allocation in front of it*/
+#if LV_USE_MEM_TAGS
+    #define TAG_HEADER       sizeof(MEM_UNIT)
+#else
+    #define TAG_HEADER       0
+#endif
+#define SPILL_POOL_HEADER    LV_ALIGN_UP(sizeof(lv_mem_spill_pool_t), 8)
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+/*In front of the TLSF pool in the memory of a spill pool*/
+struct _lv_mem_spill_pool_t {
+    lv_mem_spill_pool_t * next;
+    lv_pool_t pool;
+    uint8_t * end;          /*First byte after the memory*/
+    uint32_t used_cnt;
+};
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static void * mem_alloc(size_t size, lv_mem_tag_t tag);
+static lv_mem_spill_pool_t * spill_pool_of(const void * block);
+static void * spill_malloc(size_t bytes);
+static bool spill_pool_add(size_t bytes);
+static void spill_pool_release(lv_mem_spill_pool_t * sp);
+static void tag_add(uint8_t * block, lv_mem_tag_t tag, size_t size, bool spill);
+static void tag_sub(const uint8_t * block, size_t size, bool spill);
 static void lv_mem_walker(void * ptr, size_t size, int used, void * user);
+static void monitor_pct(lv_mem_monitor_t * mon_p);
 
 /**********************
  *  STATIC VARIABLES
@@ -100,6 +124,17 @@ void lv_mem_init(void)
 
 void lv_mem_deinit(void)
 {
+    while(state.spill_pools) {
+        lv_mem_spill_pool_t * next = state.spill_pools->next;
+        state.spill_free_cb(state.spill_pools);
+        state.spill_pools = next;
+    }
+    if(state.spill_tlsf) {
+        lv_tlsf_destroy(state.spill_tlsf);
+        state.spill_free_cb(state.spill_tlsf);
+        state.spill_tlsf = NULL;
+    }
+
     lv_ll_clear(&state.pool_ll);
     lv_tlsf_destroy(state.tlsf);
 #if LV_USE_OS
@@ -136,42 +171,121 @@ void lv_mem_remove_pool(lv_mem_pool_t pool)
     LV_LOG_WARN("invalid pool: %p", pool);
 }
 
-void * lv_malloc_core(size_t size)
+void lv_mem_set_spill_pools(size_t pool_size, uint32_t max_pools, void * (*malloc_cb)(size_t size),
+                            void (*free_cb)(void * p))
 {
+    if(malloc_cb == NULL || free_cb == NULL) pool_size = 0;
+    /*TLSF caps a pool at `LV_MEM_SIZE + LV_MEM_POOL_EXPAND_SIZE`*/
+    pool_size = LV_MIN(pool_size, SPILL_POOL_HEADER + lv_tlsf_block_size_max());
+
 #if LV_USE_OS
     lv_mutex_lock(&state.mutex);
 #endif
-    void * p = lv_tlsf_malloc(state.tlsf, size);
+    state.spill_max_pools = max_pools;
+    if(state.spill_tlsf && (pool_size != state.spill_pool_size || malloc_cb != state.spill_malloc_cb)) {
+        /*The pools and the TLSF control are freed with this allocator*/
+        LV_LOG_WARN("spill pools already taken, only their limit is changed");
+    }
+    else {
+        state.spill_pool_size = pool_size;
+        state.spill_malloc_cb = malloc_cb;
+        state.spill_free_cb = free_cb;
+    }
+#if LV_USE_OS
+    lv_mutex_unlock(&state.mutex);
+#endif
+}
 
-    if(p) {
-        state.cur_used += lv_tlsf_block_size(p);
-        state.max_used = LV_MAX(state.cur_used, state.max_used);
+void lv_mem_set_spill_policy(size_t min_size, uint32_t tag_mask)
+{
+#if LV_USE_OS
+    lv_mutex_lock(&state.mutex);
+#endif
+    state.spill_min_size = min_size;
+    state.spill_tags = tag_mask;
+#if LV_USE_OS
+    lv_mutex_unlock(&state.mutex);
+#endif
+}
+
+void lv_mem_get_spill_stats(lv_mem_spill_stats_t * stats, bool reset)
+{
+    LV_ASSERT_NULL(stats);
+#if LV_USE_OS
+    lv_mutex_lock(&state.mutex);
+#endif
+    *stats = state.spill_stats;
+    if(reset) {
+        state.spill_stats.max_pools = state.spill_stats.pools;
+        state.spill_stats.added = 0;
+        state.spill_stats.removed = 0;
+        state.spill_stats.failed = 0;
     }
+#if LV_USE_OS
+    lv_mutex_unlock(&state.mutex);
+#endif
+}
 
+#if LV_USE_MEM_TAGS
+void lv_mem_get_tag_stats(lv_mem_tag_t tag, lv_mem_tag_stats_t * stats, bool reset)
+{
+    LV_ASSERT_NULL(stats);
+    LV_ASSERT(tag < LV_MEM_TAG_CNT);
+#if LV_USE_OS
+    lv_mutex_lock(&state.mutex);
+#endif
+    *stats = state.tag_stats[tag];
+    if(reset) state.tag_stats[tag].max_used = state.tag_stats[tag].used;
 #if LV_USE_OS
     lv_mutex_unlock(&state.mutex);
 #endif
-    return p;
+}
+#endif
+
+void * lv_malloc_core(size_t size)
+{
+    return mem_alloc(size, lv_mem_get_tag());
 }
 
 void * lv_realloc_core(void * p, size_t new_size)
 {
+    if(p == NULL) return lv_malloc_core(new_size);
+
 #if LV_USE_OS
     lv_mutex_lock(&state.mutex);
 #endif
 
-    size_t old_size = lv_tlsf_block_size(p);
-    void * p_new = lv_tlsf_realloc(state.tlsf, p, new_size);
+    uint8_t * block = (uint8_t *)p - TAG_HEADER;
+    size_t old_size = lv_tlsf_block_size(block);
+    lv_mem_spill_pool_t * sp = spill_pool_of(block);
+    uint8_t * new_block = lv_tlsf_realloc(sp ? state.spill_tlsf : state.tlsf, block, new_size + TAG_HEADER);
 
-    if(p_new) {
+    if(new_block) {
+        size_t size = lv_tlsf_block_size(new_block);
+        tag_sub(new_block, old_size, sp != NULL);
+        tag_add(new_block, TAG_HEADER ? new_block[0] : LV_MEM_TAG_APP, size, sp != NULL);
         state.cur_used -= old_size;
-        state.cur_used += lv_tlsf_block_size(p_new);
+        state.cur_used += size;
         state.max_used = LV_MAX(state.cur_used, state.max_used);
+
+        /*Moved to another spill pool*/
+        lv_mem_spill_pool_t * new_sp = sp ? spill_pool_of(new_block) : NULL;
+        if(new_sp != sp) {
+            new_sp->used_cnt++;
+            sp->used_cnt--;
+            spill_pool_release(sp);
+        }
     }
 #if LV_USE_OS
     lv_mutex_unlock(&state.mutex);
 #endif
+    if(new_block) return new_block + TAG_HEADER;
 
+    /*No room in its heap: move it, maybe to the other heap*/
+    void * p_new = mem_alloc(new_size, TAG_HEADER ? block[0] : LV_MEM_TAG_APP);
+    if(p_new == NULL) return NULL;
+    lv_memcpy(p_new, p, LV_MIN(old_size - TAG_HEADER, new_size));
+    lv_free_core(p);
     return p_new;
 }
 
@@ -181,11 +295,21 @@ void lv_free_core(void * p)
     lv_mutex_lock(&state.mutex);
 #endif
 
+    uint8_t * block = (uint8_t *)p - TAG_HEADER;
+    size_t size = lv_tlsf_block_size(block);
+    lv_mem_spill_pool_t * sp = spill_pool_of(block);
+    tag_sub(block, size, sp != NULL);
 #if LV_MEM_ADD_JUNK
-    lv_memset(p, 0xbb, lv_tlsf_block_size(data));
+    lv_memset(block, 0xbb, size);
 #endif
-    size_t size = lv_tlsf_block_size(p);
-    lv_tlsf_free(state.tlsf, p);
+    if(sp) {
+        lv_tlsf_free(state.spill_tlsf, block);
+        sp->used_cnt--;
+        spill_pool_release(sp);
+    }
+    else {
+        lv_tlsf_free(state.tlsf, block);
+    }
     if(state.cur_used > size) state.cur_used -= size;
     else state.cur_used = 0;
 
@@ -195,24 +319,47 @@ void lv_free_core(void * p)
 }
 
 void lv_mem_monitor_core(lv_mem_monitor_t * mon_p)
+{
+    lv_mem_monitor_heap(LV_MEM_HEAP_MAIN, mon_p);
+    lv_mem_monitor_t spill;
+    lv_mem_monitor_heap(LV_MEM_HEAP_SPILL, &spill);
+    if(spill.total_size == 0) return;
+
+    mon_p->total_size += spill.total_size;
+    mon_p->free_cnt += spill.free_cnt;
+    mon_p->free_size += spill.free_size;
+    mon_p->free_biggest_size = LV_MAX(mon_p->free_biggest_size, spill.free_biggest_size);
+    mon_p->used_cnt += spill.used_cnt;
+    monitor_pct(mon_p);
+}
+
+void lv_mem_monitor_heap(lv_mem_heap_t heap, lv_mem_monitor_t * mon_p)
 {
     /*Init the data*/
     lv_memzero(mon_p, sizeof(lv_mem_monitor_t));
     LV_TRACE_MEM("begin");
 
-    lv_pool_t * pool_p;
-    LV_LL_READ(&state.pool_ll, pool_p) {
-        lv_tlsf_walk_pool(*pool_p, lv_mem_walker, mon_p);
-    }
-
-    mon_p->used_pct = 100 - (uint64_t)100U * mon_p->free_size / mon_p->total_size;
-    if(mon_p->free_size > 0) {
-        mon_p->frag_pct = (uint64_t)mon_p->free_biggest_size * 100U / mon_p->free_size;
-        mon_p->frag_pct = 100 - mon_p->frag_pct;
+#if LV_USE_OS
+    lv_mutex_lock(&state.mutex);
+#endif
+    if(heap == LV_MEM_HEAP_MAIN) {
+        lv_pool_t * pool_p;
+        LV_LL_READ(&state.pool_ll, pool_p) {
+            lv_tlsf_walk_pool(*pool_p, lv_mem_walker, mon_p);
+        }
     }
     else {
-        mon_p->frag_pct = 0; /*no fragmentation if all the RAM is used*/
+        lv_mem_spill_pool_t * sp;
+        for(sp = state.spill_pools; sp; sp = sp->next) {
+            lv_tlsf_walk_pool(sp->pool, lv_mem_walker, mon_p);
+        }
     }
+#if LV_USE_OS
+    lv_mutex_unlock(&state.mutex);
+#endif
+
+    if(mon_p->total_size == 0) return;
+    monitor_pct(mon_p);
 
     mon_p->max_used = state.max_used;
 
@@ -243,6 +390,24 @@ lv_result_t lv_mem_test_core(void)
         }
     }
 
+    lv_mem_spill_pool_t * sp;
+    for(sp = state.spill_pools; sp; sp = sp->next) {
+        if(lv_tlsf_check_pool(sp->pool)) {
+            LV_LOG_WARN("spill pool failed");
+#if LV_USE_OS
+            lv_mutex_unlock(&state.mutex);
+#endif
+            return LV_RESULT_INVALID;
+        }
+    }
+    if(state.spill_tlsf && lv_tlsf_check(state.spill_tlsf)) {
+        LV_LOG_WARN("spill heap failed");
+#if LV_USE_OS
+        lv_mutex_unlock(&state.mutex);
+#endif
+        return LV_RESULT_INVALID;
+    }
+
     LV_TRACE_MEM("passed");
 #if LV_USE_OS
     lv_mutex_unlock(&state.mutex);
@@ -254,6 +419,154 @@ lv_result_t lv_mem_test_core(void)
  *   STATIC FUNCTIONS
  **********************/
 
+/**
+ * Percentages of use and fragmentation from the sizes summed by the walker
+ */
+static void monitor_pct(lv_mem_monitor_t * mon_p)
+{
+    mon_p->used_pct = 100 - (uint64_t)100U * mon_p->free_size / mon_p->total_size;
+    if(mon_p->free_size > 0) {
+        mon_p->frag_pct = (uint64_t)mon_p->free_biggest_size * 100U / mon_p->free_size;
+        mon_p->frag_pct = 100 - mon_p->frag_pct;
+    }
+    else {
+        mon_p->frag_pct = 0; /*no fragmentation if all the RAM is used*/
+    }
+}
+
+static void * mem_alloc(size_t size, lv_mem_tag_t tag)
+{
+    const size_t bytes = size + TAG_HEADER;
+#if LV_USE_OS
+    lv_mutex_lock(&state.mutex);
+#endif
+    const bool spill = state.spill_pool_size > 0;
+    const bool spill_first = spill && ((state.spill_min_size && size >= state.spill_min_size) ||
+                                       (state.spill_tags & (1U << tag)));
+    uint8_t * block = NULL;
+    bool in_spill = false;
+    if(!spill_first) block = lv_tlsf_malloc(state.tlsf, bytes);
+    if(block == NULL && spill) {
+        block = spill_malloc(bytes);
+        in_spill = block != NULL;
+    }
+    if(block == NULL && spill_first) block = lv_tlsf_malloc(state.tlsf, bytes);
+
+    if(block) {
+        size_t block_size = lv_tlsf_block_size(block);
+        tag_add(block, tag, block_size, in_spill);
+        state.cur_used += block_size;
+        state.max_used = LV_MAX(state.cur_used, state.max_used);
+    }
+    else {
+        state.spill_stats.failed++;
+    }
+
+#if LV_USE_OS
+    lv_mutex_unlock(&state.mutex);
+#endif
+    return block ? block + TAG_HEADER : NULL;
+}
+
+static lv_mem_spill_pool_t * spill_pool_of(const void * block)
+{
+    lv_mem_spill_pool_t * sp;
+    for(sp = state.spill_pools; sp; sp = sp->next) {
+        if((const uint8_t *)block > (const uint8_t *)sp && (const uint8_t *)block < sp->end) return sp;
+    }
+    return NULL;
+}
+
+static void * spill_malloc(size_t bytes)
+{
+    void * block = state.spill_tlsf ? lv_tlsf_malloc(state.spill_tlsf, bytes) : NULL;
+    if(block == NULL && spill_pool_add(bytes)) block = lv_tlsf_malloc(state.spill_tlsf, bytes);
+    if(block) spill_pool_of(block)->used_cnt++;
+    else if(state.spill_pools && state.spill_pools->used_cnt == 0) spill_pool_release(state.spill_pools);
+    return block;
+}
+
+static bool spill_pool_add(size_t bytes)
+{
+    if(state.spill_stats.pools >= state.spill_max_pools) return false;
+    if(bytes + SPILL_POOL_HEADER + lv_tlsf_pool_overhead() + lv_tlsf_alloc_overhead() > state.spill_pool_size) {
+        return false;
+    }
+
+    if(state.spill_tlsf == NULL) {
+        void * control = state.spill_malloc_cb(lv_tlsf_size());
+        if(control == NULL) return false;
+        state.spill_tlsf = lv_tlsf_create(control);
+    }
+
+    lv_mem_spill_pool_t * sp = state.spill_malloc_cb(state.spill_pool_size);
+    if(sp == NULL) return false;
+    sp->pool = lv_tlsf_add_pool(state.spill_tlsf, (uint8_t *)sp + SPILL_POOL_HEADER,
+                                state.spill_pool_size - SPILL_POOL_HEADER);
+    if(sp->pool == NULL) {
+        state.spill_free_cb(sp);
+        return false;
+    }
+    sp->end = (uint8_t *)sp + state.spill_pool_size;
+    sp->used_cnt = 0;
+    sp->next = state.spill_pools;
+    state.spill_pools = sp;
+
+    state.spill_stats.pools++;
+    state.spill_stats.added++;
+    state.spill_stats.max_pools = LV_MAX(state.spill_stats.max_pools, state.spill_stats.pools);
+    return true;
+}
+
+/**
+ * Give an empty spill pool back, unless it is the last one: an allocation freed and taken
+ * again does not take and give back a pool each time
+ */
+static void spill_pool_release(lv_mem_spill_pool_t * sp)
+{
+    if(sp->used_cnt > 0 || state.spill_stats.pools <= 1) return;
+
+    lv_mem_spill_pool_t ** prev = &state.spill_pools;
+    while(*prev != sp) prev = &(*prev)->next;
+    *prev = sp->next;
+    lv_tlsf_remove_pool(state.spill_tlsf, sp->pool);
+    state.spill_free_cb(sp);
+
+    state.spill_stats.pools--;
+    state.spill_stats.removed++;
+}
+
+static void tag_add(uint8_t * block, lv_mem_tag_t tag, size_t size, bool spill)
+{
+#if LV_USE_MEM_TAGS
+    block[0] = (uint8_t)tag;
+    lv_mem_tag_stats_t * ts = &state.tag_stats[tag];
+    ts->used += size;
+    ts->max_used = LV_MAX(ts->used, ts->max_used);
+    if(spill) ts->spill_used += size;
+    ts->cnt++;
+#else
+    LV_UNUSED(block);
+    LV_UNUSED(tag);
+    LV_UNUSED(size);
+    LV_UNUSED(spill);
+#endif
+}
+
+static void tag_sub(const uint8_t * block, size_t size, bool spill)
+{
+#if LV_USE_MEM_TAGS
+    lv_mem_tag_stats_t * ts = &state.tag_stats[block[0]];
+    ts->used -= size;
+    if(spill) ts->spill_used -= size;
+    ts->cnt--;
+#else
+    LV_UNUSED(block);
+    LV_UNUSED(size);
+    LV_UNUSED(spill);
+#endif
+}
+
 static void lv_mem_walker(void * ptr, size_t size, int used, void * user)
 {
     LV_UNUSED(ptr);
@@ -17,6 +17,7 @@ extern "C" {
  *********************/
 
 #include "lv_tlsf.h"
+#include "../lv_mem.h"
 #include "../../osal/lv_os_private.h"
 
 /*********************
@@ -27,6 +28,8 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+typedef struct _lv_mem_spill_pool_t lv_mem_spill_pool_t;
+
 typedef struct {
 #if LV_USE_OS
     lv_mutex_t mutex;
@@ -35,6 +38,19 @@ typedef struct {
     size_t cur_used;
     size_t max_used;
     lv_ll_t  pool_ll;
+
+    lv_tlsf_t spill_tlsf;               /**< Created with the first spill pool */
+    lv_mem_spill_pool_t * spill_pools;  /**< Linked through their headers */
+    size_t spill_pool_size;
+    uint32_t spill_max_pools;
+    size_t spill_min_size;
+    uint32_t spill_tags;
+    void * (*spill_malloc_cb)(size_t size);
+    void (*spill_free_cb)(void * p);
+    lv_mem_spill_stats_t spill_stats;
+#if LV_USE_MEM_TAGS
+    lv_mem_tag_stats_t tag_stats[LV_MEM_TAG_CNT];
+#endif
 } lv_tlsf_state_t;
 
 /**********************
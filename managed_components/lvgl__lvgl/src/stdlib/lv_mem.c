@@ -9,6 +9,7 @@
 #include "lv_string.h"
 #include "../misc/lv_assert.h"
 #include "../misc/lv_log.h"
+#include "../misc/lv_math.h"
 #include "../core/lv_global.h"
 
 #if LV_USE_OS == LV_OS_PTHREAD
@@ -25,6 +26,34 @@
 
 #define zero_mem LV_GLOBAL_DEFAULT()->memory_zero
 
+/*The draw threads count their allocations in their own tag*/
+#if LV_USE_OS && defined(__GNUC__)
+    static __thread uint8_t thread_mem_tag;
+    #define mem_tag thread_mem_tag
+#else
+    #define mem_tag LV_GLOBAL_DEFAULT()->memory_tag
+#endif
+
+#if LV_MEM_ARENA_CNT
+    /*Only the creating thread allocates from its arena*/
+    #if LV_USE_OS && defined(__GNUC__)
+        static __thread lv_mem_arena_t * thread_mem_arena;
+        #define mem_arena thread_mem_arena
+    #else
+        #define mem_arena LV_GLOBAL_DEFAULT()->memory_arena
+    #endif
+    #define arenas LV_GLOBAL_DEFAULT()->memory_arenas
+    /*Any thread may free an allocation of an arena, as any `lv_free()` looks the arenas up*/
+    #define arena_lock LV_GLOBAL_DEFAULT()->memory_arena_lock
+    #define arena_live LV_GLOBAL_DEFAULT()->memory_arena_live
+
+    /*The size of an allocation in front of it, to copy it when it is reallocated*/
+    #define ARENA_HEADER        8
+    #define ARENA_ALIGN(size)   LV_ALIGN_UP(size, 8)
+    /*What belongs to the objects of a screen and goes with them*/
+    #define ARENA_TAGS          ((1U << LV_MEM_TAG_OBJ) | (1U << LV_MEM_TAG_STYLE))
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -32,6 +61,14 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+#if LV_MEM_ARENA_CNT
+    static void * arena_alloc(size_t size);
+    static void * arena_take(lv_mem_arena_t * arena, size_t size);
+    static bool arena_may_hold(const void * p);
+    static lv_mem_arena_t * arena_find(const void * p);
+    static void arena_free(lv_mem_arena_t * arena, void * p);
+    static void * arena_realloc(lv_mem_arena_t * arena, void * p, size_t new_size);
+#endif
 
 /**********************
  *  GLOBAL PROTOTYPES
@@ -67,7 +104,12 @@ void * lv_malloc(size_t size)
         return &zero_mem;
     }
 
+#if LV_MEM_ARENA_CNT
+    void * alloc = arena_alloc(size);
+    if(alloc == NULL) alloc = lv_malloc_core(size);
+#else
     void * alloc = lv_malloc_core(size);
+#endif
 
     if(alloc == NULL) {
         LV_LOG_INFO("couldn't allocate memory (%lu bytes)", (unsigned long)size);
@@ -97,7 +139,12 @@ void * lv_malloc_zeroed(size_t size)
         return &zero_mem;
     }
 
+#if LV_MEM_ARENA_CNT
+    void * alloc = arena_alloc(size);
+    if(alloc == NULL) alloc = lv_malloc_core(size);
+#else
     void * alloc = lv_malloc_core(size);
+#endif
     if(alloc == NULL) {
         LV_LOG_INFO("couldn't allocate memory (%lu bytes)", (unsigned long)size);
 #if LV_LOG_LEVEL <= LV_LOG_LEVEL_INFO
@@ -133,6 +180,16 @@ void lv_free(void * data)
     if(data == &zero_mem) return;
     if(data == NULL) return;
 
+#if LV_MEM_ARENA_CNT
+    if(arena_may_hold(data)) {
+        lv_mutex_lock(&arena_lock);
+        lv_mem_arena_t * arena = arena_find(data);
+        if(arena) arena_free(arena, data);
+        lv_mutex_unlock(&arena_lock);
+        if(arena) return;
+    }
+#endif
+
     lv_free_core(data);
 }
 
@@ -156,7 +213,21 @@ void * lv_realloc(void * data_p, size_t new_size)
 
     if(data_p == &zero_mem) return lv_malloc(new_size);
 
+#if LV_MEM_ARENA_CNT
+    if(data_p == NULL) return lv_malloc(new_size);
+
+    lv_mem_arena_t * arena = NULL;
+    void * new_p = NULL;
+    if(arena_may_hold(data_p)) {
+        lv_mutex_lock(&arena_lock);
+        arena = arena_find(data_p);
+        if(arena) new_p = arena_realloc(arena, data_p, new_size);
+        lv_mutex_unlock(&arena_lock);
+    }
+    if(arena == NULL) new_p = lv_realloc_core(data_p, new_size);
+#else
     void * new_p = lv_realloc_core(data_p, new_size);
+#endif
 
     if(new_p == NULL) {
         LV_LOG_ERROR("couldn't reallocate memory");
@@ -167,6 +238,117 @@ void * lv_realloc(void * data_p, size_t new_size)
     return new_p;
 }
 
+lv_mem_tag_t lv_mem_set_tag(lv_mem_tag_t tag)
+{
+    lv_mem_tag_t prev = mem_tag;
+    mem_tag = tag;
+    return prev;
+}
+
+lv_mem_tag_t lv_mem_get_tag(void)
+{
+    return mem_tag;
+}
+
+#if LV_MEM_ARENA_CNT
+void lv_mem_arena_init(void)
+{
+    lv_mutex_init(&arena_lock);
+}
+
+void lv_mem_arena_deinit(void)
+{
+    lv_mutex_delete(&arena_lock);
+}
+
+lv_mem_arena_t * lv_mem_arena_create(size_t size, void * (*malloc_cb)(size_t size), void (*free_cb)(void * p))
+{
+    /*Not with `lv_malloc()`: the region would come from the arena set by the caller*/
+    if(malloc_cb == NULL) {
+        malloc_cb = lv_malloc_core;
+        free_cb = lv_free_core;
+    }
+    size = ARENA_ALIGN(size);
+    uint8_t * buf = malloc_cb(size);
+    if(buf == NULL) {
+        LV_LOG_WARN("couldn't allocate an arena of %lu bytes", (unsigned long)size);
+        return NULL;
+    }
+
+    lv_mem_arena_t * arena = NULL;
+    lv_mutex_lock(&arena_lock);
+    uint32_t i;
+    for(i = 0; i < LV_MEM_ARENA_CNT; i++) {
+        if(arenas[i].buf == NULL) {
+            arena = &arenas[i];
+            lv_memzero(arena, sizeof(lv_mem_arena_t));
+            arena->buf = buf;
+            arena->next = buf;
+            arena->end = buf + size;
+            arena->free_cb = free_cb;
+            arena->cnt = 1;
+            arena_live++;
+            break;
+        }
+    }
+    lv_mutex_unlock(&arena_lock);
+
+    if(arena == NULL) {
+        LV_LOG_WARN("%d arenas exist already", LV_MEM_ARENA_CNT);
+        free_cb(buf);
+    }
+    return arena;
+}
+
+lv_mem_arena_t * lv_mem_set_arena(lv_mem_arena_t * arena)
+{
+    LV_ASSERT(arena == NULL || !arena->released);
+    lv_mem_arena_t * prev = mem_arena;
+    mem_arena = arena;
+    return prev;
+}
+
+lv_mem_arena_t * lv_mem_set_arena_for(const void * owner)
+{
+    lv_mem_arena_t * arena = mem_arena;
+    if(arena && lv_mem_arena_of(owner) != arena) mem_arena = NULL;
+    return arena;
+}
+
+void lv_mem_arena_release(lv_mem_arena_t * arena)
+{
+    LV_ASSERT_NULL(arena);
+    LV_ASSERT(!arena->released);
+    if(mem_arena == arena) mem_arena = NULL;
+    lv_mutex_lock(&arena_lock);
+    arena->released = true;
+    arena_free(arena, NULL);
+    lv_mutex_unlock(&arena_lock);
+}
+
+lv_mem_arena_t * lv_mem_arena_of(const void * p)
+{
+    if(!arena_may_hold(p)) return NULL;
+    lv_mutex_lock(&arena_lock);
+    lv_mem_arena_t * arena = arena_find(p);
+    lv_mutex_unlock(&arena_lock);
+    return arena;
+}
+
+void lv_mem_arena_get_stats(const lv_mem_arena_t * arena, lv_mem_arena_stats_t * stats)
+{
+    LV_ASSERT_NULL(arena);
+    LV_ASSERT_NULL(stats);
+    lv_mutex_lock(&arena_lock);
+    stats->size = arena->end - arena->buf;
+    stats->used = arena->next - arena->buf;
+    stats->max_used = arena->max_used;
+    stats->cnt = arena->cnt - (arena->released ? 0 : 1);
+    stats->fallbacks = arena->fallbacks;
+    lv_mutex_unlock(&arena_lock);
+}
+#endif /*LV_MEM_ARENA_CNT*/
+
 lv_result_t lv_mem_test(void)
 {
     if(zero_mem != ZERO_MEM_SENTINEL) {
@@ -186,3 +368,113 @@ void lv_mem_monitor(lv_mem_monitor_t * mon_p)
 /**********************
  *   STATIC FUNCTIONS
  **********************/
+
+#if LV_MEM_ARENA_CNT
+/**
+ * Allocate from the arena of the calling thread, if the allocation belongs to the objects
+ * @return      the memory, or NULL to allocate it from the heap
+ */
+static void * arena_alloc(size_t size)
+{
+    lv_mem_arena_t * arena = mem_arena;
+    if(arena == NULL || !(ARENA_TAGS & (1U << mem_tag))) return NULL;
+
+    lv_mutex_lock(&arena_lock);
+    void * p = arena_take(arena, size);
+    if(p == NULL) arena->fallbacks++;
+    lv_mutex_unlock(&arena_lock);
+    return p;
+}
+
+/**
+ * Look the arenas up without `arena_lock`, for the heap blocks not to take it. An allocation of an
+ * arena keeps it in the table until the allocation is freed, and a region created meanwhile can't
+ * hold a block still allocated in the heap, so a miss is certain. A hit is confirmed under the lock.
+ */
+static bool arena_may_hold(const void * p)
+{
+    if(arena_live == 0) return false;
+    const uint8_t * b = p;
+    uint32_t i;
+    for(i = 0; i < LV_MEM_ARENA_CNT; i++) {
+        if(b >= arenas[i].buf && b < arenas[i].end) return true;
+    }
+    return false;
+}
+
+/**
+ * The functions below are called with `arena_lock` held
+ */
+static void * arena_take(lv_mem_arena_t * arena, size_t size)
+{
+    size_t block = ARENA_HEADER + ARENA_ALIGN(size);
+    if(block > (size_t)(arena->end - arena->next)) return NULL;
+
+    uint8_t * p = arena->next + ARENA_HEADER;
+    *(size_t *)arena->next = size;
+    arena->last = p;
+    arena->next += block;
+    arena->cnt++;
+    if((size_t)(arena->next - arena->buf) > arena->max_used) arena->max_used = arena->next - arena->buf;
+    return p;
+}
+
+static lv_mem_arena_t * arena_find(const void * p)
+{
+    const uint8_t * b = p;
+    uint32_t i;
+    for(i = 0; i < LV_MEM_ARENA_CNT; i++) {
+        if(b >= arenas[i].buf && b < arenas[i].end) return &arenas[i];
+    }
+    return NULL;
+}
+
+/**
+ * Count an allocation of the arena freed: only the last one gives its bytes back.
+ * The region is freed with the last allocation of a released arena.
+ * @param p     the allocation, NULL: the reference of the creator
+ */
+static void arena_free(lv_mem_arena_t * arena, void * p)
+{
+    if(p != NULL && p == arena->last) {
+        arena->next = (uint8_t *)p - ARENA_HEADER;
+        arena->last = NULL;
+    }
+
+    arena->cnt--;
+    if(arena->cnt > 0) return;
+
+    /*Out of the table first: its range is looked up by every `lv_free()`*/
+    uint8_t * buf = arena->buf;
+    void (*free_cb)(void * p) = arena->free_cb;
+    lv_memzero(arena, sizeof(lv_mem_arena_t));
+    arena_live--;
+    free_cb(buf);
+}
+
+/**
+ * Resize an allocation of the arena: in place when it is the last one, else by a copy in the
+ * arena, or in the heap if it is not set anymore or full.
+ */
+static void * arena_realloc(lv_mem_arena_t * arena, void * p, size_t new_size)
+{
+    size_t size = *(size_t *)((uint8_t *)p - ARENA_HEADER);
+    bool in_arena = arena == mem_arena && (ARENA_TAGS & (1U << mem_tag));
+    if(in_arena && p == arena->last && ARENA_ALIGN(new_size) <= (size_t)(arena->end - (uint8_t *)p)) {
+        *(size_t *)((uint8_t *)p - ARENA_HEADER) = new_size;
+        arena->next = (uint8_t *)p + ARENA_ALIGN(new_size);
+        if((size_t)(arena->next - arena->buf) > arena->max_used) arena->max_used = arena->next - arena->buf;
+        return p;
+    }
+
+    void * new_p = in_arena ? arena_take(arena, new_size) : NULL;
+    if(new_p == NULL) {
+        if(in_arena) arena->fallbacks++;
+        new_p = lv_malloc_core(new_size);
+        if(new_p == NULL) return NULL;
+    }
+    lv_memcpy(new_p, p, LV_MIN(size, new_size));
+    arena_free(arena, p);
+    return new_p;
+}
+#endif /*LV_MEM_ARENA_CNT*/
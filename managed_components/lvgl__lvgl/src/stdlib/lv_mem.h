@@ -43,6 +43,51 @@ typedef struct {
     uint8_t frag_pct;   /**< Amount of fragmentation */
 } lv_mem_monitor_t;
 
+/**
+ * Subsystem an allocation is counted in, see `lv_mem_set_tag()`
+ */
+typedef enum {
+    LV_MEM_TAG_APP,         /**< Outside of the tagged subsystems: label texts, chart points, user data... */
+    LV_MEM_TAG_OBJ,         /**< Objects and their attributes, created and initialized */
+    LV_MEM_TAG_STYLE,       /**< Style properties and the styles of the objects */
+    LV_MEM_TAG_DRAW,        /**< Draw tasks, layers and buffers of a refresh */
+    LV_MEM_TAG_CACHE,       /**< Cache entries and their data, e.g. decoded images */
+    LV_MEM_TAG_CNT,
+} lv_mem_tag_t;
+
+/**
+ * The heaps of the builtin allocator
+ */
+typedef enum {
+    LV_MEM_HEAP_MAIN,       /**< `LV_MEM_SIZE` and the pools of `lv_mem_add_pool()` */
+    LV_MEM_HEAP_SPILL,      /**< The pools of `lv_mem_set_spill_pools()` */
+} lv_mem_heap_t;
+
+typedef struct {
+    size_t used;            /**< Bytes in use, the allocator's overhead included */
+    size_t max_used;        /**< Most bytes in use at once */
+    size_t spill_used;      /**< Part of `used` in the spill pools */
+    uint32_t cnt;           /**< Allocations in use */
+} lv_mem_tag_stats_t;
+
+typedef struct {
+    uint32_t pools;         /**< Spill pools in the heap */
+    uint32_t max_pools;     /**< Most spill pools at once */
+    uint32_t added;         /**< Spill pools taken from the allocator */
+    uint32_t removed;       /**< Empty spill pools given back to it */
+    uint32_t failed;        /**< Allocations failing in both heaps */
+} lv_mem_spill_stats_t;
+
+typedef struct _lv_mem_arena_t lv_mem_arena_t;
+
+typedef struct {
+    size_t size;            /**< Bytes of the region */
+    size_t used;            /**< Bytes taken from it, the freed ones in the middle included */
+    size_t max_used;        /**< Most bytes taken at once */
+    uint32_t cnt;           /**< Allocations in use in it */
+    uint32_t fallbacks;     /**< Allocations not fitting in it, made in the heap */
+} lv_mem_arena_stats_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -61,6 +106,134 @@ lv_mem_pool_t lv_mem_add_pool(void * mem, size_t bytes);
 
 void lv_mem_remove_pool(lv_mem_pool_t pool);
 
+/**
+ * Count the next allocations of the calling thread in a subsystem, until the previous tag
+ * is set back. LVGL sets it around the creation of objects, the styles, the refreshes, the
+ * draw threads and the caches. Without `__thread` all the threads share one tag.
+ * @param tag   element of `lv_mem_tag_t`
+ * @return      the previous tag
+ */
+lv_mem_tag_t lv_mem_set_tag(lv_mem_tag_t tag);
+
+/**
+ * Get the tag of the next allocations of the calling thread
+ * @return      element of `lv_mem_tag_t`
+ */
+lv_mem_tag_t lv_mem_get_tag(void);
+
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN
+/**
+ * Spill allocations from the heap of `LV_MEM_SIZE` to pools taken on demand, e.g. in PSRAM.
+ * A pool of `pool_size` bytes is taken from `malloc_cb` when an allocation fits in no spill
+ * pool, up to `max_pools`; a spill pool is given back when it is empty and not the last one.
+ * Call it before the first spill pool is taken, or to change the limit.
+ * @param pool_size     bytes of a pool, at most `LV_MEM_SIZE + LV_MEM_POOL_EXPAND_SIZE`; 0: no spill (the default)
+ * @param max_pools     most pools at once
+ * @param malloc_cb     allocator of the pools, NULL: no spill
+ * @param free_cb       free of `malloc_cb`
+ */
+void lv_mem_set_spill_pools(size_t pool_size, uint32_t max_pools, void * (*malloc_cb)(size_t size),
+                            void (*free_cb)(void * p));
+
+/**
+ * Select the allocations going to the spill pools first; the others go there when the heap
+ * of `LV_MEM_SIZE` is full. Each one goes to the other heap when its own is full.
+ * @param min_size      allocations of at least this many bytes, 0: none by size
+ * @param tag_mask      allocations of these tags, bits `1 << lv_mem_tag_t`
+ */
+void lv_mem_set_spill_policy(size_t min_size, uint32_t tag_mask);
+
+/**
+ * Get the statistics of the spill pools.
+ * @param stats     filled with the pools and the counters since start or since the last reset
+ * @param reset     clear the counters after reading
+ */
+void lv_mem_get_spill_stats(lv_mem_spill_stats_t * stats, bool reset);
+
+/**
+ * Give information about one heap, like `lv_mem_monitor()` for all of them
+ * @param heap      element of `lv_mem_heap_t`
+ * @param mon_p     filled with its size, use and fragmentation
+ */
+void lv_mem_monitor_heap(lv_mem_heap_t heap, lv_mem_monitor_t * mon_p);
+
+#if LV_USE_MEM_TAGS
+/**
+ * Get the memory in use by a subsystem.
+ * @param tag       element of `lv_mem_tag_t`
+ * @param stats     filled with the bytes and allocations in use
+ * @param reset     start `max_used` again from the bytes in use
+ */
+void lv_mem_get_tag_stats(lv_mem_tag_t tag, lv_mem_tag_stats_t * stats, bool reset);
+#endif
+#endif /*LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN*/
+
+#if LV_MEM_ARENA_CNT
+/**
+ * Create a memory arena: one region the objects of a screen are allocated from one after the
+ * other while it is set with `lv_mem_set_arena()`, instead of one heap block each.
+ * Freeing them only counts them; the region is freed in one go with the last one once the
+ * arena is released, e.g. by deleting the screen.
+ * @param size          bytes of the region
+ * @param malloc_cb     allocator of the region, NULL: the heap of `lv_malloc()`
+ * @param free_cb       free of `malloc_cb`
+ * @return              the arena, or NULL when `LV_MEM_ARENA_CNT` arenas exist or the region can't be allocated
+ */
+lv_mem_arena_t * lv_mem_arena_create(size_t size, void * (*malloc_cb)(size_t size), void (*free_cb)(void * p));
+
+/**
+ * Allocate the objects, their attributes, local styles and event descriptors created by the
+ * calling thread from an arena, until the previous arena is set back. The other allocations,
+ * those not fitting and those reallocated after it is set back go to the heap.
+ * @param arena     an arena not released yet, NULL: none
+ * @return          the previous arena
+ */
+lv_mem_arena_t * lv_mem_set_arena(lv_mem_arena_t * arena);
+
+/**
+ * Keep the arena of the calling thread for the next allocations only if they belong to an
+ * object or style allocated in it: those of one allocated elsewhere (the screen a page is
+ * built on, a shared style) outlive the page and would keep the arena from being freed.
+ * @param owner     the object or style the next allocations are kept by
+ * @return          the arena to set back with `lv_mem_set_arena()` after them
+ */
+lv_mem_arena_t * lv_mem_set_arena_for(const void * owner);
+
+/**
+ * Give up the arena: its region is freed with its last allocation, at once if there is none.
+ * It can't be set or queried anymore.
+ * @param arena     the arena
+ */
+void lv_mem_arena_release(lv_mem_arena_t * arena);
+
+/**
+ * Get the arena an allocation was made in
+ * @param p     any pointer
+ * @return      the arena whose region holds `p`, or NULL
+ */
+lv_mem_arena_t * lv_mem_arena_of(const void * p);
+
+/**
+ * Get the use of an arena not released yet
+ * @param arena     the arena
+ * @param stats     filled with its size and the bytes and allocations in it
+ */
+void lv_mem_arena_get_stats(const lv_mem_arena_t * arena, lv_mem_arena_stats_t * stats);
+
+#else
+static inline lv_mem_arena_t * lv_mem_set_arena(lv_mem_arena_t * arena)
+{
+    LV_UNUSED(arena);
+    return NULL;
+}
+
+static inline lv_mem_arena_t * lv_mem_set_arena_for(const void * owner)
+{
+    LV_UNUSED(owner);
+    return NULL;
+}
+#endif /*LV_MEM_ARENA_CNT*/
+
 /**
  * Allocate memory dynamically
  * @param size requested size in bytes
@@ -24,10 +24,30 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+#if LV_MEM_ARENA_CNT
+struct _lv_mem_arena_t {
+    uint8_t * buf;              /**< The region, NULL: unused slot */
+    uint8_t * end;
+    uint8_t * next;             /**< Its first free byte */
+    uint8_t * last;             /**< Its last allocation, resized and freed in place */
+    void (*free_cb)(void * p);
+    size_t max_used;
+    uint32_t cnt;               /**< Allocations in it, +1 until released */
+    uint32_t fallbacks;
+    bool released;
+};
+#endif
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
 
+#if LV_MEM_ARENA_CNT
+void lv_mem_arena_init(void);
+
+void lv_mem_arena_deinit(void);
+#endif
+
 /**********************
  *      MACROS
  **********************/
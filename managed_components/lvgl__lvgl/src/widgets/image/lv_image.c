@@ -860,6 +860,18 @@ static void draw_image(lv_event_t * e)
             info->res = LV_COVER_RES_NOT_COVER;
             return;
         }
+
+        /*The background of the widget may be transparent: an image filling the widget covers it anyway*/
+        if(info->res == LV_COVER_RES_NOT_COVER &&
+           img->w == lv_obj_get_width(obj) && img->h == lv_obj_get_height(obj) &&
+           img->offset.x == 0 && img->offset.y == 0 && img->align < _LV_IMAGE_ALIGN_AUTO_TRANSFORM &&
+           img->scale_x == LV_SCALE_NONE && img->scale_y == LV_SCALE_NONE &&
+           img->blend_mode == LV_BLEND_MODE_NORMAL &&
+           lv_obj_get_style_radius(obj, LV_PART_MAIN) == 0 &&
+           lv_obj_get_style_opa(obj, LV_PART_MAIN) >= LV_OPA_MAX &&
+           lv_obj_get_style_blend_mode(obj, LV_PART_MAIN) == LV_BLEND_MODE_NORMAL) {
+            info->res = LV_COVER_RES_COVER;
+        }
     }
     else if(code == LV_EVENT_DRAW_MAIN) {
 
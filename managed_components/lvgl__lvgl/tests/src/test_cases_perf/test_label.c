@@ -17,4 +17,28 @@ void test_label(void)
                          "Lorem ipsum dolor sit amet, consectetur adipiscing elit. Ut auctor sed dui interdum convallis. Proin in ante magna. Pellentesque placerat condimentum erat ac laoreet. Cras mi eros, convallis vitae massa ac, blandit sodales urna. Proin tincidunt fermentum leo a volutpat. Donec ut blandit tortor. Duis elementum nibh nec consequat sagittis. Lutrae sunt praeclarae");
 
 }
+
+/* Short numeric labels (a clock, a temperature) redrawn from the glyph cache */
+static void set_next_text_and_refresh(lv_obj_t * obj)
+{
+    static const char * texts[] = {"12:34", "12:35", "21.5\u00B0C", "21.6\u00B0C"};
+    static uint32_t n;
+
+    lv_label_set_text(obj, texts[n++ % 4]);
+    lv_refr_now(NULL);
+}
+
+void test_label_numeric(void)
+{
+    lv_font_glyph_cache_set_size(8 * 1024, NULL, NULL);
+    lv_font_fmt_txt_add_ascii_index(LV_FONT_DEFAULT);
+    set_next_text_and_refresh(label);
+
+    TEST_ASSERT_MAX_TIME_ITER(set_next_text_and_refresh, 5, 100, label);
+
+    lv_font_glyph_cache_stats_t stats;
+    lv_font_glyph_cache_get_stats(&stats, false);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.uncached);
+    lv_font_glyph_cache_set_size(0, NULL, NULL);
+}
 #endif
@@ -310,7 +310,12 @@ esp_err_t bsp_display_new(const bsp_display_config_t *config, esp_lcd_panel_hand
             BSP_LCD_DATA15,
         },
         .timings = ST7701_480_480_PANEL_60HZ_RGB_TIMING(),
+#if CONFIG_BSP_DISPLAY_LVGL_SCANOUT
+        /* The bounce buffers are filled by the LVGL port from its tile store */
+        .flags.no_fb = 1,
+#else
         .flags.fb_in_psram = 1,
+#endif
         .num_fbs = CONFIG_BSP_LCD_RGB_BUFFER_NUMS,
         .bounce_buffer_size_px = BSP_LCD_DRAW_BUFF_SIZE,
     };
@@ -413,6 +418,9 @@ static lv_display_t *bsp_display_lcd_init()
         .io_handle = io_handle,
         .panel_handle = panel_handle,
         .buffer_size = buffer_size,
+#if BSP_LVGL_ASYNC_FLUSH
+        .double_buffer = true,
+#endif
 
         .monochrome = false,
         .hres = BSP_LCD_H_RES,
@@ -427,8 +435,23 @@ static lv_display_t *bsp_display_lcd_init()
             .mirror_y = false,
         },
         .flags = {
+#if CONFIG_BSP_DISPLAY_LVGL_AVOID_TEAR
+            /* LVGL draws in the panel framebuffers, a rotation buffer would be a third frame */
+            .sw_rotate = false,
+#elif BSP_LVGL_ASYNC_FLUSH
+            /* A rotation buffer would be a third internal buffer, and rotated areas are copied by the CPU */
+            .sw_rotate = false,
+#elif CONFIG_BSP_DISPLAY_LVGL_SCANOUT
+            /* Areas are stored as rendered: no rotation buffer */
+            .sw_rotate = false,
+#else
             .sw_rotate = true,
+#endif
+#if BSP_LVGL_ASYNC_FLUSH
+            .buff_dma = true,
+#else
             .buff_dma = false,
+#endif
 #if CONFIG_BSP_DISPLAY_LVGL_PSRAM
             .buff_spiram = false,
 #endif
@@ -443,7 +466,7 @@ static lv_display_t *bsp_display_lcd_init()
         }};
     const lvgl_port_display_rgb_cfg_t rgb_cfg = {
         .flags = {
-#if CONFIG_BSP_LCD_RGB_BOUNCE_BUFFER_MODE
+#if CONFIG_BSP_LCD_RGB_BOUNCE_BUFFER_MODE || CONFIG_BSP_DISPLAY_LVGL_SCANOUT
             .bb_mode = 1,
 #else
             .bb_mode = 0,
@@ -453,7 +476,20 @@ static lv_display_t *bsp_display_lcd_init()
 #else
             .avoid_tearing = false,
 #endif
-        }};
+#if BSP_LVGL_ASYNC_FLUSH
+            .async_flush = true,
+#endif
+#if CONFIG_BSP_DISPLAY_LVGL_VSYNC_PACED
+            .vsync_paced = true,
+#endif
+#if CONFIG_BSP_DISPLAY_LVGL_SCANOUT
+            .no_fb = true,
+#endif
+        },
+#if CONFIG_BSP_DISPLAY_LVGL_SCANOUT_RLE_LINES
+        .scanout_format = LVGL_PORT_SCANOUT_RLE_LINES,
+#endif
+    };
 
 #if CONFIG_BSP_LCD_RGB_BOUNCE_BUFFER_MODE
     ESP_LOGW(TAG, "CONFIG_BSP_LCD_RGB_BOUNCE_BUFFER_MODE");
@@ -74,6 +74,12 @@
 
 #define BSP_IO_EXPANDER_I2C_ADDRESS     (CUSTOM_IO_EXPANDER_I2C_CH32V003_ADDRESS)
 #define LVGL_BUFFER_HEIGHT          (CONFIG_BSP_DISPLAY_LVGL_BUF_HEIGHT)
+/* The GDMA copies partial draw buffers only: nothing to copy when LVGL renders into the frame buffers */
+#if CONFIG_BSP_DISPLAY_LVGL_ASYNC_FLUSH && !CONFIG_BSP_DISPLAY_LVGL_AVOID_TEAR
+#define BSP_LVGL_ASYNC_FLUSH        (1)
+#else
+#define BSP_LVGL_ASYNC_FLUSH        (0)
+#endif
 
 #ifdef __cplusplus
 extern "C" {
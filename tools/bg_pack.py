@@ -0,0 +1,239 @@
+#!/usr/bin/env python3
+"""
+Pack a room background into an LVGL compressed binary image (.bin) for the
+`storage` partition.
+
+Input:  a PNG (8-bit RGB / RGBA, not interlaced) or a C file produced by the
+        LVGL Image Converter (RGB565, e.g. main/backg_room1.c).
+Output: lv_image_header_t + lv_image_compressed_t + data, colour format RGB565.
+
+  --rle        LVGL RLE (LV_IMAGE_COMPRESS_RLE, 2-byte blocks). Runs never cross
+               a row, so the firmware can index rows and decode only the lines
+               being redrawn. Still a valid stream for LVGL's own bin decoder.
+  --lz4        LZ4 (LV_IMAGE_COMPRESS_LZ4) in independent bands of --band rows
+               (default 16). The band height is kept in the `reserved` bits of
+               the compression header and the data starts with the band offset
+               table. Only readable by main/bg_image.c.
+
+Python standard library only.
+
+  python3 tools/bg_pack.py --rle main/backg_room1.c storage_build/bg/room1.bin
+"""
+import argparse
+import re
+import struct
+import sys
+import zlib
+
+LV_IMAGE_HEADER_MAGIC = 0x19
+LV_COLOR_FORMAT_RGB565 = 0x12
+LV_IMAGE_FLAGS_COMPRESSED = 0x0008
+LV_IMAGE_COMPRESS_RLE = 1
+LV_IMAGE_COMPRESS_LZ4 = 2
+
+RLE_MAX = 127       # 7-bit count in the control byte
+RLE_MIN_REPEAT = 3  # a 2-pixel repeat costs as much as staying in a literal
+
+
+# ---------------- Input ----------------
+def load_c_array(path):
+    text = open(path, encoding="utf-8", errors="replace").read()
+    cf = re.search(r"\.header\.cf\s*=\s*(\w+)", text)
+    w = re.search(r"\.header\.w\s*=\s*(\d+)", text)
+    h = re.search(r"\.header\.h\s*=\s*(\d+)", text)
+    body = re.search(r"_map\s*\[\s*\]\s*=\s*\{(.*?)\};", text, re.S)
+    if not (cf and w and h and body):
+        sys.exit(f"{path}: not an LVGL image C file")
+    if cf.group(1) != "LV_COLOR_FORMAT_RGB565":
+        sys.exit(f"{path}: {cf.group(1)} not supported, convert the image as RGB565")
+    data = bytes(int(v, 16) for v in re.findall(r"0x([0-9a-fA-F]{1,2})", body.group(1)))
+    w, h = int(w.group(1)), int(h.group(1))
+    if len(data) != w * h * 2:
+        sys.exit(f"{path}: {len(data)} bytes, expected {w * h * 2}")
+    return w, h, data
+
+
+def png_rgba(path):
+    """8-bit RGB / RGBA PNG -> (w, h, RGBA bytes)."""
+    raw = open(path, "rb").read()
+    if raw[:8] != b"\x89PNG\r\n\x1a\n":
+        sys.exit(f"{path}: not a PNG")
+    pos, idat, w = 8, b"", 0
+    while pos < len(raw):
+        n, kind = struct.unpack(">I4s", raw[pos:pos + 8])
+        chunk = raw[pos + 8:pos + 8 + n]
+        if kind == b"IHDR":
+            w, h, depth, ctype, _, _, interlace = struct.unpack(">IIBBBBB", chunk)
+            if depth != 8 or ctype not in (2, 6) or interlace:
+                sys.exit(f"{path}: only 8-bit RGB/RGBA non-interlaced PNGs are supported")
+            bpp = 3 if ctype == 2 else 4
+        elif kind == b"IDAT":
+            idat += chunk
+        pos += 12 + n
+    if not w:
+        sys.exit(f"{path}: missing IHDR")
+
+    src = zlib.decompress(idat)
+    stride = w * bpp
+    prev = bytearray(stride)
+    out = bytearray()
+    for y in range(h):
+        ftype = src[y * (stride + 1)]
+        line = bytearray(src[y * (stride + 1) + 1:(y + 1) * (stride + 1)])
+        for i in range(stride):
+            a = line[i - bpp] if i >= bpp else 0
+            b = prev[i]
+            c = prev[i - bpp] if i >= bpp else 0
+            if ftype == 1:
+                line[i] = (line[i] + a) & 0xFF
+            elif ftype == 2:
+                line[i] = (line[i] + b) & 0xFF
+            elif ftype == 3:
+                line[i] = (line[i] + ((a + b) >> 1)) & 0xFF
+            elif ftype == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                pred = a if pa <= pb and pa <= pc else (b if pb <= pc else c)
+                line[i] = (line[i] + pred) & 0xFF
+        for x in range(w):
+            out += line[x * bpp:x * bpp + 3]
+            out.append(line[x * bpp + 3] if bpp == 4 else 0xFF)
+        prev = line
+    return w, h, bytes(out)
+
+
+def load_png(path):
+    w, h, rgba = png_rgba(path)
+    out = bytearray()
+    for i in range(0, len(rgba), 4):
+        r, g, b, alpha = rgba[i:i + 4]
+        # backgrounds are opaque: flatten on black
+        r, g, b = (r * alpha // 255, g * alpha // 255, b * alpha // 255)
+        out += struct.pack("<H", ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3))
+    return w, h, bytes(out)
+
+
+# ---------------- RLE (row aligned) ----------------
+def rle_row(px):
+    out = bytearray()
+    n, i = len(px), 0
+    while i < n:
+        run = 1
+        while i + run < n and run < RLE_MAX and px[i + run] == px[i]:
+            run += 1
+        if run >= RLE_MIN_REPEAT:
+            out.append(run)
+            out += px[i]
+            i += run
+            continue
+        start = i
+        while i < n and i - start < RLE_MAX:
+            if i + RLE_MIN_REPEAT <= n and px[i] == px[i + 1] == px[i + 2]:
+                break
+            i += 1
+        out.append(0x80 | (i - start))
+        for p in px[start:i]:
+            out += p
+    return out
+
+
+def pack_rle(w, h, data):
+    out = bytearray()
+    for y in range(h):
+        row = data[y * w * 2:(y + 1) * w * 2]
+        out += rle_row([row[x * 2:x * 2 + 2] for x in range(w)])
+    return 0, bytes(out)
+
+
+# ---------------- LZ4 (independent bands) ----------------
+LZ4_MIN_MATCH = 4
+LZ4_LAST_LITERALS = 5
+LZ4_MF_LIMIT = 12
+
+
+def lz4_lengths(out, n):
+    while n >= 255:
+        out.append(255)
+        n -= 255
+    out.append(n)
+
+
+def lz4_block(src):
+    """Greedy LZ4 block compressor (format rules from lz4_Block_format.md)."""
+    out = bytearray()
+    n = len(src)
+    table = {}
+    anchor = i = 0
+    limit = n - LZ4_MF_LIMIT
+    while i < limit:
+        key = src[i:i + 4]
+        ref = table.get(key)
+        table[key] = i
+        if ref is None or i - ref > 0xFFFF:
+            i += 1
+            continue
+        mlen = 4
+        end = n - LZ4_LAST_LITERALS
+        while i + mlen < end and src[ref + mlen] == src[i + mlen]:
+            mlen += 1
+        lit = i - anchor
+        ml = mlen - LZ4_MIN_MATCH
+        out.append((min(lit, 15) << 4) | min(ml, 15))
+        if lit >= 15:
+            lz4_lengths(out, lit - 15)
+        out += src[anchor:i]
+        out += struct.pack("<H", i - ref)
+        if ml >= 15:
+            lz4_lengths(out, ml - 15)
+        i += mlen
+        anchor = i
+    lit = n - anchor
+    out.append(min(lit, 15) << 4)
+    if lit >= 15:
+        lz4_lengths(out, lit - 15)
+    out += src[anchor:]
+    return out
+
+
+def pack_lz4(w, h, data, band_h):
+    stride = w * 2
+    bands = (h + band_h - 1) // band_h
+    blocks = [lz4_block(data[b * band_h * stride:min(h, (b + 1) * band_h) * stride]) for b in range(bands)]
+    offsets, pos = [], 4 * (bands + 1)
+    for blk in blocks:
+        offsets.append(pos)
+        pos += len(blk)
+    offsets.append(pos)
+    return band_h, struct.pack(f"<{bands + 1}I", *offsets) + b"".join(blocks)
+
+
+# ---------------- Output ----------------
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    method = ap.add_mutually_exclusive_group(required=True)
+    method.add_argument("--rle", action="store_true")
+    method.add_argument("--lz4", action="store_true")
+    ap.add_argument("--band", type=int, default=16, metavar="ROWS", help="LZ4 band height (default 16)")
+    ap.add_argument("input", help="PNG or LVGL C image (RGB565)")
+    ap.add_argument("output", help="LVGL .bin")
+    args = ap.parse_args()
+
+    w, h, data = load_png(args.input) if args.input.lower().endswith(".png") else load_c_array(args.input)
+    if args.rle:
+        kind, (reserved, payload) = LV_IMAGE_COMPRESS_RLE, pack_rle(w, h, data)
+    else:
+        if not 1 <= args.band <= h:
+            sys.exit(f"--band: must be 1..{h}")
+        kind, (reserved, payload) = LV_IMAGE_COMPRESS_LZ4, pack_lz4(w, h, data, args.band)
+
+    header = struct.pack("<BBHHHHH", LV_IMAGE_HEADER_MAGIC, LV_COLOR_FORMAT_RGB565,
+                         LV_IMAGE_FLAGS_COMPRESSED, w, h, w * 2, 0)
+    compressed = struct.pack("<III", kind | (reserved << 4), len(payload), len(data))
+    with open(args.output, "wb") as f:
+        f.write(header + compressed + payload)
+    print(f"{args.output}: {w}x{h} RGB565, {len(data)} -> {len(payload) + 24} bytes "
+          f"({100 * (len(payload) + 24) / len(data):.1f} %)")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,152 @@
+#!/usr/bin/env python3
+"""
+Convert a dashboard icon to the colour format it is linked with.
+
+Input:  a C file produced by the LVGL Image Converter (ARGB8888, e.g.
+        main/floor_lamp.c) or an 8-bit RGBA PNG.
+Output: the same kind of C file (same symbol unless --name is given) in
+
+  --cf rgb565a8      RGB565 plane followed by an 8-bit alpha plane, 3 B/px.
+                     Drawn as an RGB565 copy through an alpha mask: no 32-bit
+                     pixel conversion on the 16-bit display.
+  --cf argb8888_premultiplied
+                     ARGB8888 with the colour already multiplied by alpha,
+                     saves one multiply per channel and pixel when blending.
+  --cf argb8888      unchanged, as converted.
+
+Colour is truncated to RGB565 exactly like LVGL does when it blends ARGB8888
+to an RGB565 display, and premultiplication matches lv_draw_buf_premultiply().
+
+Python standard library only.
+
+  python3 tools/icon_pack.py --cf rgb565a8 main/floor_lamp.c build/icons/floor_lamp.c
+"""
+import argparse
+import re
+import sys
+
+from bg_pack import png_rgba
+
+FORMATS = {
+    "rgb565a8": "LV_COLOR_FORMAT_RGB565A8",
+    "argb8888_premultiplied": "LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED",
+    "argb8888": "LV_COLOR_FORMAT_ARGB8888",
+}
+
+PREAMBLE = """#ifdef __has_include
+    #if __has_include("lvgl.h")
+        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
+            #define LV_LVGL_H_INCLUDE_SIMPLE
+        #endif
+    #endif
+#endif
+
+#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
+    #include "lvgl.h"
+#else
+    #include "lvgl/lvgl.h"
+#endif
+
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+#define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+"""
+
+
+# ---------------- Input (BGRA, as lv_color32_t in memory) ----------------
+def load_c_array(path):
+    text = open(path, encoding="utf-8", errors="replace").read()
+    cf = re.search(r"\.header\.cf\s*=\s*(\w+)", text)
+    w = re.search(r"\.header\.w\s*=\s*(\d+)", text)
+    h = re.search(r"\.header\.h\s*=\s*(\d+)", text)
+    name = re.search(r"lv_image_dsc_t\s+(\w+)\s*=", text)
+    body = re.search(r"_map\s*\[\s*\]\s*=\s*\{(.*?)\};", text, re.S)
+    if not (cf and w and h and name and body):
+        sys.exit(f"{path}: not an LVGL image C file")
+    if cf.group(1) != "LV_COLOR_FORMAT_ARGB8888":
+        sys.exit(f"{path}: {cf.group(1)} not supported, convert the icon as ARGB8888")
+    data = bytes(int(v, 16) for v in re.findall(r"0x([0-9a-fA-F]{1,2})", body.group(1)))
+    w, h = int(w.group(1)), int(h.group(1))
+    if len(data) != w * h * 4:
+        sys.exit(f"{path}: {len(data)} bytes, expected {w * h * 4}")
+    return name.group(1), w, h, data
+
+
+def load_png(path):
+    w, h, rgba = png_rgba(path)
+    out = bytearray(len(rgba))
+    out[0::4], out[1::4], out[2::4], out[3::4] = rgba[2::4], rgba[1::4], rgba[0::4], rgba[3::4]
+    name = re.sub(r"\W", "_", path.replace("\\", "/").rsplit("/", 1)[-1].rsplit(".", 1)[0])
+    return name, w, h, bytes(out)
+
+
+# ---------------- Conversion ----------------
+def to_rgb565a8(w, h, bgra):
+    rgb, alpha = bytearray(), bytearray()
+    for i in range(0, w * h * 4, 4):
+        b, g, r, a = bgra[i:i + 4]
+        c = ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+        rgb += bytes((c & 0xFF, c >> 8))
+        alpha.append(a)
+    return [(rgb, w * 2), (alpha, w)]
+
+
+def to_premultiplied(w, h, bgra):
+    out = bytearray(bgra)
+    for i in range(0, len(out), 4):
+        a = out[i + 3]
+        if a != 255:
+            for c in range(3):
+                out[i + c] = out[i + c] * a >> 8
+    return [(out, w * 4)]
+
+
+# ---------------- Output ----------------
+def c_rows(data, row_len):
+    return "".join("  " + "".join(f"0x{v:02x}, " for v in data[y:y + row_len]) + "\n"
+                   for y in range(0, len(data), row_len))
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("--cf", choices=FORMATS, required=True)
+    ap.add_argument("--name", help="C symbol of the image (default: the input's)")
+    ap.add_argument("input", help="LVGL C image (ARGB8888) or RGBA PNG")
+    ap.add_argument("output", help="C file")
+    args = ap.parse_args()
+
+    name, w, h, bgra = load_png(args.input) if args.input.lower().endswith(".png") else load_c_array(args.input)
+    name = args.name or name
+    if args.cf == "rgb565a8":
+        planes, bpp, stride = to_rgb565a8(w, h, bgra), 3, w * 2
+    elif args.cf == "argb8888_premultiplied":
+        planes, bpp, stride = to_premultiplied(w, h, bgra), 4, w * 4
+    else:
+        planes, bpp, stride = [(bgra, w * 4)], 4, w * 4
+
+    attr = f"LV_ATTRIBUTE_IMAGE_{name.upper()}"
+    out = PREAMBLE
+    out += f"#ifndef {attr}\n#define {attr}\n#endif\n\n"
+    out += f"const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST {attr} uint8_t {name}_map[] = {{\n"
+    out += "\n".join(c_rows(data, row_len) for data, row_len in planes)
+    out += "};\n\n"
+    out += f"const lv_image_dsc_t {name} = {{\n"
+    out += f"  .header.cf = {FORMATS[args.cf]},\n"
+    out += "  .header.magic = LV_IMAGE_HEADER_MAGIC,\n"
+    if args.cf == "argb8888_premultiplied":
+        out += "  .header.flags = LV_IMAGE_FLAGS_PREMULTIPLIED,\n"
+    out += f"  .header.w = {w},\n"
+    out += f"  .header.h = {h},\n"
+    out += f"  .header.stride = {stride},\n"
+    out += f"  .data_size = {w * h} * {bpp},\n"
+    out += f"  .data = {name}_map,\n"
+    out += "};\n\n"
+    with open(args.output, "w", encoding="utf-8") as f:
+        f.write(out)
+    print(f"{args.output}: {name} {w}x{h} {FORMATS[args.cf]}, {w * h * 4} -> {w * h * bpp} bytes")
+
+
+if __name__ == "__main__":
+    main()